@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*
+"""Decoder for the binary trace files written by the TraceRingFile trace sink of the
+flight software framework. The records are printed in the order they were written.
+"""
+import argparse
+import datetime
+import struct
+import sys
+from typing import List, NamedTuple
+
+MAGIC = b"FSFWTRC1"
+FILE_VERSION = 1
+HEADER_FORMAT = "=8sIIQQ32x"
+RECORD_FORMAT = "=IB3xIIQII"
+
+RECORD_TYPES = {
+    0: "EVENT",
+    1: "DEVICE_COMMAND",
+    2: "DEVICE_REPLY",
+    3: "TC_RECEIVED",
+    4: "TM_SENT",
+}
+
+
+class TraceRecord(NamedTuple):
+    index: int
+    record_type: int
+    record_id: int
+    object_id: int
+    timestamp_us: int
+    parameter1: int
+    parameter2: int
+
+
+def main():
+    parser = argparse.ArgumentParser(description="FSFW binary trace file decoder")
+    parser.add_argument("file", help="Trace file written by the TraceRingFile")
+    parser.add_argument(
+        "-b",
+        "--big-endian",
+        action="store_true",
+        help="Decode a trace file written by a big endian host",
+    )
+    parser.add_argument(
+        "-o", "--object", type=lambda x: int(x, 0), help="Only print records of this object ID"
+    )
+    parser.add_argument(
+        "-t", "--type", choices=RECORD_TYPES.values(), help="Only print records of this type"
+    )
+    parser.add_argument("--csv", action="store_true", help="Print the records as CSV")
+    args = parser.parse_args()
+
+    byte_order = ">" if args.big_endian else "<"
+    try:
+        with open(args.file, "rb") as trace_file:
+            raw = trace_file.read()
+    except OSError as e:
+        print(f"Could not read trace file: {e}")
+        sys.exit(1)
+    try:
+        records = decode(raw, byte_order)
+    except ValueError as e:
+        print(f"Invalid trace file: {e}")
+        sys.exit(1)
+
+    if args.csv:
+        print("index,time,type,id,object,parameter1,parameter2")
+    for record in records:
+        type_name = RECORD_TYPES.get(record.record_type, f"USER_{record.record_type:#04x}")
+        if args.object is not None and record.object_id != args.object:
+            continue
+        if args.type is not None and type_name != args.type:
+            continue
+        print(format_record(record, type_name, args.csv))
+
+
+def decode(raw: bytes, byte_order: str) -> List[TraceRecord]:
+    header_format = byte_order + HEADER_FORMAT[1:]
+    record_format = byte_order + RECORD_FORMAT[1:]
+    header_size = struct.calcsize(header_format)
+    if len(raw) < header_size:
+        raise ValueError("File too short")
+    magic, version, record_size, capacity, write_index = struct.unpack_from(header_format, raw)
+    if magic != MAGIC:
+        raise ValueError("Wrong magic")
+    if version != FILE_VERSION or record_size != struct.calcsize(record_format):
+        raise ValueError(f"Unsupported version {version} or record size {record_size}")
+    if capacity == 0 or len(raw) < header_size + capacity * record_size:
+        raise ValueError("File is smaller than the ring")
+
+    records = []
+    newest = write_index - 1
+    for slot in range(min(capacity, write_index)):
+        fields = struct.unpack_from(record_format, raw, header_size + slot * record_size)
+        sequence = fields[0]
+        if sequence == 0:
+            # Incomplete record
+            continue
+        # Newest index which maps to this slot. If the writer of this index crashed before
+        # reserving the slot, the record may still belong to the previous round.
+        index = newest - ((newest - slot) % capacity)
+        for candidate in (index, index - capacity):
+            if candidate >= 0 and (candidate + 1) & 0xFFFFFFFF == sequence:
+                records.append(TraceRecord(candidate, *fields[1:]))
+                break
+    records.sort(key=lambda record: record.index)
+    return records
+
+
+def format_record(record: TraceRecord, type_name: str, csv: bool) -> str:
+    time = datetime.datetime.fromtimestamp(
+        record.timestamp_us / 1e6, tz=datetime.timezone.utc
+    ).strftime("%Y-%m-%dT%H:%M:%S.%fZ")
+    if csv:
+        return (
+            f"{record.index},{time},{type_name},{record.record_id:#010x},"
+            f"{record.object_id:#010x},{record.parameter1},{record.parameter2}"
+        )
+    details = f"ID {record.record_id:#010x}"
+    if type_name == "EVENT":
+        details = (
+            f"Event {record.record_id & 0xFFFF:5d} | Severity {(record.record_id >> 16) & 0xFF}"
+        )
+    return (
+        f"{record.index:8d} | {time} | {type_name:<14} | {details} | "
+        f"Object {record.object_id:#010x} | P1 {record.parameter1:#010x} | "
+        f"P2 {record.parameter2:#010x}"
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -47,12 +47,14 @@ double CoordinateTransformations::getEarthRotationAngle(timeval timeUTC) {
 
 void CoordinateTransformations::getEarthRotationMatrix(timeval timeUTC, double matrix[][3]) {
   double theta = getEarthRotationAngle(timeUTC);
+  double sinTheta = sin(theta);
+  double cosTheta = cos(theta);
 
-  matrix[0][0] = cos(theta);
-  matrix[0][1] = sin(theta);
+  matrix[0][0] = cosTheta;
+  matrix[0][1] = sinTheta;
   matrix[0][2] = 0;
-  matrix[1][0] = -sin(theta);
-  matrix[1][1] = cos(theta);
+  matrix[1][0] = -sinTheta;
+  matrix[1][1] = cosTheta;
   matrix[1][2] = 0;
   matrix[2][0] = 0;
   matrix[2][1] = 0;
@@ -73,25 +75,25 @@ void CoordinateTransformations::ecfToEci(const double* ecfCoordinates, double* e
   double Tif[3][3];
   getTransMatrixECITOECF(timeUTC, Tfi);
 
-  MatrixOperations<double>::transpose(Tfi[0], Tif[0], 3);
+  MatrixOperations<double>::transpose<3>(Tfi[0], Tif[0]);
 
-  MatrixOperations<double>::multiply(Tif[0], ecfCoordinates, eciCoordinates, 3, 3, 1);
+  MatrixOperations<double>::multiply<3, 3, 1>(Tif[0], ecfCoordinates, eciCoordinates);
 
   if (ecfPositionIfCoordinatesAreVelocity != NULL) {
     double Tdotfi[3][3];
     double Tdotif[3][3];
     double Trot[3][3] = {{0, Earth::OMEGA, 0}, {0 - Earth::OMEGA, 0, 0}, {0, 0, 0}};
 
-    MatrixOperations<double>::multiply(Trot[0], Tfi[0], Tdotfi[0], 3, 3, 3);
+    MatrixOperations<double>::multiply<3, 3, 3>(Trot[0], Tfi[0], Tdotfi[0]);
 
-    MatrixOperations<double>::transpose(Tdotfi[0], Tdotif[0], 3);
+    MatrixOperations<double>::transpose<3>(Tdotfi[0], Tdotif[0]);
 
     double velocityCorrection[3];
 
-    MatrixOperations<double>::multiply(Tdotif[0], ecfPositionIfCoordinatesAreVelocity,
-                                       velocityCorrection, 3, 3, 1);
+    MatrixOperations<double>::multiply<3, 3, 1>(Tdotif[0], ecfPositionIfCoordinatesAreVelocity,
+                                                velocityCorrection);
 
-    VectorOperations<double>::add(velocityCorrection, eciCoordinates, eciCoordinates, 3);
+    VectorOperations<double>::add<3>(velocityCorrection, eciCoordinates, eciCoordinates);
   }
 }
 
@@ -118,20 +120,20 @@ void CoordinateTransformations::eciToEcf(const double* eciCoordinates, double* e
 
   getTransMatrixECITOECF(timeUTC, Tfi);
 
-  MatrixOperations<double>::multiply(Tfi[0], eciCoordinates, ecfCoordinates, 3, 3, 1);
+  MatrixOperations<double>::multiply<3, 3, 1>(Tfi[0], eciCoordinates, ecfCoordinates);
 
   if (eciPositionIfCoordinatesAreVelocity != NULL) {
     double Tdotfi[3][3];
     double Trot[3][3] = {{0, Earth::OMEGA, 0}, {0 - Earth::OMEGA, 0, 0}, {0, 0, 0}};
 
-    MatrixOperations<double>::multiply(Trot[0], Tfi[0], Tdotfi[0], 3, 3, 3);
+    MatrixOperations<double>::multiply<3, 3, 3>(Trot[0], Tfi[0], Tdotfi[0]);
 
     double velocityCorrection[3];
 
-    MatrixOperations<double>::multiply(Tdotfi[0], eciPositionIfCoordinatesAreVelocity,
-                                       velocityCorrection, 3, 3, 1);
+    MatrixOperations<double>::multiply<3, 3, 1>(Tdotfi[0], eciPositionIfCoordinatesAreVelocity,
+                                                velocityCorrection);
 
-    VectorOperations<double>::add(ecfCoordinates, velocityCorrection, ecfCoordinates, 3);
+    VectorOperations<double>::add<3>(ecfCoordinates, velocityCorrection, ecfCoordinates);
   }
 };
 
@@ -203,7 +205,7 @@ void CoordinateTransformations::getTransMatrixECITOECF(timeval timeUTC, double T
   getEarthRotationMatrix(timeUTC, mTheta);
 
   // polar motion is neglected
-  MatrixOperations<double>::multiply(mNutation[0], mPrecession[0], Ttemp[0], 3, 3, 3);
+  MatrixOperations<double>::multiply<3, 3, 3>(mNutation[0], mPrecession[0], Ttemp[0]);
 
-  MatrixOperations<double>::multiply(mTheta[0], Ttemp[0], Tfi[0], 3, 3, 3);
+  MatrixOperations<double>::multiply<3, 3, 3>(mTheta[0], Ttemp[0], Tfi[0]);
 };
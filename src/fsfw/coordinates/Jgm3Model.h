@@ -3,6 +3,7 @@
 
 #include <memory.h>
 
+#include <cstddef>
 #include <cstdint>
 
 #include "CoordinateTransformations.h"
@@ -14,9 +15,9 @@
 template <uint8_t DEGREE, uint8_t ORDER>
 class Jgm3Model {
  public:
-  static const uint32_t
-      factorialLookupTable[DEGREE + 3];  // This table is used instead of factorial calculation,
-                                         // must be increased if order or degree is higher
+  //! Not used anymore, the factorial quotients are computed directly. Kept so existing
+  //! definitions still compile.
+  static const uint32_t factorialLookupTable[DEGREE + 3];
 
   Jgm3Model() {
     y0[0] = 0;
@@ -36,77 +37,43 @@ class Jgm3Model {
   double y0[6];               // position and velocity at beginning of RK step in EC
   timeval lastExecutionTime;  // Time of last execution
 
+  /**
+   * @brief   Acceleration of the gravity field at a position in ECF.
+   * @details
+   * Uses the recursions from Montenbruck "Satellite Orbits" Eq. 3.29 to 3.33. The recursion
+   * coefficients are computed at compile time.
+   */
   void accelDegOrd(const double pos[3], const double S[ORDER + 1][DEGREE + 1],
                    const double C[ORDER + 1][DEGREE + 1], double* accel) {
-    // Get radius of this position
-    double r = VectorOperations<double>::norm(pos, 3);
-
-    // Initialize the V and W matrix
-    double V[DEGREE + 2][ORDER + 2] = {{0}};
-    double W[DEGREE + 2][ORDER + 2] = {{0}};
-
-    for (uint8_t m = 0; m < (ORDER + 2); m++) {
-      for (uint8_t n = m; n < (DEGREE + 2); n++) {
-        if ((n == 0) && (m == 0)) {
-          // Montenbruck "Satellite Orbits Eq.3.31"
-          V[0][0] = Earth::MEAN_RADIUS / r;
-          W[0][0] = 0;
-        } else {
-          if (n == m) {
-            // Montenbruck "Satellite Orbits Eq.3.29"
-            V[m][m] = (2 * m - 1) * (pos[0] * Earth::MEAN_RADIUS / pow(r, 2) * V[m - 1][m - 1] -
-                                     pos[1] * Earth::MEAN_RADIUS / pow(r, 2) * W[m - 1][m - 1]);
-            W[m][m] = (2 * m - 1) * (pos[0] * Earth::MEAN_RADIUS / pow(r, 2) * W[m - 1][m - 1] +
-                                     pos[1] * Earth::MEAN_RADIUS / pow(r, 2) * V[m - 1][m - 1]);
-          } else {
-            // Montenbruck "Satellite Orbits Eq.3.30"
-            V[n][m] = ((2 * n - 1) / (double)(n - m)) * pos[2] * Earth::MEAN_RADIUS / pow(r, 2) *
-                      V[n - 1][m];
-            W[n][m] = ((2 * n - 1) / (double)(n - m)) * pos[2] * Earth::MEAN_RADIUS / pow(r, 2) *
-                      W[n - 1][m];
-            if (n != (m + 1)) {
-              V[n][m] = V[n][m] - (((n + m - 1) / (double)(n - m)) *
-                                   (pow(Earth::MEAN_RADIUS, 2) / pow(r, 2)) * V[n - 2][m]);
-              W[n][m] = W[n][m] - (((n + m - 1) / (double)(n - m)) *
-                                   (pow(Earth::MEAN_RADIUS, 2) / pow(r, 2)) * W[n - 2][m]);
-            }  // End of if(n!=(m+1))
-          }    // End of if(n==m){
-        }      // End of if(n==0 and m==0)
-      }        // End of for(uint8_t n=0;n<(DEGREE+1);n++)
-    }          // End of for(uint8_t m=0;m<(ORDER+1);m++)
-
-    // overwrite accel if not properly initialized
-    accel[0] = 0;
-    accel[1] = 0;
-    accel[2] = 0;
-
-    for (uint8_t m = 0; m < (ORDER + 1); m++) {
-      for (uint8_t n = m; n < (DEGREE + 1); n++) {
-        // Use table lookup to get factorial
-        double partAccel[3] = {0};
-        double factor = Earth::STANDARD_GRAVITATIONAL_PARAMETER / pow(Earth::MEAN_RADIUS, 2);
-        if (m == 0) {
-          // Montenbruck "Satellite Orbits Eq.3.33"
-          partAccel[0] = factor * (-C[n][0] * V[n + 1][1]);
-          partAccel[1] = factor * (-C[n][0] * W[n + 1][1]);
-        } else {
-          double factMN = static_cast<double>(factorialLookupTable[n - m + 2]) /
-                          static_cast<double>(factorialLookupTable[n - m]);
-          partAccel[0] = factor * 0.5 *
-                         ((-C[n][m] * V[n + 1][m + 1] - S[n][m] * W[n + 1][m + 1]) +
-                          factMN * (C[n][m] * V[n + 1][m - 1] + S[n][m] * W[n + 1][m - 1]));
-          partAccel[1] = factor * 0.5 *
-                         ((-C[n][m] * W[n + 1][m + 1] + S[n][m] * V[n + 1][m + 1]) +
-                          factMN * (-C[n][m] * W[n + 1][m - 1] + S[n][m] * V[n + 1][m - 1]));
-        }
-
-        partAccel[2] = factor * ((n - m + 1) * (-C[n][m] * V[n + 1][m] - S[n][m] * W[n + 1][m]));
+    const double position[1][3] = {{pos[0], pos[1], pos[2]}};
+    double result[1][3];
+    evaluateLanes<1>(position, S, C, result);
+    memcpy(accel, result[0], sizeof(result[0]));
+  }
 
-        accel[0] += partAccel[0];
-        accel[1] += partAccel[1];
-        accel[2] += partAccel[2];
-      }  // End of for(uint8_t n=0;n<DEGREE;n++)
-    }    // End of uint8_t m=0;m<ORDER;m++
+  /**
+   * @brief   Accelerations at several positions in ECF.
+   * @details
+   * The positions are evaluated in groups of LANES states whose recursions are interleaved,
+   * so the compiler can vectorize them. The results are the same as with the overload for one
+   * position. The recursion arrays of a group take
+   * 16 * LANES * (DEGREE + 2) * (ORDER + 2) bytes of stack.
+   */
+  template <uint8_t LANES = 4>
+  void accelDegOrd(const double (*positions)[3], size_t count,
+                   const double S[ORDER + 1][DEGREE + 1], const double C[ORDER + 1][DEGREE + 1],
+                   double (*accels)[3]) {
+    size_t remaining = count;
+    for (; remaining >= LANES; remaining -= LANES) {
+      evaluateLanes<LANES>(positions, S, C, accels);
+      positions += LANES;
+      accels += LANES;
+    }
+    for (; remaining > 0; remaining--) {
+      evaluateLanes<1>(positions, S, C, accels);
+      positions++;
+      accels++;
+    }
   }
 
   void initializeNavOrbit(const double position[3], const double velocity[3], timeval timeUTC) {
@@ -133,28 +100,28 @@ class Jgm3Model {
     rungeKuttaStep(y0, y0dot, lastExecutionTime, S, C);
 
     // Step Two
-    VectorOperations<double>::mulScalar(y0dot, deltaT / 2, yA, 6);
-    VectorOperations<double>::add(y0, yA, yA, 6);
+    VectorOperations<double>::mulScalar<6>(y0dot, deltaT / 2, yA);
+    VectorOperations<double>::add<6>(y0, yA, yA);
     rungeKuttaStep(yA, yAdot, lastExecutionTime, S, C);
 
     // Step Three
-    VectorOperations<double>::mulScalar(yAdot, deltaT / 2, yB, 6);
-    VectorOperations<double>::add(y0, yB, yB, 6);
+    VectorOperations<double>::mulScalar<6>(yAdot, deltaT / 2, yB);
+    VectorOperations<double>::add<6>(y0, yB, yB);
     rungeKuttaStep(yB, yBdot, lastExecutionTime, S, C);
 
     // Step Four
-    VectorOperations<double>::mulScalar(yBdot, deltaT, yC, 6);
-    VectorOperations<double>::add(y0, yC, yC, 6);
+    VectorOperations<double>::mulScalar<6>(yBdot, deltaT, yC);
+    VectorOperations<double>::add<6>(y0, yC, yC);
     rungeKuttaStep(yC, yCdot, lastExecutionTime, S, C);
 
     // Calc new State
-    VectorOperations<double>::mulScalar(yAdot, 2, yAdot, 6);
-    VectorOperations<double>::mulScalar(yBdot, 2, yBdot, 6);
-    VectorOperations<double>::add(y0dot, yAdot, y0dot, 6);
-    VectorOperations<double>::add(y0dot, yBdot, y0dot, 6);
-    VectorOperations<double>::add(y0dot, yCdot, y0dot, 6);
-    VectorOperations<double>::mulScalar(y0dot, 1. / 6. * deltaT, y0dot, 6);
-    VectorOperations<double>::add(y0, y0dot, y0, 6);
+    VectorOperations<double>::mulScalar<6>(yAdot, 2, yAdot);
+    VectorOperations<double>::mulScalar<6>(yBdot, 2, yBdot);
+    VectorOperations<double>::add<6>(y0dot, yAdot, y0dot);
+    VectorOperations<double>::add<6>(y0dot, yBdot, y0dot);
+    VectorOperations<double>::add<6>(y0dot, yCdot, y0dot);
+    VectorOperations<double>::mulScalar<6>(y0dot, 1. / 6. * deltaT, y0dot);
+    VectorOperations<double>::add<6>(y0, y0dot, y0);
 
     CoordinateTransformations::positionEciToEcf(&y0[0], outputPos, &timeUTC);
     CoordinateTransformations::velocityEciToEcf(&y0[3], &y0[0], outputVel, &timeUTC);
@@ -166,12 +133,11 @@ class Jgm3Model {
                       const double S[ORDER + 1][DEGREE + 1],
                       const double C[ORDER + 1][DEGREE + 1]) {
     double rECF[3] = {0, 0, 0};
-    double rDotECF[3] = {0, 0, 0};
     double accelECF[3] = {0, 0, 0};
     double accelECI[3] = {0, 0, 0};
 
+    // The velocity in ECF is not needed because the acceleration does not depend on it
     CoordinateTransformations::positionEciToEcf(&yIn[0], rECF, &time);
-    CoordinateTransformations::velocityEciToEcf(&yIn[3], &yIn[0], rDotECF, &time);
     accelDegOrd(rECF, S, C, accelECF);
     // This is not correct, as the acceleration would have derived terms but we don't know the
     // velocity and position at that time Tests showed that a wrong velocity does make the equation
@@ -180,6 +146,121 @@ class Jgm3Model {
     memcpy(&yOut[0], &yIn[3], sizeof(yOut[0]) * 3);
     memcpy(&yOut[3], accelECI, sizeof(yOut[0]) * 3);
   }
+
+ private:
+  struct RecursionCoefficients {
+    //! Factor of the diagonal elements (Eq. 3.29)
+    double diagonal[ORDER + 2];
+    //! Factors of the elements of degree n - 1 and n - 2 (Eq. 3.30)
+    double previous[DEGREE + 2][ORDER + 2];
+    double secondPrevious[DEGREE + 2][ORDER + 2];
+  };
+
+  static constexpr RecursionCoefficients makeRecursionCoefficients() {
+    RecursionCoefficients coefficients{};
+    for (uint8_t m = 0; m < (ORDER + 2); m++) {
+      coefficients.diagonal[m] = 2 * m - 1;
+      for (uint8_t n = m + 1; n < (DEGREE + 2); n++) {
+        coefficients.previous[n][m] = (2 * n - 1) / static_cast<double>(n - m);
+        coefficients.secondPrevious[n][m] = (n + m - 1) / static_cast<double>(n - m);
+      }
+    }
+    return coefficients;
+  }
+
+  static constexpr RecursionCoefficients recursion = makeRecursionCoefficients();
+
+  template <uint8_t LANES>
+  void evaluateLanes(const double (*positions)[3], const double S[ORDER + 1][DEGREE + 1],
+                     const double C[ORDER + 1][DEGREE + 1], double (*accels)[3]) {
+    double x[LANES];
+    double y[LANES];
+    double z[LANES];
+    double rho[LANES];
+    double V[DEGREE + 2][ORDER + 2][LANES];
+    double W[DEGREE + 2][ORDER + 2][LANES];
+
+    for (uint8_t lane = 0; lane < LANES; lane++) {
+      const double* pos = positions[lane];
+      double r = VectorOperations<double>::norm<3>(pos);
+      double scale = Earth::MEAN_RADIUS / (r * r);
+      x[lane] = pos[0] * scale;
+      y[lane] = pos[1] * scale;
+      z[lane] = pos[2] * scale;
+      rho[lane] = Earth::MEAN_RADIUS * scale;
+      // Montenbruck "Satellite Orbits Eq.3.31"
+      V[0][0][lane] = Earth::MEAN_RADIUS / r;
+      W[0][0][lane] = 0;
+    }
+
+    for (uint8_t m = 0; m < (ORDER + 2); m++) {
+      if (m > 0) {
+        // Montenbruck "Satellite Orbits Eq.3.29"
+        const double diagonal = recursion.diagonal[m];
+        for (uint8_t lane = 0; lane < LANES; lane++) {
+          double vPrevious = V[m - 1][m - 1][lane];
+          double wPrevious = W[m - 1][m - 1][lane];
+          V[m][m][lane] = diagonal * (x[lane] * vPrevious - y[lane] * wPrevious);
+          W[m][m][lane] = diagonal * (x[lane] * wPrevious + y[lane] * vPrevious);
+        }
+      }
+      // Montenbruck "Satellite Orbits Eq.3.30"
+      if (m + 1 < (DEGREE + 2)) {
+        const double previous = recursion.previous[m + 1][m];
+        for (uint8_t lane = 0; lane < LANES; lane++) {
+          V[m + 1][m][lane] = previous * z[lane] * V[m][m][lane];
+          W[m + 1][m][lane] = previous * z[lane] * W[m][m][lane];
+        }
+      }
+      for (uint8_t n = m + 2; n < (DEGREE + 2); n++) {
+        const double previous = recursion.previous[n][m];
+        const double secondPrevious = recursion.secondPrevious[n][m];
+        for (uint8_t lane = 0; lane < LANES; lane++) {
+          V[n][m][lane] = previous * z[lane] * V[n - 1][m][lane] -
+                          secondPrevious * rho[lane] * V[n - 2][m][lane];
+          W[n][m][lane] = previous * z[lane] * W[n - 1][m][lane] -
+                          secondPrevious * rho[lane] * W[n - 2][m][lane];
+        }
+      }
+    }
+
+    // The constant factors are applied to the sums
+    double sum[3][LANES] = {};
+    for (uint8_t m = 0; m < (ORDER + 1); m++) {
+      for (uint8_t n = m; n < (DEGREE + 1); n++) {
+        const double c = C[n][m];
+        const double s = S[n][m];
+        const double orderFactor = n - m + 1;
+        if (m == 0) {
+          // Montenbruck "Satellite Orbits Eq.3.33", with the factor 0.5 applied to the sums
+          for (uint8_t lane = 0; lane < LANES; lane++) {
+            sum[0][lane] += 2 * (-c * V[n + 1][1][lane]);
+            sum[1][lane] += 2 * (-c * W[n + 1][1][lane]);
+          }
+        } else {
+          // (n - m + 2)! / (n - m)!
+          const double factMN = (n - m + 2) * (n - m + 1);
+          for (uint8_t lane = 0; lane < LANES; lane++) {
+            sum[0][lane] += (-c * V[n + 1][m + 1][lane] - s * W[n + 1][m + 1][lane]) +
+                            factMN * (c * V[n + 1][m - 1][lane] + s * W[n + 1][m - 1][lane]);
+            sum[1][lane] += (-c * W[n + 1][m + 1][lane] + s * V[n + 1][m + 1][lane]) +
+                            factMN * (-c * W[n + 1][m - 1][lane] + s * V[n + 1][m - 1][lane]);
+          }
+        }
+        for (uint8_t lane = 0; lane < LANES; lane++) {
+          sum[2][lane] += orderFactor * (-c * V[n + 1][m][lane] - s * W[n + 1][m][lane]);
+        }
+      }
+    }
+
+    const double factor = Earth::STANDARD_GRAVITATIONAL_PARAMETER /
+                          (Earth::MEAN_RADIUS * Earth::MEAN_RADIUS);
+    for (uint8_t lane = 0; lane < LANES; lane++) {
+      accels[lane][0] = factor * 0.5 * sum[0][lane];
+      accels[lane][1] = factor * 0.5 * sum[1][lane];
+      accels[lane][2] = factor * sum[2][lane];
+    }
+  }
 };
 
 #endif /* FRAMEWORK_COORDINATES_JGM3MODEL_H_ */
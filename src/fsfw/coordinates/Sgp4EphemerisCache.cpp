@@ -0,0 +1,125 @@
+#include "fsfw/coordinates/Sgp4EphemerisCache.h"
+
+#include <algorithm>
+
+namespace {
+constexpr int64_t USECS_PER_SECOND = 1000000;
+
+int64_t floorDivide(int64_t dividend, int64_t divisor) {
+  int64_t quotient = dividend / divisor;
+  if ((dividend % divisor != 0) && ((dividend < 0) != (divisor < 0))) {
+    quotient--;
+  }
+  return quotient;
+}
+}  // namespace
+
+Sgp4EphemerisCache::Sgp4EphemerisCache(Sgp4Propagator& propagator, size_t numberOfNodes,
+                                       uint32_t nodeStepMs, uint8_t gpsUtcOffset)
+    : propagator(propagator),
+      numberOfNodes(std::max<size_t>(numberOfNodes, 2)),
+      nodeStepUs(std::max<int64_t>(nodeStepMs, 1) * 1000),
+      gpsUtcOffset(gpsUtcOffset),
+      positions(new double[this->numberOfNodes][3]),
+      velocities(new double[this->numberOfNodes][3]),
+      missingTimes(this->numberOfNodes) {}
+
+Sgp4EphemerisCache::~Sgp4EphemerisCache() {
+  delete[] positions;
+  delete[] velocities;
+}
+
+ReturnValue_t Sgp4EphemerisCache::getState(double* position, double* velocity, timeval time) {
+  int64_t timeUs = static_cast<int64_t>(time.tv_sec) * USECS_PER_SECOND + time.tv_usec;
+  int64_t step = floorDivide(timeUs, nodeStepUs);
+  if (!valid || step < firstStep ||
+      step + 1 >= firstStep + static_cast<int64_t>(numberOfNodes)) {
+    // Keep one node before the requested time for small steps back
+    ReturnValue_t result = moveWindow(numberOfNodes > 2 ? step - 1 : step);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+  }
+
+  const double* p0 = positions[getSlot(step)];
+  const double* v0 = velocities[getSlot(step)];
+  const double* p1 = positions[getSlot(step + 1)];
+  const double* v1 = velocities[getSlot(step + 1)];
+
+  // Cubic Hermite basis functions of the normalized time and their derivatives
+  double h = static_cast<double>(nodeStepUs) / USECS_PER_SECOND;
+  double s = static_cast<double>(timeUs - step * nodeStepUs) / nodeStepUs;
+  double s2 = s * s;
+  double s3 = s2 * s;
+  double h00 = 2 * s3 - 3 * s2 + 1;
+  double h10 = (s3 - 2 * s2 + s) * h;
+  double h01 = -2 * s3 + 3 * s2;
+  double h11 = (s3 - s2) * h;
+  for (uint8_t idx = 0; idx < 3; idx++) {
+    position[idx] = h00 * p0[idx] + h10 * v0[idx] + h01 * p1[idx] + h11 * v1[idx];
+  }
+  if (velocity != nullptr) {
+    double dh00 = (6 * s2 - 6 * s) / h;
+    double dh10 = 3 * s2 - 4 * s + 1;
+    double dh01 = (-6 * s2 + 6 * s) / h;
+    double dh11 = 3 * s2 - 2 * s;
+    for (uint8_t idx = 0; idx < 3; idx++) {
+      velocity[idx] = dh00 * p0[idx] + dh10 * v0[idx] + dh01 * p1[idx] + dh11 * v1[idx];
+    }
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void Sgp4EphemerisCache::invalidate() { valid = false; }
+
+ReturnValue_t Sgp4EphemerisCache::moveWindow(int64_t newFirstStep) {
+  int64_t size = static_cast<int64_t>(numberOfNodes);
+  int64_t newEndStep = newFirstStep + size;
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+  if (!valid || newFirstStep >= firstStep + size || newEndStep <= firstStep) {
+    result = propagateNodes(newFirstStep, newEndStep);
+  } else if (newFirstStep > firstStep) {
+    result = propagateNodes(firstStep + size, newEndStep);
+  } else {
+    result = propagateNodes(newFirstStep, firstStep);
+  }
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    valid = false;
+    return result;
+  }
+  firstStep = newFirstStep;
+  valid = true;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t Sgp4EphemerisCache::propagateNodes(int64_t firstMissing, int64_t endMissing) {
+  size_t count = static_cast<size_t>(endMissing - firstMissing);
+  for (size_t idx = 0; idx < count; idx++) {
+    int64_t nodeUs = (firstMissing + static_cast<int64_t>(idx)) * nodeStepUs;
+    int64_t seconds = floorDivide(nodeUs, USECS_PER_SECOND);
+    missingTimes[idx].tv_sec = seconds;
+    missingTimes[idx].tv_usec = nodeUs - seconds * USECS_PER_SECOND;
+  }
+  // The slots of consecutive steps are consecutive except for the wrap-around at the end
+  size_t done = 0;
+  while (done < count) {
+    size_t slot = getSlot(firstMissing + static_cast<int64_t>(done));
+    size_t length = std::min(count - done, numberOfNodes - slot);
+    ReturnValue_t result = propagator.propagate(positions + slot, velocities + slot,
+                                                missingTimes.data() + done, length, gpsUtcOffset);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+    done += length;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+size_t Sgp4EphemerisCache::getSlot(int64_t step) const {
+  int64_t size = static_cast<int64_t>(numberOfNodes);
+  int64_t slot = step % size;
+  if (slot < 0) {
+    slot += size;
+  }
+  return static_cast<size_t>(slot);
+}
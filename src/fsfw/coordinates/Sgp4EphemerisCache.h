@@ -0,0 +1,70 @@
+#ifndef FSFW_COORDINATES_SGP4EPHEMERISCACHE_H_
+#define FSFW_COORDINATES_SGP4EPHEMERISCACHE_H_
+
+#include <vector>
+
+#include "fsfw/coordinates/Sgp4Propagator.h"
+
+/**
+ * @brief   Sliding window of SGP4 states which are interpolated with cubic Hermite polynomials.
+ * @details
+ * The window contains states at multiples of the node step. A request between two nodes
+ * interpolates the position and velocity from the positions and velocities of the two nodes,
+ * so controllers which need the state at a high rate do not have to evaluate SGP4 each time.
+ * If a request is outside of the window, the window is moved so that it starts one node before
+ * the requested time, and only the nodes which are not in the window yet are propagated, in one
+ * batch.
+ *
+ * With the default node step of 60 seconds, the interpolation error in a low Earth orbit is
+ * below one meter. The cache is not thread-safe.
+ */
+class Sgp4EphemerisCache {
+ public:
+  /**
+   * @param propagator        Initialized propagator. #invalidate has to be called if it is
+   *                          initialized with another TLE.
+   * @param numberOfNodes     Number of nodes in the window, at least two
+   * @param nodeStepMs        Time between two nodes in milliseconds
+   * @param gpsUtcOffset      Passed to the propagator
+   */
+  Sgp4EphemerisCache(Sgp4Propagator& propagator, size_t numberOfNodes = 16,
+                     uint32_t nodeStepMs = 60000, uint8_t gpsUtcOffset = 0);
+  virtual ~Sgp4EphemerisCache();
+
+  Sgp4EphemerisCache(const Sgp4EphemerisCache&) = delete;
+  Sgp4EphemerisCache& operator=(const Sgp4EphemerisCache&) = delete;
+
+  /**
+   * @param[out] position     Interpolated position in ECF
+   * @param[out] velocity     Interpolated velocity in ECF, can be nullptr
+   * @param time              Time of the state
+   * @return  Result of the propagation if the window had to be moved
+   */
+  ReturnValue_t getState(double* position, double* velocity, timeval time);
+
+  /**
+   * @brief   Drops all nodes, for example after the propagator was initialized with a new TLE.
+   */
+  void invalidate();
+
+ private:
+  Sgp4Propagator& propagator;
+  size_t numberOfNodes;
+  int64_t nodeStepUs;
+  uint8_t gpsUtcOffset;
+
+  //! Nodes are stored at the index of their step number modulo the number of nodes
+  double (*positions)[3];
+  double (*velocities)[3];
+  //! Step number of the first node in the window
+  int64_t firstStep = 0;
+  bool valid = false;
+  //! Epochs of the nodes which are propagated when the window is moved
+  std::vector<timeval> missingTimes;
+
+  ReturnValue_t moveWindow(int64_t newFirstStep);
+  ReturnValue_t propagateNodes(int64_t firstMissing, int64_t endMissing);
+  size_t getSlot(int64_t step) const;
+};
+
+#endif /* FSFW_COORDINATES_SGP4EPHEMERISCACHE_H_ */
@@ -1,5 +1,6 @@
 #include "fsfw/coordinates/Sgp4Propagator.h"
 
+#include <algorithm>
 #include <cstring>
 
 #include "fsfw/coordinates/CoordinateTransformations.h"
@@ -8,6 +9,15 @@
 #include "fsfw/globalfunctions/math/VectorOperations.h"
 #include "fsfw/globalfunctions/timevalOperations.h"
 
+// Threads are only available on hosted OSALs
+#if defined(FSFW_OSAL_HOST) || defined(FSFW_OSAL_LINUX)
+#define FSFW_SGP4_BATCH_THREADS 1
+#include <thread>
+#include <vector>
+#else
+#define FSFW_SGP4_BATCH_THREADS 0
+#endif
+
 Sgp4Propagator::Sgp4Propagator() : initialized(false), epoch({0, 0}), whichconst(wgs84) {}
 
 Sgp4Propagator::~Sgp4Propagator() {}
@@ -161,7 +171,91 @@ ReturnValue_t Sgp4Propagator::propagate(double* position, double* velocity, time
   if (!initialized) {
     return TLE_NOT_INITIALIZED;
   }
+  return propagateEpoch(satrec, position, velocity, time);
+}
+
+ReturnValue_t Sgp4Propagator::propagate(double (*positions)[3], double (*velocities)[3],
+                                        const timeval* times, size_t count, uint8_t gpsUtcOffset,
+                                        size_t* propagated) {
+  if (propagated != nullptr) {
+    *propagated = 0;
+  }
+  if (!initialized) {
+    return TLE_NOT_INITIALIZED;
+  }
+  size_t numberOfThreads = 1;
+#if FSFW_SGP4_BATCH_THREADS == 1
+  numberOfThreads = std::min<size_t>(propagationThreads, count / MIN_EPOCHS_PER_THREAD);
+#endif
+  if (numberOfThreads <= 1) {
+    ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+    size_t done = propagateChunk(positions, velocities, times, count, &result);
+    if (propagated != nullptr) {
+      *propagated = done;
+    }
+    return result;
+  }
+#if FSFW_SGP4_BATCH_THREADS == 1
+  // Each thread propagates a contiguous chunk with its own copy of the element set. The calling
+  // thread takes the first chunk.
+  std::vector<size_t> done(numberOfThreads, 0);
+  std::vector<ReturnValue_t> results(numberOfThreads,
+                                     static_cast<ReturnValue_t>(HasReturnvaluesIF::RETURN_OK));
+  size_t chunkSize = (count + numberOfThreads - 1) / numberOfThreads;
+  auto work = [&](size_t thread) {
+    size_t start = thread * chunkSize;
+    size_t end = std::min(count, start + chunkSize);
+    done[thread] = propagateChunk(positions + start, velocities + start, times + start,
+                                  end - start, &results[thread]);
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(numberOfThreads - 1);
+  for (size_t thread = 1; thread < numberOfThreads; thread++) {
+    threads.emplace_back(work, thread);
+  }
+  work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  size_t total = 0;
+  for (size_t thread = 0; thread < numberOfThreads; thread++) {
+    total += done[thread];
+    if (results[thread] != HasReturnvaluesIF::RETURN_OK) {
+      if (propagated != nullptr) {
+        *propagated = total;
+      }
+      return results[thread];
+    }
+  }
+  if (propagated != nullptr) {
+    *propagated = total;
+  }
+#endif
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void Sgp4Propagator::setPropagationThreads(uint8_t numberOfThreads) {
+  if (numberOfThreads == 0) {
+    numberOfThreads = 1;
+  }
+  propagationThreads = numberOfThreads;
+}
+
+size_t Sgp4Propagator::propagateChunk(double (*positions)[3], double (*velocities)[3],
+                                      const timeval* times, size_t count,
+                                      ReturnValue_t* result) const {
+  elsetrec record = satrec;
+  for (size_t idx = 0; idx < count; idx++) {
+    *result = propagateEpoch(record, positions[idx], velocities[idx], times[idx]);
+    if (*result != HasReturnvaluesIF::RETURN_OK) {
+      return idx;
+    }
+  }
+  return count;
+}
 
+ReturnValue_t Sgp4Propagator::propagateEpoch(elsetrec& record, double* position,
+                                             double* velocity, timeval time) const {
   // Time since epoch in minutes
   timeval timeSinceEpoch = time - epoch;
   double minutesSinceEpoch = timeSinceEpoch.tv_sec / 60. + timeSinceEpoch.tv_usec / 60000000.;
@@ -175,22 +269,22 @@ ReturnValue_t Sgp4Propagator::propagate(double* position, double* velocity, time
   double positionTEME[3];
   double velocityTEME[3];
 
-  uint8_t result = sgp4(whichconst, satrec, minutesSinceEpoch, positionTEME, velocityTEME);
+  uint8_t result = sgp4(whichconst, record, minutesSinceEpoch, positionTEME, velocityTEME);
 
-  VectorOperations<double>::mulScalar(positionTEME, 1000, positionTEME, 3);
-  VectorOperations<double>::mulScalar(velocityTEME, 1000, velocityTEME, 3);
+  VectorOperations<double>::mulScalar<3>(positionTEME, 1000, positionTEME);
+  VectorOperations<double>::mulScalar<3>(velocityTEME, 1000, velocityTEME);
 
   // Transform to ECF
   double earthRotationMatrix[3][3];
   CoordinateTransformations::getEarthRotationMatrix(time, earthRotationMatrix);
 
-  MatrixOperations<double>::multiply(earthRotationMatrix[0], positionTEME, position, 3, 3, 1);
-  MatrixOperations<double>::multiply(earthRotationMatrix[0], velocityTEME, velocity, 3, 3, 1);
+  MatrixOperations<double>::multiply<3, 3, 1>(earthRotationMatrix[0], positionTEME, position);
+  MatrixOperations<double>::multiply<3, 3, 1>(earthRotationMatrix[0], velocityTEME, velocity);
 
   double omegaEarth[3] = {0, 0, Earth::OMEGA};
   double velocityCorrection[3];
   VectorOperations<double>::cross(omegaEarth, position, velocityCorrection);
-  VectorOperations<double>::subtract(velocity, velocityCorrection, velocity);
+  VectorOperations<double>::subtract<3>(velocity, velocityCorrection, velocity);
 
   if (result != 0) {
     return MAKE_RETURN_CODE(result || 0xB0);
@@ -7,6 +7,8 @@
 #ifndef PLATFORM_WIN
 #include <sys/time.h>
 #endif
+#include <cstddef>
+
 #include "fsfw/returnvalues/HasReturnvaluesIF.h"
 #include "fsfw_contrib/sgp4/sgp4unit.h"
 
@@ -36,8 +38,47 @@ class Sgp4Propagator {
    */
   ReturnValue_t propagate(double *position, double *velocity, timeval time, uint8_t gpsUtcOffset);
 
+  /**
+   * @brief   Propagates to several epochs at once.
+   * @details
+   * With more than one propagation thread, large batches are split into contiguous chunks
+   * which are propagated in parallel. The results are the same as with #propagate for each
+   * epoch.
+   * @param[out] positions    Positions in ECF, one per epoch
+   * @param[out] velocities   Velocities in ECF, one per epoch
+   * @param times             Epochs to which to propagate
+   * @param count             Number of epochs
+   * @param[out] propagated   Optional, number of epochs which were propagated before the
+   *                          first epoch which failed. The outputs of the following epochs
+   *                          are undefined.
+   * @return  Result of the first epoch which failed, or RETURN_OK
+   */
+  ReturnValue_t propagate(double (*positions)[3], double (*velocities)[3], const timeval *times,
+                          size_t count, uint8_t gpsUtcOffset, size_t *propagated = nullptr);
+
+  /**
+   * @brief   Sets the number of threads which propagate large batches, including the
+   *          calling thread. One thread is the default.
+   * @details
+   * Only the host and Linux OSAL support more than one thread, the other OSALs always use
+   * the calling thread.
+   */
+  void setPropagationThreads(uint8_t numberOfThreads);
+
+  //! Minimum number of epochs per thread for which a batch is split
+  static constexpr size_t MIN_EPOCHS_PER_THREAD = 64;
+
  private:
+  /**
+   * Propagates with the given copy of the element set, because SGP4 updates it.
+   */
+  ReturnValue_t propagateEpoch(elsetrec &record, double *position, double *velocity,
+                               timeval time) const;
+  size_t propagateChunk(double (*positions)[3], double (*velocities)[3], const timeval *times,
+                        size_t count, ReturnValue_t *result) const;
+
   bool initialized;
+  uint8_t propagationThreads = 1;
   timeval epoch;
   elsetrec satrec;
   gravconsttype whichconst;
@@ -73,6 +73,10 @@ class CCSDSReturnValuesIF : public HasReturnvaluesIF {
       MAKE_RETURN_CODE(0xD2);  //!< An error code for a frame.
   static const ReturnValue_t TOO_SHORT_MAP_EXTRACTION =
       MAKE_RETURN_CODE(0xD3);  //!< An error code for a frame.
+  static const ReturnValue_t FRAME_BUFFER_FULL =
+      MAKE_RETURN_CODE(0xD4);  //!< No space left for outgoing frames.
+  static const ReturnValue_t NO_FRAME_AVAILABLE =
+      MAKE_RETURN_CODE(0xD5);  //!< No outgoing frame is ready to be sent.
 
   virtual ~CCSDSReturnValuesIF() {}  //!< Empty virtual destructor
 };
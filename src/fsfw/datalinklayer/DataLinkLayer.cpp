@@ -112,6 +112,54 @@ ReturnValue_t DataLinkLayer::processFrame(uint16_t length) {
   }
 }
 
+ReturnValue_t DataLinkLayer::processFrames(uint8_t* frames, size_t length,
+                                           uint16_t* processedFrames) {
+  ReturnValue_t status = RETURN_OK;
+  uint16_t successfulFrames = 0;
+  uint16_t failedFrames = 0;
+  size_t position = 0;
+  const size_t minimumFrameLength = startSequenceLength + FRAME_PRIMARY_HEADER_LENGTH;
+  while (length - position >= minimumFrameLength) {
+    position += startSequenceLength;
+    currentFrame = TcTransferFrame(frames + position);
+    size_t remaining = length - position;
+    receivedDataLength = (remaining > UINT16_MAX) ? UINT16_MAX : remaining;
+    uint16_t frameLength = currentFrame.getFullSize();
+    ReturnValue_t result = frameValidationCheck();
+    if (result == RETURN_OK) {
+      result = masterChannelDemultiplexing();
+    }
+    if (result == RETURN_OK) {
+      successfulFrames++;
+    } else {
+      failedFrames++;
+      if (status == RETURN_OK) {
+        status = result;
+      }
+    }
+    if (frameLength > remaining) {
+      // The rest of the buffer can not be delimited anymore
+      position = length;
+      break;
+    }
+    position += frameLength;
+  }
+  if (position < length and status == RETURN_OK) {
+    status = SHORTER_THAN_HEADER;
+  }
+  if (processedFrames != nullptr) {
+    *processedFrames = successfulFrames;
+  }
+  if (failedFrames > 0) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "DataLinkLayer::processFrames: Reception of " << failedFrames
+               << " frame(s) failed. First error code: " << std::hex << status << std::dec
+               << std::endl;
+#endif
+  }
+  return status;
+}
+
 ReturnValue_t DataLinkLayer::addVirtualChannel(uint8_t virtualChannelId,
                                                VirtualChannelReceptionIF* object) {
   std::pair<virtualChannelIterator, bool> returnValue = virtualChannels.insert(
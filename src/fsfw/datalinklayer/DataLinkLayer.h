@@ -55,6 +55,19 @@ class DataLinkLayer : public CCSDSReturnValuesIF {
    * methods.
    */
   ReturnValue_t processFrame(uint16_t length);
+  /**
+   * Processes a buffer holding several consecutive frame candidates, for example all frames
+   * read from the receiver in one cycle. Each frame is expected to be preceded by exactly
+   * the configured start sequence length, the frame length is taken from the frame headers.
+   * A frame failing validation or demultiplexing is skipped and does not stop the batch.
+   * Processing stops if a frame header announces more data than left in the buffer.
+   * @param frames	Buffer holding the frames.
+   * @param length	Total length of the buffer.
+   * @param processedFrames	Optional, number of frames which were handled successfully.
+   * @return	@c RETURN_OK if all frames were handled, otherwise the return code of the first
+   * failed frame.
+   */
+  ReturnValue_t processFrames(uint8_t* frames, size_t length, uint16_t* processedFrames = nullptr);
   /**
    * Configuration method to add a new TC Virtual Channel.
    * Shall only be called during initialization. As soon as the method was called, the layer can
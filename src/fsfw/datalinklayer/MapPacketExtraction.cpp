@@ -27,8 +27,17 @@ ReturnValue_t MapPacketExtraction::extractPackets(TcTransferFrame* frame) {
       status = unpackBlockingPackets(frame);
       break;
     case FIRST_PORTION:
+      if (lastSegmentationFlag == FIRST_PORTION || lastSegmentationFlag == CONTINUING_PORTION) {
+        // Previous packet was never completed
+        clearBuffers();
+      }
       packetLength = frame->getDataLength();
-      if (packetLength <= MAX_PACKET_SIZE) {
+      if (packetLength >= sizeof(CCSDSPrimaryHeader)) {
+        status = startStoreAssembly(frame);
+        if (status != RETURN_OK) {
+          segmentationFlag = NO_SEGMENTATION;
+        }
+      } else if (packetLength <= MAX_PACKET_SIZE) {
         memcpy(packetBuffer, frame->getDataField(), packetLength);
         bufferPosition = &packetBuffer[packetLength];
         status = RETURN_OK;
@@ -43,7 +52,15 @@ ReturnValue_t MapPacketExtraction::extractPackets(TcTransferFrame* frame) {
       break;
     case CONTINUING_PORTION:
     case LAST_PORTION:
-      if (lastSegmentationFlag == FIRST_PORTION || lastSegmentationFlag == CONTINUING_PORTION) {
+      if ((lastSegmentationFlag == FIRST_PORTION || lastSegmentationFlag == CONTINUING_PORTION) &&
+          assemblyBuffer != nullptr) {
+        status = continueStoreAssembly(frame, segmentationFlag == LAST_PORTION);
+        if (status != RETURN_OK || segmentationFlag == LAST_PORTION) {
+          // Buffers were already reset
+          segmentationFlag = NO_SEGMENTATION;
+        }
+      } else if (lastSegmentationFlag == FIRST_PORTION ||
+                 lastSegmentationFlag == CONTINUING_PORTION) {
         packetLength += frame->getDataLength();
         if (packetLength <= MAX_PACKET_SIZE) {
           memcpy(bufferPosition, frame->getDataField(), frame->getDataLength());
@@ -117,7 +134,65 @@ ReturnValue_t MapPacketExtraction::sendCompletePacket(uint8_t* data, uint32_t si
   return status;
 }
 
+ReturnValue_t MapPacketExtraction::startStoreAssembly(TcTransferFrame* frame) {
+  SpacePacketBase packet(frame->getDataField());
+  assemblyPacketSize = packet.getFullSize();
+  if (assemblyPacketSize > MAX_PACKET_SIZE) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "MapPacketExtraction::extractPackets. Packet too large! Size: "
+               << assemblyPacketSize << std::endl;
+#endif
+    clearBuffers();
+    return CONTENT_TOO_LARGE;
+  }
+  if (packetLength > assemblyPacketSize) {
+    clearBuffers();
+    return DATA_CORRUPTED;
+  }
+  ReturnValue_t status =
+      packetStore->getFreeElement(&assemblyStoreId, assemblyPacketSize, &assemblyBuffer);
+  if (status != RETURN_OK) {
+    clearBuffers();
+    return status;
+  }
+  std::memcpy(assemblyBuffer, frame->getDataField(), packetLength);
+  return RETURN_OK;
+}
+
+ReturnValue_t MapPacketExtraction::continueStoreAssembly(TcTransferFrame* frame, bool isLast) {
+  uint32_t portionLength = frame->getDataLength();
+  if (packetLength + portionLength > assemblyPacketSize) {
+    clearBuffers();
+    return CONTENT_TOO_LARGE;
+  }
+  std::memcpy(assemblyBuffer + packetLength, frame->getDataField(), portionLength);
+  packetLength += portionLength;
+  if (!isLast) {
+    return RETURN_OK;
+  }
+  if (packetLength != assemblyPacketSize) {
+    clearBuffers();
+    return DATA_CORRUPTED;
+  }
+  TmTcMessage message(assemblyStoreId);
+  ReturnValue_t status = MessageQueueSenderIF::sendMessage(tcQueueId, &message);
+  if (status != RETURN_OK) {
+    packetStore->deleteData(assemblyStoreId);
+  }
+  // The store element belongs to the receiver now
+  assemblyStoreId = store_address_t();
+  assemblyBuffer = nullptr;
+  clearBuffers();
+  return status;
+}
+
 void MapPacketExtraction::clearBuffers() {
+  if (assemblyBuffer != nullptr) {
+    packetStore->deleteData(assemblyStoreId);
+    assemblyStoreId = store_address_t();
+    assemblyBuffer = nullptr;
+  }
+  assemblyPacketSize = 0;
   memset(packetBuffer, 0, sizeof(packetBuffer));
   bufferPosition = packetBuffer;
   packetLength = 0;
@@ -6,6 +6,7 @@
 #include "fsfw/ipc/MessageQueueSenderIF.h"
 #include "fsfw/objectmanager/ObjectManagerIF.h"
 #include "fsfw/returnvalues/HasReturnvaluesIF.h"
+#include "fsfw/storagemanager/storeAddress.h"
 
 class StorageManagerIF;
 
@@ -24,6 +25,10 @@ class MapPacketExtraction : public MapPacketExtractionIF {
   uint32_t packetLength = 0;              //!< Complete length of the current Space Packet.
   uint8_t* bufferPosition;                //!< Position to write to in the internal Packet buffer.
   uint8_t packetBuffer[MAX_PACKET_SIZE];  //!< The internal Space Packet Buffer.
+  //! Store element a segmented packet is assembled in if its header was in the first portion.
+  store_address_t assemblyStoreId;
+  uint8_t* assemblyBuffer = nullptr;  //!< Data of #assemblyStoreId.
+  uint32_t assemblyPacketSize = 0;    //!< Full size of the packet which is assembled.
   object_id_t packetDestination;
   //!< Pointer to the store where full TC packets are stored.
   StorageManagerIF* packetStore = nullptr;
@@ -48,6 +53,23 @@ class MapPacketExtraction : public MapPacketExtractionIF {
    * @return	Return Code of the Packet Store or the Message Queue.
    */
   ReturnValue_t sendCompletePacket(uint8_t* data, uint32_t size);
+  /**
+   * Starts assembling a segmented packet directly inside the packet store, which avoids
+   * copying the packet into the #packetBuffer first. Only possible if the first portion
+   * contains the complete space packet header.
+   * @param frame	The frame containing the first portion.
+   * @return	@c RETURN_OK or the return code of the packet store.
+   */
+  ReturnValue_t startStoreAssembly(TcTransferFrame* frame);
+  /**
+   * Appends a continuing or last portion to the packet assembled in the store.
+   * The packet is forwarded to the OBSW once the last portion was received.
+   * @param frame	The frame containing the portion.
+   * @param isLast	Set if this is the last portion.
+   * @return	@c RETURN_OK, @c CONTENT_TOO_LARGE or @c DATA_CORRUPTED if the portions do
+   * not add up to the packet size from the header.
+   */
+  ReturnValue_t continueStoreAssembly(TcTransferFrame* frame, bool isLast);
   /**
    * Helper method to reset the internal buffer.
    */
@@ -0,0 +1,90 @@
+#include "fsfw/datalinklayer/TmTransferFrame.h"
+
+#include "fsfw/globalfunctions/CRC.h"
+
+uint16_t TmFrameConfig::getDataFieldLength() const {
+  uint16_t overhead = TmTransferFrame::PRIMARY_HEADER_SIZE;
+  if (ocfPresent) {
+    overhead += TmTransferFrame::OCF_SIZE;
+  }
+  if (fecfPresent) {
+    overhead += TmTransferFrame::FECF_SIZE;
+  }
+  if (frameLength <= overhead) {
+    return 0;
+  }
+  return frameLength - overhead;
+}
+
+TmTransferFrame::TmTransferFrame(uint8_t* setData, const TmFrameConfig& config)
+    : frame(setData), config(config) {}
+
+void TmTransferFrame::setPrimaryHeader(uint8_t virtualChannelId, uint8_t masterChannelFrameCount,
+                                       uint8_t virtualChannelFrameCount,
+                                       uint16_t firstHeaderPointer) {
+  // Version number 0 in the two uppermost bits
+  frame[0] = (config.spacecraftId >> 4) & 0x3F;
+  frame[1] = ((config.spacecraftId & 0x0F) << 4) | ((virtualChannelId & 0x07) << 1) |
+             (config.ocfPresent ? 1 : 0);
+  frame[2] = masterChannelFrameCount;
+  frame[3] = virtualChannelFrameCount;
+  // No secondary header, synchronous flag and packet order zero, segment length ID 0b11
+  frame[4] = 0b00011000 | ((firstHeaderPointer >> 8) & 0x07);
+  frame[5] = firstHeaderPointer & 0xFF;
+}
+
+void TmTransferFrame::setMasterChannelFrameCount(uint8_t count) { frame[2] = count; }
+
+void TmTransferFrame::setOcf(uint32_t ocf) {
+  if (not config.ocfPresent) {
+    return;
+  }
+  uint8_t* ocfField = getDataField() + config.getDataFieldLength();
+  ocfField[0] = (ocf >> 24) & 0xFF;
+  ocfField[1] = (ocf >> 16) & 0xFF;
+  ocfField[2] = (ocf >> 8) & 0xFF;
+  ocfField[3] = ocf & 0xFF;
+}
+
+void TmTransferFrame::setFecf() {
+  if (not config.fecfPresent) {
+    return;
+  }
+  uint16_t crcPosition = config.frameLength - FECF_SIZE;
+  uint16_t crc = CRC::crc16ccitt(frame, crcPosition);
+  frame[crcPosition] = (crc >> 8) & 0xFF;
+  frame[crcPosition + 1] = crc & 0xFF;
+}
+
+uint8_t TmTransferFrame::getVersionNumber() const { return (frame[0] >> 6) & 0x03; }
+
+uint16_t TmTransferFrame::getSpacecraftId() const {
+  return ((frame[0] & 0x3F) << 4) | ((frame[1] >> 4) & 0x0F);
+}
+
+uint8_t TmTransferFrame::getVirtualChannelId() const { return (frame[1] >> 1) & 0x07; }
+
+bool TmTransferFrame::ocfFlagSet() const { return frame[1] & 0x01; }
+
+uint8_t TmTransferFrame::getMasterChannelFrameCount() const { return frame[2]; }
+
+uint8_t TmTransferFrame::getVirtualChannelFrameCount() const { return frame[3]; }
+
+uint16_t TmTransferFrame::getFirstHeaderPointer() const {
+  return ((frame[4] & 0x07) << 8) | frame[5];
+}
+
+uint32_t TmTransferFrame::getOcf() const {
+  if (not config.ocfPresent) {
+    return 0;
+  }
+  const uint8_t* ocfField = frame + PRIMARY_HEADER_SIZE + config.getDataFieldLength();
+  return (static_cast<uint32_t>(ocfField[0]) << 24) | (ocfField[1] << 16) | (ocfField[2] << 8) |
+         ocfField[3];
+}
+
+uint8_t* TmTransferFrame::getDataField() { return frame + PRIMARY_HEADER_SIZE; }
+
+uint8_t* TmTransferFrame::getFullFrame() { return frame; }
+
+uint16_t TmTransferFrame::getFullSize() const { return config.frameLength; }
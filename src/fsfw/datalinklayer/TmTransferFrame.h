@@ -0,0 +1,76 @@
+#ifndef FSFW_DATALINKLAYER_TMTRANSFERFRAME_H_
+#define FSFW_DATALINKLAYER_TMTRANSFERFRAME_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "dllConf.h"
+
+/**
+ * Fixed configuration of all TM Transfer Frames of one Master Channel.
+ */
+struct TmFrameConfig {
+  uint16_t spacecraftId = 0;
+  //! Total length of every frame including all headers and trailers
+  uint16_t frameLength = 1115;
+  //! Operational Control Field carrying the CLCW
+  bool ocfPresent = true;
+  //! Frame Error Control Field, CRC16-CCITT over the whole frame
+  bool fecfPresent = true;
+
+  uint16_t getDataFieldLength() const;
+};
+
+/**
+ * The TmTransferFrame class simplifies building and reading frames as specified in the
+ * CCSDS TM Space Data Link Protocol. It operates on any buffer passed on construction, the
+ * frame length is fixed by the #TmFrameConfig of the Master Channel.
+ * No secondary header is supported.
+ * @ingroup ccsds_handling
+ */
+class TmTransferFrame {
+ public:
+  static constexpr uint8_t PRIMARY_HEADER_SIZE = 6;
+  static constexpr uint8_t OCF_SIZE = 4;
+  static constexpr uint8_t FECF_SIZE = 2;
+  //! First Header Pointer value if no packet starts in this frame
+  static constexpr uint16_t FHP_NO_PACKET_START = 0x7FF;
+  //! First Header Pointer value if the frame only contains idle data
+  static constexpr uint16_t FHP_IDLE_DATA_ONLY = 0x7FE;
+
+  TmTransferFrame(uint8_t* setData, const TmFrameConfig& config);
+
+  /**
+   * Writes the complete primary header.
+   */
+  void setPrimaryHeader(uint8_t virtualChannelId, uint8_t masterChannelFrameCount,
+                        uint8_t virtualChannelFrameCount, uint16_t firstHeaderPointer);
+  void setMasterChannelFrameCount(uint8_t count);
+  /**
+   * Sets the Operational Control Field, if it is present.
+   */
+  void setOcf(uint32_t ocf);
+  /**
+   * Calculates and sets the Frame Error Control Field, if it is present.
+   * Must be called last, after all other fields were set.
+   */
+  void setFecf();
+
+  uint8_t getVersionNumber() const;
+  uint16_t getSpacecraftId() const;
+  uint8_t getVirtualChannelId() const;
+  bool ocfFlagSet() const;
+  uint8_t getMasterChannelFrameCount() const;
+  uint8_t getVirtualChannelFrameCount() const;
+  uint16_t getFirstHeaderPointer() const;
+  uint32_t getOcf() const;
+  uint8_t* getDataField();
+  uint8_t* getFullFrame();
+  uint16_t getFullSize() const;
+
+ private:
+  uint8_t* frame;
+  const TmFrameConfig& config;
+};
+
+#endif /* FSFW_DATALINKLAYER_TMTRANSFERFRAME_H_ */
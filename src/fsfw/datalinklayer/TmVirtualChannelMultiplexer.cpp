@@ -0,0 +1,113 @@
+#include "fsfw/datalinklayer/TmVirtualChannelMultiplexer.h"
+
+#include <cstring>
+
+TmVirtualChannelMultiplexer::TmVirtualChannelMultiplexer(const TmFrameConfig& config,
+                                                         ClcwIF* clcw, StorageManagerIF* tmStore)
+    : config(config), clcw(clcw), tmStore(tmStore) {}
+
+ReturnValue_t TmVirtualChannelMultiplexer::addVirtualChannel(VirtualChannelTransmission* channel,
+                                                             uint8_t weight) {
+  if (channel == nullptr or weight == 0 or channel->getChannelId() >= IDLE_VIRTUAL_CHANNEL) {
+    return RETURN_FAILED;
+  }
+  // The frames of the channel are copied into buffers sized and finished for the frame
+  // configuration of the multiplexer
+  const TmFrameConfig& channelConfig = channel->getFrameConfig();
+  if (channelConfig.frameLength != config.frameLength or
+      channelConfig.spacecraftId != config.spacecraftId or
+      channelConfig.ocfPresent != config.ocfPresent or
+      channelConfig.fecfPresent != config.fecfPresent) {
+    return RETURN_FAILED;
+  }
+  ChannelEntry entry;
+  entry.channel = channel;
+  entry.weight = weight;
+  std::pair<channelIterator, bool> returnValue =
+      channels.insert(std::pair<uint8_t, ChannelEntry>(channel->getChannelId(), entry));
+  if (returnValue.second == true) {
+    return RETURN_OK;
+  } else {
+    return RETURN_FAILED;
+  }
+}
+
+ReturnValue_t TmVirtualChannelMultiplexer::addStoredPacket(uint8_t virtualChannelId,
+                                                           store_address_t storeId) {
+  if (tmStore == nullptr) {
+    return RETURN_FAILED;
+  }
+  channelIterator iter = channels.find(virtualChannelId);
+  if (iter == channels.end()) {
+    return VC_NOT_FOUND;
+  }
+  const uint8_t* packet = nullptr;
+  size_t size = 0;
+  ReturnValue_t result = tmStore->getData(storeId, &packet, &size);
+  if (result != RETURN_OK) {
+    return result;
+  }
+  result = iter->second.channel->addPacket(packet, size);
+  if (result == RETURN_OK) {
+    tmStore->deleteData(storeId);
+  }
+  return result;
+}
+
+ReturnValue_t TmVirtualChannelMultiplexer::flushAll() {
+  ReturnValue_t status = RETURN_OK;
+  for (auto& channel : channels) {
+    ReturnValue_t result = channel.second.channel->flush();
+    if (result != RETURN_OK) {
+      status = result;
+    }
+  }
+  return status;
+}
+
+ReturnValue_t TmVirtualChannelMultiplexer::getNextFrame(uint8_t* frame, bool generateIdleFrame) {
+  ChannelEntry* selected = nullptr;
+  int16_t totalWeight = 0;
+  for (auto& iter : channels) {
+    ChannelEntry& entry = iter.second;
+    if (not entry.channel->hasCompletedFrame()) {
+      continue;
+    }
+    entry.currentWeight += entry.weight;
+    totalWeight += entry.weight;
+    if (selected == nullptr or entry.currentWeight > selected->currentWeight) {
+      selected = &entry;
+    }
+  }
+  if (selected != nullptr) {
+    selected->currentWeight -= totalWeight;
+    selected->channel->popFrame(frame);
+  } else if (generateIdleFrame) {
+    TmTransferFrame idleFrame(frame, config);
+    idleFrame.setPrimaryHeader(IDLE_VIRTUAL_CHANNEL, 0, idleFrameCount++,
+                               TmTransferFrame::FHP_IDLE_DATA_ONLY);
+    std::memset(idleFrame.getDataField(), VirtualChannelTransmission::IDLE_PATTERN,
+                config.getDataFieldLength());
+    sentIdleFrames++;
+  } else {
+    return NO_FRAME_AVAILABLE;
+  }
+  finishFrame(frame);
+  return RETURN_OK;
+}
+
+uint32_t TmVirtualChannelMultiplexer::getSentFrameCount() const { return sentFrames; }
+
+uint32_t TmVirtualChannelMultiplexer::getIdleFrameCount() const { return sentIdleFrames; }
+
+void TmVirtualChannelMultiplexer::finishFrame(uint8_t* frame) {
+  TmTransferFrame tmFrame(frame, config);
+  tmFrame.setMasterChannelFrameCount(masterChannelFrameCount++);
+  if (clcw != nullptr) {
+    tmFrame.setOcf(clcw->getAsWhole());
+  } else {
+    tmFrame.setOcf(0);
+  }
+  tmFrame.setFecf();
+  sentFrames++;
+}
@@ -0,0 +1,88 @@
+#ifndef FSFW_DATALINKLAYER_TMVIRTUALCHANNELMULTIPLEXER_H_
+#define FSFW_DATALINKLAYER_TMVIRTUALCHANNELMULTIPLEXER_H_
+
+#include <map>
+
+#include "CCSDSReturnValuesIF.h"
+#include "ClcwIF.h"
+#include "TmTransferFrame.h"
+#include "VirtualChannelTransmission.h"
+#include "dllConf.h"
+#include "fsfw/storagemanager/StorageManagerIF.h"
+
+/**
+ * Master Channel multiplexer for the TM downlink.
+ * The multiplexer collects the completed frames of all assigned Virtual Channels and fills in
+ * the Master Channel Frame Count, the Operational Control Field with the current CLCW and the
+ * Frame Error Control Field.
+ *
+ * The next Virtual Channel is selected with a smooth weighted round robin among all channels
+ * with completed frames: a channel with weight 3 gets three times as many frames as a channel
+ * with weight 1 while both have data, without sending them in bursts. If no channel has a
+ * frame ready, an idle frame on VC 7 can be generated to keep the downlink and the CLCW
+ * reporting running.
+ * @ingroup ccsds_handling
+ */
+class TmVirtualChannelMultiplexer : public CCSDSReturnValuesIF {
+ public:
+  static constexpr uint8_t IDLE_VIRTUAL_CHANNEL = 7;
+
+  /**
+   * @param config	Frame configuration. Has to outlive this instance.
+   * @param clcw	Optional CLCW which is inserted into the OCF of every frame.
+   * @param tmStore	Optional store used by #addStoredPacket.
+   */
+  TmVirtualChannelMultiplexer(const TmFrameConfig& config, ClcwIF* clcw = nullptr,
+                              StorageManagerIF* tmStore = nullptr);
+
+  /**
+   * Configuration method to add a new TM Virtual Channel.
+   * @param channel	Virtual Channel, using the same frame configuration as the multiplexer.
+   *                  The VCID has to be below #IDLE_VIRTUAL_CHANNEL.
+   * @param weight	Relative share of the frames for this channel. Shall be larger than 0.
+   * @return	@c RETURN_OK on success, @c RETURN_FAILED if the VCID was already added, is
+   *          reserved for idle frames or the frame configuration differs.
+   */
+  ReturnValue_t addVirtualChannel(VirtualChannelTransmission* channel, uint8_t weight = 1);
+  /**
+   * Packs a packet from the TM store into the given Virtual Channel. The store entry is
+   * deleted if the packet was accepted.
+   * @return	@c RETURN_OK, @c VC_NOT_FOUND, @c FRAME_BUFFER_FULL or the store return code.
+   */
+  ReturnValue_t addStoredPacket(uint8_t virtualChannelId, store_address_t storeId);
+  /**
+   * Completes the partially filled frames of all Virtual Channels with idle packets.
+   */
+  ReturnValue_t flushAll();
+  /**
+   * Copies the next frame to send into the given buffer.
+   * @param frame	Buffer with a size of at least the frame length.
+   * @param generateIdleFrame	Generate an idle frame if no Virtual Channel has a frame.
+   * @return	@c RETURN_OK or @c NO_FRAME_AVAILABLE.
+   */
+  ReturnValue_t getNextFrame(uint8_t* frame, bool generateIdleFrame = true);
+
+  uint32_t getSentFrameCount() const;
+  uint32_t getIdleFrameCount() const;
+
+ private:
+  struct ChannelEntry {
+    VirtualChannelTransmission* channel = nullptr;
+    int16_t weight = 1;
+    int16_t currentWeight = 0;
+  };
+  typedef std::map<uint8_t, ChannelEntry>::iterator channelIterator;
+
+  const TmFrameConfig& config;
+  ClcwIF* clcw;
+  StorageManagerIF* tmStore;
+  std::map<uint8_t, ChannelEntry> channels;
+  uint8_t masterChannelFrameCount = 0;
+  uint8_t idleFrameCount = 0;
+  uint32_t sentFrames = 0;
+  uint32_t sentIdleFrames = 0;
+
+  void finishFrame(uint8_t* frame);
+};
+
+#endif /* FSFW_DATALINKLAYER_TMVIRTUALCHANNELMULTIPLEXER_H_ */
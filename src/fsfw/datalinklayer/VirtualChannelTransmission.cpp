@@ -0,0 +1,134 @@
+#include "fsfw/datalinklayer/VirtualChannelTransmission.h"
+
+#include <algorithm>
+#include <cstring>
+
+VirtualChannelTransmission::VirtualChannelTransmission(uint8_t virtualChannelId,
+                                                       const TmFrameConfig& config,
+                                                       uint8_t frameQueueDepth)
+    : channelId(virtualChannelId),
+      config(config),
+      dataFieldLength(config.getDataFieldLength()),
+      frameQueueDepth(frameQueueDepth),
+      frameQueue(static_cast<size_t>(frameQueueDepth) * config.frameLength) {}
+
+ReturnValue_t VirtualChannelTransmission::addPacket(const uint8_t* packet, size_t size) {
+  if (packet == nullptr or size == 0) {
+    return RETURN_FAILED;
+  }
+  if (size > getFreeSpace()) {
+    return FRAME_BUFFER_FULL;
+  }
+  append(packet, size, true, true);
+  return RETURN_OK;
+}
+
+ReturnValue_t VirtualChannelTransmission::flush() {
+  if (fill == 0) {
+    return RETURN_OK;
+  }
+  size_t idleSize = dataFieldLength - fill;
+  if (idleSize < IDLE_PACKET_MIN_SIZE) {
+    idleSize += dataFieldLength;
+  }
+  if (idleSize > getFreeSpace()) {
+    return FRAME_BUFFER_FULL;
+  }
+  // Packet data length field contains the data length minus one
+  uint16_t idleDataLength = idleSize - 6 - 1;
+  const uint8_t idleHeader[6] = {IDLE_APID >> 8,
+                                 IDLE_APID & 0xFF,
+                                 0xC0,
+                                 0x00,
+                                 static_cast<uint8_t>(idleDataLength >> 8),
+                                 static_cast<uint8_t>(idleDataLength & 0xFF)};
+  append(idleHeader, sizeof(idleHeader), true, false);
+  append(nullptr, idleSize - sizeof(idleHeader), false, false);
+  return RETURN_OK;
+}
+
+size_t VirtualChannelTransmission::getFreeSpace() const {
+  if (completedFrames >= frameQueueDepth) {
+    return 0;
+  }
+  return static_cast<size_t>(frameQueueDepth - completedFrames) * dataFieldLength - fill;
+}
+
+bool VirtualChannelTransmission::hasCompletedFrame() const { return completedFrames > 0; }
+
+ReturnValue_t VirtualChannelTransmission::popFrame(uint8_t* frame) {
+  if (completedFrames == 0) {
+    return NO_FRAME_AVAILABLE;
+  }
+  std::memcpy(frame, &frameQueue[static_cast<size_t>(queueHead) * config.frameLength],
+              config.frameLength);
+  queueHead = (queueHead + 1) % frameQueueDepth;
+  completedFrames--;
+  return RETURN_OK;
+}
+
+void VirtualChannelTransmission::clear() {
+  queueHead = 0;
+  completedFrames = 0;
+  fill = 0;
+  assemblyPacketBytes = 0;
+  firstHeaderPointer = TmTransferFrame::FHP_NO_PACKET_START;
+}
+
+uint8_t VirtualChannelTransmission::getChannelId() const { return channelId; }
+
+const TmFrameConfig& VirtualChannelTransmission::getFrameConfig() const { return config; }
+
+float VirtualChannelTransmission::getPackingEfficiency() const {
+  if (completedFrameCount == 0) {
+    return 0.0;
+  }
+  return static_cast<float>(framedPacketBytes) /
+         (static_cast<float>(completedFrameCount) * dataFieldLength);
+}
+
+uint32_t VirtualChannelTransmission::getCompletedFrameCount() const {
+  return completedFrameCount;
+}
+
+uint8_t* VirtualChannelTransmission::getAssemblyFrame() {
+  uint8_t slot = (queueHead + completedFrames) % frameQueueDepth;
+  return &frameQueue[static_cast<size_t>(slot) * config.frameLength];
+}
+
+void VirtualChannelTransmission::append(const uint8_t* data, size_t size, bool packetStart,
+                                        bool isPacketData) {
+  while (size > 0) {
+    if (packetStart and firstHeaderPointer == TmTransferFrame::FHP_NO_PACKET_START) {
+      firstHeaderPointer = fill;
+    }
+    packetStart = false;
+    size_t chunk = std::min<size_t>(size, dataFieldLength - fill);
+    uint8_t* target = getAssemblyFrame() + TmTransferFrame::PRIMARY_HEADER_SIZE + fill;
+    if (data != nullptr) {
+      std::memcpy(target, data, chunk);
+      data += chunk;
+    } else {
+      std::memset(target, IDLE_PATTERN, chunk);
+    }
+    fill += chunk;
+    size -= chunk;
+    if (isPacketData) {
+      assemblyPacketBytes += chunk;
+    }
+    if (fill == dataFieldLength) {
+      completeFrame();
+    }
+  }
+}
+
+void VirtualChannelTransmission::completeFrame() {
+  TmTransferFrame frame(getAssemblyFrame(), config);
+  frame.setPrimaryHeader(channelId, 0, frameCount++, firstHeaderPointer);
+  completedFrames++;
+  completedFrameCount++;
+  framedPacketBytes += assemblyPacketBytes;
+  assemblyPacketBytes = 0;
+  fill = 0;
+  firstHeaderPointer = TmTransferFrame::FHP_NO_PACKET_START;
+}
@@ -0,0 +1,99 @@
+#ifndef FSFW_DATALINKLAYER_VIRTUALCHANNELTRANSMISSION_H_
+#define FSFW_DATALINKLAYER_VIRTUALCHANNELTRANSMISSION_H_
+
+#include <vector>
+
+#include "CCSDSReturnValuesIF.h"
+#include "TmTransferFrame.h"
+#include "dllConf.h"
+
+/**
+ * Implementation of the sending side of a TM Virtual Channel.
+ * Space Packets are packed back to back into fixed-length TM Transfer Frames, a packet may
+ * span several frames. The First Header Pointer of each frame is maintained accordingly.
+ * Completed frames are kept in an internal queue of configurable depth until they are
+ * fetched by the TmVirtualChannelMultiplexer, which fills in the Master Channel fields.
+ * All memory is allocated on construction.
+ * @ingroup ccsds_handling
+ */
+class VirtualChannelTransmission : public CCSDSReturnValuesIF {
+ public:
+  //! APID of idle packets
+  static constexpr uint16_t IDLE_APID = 0x7FF;
+  //! Smallest possible idle packet, a primary header and one data byte
+  static constexpr uint8_t IDLE_PACKET_MIN_SIZE = 7;
+  static constexpr uint8_t IDLE_PATTERN = 0x55;
+
+  /**
+   * @param virtualChannelId	VCID, 0 to 7.
+   * @param config	Frame configuration of the Master Channel. Has to outlive this instance.
+   * @param frameQueueDepth	Number of completed frames which can be buffered.
+   */
+  VirtualChannelTransmission(uint8_t virtualChannelId, const TmFrameConfig& config,
+                             uint8_t frameQueueDepth = 4);
+
+  /**
+   * Appends a Space Packet to the Virtual Channel.
+   * @return	@c RETURN_OK or @c FRAME_BUFFER_FULL if the packet does not fit into the
+   * remaining frames. In that case, nothing is written.
+   */
+  ReturnValue_t addPacket(const uint8_t* packet, size_t size);
+  /**
+   * Completes a partially filled frame by appending an idle packet. If the remaining space is
+   * too small for an idle packet, the idle packet continues in the next frame.
+   * @return	@c RETURN_OK or @c FRAME_BUFFER_FULL.
+   */
+  ReturnValue_t flush();
+  /**
+   * @return Number of bytes which can still be added before the frame queue is full.
+   */
+  size_t getFreeSpace() const;
+
+  bool hasCompletedFrame() const;
+  /**
+   * Copies the oldest completed frame into the given buffer and removes it from the queue.
+   * @param frame	Buffer with a size of at least the frame length.
+   * @return	@c RETURN_OK or @c NO_FRAME_AVAILABLE.
+   */
+  ReturnValue_t popFrame(uint8_t* frame);
+  /**
+   * Discards all frames and a partially filled frame.
+   */
+  void clear();
+
+  uint8_t getChannelId() const;
+  const TmFrameConfig& getFrameConfig() const;
+  /**
+   * @return Ratio of packet bytes to the data field size of all completed frames.
+   */
+  float getPackingEfficiency() const;
+  uint32_t getCompletedFrameCount() const;
+
+ private:
+  uint8_t channelId;
+  const TmFrameConfig& config;
+  uint16_t dataFieldLength;
+  uint8_t frameQueueDepth;
+  std::vector<uint8_t> frameQueue;
+  uint8_t queueHead = 0;
+  uint8_t completedFrames = 0;
+  //! Bytes written into the data field of the frame which is currently assembled.
+  uint16_t fill = 0;
+  uint16_t firstHeaderPointer = TmTransferFrame::FHP_NO_PACKET_START;
+  uint8_t frameCount = 0;
+
+  //! Packet bytes, without idle packets, in the frame which is currently assembled.
+  uint16_t assemblyPacketBytes = 0;
+  uint64_t framedPacketBytes = 0;
+  uint32_t completedFrameCount = 0;
+
+  uint8_t* getAssemblyFrame();
+  /**
+   * Copies data into the frames, completing frames as they are filled.
+   * @param data	Data to append. If this is a nullptr, the idle pattern is appended.
+   */
+  void append(const uint8_t* data, size_t size, bool packetStart, bool isPacketData);
+  void completeFrame();
+};
+
+#endif /* FSFW_DATALINKLAYER_VIRTUALCHANNELTRANSMISSION_H_ */
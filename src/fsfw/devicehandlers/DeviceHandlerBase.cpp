@@ -9,6 +9,7 @@
 #include "fsfw/ipc/QueueFactory.h"
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
+#include "fsfw/serviceinterface/TraceChannel.h"
 #include "fsfw/storagemanager/StorageManagerIF.h"
 #include "fsfw/subsystem/SubsystemBase.h"
 #include "fsfw/thermal/ThermalComponentIF.h"
@@ -663,6 +664,8 @@ void DeviceHandlerBase::doSendWrite() {
     ReturnValue_t result = communicationInterface->sendMessage(comCookie, rawPacket, rawPacketLen);
 
     if (result == RETURN_OK) {
+      trace::record(trace::RecordTypes::DEVICE_COMMAND, cookieInfo.pendingCommand->first,
+                    getObjectId(), rawPacketLen);
       cookieInfo.state = COOKIE_WRITE_SENT;
     } else {
       // always generate a failure event, so that FDIR knows what's up
@@ -750,6 +753,10 @@ void DeviceHandlerBase::doGetRead() {
 
   if (receivedDataLen == 0 or result == DeviceCommunicationIF::NO_REPLY_RECEIVED) return;
 
+  // Unsolicited and periodic replies arrive without a pending command
+  trace::record(trace::RecordTypes::DEVICE_REPLY, getPendingCommand(), getObjectId(),
+                receivedDataLen);
+
   if (wiretappingMode == RAW) {
     replyRawData(receivedData, receivedDataLen, requestedRawTraffic);
   }
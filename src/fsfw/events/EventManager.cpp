@@ -3,6 +3,7 @@
 #include "fsfw/events/EventMessage.h"
 #include "fsfw/ipc/MutexFactory.h"
 #include "fsfw/ipc/QueueFactory.h"
+#include "fsfw/serviceinterface/TraceChannel.h"
 
 MessageQueueId_t EventManagerIF::eventmanagerQueue = MessageQueueIF::NO_QUEUE;
 
@@ -20,6 +21,9 @@ EventManager::EventManager(object_id_t setObjectId)
   mutex = MutexFactory::instance()->createMutex();
   eventReportQueue = QueueFactory::instance()->createMessageQueue(MAX_EVENTS_PER_CYCLE,
                                                                   EventMessage::EVENT_MESSAGE_SIZE);
+  for (size_t idx = 0; idx < eventBatch.size(); idx++) {
+    eventBatchPointers[idx] = &eventBatch[idx];
+  }
 }
 
 EventManager::~EventManager() {
@@ -30,25 +34,49 @@ EventManager::~EventManager() {
 MessageQueueId_t EventManager::getEventReportQueue() { return eventReportQueue->getId(); }
 
 ReturnValue_t EventManager::performOperation(uint8_t opCode) {
-  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
-  while (result == HasReturnvaluesIF::RETURN_OK) {
-    EventMessage message;
-    result = eventReportQueue->receiveMessage(&message);
-    if (result == HasReturnvaluesIF::RETURN_OK) {
+  size_t received = 0;
+  while (eventReportQueue->receiveMessages(eventBatchPointers.data(), eventBatchPointers.size(),
+                                           &received) == HasReturnvaluesIF::RETURN_OK) {
+    for (size_t idx = 0; idx < received; idx++) {
+      EventMessage& message = eventBatch[idx];
+      trace::record(trace::RecordTypes::EVENT, message.getEvent(), message.getReporter(),
+                    message.getParameter1(), message.getParameter2());
 #if FSFW_OBJ_EVENT_TRANSLATION == 1
       printEvent(&message);
 #endif
-      notifyListeners(&message);
+    }
+    notifyListeners(eventBatch.data(), received);
+    if (received < eventBatchPointers.size()) {
+      break;
     }
   }
   return HasReturnvaluesIF::RETURN_OK;
 }
 
-void EventManager::notifyListeners(EventMessage* message) {
+void EventManager::notifyListeners(EventMessage* message) { notifyListeners(message, 1); }
+
+void EventManager::notifyListeners(EventMessage* messages, size_t count) {
+  std::array<MessageQueueMessageIF*, EVENT_BATCH_SIZE> matches;
   lockMutex();
-  for (auto iter = listenerList.begin(); iter != listenerList.end(); ++iter) {
-    if (iter->second.match(message)) {
-      MessageQueueSenderIF::sendMessage(iter->first, message, message->getSender());
+  for (size_t offset = 0; offset < count; offset += EVENT_BATCH_SIZE) {
+    size_t batchSize = count - offset < EVENT_BATCH_SIZE ? count - offset : EVENT_BATCH_SIZE;
+    for (auto iter = listenerList.begin(); iter != listenerList.end(); ++iter) {
+      size_t numberOfMatches = 0;
+      for (size_t idx = offset; idx < offset + batchSize; idx++) {
+        if (iter->second.match(&messages[idx])) {
+          matches[numberOfMatches++] = &messages[idx];
+        }
+      }
+      // The events keep their original sender, so consecutive events with the same sender are
+      // forwarded together
+      size_t first = 0;
+      for (size_t idx = 1; idx <= numberOfMatches; idx++) {
+        if (idx == numberOfMatches or matches[idx]->getSender() != matches[first]->getSender()) {
+          eventReportQueue->sendMessagesFrom(iter->first, &matches[first], idx - first,
+                                             matches[first]->getSender(), nullptr);
+          first = idx;
+        }
+      }
     }
   }
   unlockMutex();
@@ -56,8 +84,10 @@ void EventManager::notifyListeners(EventMessage* message) {
 
 ReturnValue_t EventManager::registerListener(MessageQueueId_t listener,
                                              bool forwardAllButSelected) {
+  lockMutex();
   auto result = listenerList.insert(std::pair<MessageQueueId_t, EventMatchTree>(
       listener, EventMatchTree(&factoryBackend, forwardAllButSelected)));
+  unlockMutex();
   if (!result.second) {
     return HasReturnvaluesIF::RETURN_FAILED;
   }
@@ -77,11 +107,12 @@ ReturnValue_t EventManager::subscribeToEventRange(MessageQueueId_t listener, Eve
                                                   EventId_t idTo, bool idInverted,
                                                   object_id_t reporterFrom, object_id_t reporterTo,
                                                   bool reporterInverted) {
+  lockMutex();
   auto iter = listenerList.find(listener);
   if (iter == listenerList.end()) {
+    unlockMutex();
     return LISTENER_NOT_FOUND;
   }
-  lockMutex();
   ReturnValue_t result =
       iter->second.addMatch(idFrom, idTo, idInverted, reporterFrom, reporterTo, reporterInverted);
   unlockMutex();
@@ -98,11 +129,12 @@ ReturnValue_t EventManager::unsubscribeFromEventRange(MessageQueueId_t listener,
                                                       object_id_t reporterFrom,
                                                       object_id_t reporterTo,
                                                       bool reporterInverted) {
+  lockMutex();
   auto iter = listenerList.find(listener);
   if (iter == listenerList.end()) {
+    unlockMutex();
     return LISTENER_NOT_FOUND;
   }
-  lockMutex();
   ReturnValue_t result = iter->second.removeMatch(idFrom, idTo, idInverted, reporterFrom,
                                                   reporterTo, reporterInverted);
   unlockMutex();
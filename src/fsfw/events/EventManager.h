@@ -1,6 +1,7 @@
 #ifndef FSFW_EVENT_EVENTMANAGER_H_
 #define FSFW_EVENT_EVENTMANAGER_H_
 
+#include <array>
 #include <map>
 
 #include "../ipc/MessageQueueIF.h"
@@ -10,6 +11,7 @@
 #include "../storagemanager/LocalPool.h"
 #include "../tasks/ExecutableObjectIF.h"
 #include "EventManagerIF.h"
+#include "EventMessage.h"
 #include "FSFWConfig.h"
 #include "eventmatching/EventMatchTree.h"
 
@@ -22,6 +24,8 @@ extern const char* translateEvents(Event event);
 class EventManager : public EventManagerIF, public ExecutableObjectIF, public SystemObject {
  public:
   static const uint16_t MAX_EVENTS_PER_CYCLE = 80;
+  //! Number of events which are read from the report queue and forwarded at once
+  static const uint16_t EVENT_BATCH_SIZE = 16;
 
   EventManager(object_id_t setObjectId);
   virtual ~EventManager();
@@ -46,6 +50,9 @@ class EventManager : public EventManagerIF, public ExecutableObjectIF, public Sy
 
  protected:
   MessageQueueIF* eventReportQueue = nullptr;
+  //! Messages and message pointers used to read the events in batches
+  std::array<EventMessage, EVENT_BATCH_SIZE> eventBatch;
+  std::array<MessageQueueMessageIF*, EVENT_BATCH_SIZE> eventBatchPointers = {};
 
   std::map<MessageQueueId_t, EventMatchTree> listenerList;
 
@@ -61,6 +68,11 @@ class EventManager : public EventManagerIF, public ExecutableObjectIF, public Sy
   static const uint16_t N_ELEMENTS[N_POOLS];
 
   void notifyListeners(EventMessage* message);
+  /**
+   * @brief   Forwards a batch of events. The mutex is locked once and each listener receives
+   *          its matching events with as few send calls as possible.
+   */
+  void notifyListeners(EventMessage* messages, size_t count);
 
 #if FSFW_OBJ_EVENT_TRANSLATION == 1
   void printEvent(EventMessage* message);
@@ -26,11 +26,55 @@ const uint16_t CRC::crc16ccitt_table[256] = {
     0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8, 0x6e17, 0x7e36, 0x4e55, 0x5e74,
     0x2e93, 0x3eb2, 0x0ed1, 0x1ef0};
 
+namespace {
+
+/**
+ * Tables for the slicing-by-4 variant of the CRC16-CCITT. Table k contains the CRC of
+ * a byte followed by k zero bytes, so four input bytes can be processed with four independent
+ * table lookups instead of four dependent ones.
+ */
+struct Crc16SlicingTables {
+  uint16_t table[4][256];
+};
+
+constexpr Crc16SlicingTables generateSlicingTables() {
+  Crc16SlicingTables tables = {};
+  for (uint16_t byte = 0; byte < 256; byte++) {
+    uint16_t crc = byte << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                           : static_cast<uint16_t>(crc << 1);
+    }
+    tables.table[0][byte] = crc;
+  }
+  for (uint8_t slice = 1; slice < 4; slice++) {
+    for (uint16_t byte = 0; byte < 256; byte++) {
+      uint16_t prev = tables.table[slice - 1][byte];
+      tables.table[slice][byte] =
+          static_cast<uint16_t>(tables.table[0][prev >> 8] ^ (prev << 8));
+    }
+  }
+  return tables;
+}
+
+constexpr Crc16SlicingTables SLICING_TABLES = generateSlicingTables();
+
+}  // namespace
+
 // CRC implementation
 uint16_t CRC::crc16ccitt(uint8_t const input[], uint32_t length, uint16_t startingCrc) {
   const uint8_t *data = static_cast<const uint8_t *>(input);
   unsigned int tbl_idx;
 
+  // The CRC register only overlaps the first two bytes of each four byte block
+  while (length >= 4) {
+    startingCrc = SLICING_TABLES.table[3][data[0] ^ (startingCrc >> 8)] ^
+                  SLICING_TABLES.table[2][data[1] ^ (startingCrc & 0xff)] ^
+                  SLICING_TABLES.table[1][data[2]] ^ SLICING_TABLES.table[0][data[3]];
+    data += 4;
+    length -= 4;
+  }
+
   while (length--) {
     tbl_idx = ((startingCrc >> 8) ^ *data) & 0xff;
     startingCrc = (crc16ccitt_table[tbl_idx] ^ (startingCrc << 8)) & 0xffff;
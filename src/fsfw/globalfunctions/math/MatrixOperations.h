@@ -4,6 +4,9 @@
 #include <stdint.h>
 
 #include <cmath>
+#include <type_traits>
+
+#include "fsfw/globalfunctions/math/simdKernels.h"
 
 template <typename T1, typename T2 = T1, typename T3 = T2>
 class MatrixOperations {
@@ -95,6 +98,81 @@ class MatrixOperations {
       }
     }
   }
+
+  /**
+   * Overloads with compile-time dimensions, e.g. multiply<3, 3, 1>(dcm, vector, result).
+   * The loops are unrolled by the compiler and for double matrices the rows are processed with
+   * the SIMD kernels. The results are the same as the ones of the overloads with run-time
+   * dimensions.
+   *
+   * Do not use multiply with result == matrix1 or matrix2.
+   */
+  template <uint8_t ROWS1, uint8_t COLUMNS1, uint8_t COLUMNS2>
+  static void multiply(const T1 *matrix1, const T2 *matrix2, T3 *result) {
+    if ((matrix1 == (T1 *)result) || (matrix2 == (T2 *)result)) {
+      return;
+    }
+    if constexpr (ALL_DOUBLE) {
+      // Row-wise formulation which accumulates the products in the same order
+      for (uint8_t resultRow = 0; resultRow < ROWS1; resultRow++) {
+        double *resultRowStart = result + COLUMNS2 * resultRow;
+        for (uint8_t resultColumn = 0; resultColumn < COLUMNS2; resultColumn++) {
+          resultRowStart[resultColumn] = 0;
+        }
+        for (uint8_t i = 0; i < COLUMNS1; i++) {
+          simdkernels::addScaled<COLUMNS2>(resultRowStart, matrix2 + i * COLUMNS2,
+                                           matrix1[i + resultRow * COLUMNS1]);
+        }
+      }
+    } else {
+      multiply(matrix1, matrix2, result, ROWS1, COLUMNS1, COLUMNS2);
+    }
+  }
+
+  template <uint8_t SIZE>
+  static void transpose(const T1 *matrix, T2 *transposed) {
+    transposed[0] = matrix[0];
+    for (uint8_t column = 1; column < SIZE; column++) {
+      transposed[column + SIZE * column] = matrix[column + SIZE * column];
+      for (uint8_t row = 0; row < column; row++) {
+        T1 temp = matrix[column + SIZE * row];
+        transposed[column + SIZE * row] = matrix[row + SIZE * column];
+        transposed[row + SIZE * column] = temp;
+      }
+    }
+  }
+
+  template <uint8_t ROWS, uint8_t COLUMNS>
+  static void add(const T1 *matrix1, const T2 *matrix2, T3 *result) {
+    if constexpr (ALL_DOUBLE) {
+      simdkernels::add<ROWS * COLUMNS>(matrix1, matrix2, result);
+    } else {
+      add(matrix1, matrix2, result, ROWS, COLUMNS);
+    }
+  }
+
+  template <uint8_t ROWS, uint8_t COLUMNS>
+  static void subtract(const T1 *matrix1, const T2 *matrix2, T3 *result) {
+    if constexpr (ALL_DOUBLE) {
+      simdkernels::subtract<ROWS * COLUMNS>(matrix1, matrix2, result);
+    } else {
+      subtract(matrix1, matrix2, result, ROWS, COLUMNS);
+    }
+  }
+
+  template <uint8_t ROWS, uint8_t COLUMNS>
+  static void multiplyScalar(const T1 *matrix1, const T2 scalar, T3 *result) {
+    if constexpr (ALL_DOUBLE) {
+      simdkernels::scale<ROWS * COLUMNS>(matrix1, scalar, result);
+    } else {
+      multiplyScalar(matrix1, scalar, result, ROWS, COLUMNS);
+    }
+  }
+
+ private:
+  static constexpr bool ALL_DOUBLE = std::is_same<T1, double>::value &&
+                                     std::is_same<T2, double>::value &&
+                                     std::is_same<T3, double>::value;
 };
 
 #endif /* MATRIXOPERATIONS_H_ */
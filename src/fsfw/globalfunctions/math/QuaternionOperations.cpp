@@ -42,11 +42,11 @@ void QuaternionOperations::inverse(const double* quaternion, double* inverseQuat
 QuaternionOperations::QuaternionOperations() {}
 
 void QuaternionOperations::normalize(const double* quaternion, double* unitQuaternion) {
-  VectorOperations<double>::normalize(quaternion, unitQuaternion, 4);
+  VectorOperations<double>::normalize<4>(quaternion, unitQuaternion);
 }
 
 float QuaternionOperations::norm(const double* quaternion) {
-  return VectorOperations<double>::norm(quaternion, 4);
+  return VectorOperations<double>::norm<4>(quaternion);
 }
 
 void QuaternionOperations::fromDcm(const double dcm[][3], double* quaternion, uint8_t* index) {
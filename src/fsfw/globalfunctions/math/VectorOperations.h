@@ -4,6 +4,9 @@
 #include <stdint.h>
 
 #include <cmath>
+#include <type_traits>
+
+#include "fsfw/globalfunctions/math/simdKernels.h"
 
 template <typename T>
 class VectorOperations {
@@ -87,6 +90,52 @@ class VectorOperations {
 
   static void copy(const T *in, T *out, uint8_t size) { mulScalar(in, 1, out, size); }
 
+  /**
+   * Overloads with compile-time sizes, e.g. add<6>(state1, state2, sum). For double vectors
+   * the element-wise operations use the SIMD kernels. The norm is summed up in the same order
+   * as by the overload with a run-time size, so the results are the same.
+   */
+  template <uint8_t SIZE>
+  static void mulScalar(const T vector[], T scalar, T out[]) {
+    if constexpr (std::is_same<T, double>::value) {
+      simdkernels::scale<SIZE>(vector, scalar, out);
+    } else {
+      mulScalar(vector, scalar, out, SIZE);
+    }
+  }
+
+  template <uint8_t SIZE>
+  static void add(const T vector1[], const T vector2[], T sum[]) {
+    if constexpr (std::is_same<T, double>::value) {
+      simdkernels::add<SIZE>(vector1, vector2, sum);
+    } else {
+      add(vector1, vector2, sum, SIZE);
+    }
+  }
+
+  template <uint8_t SIZE>
+  static void subtract(const T vector1[], const T vector2[], T sum[]) {
+    if constexpr (std::is_same<T, double>::value) {
+      simdkernels::subtract<SIZE>(vector1, vector2, sum);
+    } else {
+      subtract(vector1, vector2, sum, SIZE);
+    }
+  }
+
+  template <uint8_t SIZE>
+  static T norm(const T *vector) {
+    T result = 0;
+    for (uint8_t index = SIZE; index > 0; index--) {
+      result += vector[index - 1] * vector[index - 1];
+    }
+    return sqrt(result);
+  }
+
+  template <uint8_t SIZE>
+  static void normalize(const T *vector, T *normalizedVector) {
+    mulScalar<SIZE>(vector, 1 / norm<SIZE>(vector), normalizedVector);
+  }
+
  private:
   VectorOperations();
 };
@@ -0,0 +1,138 @@
+#ifndef FSFW_GLOBALFUNCTIONS_MATH_SIMDKERNELS_H_
+#define FSFW_GLOBALFUNCTIONS_MATH_SIMDKERNELS_H_
+
+#include <cstddef>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief   Element-wise kernels for double arrays with a compile-time size, which are used by
+ *          the fixed-size overloads of the MatrixOperations and VectorOperations.
+ * @details
+ * The kernels use AVX, SSE2 or AArch64 NEON instructions if they are enabled for the target and
+ * plain loops otherwise. They do not use fused multiply-add instructions and each element is
+ * computed with the same operations in the same order as in the generic loops, so the results
+ * are identical.
+ */
+namespace simdkernels {
+
+/**
+ * accumulator[i] += scalar * row[i]
+ */
+template <size_t SIZE>
+inline void addScaled(double *accumulator, const double *row, double scalar) {
+  size_t idx = 0;
+#if defined(__AVX__)
+  const __m256d scalar4 = _mm256_set1_pd(scalar);
+  for (; idx + 4 <= SIZE; idx += 4) {
+    __m256d product = _mm256_mul_pd(scalar4, _mm256_loadu_pd(row + idx));
+    _mm256_storeu_pd(accumulator + idx, _mm256_add_pd(_mm256_loadu_pd(accumulator + idx), product));
+  }
+#endif
+#if defined(__SSE2__)
+  const __m128d scalar2 = _mm_set1_pd(scalar);
+  for (; idx + 2 <= SIZE; idx += 2) {
+    __m128d product = _mm_mul_pd(scalar2, _mm_loadu_pd(row + idx));
+    _mm_storeu_pd(accumulator + idx, _mm_add_pd(_mm_loadu_pd(accumulator + idx), product));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t scalar2 = vdupq_n_f64(scalar);
+  for (; idx + 2 <= SIZE; idx += 2) {
+    float64x2_t product = vmulq_f64(scalar2, vld1q_f64(row + idx));
+    vst1q_f64(accumulator + idx, vaddq_f64(vld1q_f64(accumulator + idx), product));
+  }
+#endif
+  for (; idx < SIZE; idx++) {
+    accumulator[idx] += scalar * row[idx];
+  }
+}
+
+/**
+ * out[i] = in[i] * scalar
+ */
+template <size_t SIZE>
+inline void scale(const double *in, double scalar, double *out) {
+  size_t idx = 0;
+#if defined(__AVX__)
+  const __m256d scalar4 = _mm256_set1_pd(scalar);
+  for (; idx + 4 <= SIZE; idx += 4) {
+    _mm256_storeu_pd(out + idx, _mm256_mul_pd(_mm256_loadu_pd(in + idx), scalar4));
+  }
+#endif
+#if defined(__SSE2__)
+  const __m128d scalar2 = _mm_set1_pd(scalar);
+  for (; idx + 2 <= SIZE; idx += 2) {
+    _mm_storeu_pd(out + idx, _mm_mul_pd(_mm_loadu_pd(in + idx), scalar2));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const float64x2_t scalar2 = vdupq_n_f64(scalar);
+  for (; idx + 2 <= SIZE; idx += 2) {
+    vst1q_f64(out + idx, vmulq_f64(vld1q_f64(in + idx), scalar2));
+  }
+#endif
+  for (; idx < SIZE; idx++) {
+    out[idx] = in[idx] * scalar;
+  }
+}
+
+/**
+ * out[i] = left[i] + right[i]
+ */
+template <size_t SIZE>
+inline void add(const double *left, const double *right, double *out) {
+  size_t idx = 0;
+#if defined(__AVX__)
+  for (; idx + 4 <= SIZE; idx += 4) {
+    _mm256_storeu_pd(out + idx,
+                     _mm256_add_pd(_mm256_loadu_pd(left + idx), _mm256_loadu_pd(right + idx)));
+  }
+#endif
+#if defined(__SSE2__)
+  for (; idx + 2 <= SIZE; idx += 2) {
+    _mm_storeu_pd(out + idx, _mm_add_pd(_mm_loadu_pd(left + idx), _mm_loadu_pd(right + idx)));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; idx + 2 <= SIZE; idx += 2) {
+    vst1q_f64(out + idx, vaddq_f64(vld1q_f64(left + idx), vld1q_f64(right + idx)));
+  }
+#endif
+  for (; idx < SIZE; idx++) {
+    out[idx] = left[idx] + right[idx];
+  }
+}
+
+/**
+ * out[i] = left[i] - right[i]
+ */
+template <size_t SIZE>
+inline void subtract(const double *left, const double *right, double *out) {
+  size_t idx = 0;
+#if defined(__AVX__)
+  for (; idx + 4 <= SIZE; idx += 4) {
+    _mm256_storeu_pd(out + idx,
+                     _mm256_sub_pd(_mm256_loadu_pd(left + idx), _mm256_loadu_pd(right + idx)));
+  }
+#endif
+#if defined(__SSE2__)
+  for (; idx + 2 <= SIZE; idx += 2) {
+    _mm_storeu_pd(out + idx, _mm_sub_pd(_mm_loadu_pd(left + idx), _mm_loadu_pd(right + idx)));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; idx + 2 <= SIZE; idx += 2) {
+    vst1q_f64(out + idx, vsubq_f64(vld1q_f64(left + idx), vld1q_f64(right + idx)));
+  }
+#endif
+  for (; idx < SIZE; idx++) {
+    out[idx] = left[idx] - right[idx];
+  }
+}
+
+}  // namespace simdkernels
+
+#endif /* FSFW_GLOBALFUNCTIONS_MATH_SIMDKERNELS_H_ */
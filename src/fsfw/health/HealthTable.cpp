@@ -20,6 +20,7 @@ HealthTable::~HealthTable() { MutexFactory::instance()->deleteMutex(mutex); }
 
 ReturnValue_t HealthTable::registerObject(object_id_t object,
                                           HasHealthIF::HealthState initilialState) {
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   if (healthMap.count(object) != 0) {
     return HasReturnvaluesIF::RETURN_FAILED;
   }
@@ -28,6 +29,7 @@ ReturnValue_t HealthTable::registerObject(object_id_t object,
 }
 
 ReturnValue_t HealthTable::removeObject(object_id_t object) {
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   mapIterator = healthMap.find(object);
   if (mapIterator == healthMap.end()) {
     return HasReturnvaluesIF::RETURN_FAILED;
@@ -37,7 +39,7 @@ ReturnValue_t HealthTable::removeObject(object_id_t object) {
 }
 
 void HealthTable::setHealth(object_id_t object, HasHealthIF::HealthState newState) {
-  MutexGuard(mutex, timeoutType, mutexTimeoutMs);
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   HealthMap::iterator iter = healthMap.find(object);
   if (iter != healthMap.end()) {
     iter->second = newState;
@@ -46,7 +48,7 @@ void HealthTable::setHealth(object_id_t object, HasHealthIF::HealthState newStat
 
 HasHealthIF::HealthState HealthTable::getHealth(object_id_t object) {
   HasHealthIF::HealthState state = HasHealthIF::HEALTHY;
-  MutexGuard(mutex, timeoutType, mutexTimeoutMs);
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   HealthMap::iterator iter = healthMap.find(object);
   if (iter != healthMap.end()) {
     state = iter->second;
@@ -55,7 +57,7 @@ HasHealthIF::HealthState HealthTable::getHealth(object_id_t object) {
 }
 
 bool HealthTable::hasHealth(object_id_t object) {
-  MutexGuard(mutex, timeoutType, mutexTimeoutMs);
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   HealthMap::iterator iter = healthMap.find(object);
   if (iter != healthMap.end()) {
     return true;
@@ -64,14 +66,14 @@ bool HealthTable::hasHealth(object_id_t object) {
 }
 
 size_t HealthTable::getPrintSize() {
-  MutexGuard(mutex, timeoutType, mutexTimeoutMs);
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   uint32_t size =
       healthMap.size() * sizeof(object_id_t) + sizeof(HasHealthIF::HealthState) + sizeof(uint16_t);
   return size;
 }
 
 void HealthTable::printAll(uint8_t* pointer, size_t maxSize) {
-  MutexGuard(mutex, timeoutType, mutexTimeoutMs);
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   size_t size = 0;
   uint16_t count = healthMap.size();
   ReturnValue_t result =
@@ -103,7 +105,7 @@ void HealthTable::printAll(uint8_t* pointer, size_t maxSize) {
 
 ReturnValue_t HealthTable::iterate(HealthEntry* value, bool reset) {
   ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
-  MutexGuard(mutex, timeoutType, mutexTimeoutMs);
+  MutexGuard mg(mutex, timeoutType, mutexTimeoutMs);
   if (reset) {
     mapIterator = healthMap.begin();
   }
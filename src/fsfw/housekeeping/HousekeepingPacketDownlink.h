@@ -2,7 +2,7 @@
 #define FSFW_HOUSEKEEPING_HOUSEKEEPINGPACKETDOWNLINK_H_
 
 #include "../datapoollocal/LocalPoolDataSetBase.h"
-#include "../serialize/SerialLinkedListAdapter.h"
+#include "../serialize/SerialStruct.h"
 #include "../storagemanager/StorageManagerIF.h"
 
 /**
@@ -16,23 +16,30 @@
  *  - Housekeeping Data: The rest of the packet will be the serialized housekeeping data. A validity
  *    buffer might be appended at the end, depending on the set configuration.
  */
-class HousekeepingPacketDownlink : public SerialLinkedListAdapter<SerializeIF> {
+class HousekeepingPacketDownlink : public SerializeIF {
  public:
   HousekeepingPacketDownlink(sid_t sid, LocalPoolDataSetBase* dataSetPtr)
-      : sourceId(sid.objectId), setId(sid.ownerSetId), hkData(dataSetPtr) {
-    setLinks();
+      : sourceId(sid.objectId), setId(sid.ownerSetId), hkData(dataSetPtr) {}
+
+  ReturnValue_t serialize(uint8_t** buffer, size_t* size, size_t maxSize,
+                          Endianness streamEndianness) const override {
+    return serial::serializeFields(buffer, size, maxSize, streamEndianness, sourceId, setId,
+                                   *hkData);
   }
 
- private:
-  void setLinks() {
-    setStart(&sourceId);
-    sourceId.setNext(&setId);
-    setId.setNext(&hkData);
+  size_t getSerializedSize() const override {
+    return serial::serializedSize(sourceId, setId, *hkData);
   }
 
-  SerializeElement<object_id_t> sourceId;
-  SerializeElement<uint32_t> setId;
-  LinkedElement<SerializeIF> hkData;
+  ReturnValue_t deSerialize(const uint8_t** buffer, size_t* size,
+                            Endianness streamEndianness) override {
+    return serial::deSerializeFields(buffer, size, streamEndianness, sourceId, setId, *hkData);
+  }
+
+ private:
+  object_id_t sourceId;
+  uint32_t setId;
+  LocalPoolDataSetBase* hkData;
 };
 
 #endif /* FRAMEWORK_HOUSEKEEPING_HOUSEKEEPINGPACKETDOWNLINK_H_ */
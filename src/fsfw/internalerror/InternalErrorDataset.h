@@ -2,13 +2,24 @@
 #define FSFW_INTERNALERROR_INTERNALERRORDATASET_H_
 
 #include <fsfw/datapoollocal/LocalPoolVariable.h>
+#include <fsfw/datapoollocal/LocalPoolVector.h>
 #include <fsfw/datapoollocal/StaticLocalDataSet.h>
 
-enum errorPoolIds { TM_HITS, QUEUE_HITS, STORE_HITS };
+enum errorPoolIds {
+  TM_HITS,
+  QUEUE_HITS,
+  STORE_HITS,
+  QUEUE_HIT_IDS,
+  QUEUE_HIT_COUNTS,
+  STORE_HIT_IDS,
+  STORE_HIT_COUNTS
+};
 
-class InternalErrorDataset : public StaticLocalDataSet<3 * sizeof(uint32_t)> {
+class InternalErrorDataset : public StaticLocalDataSet<7> {
  public:
   static constexpr uint8_t ERROR_SET_ID = 0;
+  //! Number of queues and stores which are tracked individually
+  static constexpr uint8_t BREAKDOWN_ENTRIES = 8;
 
   InternalErrorDataset(HasLocalDataPoolIF* owner) : StaticLocalDataSet(owner, ERROR_SET_ID) {}
 
@@ -17,6 +28,18 @@ class InternalErrorDataset : public StaticLocalDataSet<3 * sizeof(uint32_t)> {
   lp_var_t<uint32_t> tmHits = lp_var_t<uint32_t>(sid.objectId, TM_HITS, this);
   lp_var_t<uint32_t> queueHits = lp_var_t<uint32_t>(sid.objectId, QUEUE_HITS, this);
   lp_var_t<uint32_t> storeHits = lp_var_t<uint32_t>(sid.objectId, STORE_HITS, this);
+  //! Destination queues of failed messages in the order of their first failure
+  lp_vec_t<uint32_t, BREAKDOWN_ENTRIES> queueHitIds =
+      lp_vec_t<uint32_t, BREAKDOWN_ENTRIES>(sid.objectId, QUEUE_HIT_IDS, this);
+  //! Failed messages for each entry of queueHitIds
+  lp_vec_t<uint32_t, BREAKDOWN_ENTRIES> queueHitCounts =
+      lp_vec_t<uint32_t, BREAKDOWN_ENTRIES>(sid.objectId, QUEUE_HIT_COUNTS, this);
+  //! Object IDs of full stores in the order of their first failure
+  lp_vec_t<uint32_t, BREAKDOWN_ENTRIES> storeHitIds =
+      lp_vec_t<uint32_t, BREAKDOWN_ENTRIES>(sid.objectId, STORE_HIT_IDS, this);
+  //! Failed store requests for each entry of storeHitIds
+  lp_vec_t<uint32_t, BREAKDOWN_ENTRIES> storeHitCounts =
+      lp_vec_t<uint32_t, BREAKDOWN_ENTRIES>(sid.objectId, STORE_HIT_COUNTS, this);
 };
 
 #endif /* FSFW_INTERNALERROR_INTERNALERRORDATASET_H_ */
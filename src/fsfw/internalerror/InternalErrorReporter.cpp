@@ -3,6 +3,7 @@
 #include "fsfw/datapool/PoolReadGuard.h"
 #include "fsfw/ipc/MutexFactory.h"
 #include "fsfw/ipc/QueueFactory.h"
+#include "fsfw/objectmanager/frameworkObjects.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 
 InternalErrorReporter::InternalErrorReporter(object_id_t setObjectId, uint32_t messageQueueDepth)
@@ -10,7 +11,9 @@ InternalErrorReporter::InternalErrorReporter(object_id_t setObjectId, uint32_t m
       commandQueue(QueueFactory::instance()->createMessageQueue(messageQueueDepth)),
       poolManager(this, commandQueue),
       internalErrorSid(setObjectId, InternalErrorDataset::ERROR_SET_ID),
-      internalErrorDataset(this) {
+      internalErrorDataset(this),
+      queueCounters(MessageQueueIF::NO_QUEUE),
+      storeCounters(objects::NO_OBJECT) {
   mutex = MutexFactory::instance()->createMutex();
 }
 
@@ -56,8 +59,14 @@ ReturnValue_t InternalErrorReporter::performOperation(uint8_t opCode) {
       internalErrorDataset.queueHits.value += newQueueHits;
       internalErrorDataset.storeHits.value += newStoreHits;
       internalErrorDataset.tmHits.value += newTmHits;
+      bool breakdownChanged = queueCounters.collect(internalErrorDataset.queueHitIds.value,
+                                                    internalErrorDataset.queueHitCounts.value);
+      if (storeCounters.collect(internalErrorDataset.storeHitIds.value,
+                                internalErrorDataset.storeHitCounts.value)) {
+        breakdownChanged = true;
+      }
       internalErrorDataset.setValidity(true, true);
-      if ((newQueueHits != 0) or (newStoreHits != 0) or (newTmHits != 0)) {
+      if ((newQueueHits != 0) or (newStoreHits != 0) or (newTmHits != 0) or breakdownChanged) {
         internalErrorDataset.setChanged(true);
       }
     }
@@ -69,53 +78,83 @@ ReturnValue_t InternalErrorReporter::performOperation(uint8_t opCode) {
 
 void InternalErrorReporter::queueMessageNotSent() { incrementQueueHits(); }
 
+void InternalErrorReporter::queueMessageNotSentTo(MessageQueueId_t destination) {
+  incrementQueueHits();
+  queueCounters.increment(destination);
+}
+
 void InternalErrorReporter::lostTm() { incrementTmHits(); }
 
 uint32_t InternalErrorReporter::getAndResetQueueHits() {
-  uint32_t value;
-  mutex->lockMutex(timeoutType, timeoutMs);
-  value = queueHits;
-  queueHits = 0;
-  mutex->unlockMutex();
-  return value;
+  return queueHits.exchange(0, std::memory_order_relaxed);
 }
 
 void InternalErrorReporter::incrementQueueHits() {
-  mutex->lockMutex(timeoutType, timeoutMs);
-  queueHits++;
-  mutex->unlockMutex();
+  queueHits.fetch_add(1, std::memory_order_relaxed);
 }
 
 uint32_t InternalErrorReporter::getAndResetTmHits() {
-  uint32_t value;
-  mutex->lockMutex(timeoutType, timeoutMs);
-  value = tmHits;
-  tmHits = 0;
-  mutex->unlockMutex();
-  return value;
+  return tmHits.exchange(0, std::memory_order_relaxed);
 }
 
-void InternalErrorReporter::incrementTmHits() {
-  mutex->lockMutex(timeoutType, timeoutMs);
-  tmHits++;
-  mutex->unlockMutex();
-}
+void InternalErrorReporter::incrementTmHits() { tmHits.fetch_add(1, std::memory_order_relaxed); }
 
 void InternalErrorReporter::storeFull() { incrementStoreHits(); }
 
+void InternalErrorReporter::storeFullWithId(object_id_t storeId) {
+  incrementStoreHits();
+  storeCounters.increment(storeId);
+}
+
 uint32_t InternalErrorReporter::getAndResetStoreHits() {
-  uint32_t value;
-  mutex->lockMutex(timeoutType, timeoutMs);
-  value = storeHits;
-  storeHits = 0;
-  mutex->unlockMutex();
-  return value;
+  return storeHits.exchange(0, std::memory_order_relaxed);
 }
 
 void InternalErrorReporter::incrementStoreHits() {
-  mutex->lockMutex(timeoutType, timeoutMs);
-  storeHits++;
-  mutex->unlockMutex();
+  storeHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+InternalErrorReporter::SourceCounters::SourceCounters(uint32_t invalidSource)
+    : invalidSource(invalidSource) {
+  for (auto& source : sources) {
+    source.store(invalidSource, std::memory_order_relaxed);
+  }
+}
+
+void InternalErrorReporter::SourceCounters::increment(uint32_t source) {
+  if (source == invalidSource) {
+    return;
+  }
+  for (size_t idx = 0; idx < sources.size(); idx++) {
+    uint32_t current = sources[idx].load(std::memory_order_acquire);
+    if (current == invalidSource) {
+      // Claim the entry. If another thread was faster, current is updated to its source.
+      if (sources[idx].compare_exchange_strong(current, source, std::memory_order_acq_rel)) {
+        current = source;
+      }
+    }
+    if (current == source) {
+      hits[idx].fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+}
+
+bool InternalErrorReporter::SourceCounters::collect(uint32_t* ids, uint32_t* counts) {
+  bool changed = false;
+  for (size_t idx = 0; idx < sources.size(); idx++) {
+    uint32_t source = sources[idx].load(std::memory_order_acquire);
+    if (source == invalidSource) {
+      break;
+    }
+    uint32_t newHits = hits[idx].exchange(0, std::memory_order_relaxed);
+    ids[idx] = source;
+    if (newHits > 0) {
+      counts[idx] += newHits;
+      changed = true;
+    }
+  }
+  return changed;
 }
 
 object_id_t InternalErrorReporter::getObjectId() const { return SystemObject::getObjectId(); }
@@ -129,6 +168,14 @@ ReturnValue_t InternalErrorReporter::initializeLocalDataPool(localpool::DataPool
   localDataPoolMap.emplace(errorPoolIds::TM_HITS, new PoolEntry<uint32_t>());
   localDataPoolMap.emplace(errorPoolIds::QUEUE_HITS, new PoolEntry<uint32_t>());
   localDataPoolMap.emplace(errorPoolIds::STORE_HITS, new PoolEntry<uint32_t>());
+  localDataPoolMap.emplace(errorPoolIds::QUEUE_HIT_IDS,
+                           new PoolEntry<uint32_t>(InternalErrorDataset::BREAKDOWN_ENTRIES));
+  localDataPoolMap.emplace(errorPoolIds::QUEUE_HIT_COUNTS,
+                           new PoolEntry<uint32_t>(InternalErrorDataset::BREAKDOWN_ENTRIES));
+  localDataPoolMap.emplace(errorPoolIds::STORE_HIT_IDS,
+                           new PoolEntry<uint32_t>(InternalErrorDataset::BREAKDOWN_ENTRIES));
+  localDataPoolMap.emplace(errorPoolIds::STORE_HIT_COUNTS,
+                           new PoolEntry<uint32_t>(InternalErrorDataset::BREAKDOWN_ENTRIES));
   poolManager.subscribeForPeriodicPacket(internalErrorSid, false, getPeriodicOperationFrequency(),
                                          true);
   internalErrorDataset.setValidity(true, true);
@@ -1,6 +1,9 @@
 #ifndef FSFW_INTERNALERROR_INTERNALERRORREPORTER_H_
 #define FSFW_INTERNALERROR_INTERNALERRORREPORTER_H_
 
+#include <array>
+#include <atomic>
+
 #include "InternalErrorReporterIF.h"
 #include "fsfw/datapoollocal/LocalDataPoolManager.h"
 #include "fsfw/internalerror/InternalErrorDataset.h"
@@ -15,6 +18,12 @@
  * @details
  * All functions were kept virtual so this class can be extended easily
  * to store custom internal errors (e.g. communication interface errors).
+ *
+ * The error counters are lock-free atomic counters, because errors are typically reported
+ * when the system is already overloaded. They are collected in #performOperation.
+ * Queue and store errors are additionally counted for the first
+ * InternalErrorDataset::BREAKDOWN_ENTRIES destination queues and stores which reported
+ * an error.
  */
 class InternalErrorReporter : public SystemObject,
                               public ExecutableObjectIF,
@@ -30,6 +39,10 @@ class InternalErrorReporter : public SystemObject,
    */
   void setDiagnosticPrintout(bool enable);
 
+  /**
+   * Set the timeout of the mutex which can be used by derived classes. The error counters of
+   * this class do not use the mutex.
+   */
   void setMutexTimeout(MutexIF::TimeoutType timeoutType, uint32_t timeoutMs);
 
   virtual ~InternalErrorReporter();
@@ -47,14 +60,43 @@ class InternalErrorReporter : public SystemObject,
   virtual ReturnValue_t performOperation(uint8_t opCode) override;
 
   virtual void queueMessageNotSent() override;
+  virtual void queueMessageNotSentTo(MessageQueueId_t destination) override;
 
   virtual void lostTm() override;
 
   virtual void storeFull() override;
+  virtual void storeFullWithId(object_id_t storeId) override;
 
   virtual void setTaskIF(PeriodicTaskIF* task) override;
 
  protected:
+  /**
+   * Lock-free error counters for individual queues or stores. An entry is claimed on the first
+   * error of a source and is never released, so the entry indexes are stable. Errors of
+   * additional sources are only counted in the totals.
+   */
+  class SourceCounters {
+   public:
+    /**
+     * @param invalidSource   Source ID which marks unused entries, for example NO_QUEUE.
+     *                        Errors of this source are only counted in the totals.
+     */
+    explicit SourceCounters(uint32_t invalidSource);
+    void increment(uint32_t source);
+    /**
+     * Adds the errors since the last call to the passed counters and sets the IDs of
+     * the used entries.
+     * @return True if any errors were added
+     */
+    bool collect(uint32_t* ids, uint32_t* counts);
+
+   private:
+    uint32_t invalidSource;
+    //! Source IDs, invalidSource for unused entries
+    std::array<std::atomic<uint32_t>, InternalErrorDataset::BREAKDOWN_ENTRIES> sources;
+    std::array<std::atomic<uint32_t>, InternalErrorDataset::BREAKDOWN_ENTRIES> hits{};
+  };
+
   MessageQueueIF* commandQueue;
   LocalDataPoolManager poolManager;
 
@@ -69,9 +111,11 @@ class InternalErrorReporter : public SystemObject,
 
   bool diagnosticPrintout = true;
 
-  uint32_t queueHits = 0;
-  uint32_t tmHits = 0;
-  uint32_t storeHits = 0;
+  std::atomic<uint32_t> queueHits{0};
+  std::atomic<uint32_t> tmHits{0};
+  std::atomic<uint32_t> storeHits{0};
+  SourceCounters queueCounters;
+  SourceCounters storeCounters;
 
   uint32_t getAndResetQueueHits();
   void incrementQueueHits();
@@ -1,6 +1,9 @@
 #ifndef INTERNALERRORREPORTERIF_H_
 #define INTERNALERRORREPORTERIF_H_
 
+#include "fsfw/ipc/messageQueueDefinitions.h"
+#include "fsfw/objectmanager/SystemObjectIF.h"
+
 /**
  * @brief   Interface which is used to report internal errors like full message queues or stores.
  * @details
@@ -21,6 +24,11 @@ class InternalErrorReporterIF {
    *  Implementations are required to be Thread safe
    */
   virtual void queueMessageNotSent() = 0;
+  /**
+   * @brief Same as #queueMessageNotSent, but also reports the destination queue
+   * @details The default implementation only reports the error without the destination.
+   */
+  virtual void queueMessageNotSentTo(MessageQueueId_t destination) { queueMessageNotSent(); }
   /**
    * @brief Function to be called if Telemetry could not be sent
    * @details Implementations must be Thread safe
@@ -31,6 +39,11 @@ class InternalErrorReporterIF {
    * @details Implementations must be Thread safe
    */
   virtual void storeFull() = 0;
+  /**
+   * @brief Same as #storeFull, but also reports the object ID of the store
+   * @details The default implementation only reports the error without the store.
+   */
+  virtual void storeFullWithId(object_id_t storeId) { storeFull(); }
 };
 
 #endif /* INTERNALERRORREPORTERIF_H_ */
@@ -51,6 +51,10 @@ void CommandMessageCleaner::clearCommandMessage(CommandMessage* message) {
     case messagetypes::FILE_SYSTEM_MESSAGE:
       GenericFileSystemMessage::clear(message);
       break;
+    case messagetypes::GPIO:
+      // GPIO messages do not contain store data
+      message->setCommand(CommandMessage::CMD_NONE);
+      break;
     default:
       messagetypes::clearMissionMessage(message);
       break;
@@ -17,6 +17,7 @@ enum FsfwMessageTypes {
   PARAMETER,
   FILE_SYSTEM_MESSAGE,
   HOUSEKEEPING,
+  GPIO,
 
   FW_MESSAGES_COUNT,
 };
@@ -52,3 +52,50 @@ ReturnValue_t MessageQueueBase::sendToDefaultFrom(MessageQueueMessageIF* message
                                                   MessageQueueId_t sentFrom, bool ignoreFault) {
   return sendMessageFrom(defaultDest, message, sentFrom, ignoreFault);
 }
+
+ReturnValue_t MessageQueueBase::sendMessages(MessageQueueId_t sendTo,
+                                             MessageQueueMessageIF* const* messages, size_t count,
+                                             size_t* sent, bool ignoreFault) {
+  return sendMessagesFrom(sendTo, messages, count, this->getId(), sent, ignoreFault);
+}
+
+ReturnValue_t MessageQueueBase::receiveMessages(MessageQueueMessageIF* const* messages,
+                                                size_t maxMessages, size_t* received) {
+  if (messages == nullptr or received == nullptr) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  *received = 0;
+  ReturnValue_t result = MessageQueueIF::EMPTY;
+  while (*received < maxMessages) {
+    result = this->receiveMessage(messages[*received]);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      break;
+    }
+    (*received)++;
+  }
+  if (*received > 0) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  return result;
+}
+
+ReturnValue_t MessageQueueBase::sendMessagesFrom(MessageQueueId_t sendTo,
+                                                 MessageQueueMessageIF* const* messages,
+                                                 size_t count, MessageQueueId_t sentFrom,
+                                                 size_t* sent, bool ignoreFault) {
+  size_t sentMessages = 0;
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+  if (messages == nullptr and count > 0) {
+    result = HasReturnvaluesIF::RETURN_FAILED;
+  }
+  while (result == HasReturnvaluesIF::RETURN_OK and sentMessages < count) {
+    result = sendMessageFrom(sendTo, messages[sentMessages], sentFrom, ignoreFault);
+    if (result == HasReturnvaluesIF::RETURN_OK) {
+      sentMessages++;
+    }
+  }
+  if (sent != nullptr) {
+    *sent = sentMessages;
+  }
+  return result;
+}
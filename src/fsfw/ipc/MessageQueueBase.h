@@ -24,6 +24,18 @@ class MessageQueueBase : public MessageQueueIF {
                                        MessageQueueId_t* receivedFrom) override;
   virtual ReturnValue_t sendToDefaultFrom(MessageQueueMessageIF* message, MessageQueueId_t sentFrom,
                                           bool ignoreFault = false) override;
+  virtual ReturnValue_t sendMessages(MessageQueueId_t sendTo,
+                                     MessageQueueMessageIF* const* messages, size_t count,
+                                     size_t* sent, bool ignoreFault = false) override;
+
+  // Generic implementations which call the single message functions. OSALs which can transfer
+  // several messages at once override these.
+  virtual ReturnValue_t receiveMessages(MessageQueueMessageIF* const* messages,
+                                        size_t maxMessages, size_t* received) override;
+  virtual ReturnValue_t sendMessagesFrom(MessageQueueId_t sendTo,
+                                         MessageQueueMessageIF* const* messages, size_t count,
+                                         MessageQueueId_t sentFrom, size_t* sent,
+                                         bool ignoreFault = false) override;
 
   // OSAL specific, forward the abstract function
   virtual ReturnValue_t receiveMessage(MessageQueueMessageIF* message) = 0;
@@ -73,6 +73,23 @@ class MessageQueueIF {
    *         -@c MessageQueueIF::EMPTY if queue is empty
    */
   virtual ReturnValue_t receiveMessage(MessageQueueMessageIF* message) = 0;
+  /**
+   * @brief   Reads up to maxMessages messages from the message queue in one call.
+   * @details
+   * Works like #receiveMessage for each message, but implementations can receive all messages
+   * with one lock or ring access. Receiving stops when the queue is empty, when maxMessages
+   * were received or at the first message which could not be received. The last partner is set
+   * to the sender of the last received message.
+   * @param messages      Array of maxMessages pointers to the messages in which the received
+   *                      data is stored
+   * @param maxMessages   Maximum number of messages to receive
+   * @param received      Number of received messages
+   * @return -@c RETURN_OK if at least one message was received
+   *         -@c MessageQueueIF::EMPTY if queue is empty
+   *         - Error code of the first failed receive operation otherwise
+   */
+  virtual ReturnValue_t receiveMessages(MessageQueueMessageIF* const* messages,
+                                        size_t maxMessages, size_t* received) = 0;
   /**
    * Deletes all pending messages in the queue.
    * @param count The number of flushed messages.
@@ -127,6 +144,37 @@ class MessageQueueIF {
   virtual ReturnValue_t sendMessage(MessageQueueId_t sendTo, MessageQueueMessageIF* message,
                                     bool ignoreFault = false) = 0;
 
+  /**
+   * @brief   Sends several messages to the same destination in one call.
+   * @details
+   * Works like #sendMessageFrom for each message, but implementations can send all messages
+   * with one lock or ring reservation. The messages are sent in order. Sending stops at the
+   * first message which could not be sent, so the destination never receives the messages out
+   * of order.
+   * @param sendTo        Message queue ID of the destination
+   * @param messages      Array of count pointers to the messages which are sent
+   * @param count         Number of messages
+   * @param sentFrom      Sender queue ID which is injected into all messages
+   * @param sent          Number of sent messages. May be nullptr.
+   * @param ignoreFault   If set to true, the internal software fault counter is not
+   *                      incremented if the queue is full.
+   * @return -@c RETURN_OK if all messages were sent
+   *         -@c MessageQueueIF::FULL if the queue was full before all messages were sent
+   *         - Error code of the first failed send operation otherwise
+   */
+  virtual ReturnValue_t sendMessagesFrom(MessageQueueId_t sendTo,
+                                         MessageQueueMessageIF* const* messages, size_t count,
+                                         MessageQueueId_t sentFrom, size_t* sent,
+                                         bool ignoreFault = false) = 0;
+
+  /**
+   * @brief   Sends several messages to the same destination with the ID of this queue as the
+   *          sender. See #sendMessagesFrom.
+   */
+  virtual ReturnValue_t sendMessages(MessageQueueId_t sendTo,
+                                     MessageQueueMessageIF* const* messages, size_t count,
+                                     size_t* sent, bool ignoreFault = false) = 0;
+
   /**
    * @brief	The sendToDefaultFrom method sends a queue message to the default destination.
    * @details
@@ -1,13 +1,249 @@
 #include "fsfw/objectmanager/ObjectManager.h"
 
+#include "fsfw/FSFW.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
+#include "fsfw/timemanager/Clock.h"
 
 #if FSFW_CPP_OSTREAM_ENABLED == 1
 #include <iomanip>
 #endif
+#include <algorithm>
 #include <cstdlib>
+#include <limits>
+#include <set>
+
+// Threads are only available on hosted OSALs
+#if defined(FSFW_OSAL_HOST) || defined(FSFW_OSAL_LINUX)
+#define FSFW_OBJ_MANAGER_INIT_THREADS 1
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#else
+#define FSFW_OBJ_MANAGER_INIT_THREADS 0
+#endif
 
 ObjectManager* ObjectManager::objManagerInstance = nullptr;
+std::atomic<size_t> ObjectManager::nextCastCacheSlot{0};
+
+namespace {
+// Only the address is used
+char unresolvedCastMarker = 0;
+
+constexpr size_t NO_INDEX = std::numeric_limits<size_t>::max();
+
+#if FSFW_OBJ_MANAGER_INIT_THREADS == 1
+//! Initialization thread of the calling thread, NO_INDEX outside of the initialization
+thread_local size_t currentInitThread = NO_INDEX;
+#endif
+
+uint32_t getDurationUs(uint64_t start) {
+  uint64_t end = 0;
+  Clock::getClock_usecs(&end);
+  return end > start ? end - start : 0;
+}
+}  // namespace
+
+/**
+ * Dependency graph of the objects. The objects are stored in the order of the object list and
+ * are initialized once all their dependencies are initialized, preferring lower object IDs.
+ */
+struct ObjectManager::InitScheduler {
+  enum class State : uint8_t { PENDING, RUNNING, DONE };
+
+  struct Node {
+    SystemObjectIF* object = nullptr;
+    State state = State::PENDING;
+    size_t missingDependencies = 0;
+    std::vector<size_t> dependents;
+    //! Initialization thread which runs the initialization of the object
+    size_t thread = NO_INDEX;
+  };
+
+  ObjectManager& manager;
+  std::vector<Node> nodes;
+  std::vector<ReturnValue_t> results;
+  std::set<size_t> ready;
+  size_t finished = 0;
+  size_t running = 0;
+  bool cycleReported = false;
+
+#if FSFW_OBJ_MANAGER_INIT_THREADS == 1
+  std::mutex lock;
+  std::condition_variable changed;
+  //! Node for which each initialization thread waits in a lookup
+  std::vector<size_t> waitingFor;
+#endif
+
+  explicit InitScheduler(ObjectManager& manager) : manager(manager) {
+    nodes.reserve(manager.objectList.size());
+    for (auto const& it : manager.objectList) {
+      nodes.emplace_back();
+      nodes.back().object = it.second;
+    }
+    results.assign(nodes.size(), static_cast<ReturnValue_t>(RETURN_OK));
+    for (auto const& dependency : manager.initDependencies) {
+      size_t objectIndex = findIndex(dependency.first);
+      size_t dependencyIndex = findIndex(dependency.second);
+      if (objectIndex == NO_INDEX or dependencyIndex == NO_INDEX or
+          objectIndex == dependencyIndex) {
+        continue;
+      }
+      nodes[dependencyIndex].dependents.push_back(objectIndex);
+      nodes[objectIndex].missingDependencies++;
+    }
+    for (size_t idx = 0; idx < nodes.size(); idx++) {
+      if (nodes[idx].missingDependencies == 0) {
+        ready.insert(idx);
+      }
+    }
+  }
+
+  size_t findIndex(object_id_t id) const {
+    auto& durations = manager.initDurations;
+    auto iter = std::lower_bound(
+        durations.begin(), durations.end(), id,
+        [](const InitDuration& duration, object_id_t id) { return duration.objectId < id; });
+    if (iter == durations.end() or iter->objectId != id) {
+      return NO_INDEX;
+    }
+    return iter - durations.begin();
+  }
+
+  /**
+   * Returns the next object which can be initialized, or NO_INDEX if the remaining objects
+   * wait for running initializations.
+   */
+  size_t takeNext() {
+    if (not ready.empty()) {
+      size_t next = *ready.begin();
+      ready.erase(ready.begin());
+      return next;
+    }
+    if (finished == nodes.size() or running > 0) {
+      return NO_INDEX;
+    }
+    // Only cyclic dependencies are left, so they are broken in the order of the object IDs
+    for (size_t idx = 0; idx < nodes.size(); idx++) {
+      if (nodes[idx].state == State::PENDING) {
+        if (not cycleReported) {
+          cycleReported = true;
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+          sif::warning << "ObjectManager::initialize: Cyclic initialization dependencies, "
+                          "continuing with object 0x"
+                       << std::hex << manager.initDurations[idx].objectId << std::dec
+                       << std::endl;
+#else
+          sif::printWarning(
+              "ObjectManager::initialize: Cyclic initialization dependencies, continuing with "
+              "object 0x%08x\n",
+              static_cast<unsigned int>(manager.initDurations[idx].objectId));
+#endif
+        }
+        return idx;
+      }
+    }
+    return NO_INDEX;
+  }
+
+  void initializeNode(size_t idx) {
+    uint64_t start = 0;
+    Clock::getClock_usecs(&start);
+    results[idx] = nodes[idx].object->initialize();
+    manager.initDurations[idx].initializeUs = getDurationUs(start);
+  }
+
+  void start(size_t idx, size_t thread) {
+    nodes[idx].state = State::RUNNING;
+    nodes[idx].thread = thread;
+    running++;
+  }
+
+  void complete(size_t idx) {
+    nodes[idx].state = State::DONE;
+    running--;
+    finished++;
+    for (size_t dependent : nodes[idx].dependents) {
+      Node& node = nodes[dependent];
+      node.missingDependencies--;
+      if (node.missingDependencies == 0 and node.state == State::PENDING) {
+        ready.insert(dependent);
+      }
+    }
+  }
+
+#if FSFW_OBJ_MANAGER_INIT_THREADS == 1
+  void work(size_t thread) {
+    currentInitThread = thread;
+    std::unique_lock<std::mutex> guard(lock);
+    while (finished < nodes.size()) {
+      size_t next = takeNext();
+      if (next == NO_INDEX) {
+        changed.wait(guard);
+        continue;
+      }
+      run(next, guard);
+    }
+    currentInitThread = NO_INDEX;
+  }
+
+  void run(size_t idx, std::unique_lock<std::mutex>& guard) {
+    start(idx, currentInitThread);
+    guard.unlock();
+    initializeNode(idx);
+    guard.lock();
+    complete(idx);
+    changed.notify_all();
+  }
+
+  /**
+   * Called for lookups during the initialization. Makes sure that the looked up object is
+   * initialized before the lookup returns, unless this would deadlock.
+   */
+  void awaitInitialization(object_id_t id) {
+    if (currentInitThread == NO_INDEX) {
+      return;
+    }
+    std::unique_lock<std::mutex> guard(lock);
+    size_t idx = findIndex(id);
+    if (idx == NO_INDEX) {
+      return;
+    }
+    if (nodes[idx].state == State::PENDING) {
+      // Declared dependencies take precedence over the order of lookups
+      if (nodes[idx].missingDependencies == 0) {
+        ready.erase(idx);
+        run(idx, guard);
+      }
+      return;
+    }
+    waitingFor[currentInitThread] = idx;
+    while (nodes[idx].state != State::DONE and not wouldDeadlock(idx)) {
+      changed.wait(guard);
+    }
+    waitingFor[currentInitThread] = NO_INDEX;
+  }
+
+  //! Follows the chain of threads waiting for each other, starting at the given node
+  bool wouldDeadlock(size_t idx) const {
+    for (size_t step = 0; step <= waitingFor.size(); step++) {
+      if (nodes[idx].state != State::RUNNING) {
+        return false;
+      }
+      size_t thread = nodes[idx].thread;
+      if (thread == currentInitThread) {
+        return true;
+      }
+      idx = waitingFor[thread];
+      if (idx == NO_INDEX) {
+        return false;
+      }
+    }
+    return true;
+  }
+#endif
+};
+
+void* const ObjectManager::UNRESOLVED_CAST = &unresolvedCastMarker;
 
 ObjectManager* ObjectManager::instance() {
   if (objManagerInstance == nullptr) {
@@ -24,6 +260,11 @@ void ObjectManager::setObjectFactoryFunction(produce_function_t objFactoryFunc,
 ObjectManager::ObjectManager() {}
 
 ObjectManager::~ObjectManager() {
+  // Objects remove themselves when they are deleted, so the frozen list is not rebuilt for each
+  frozen = false;
+  frozenIds.clear();
+  frozenObjects.clear();
+  clearCastCaches();
   for (auto const& iter : objectList) {
     delete iter.second;
   }
@@ -32,6 +273,9 @@ ObjectManager::~ObjectManager() {
 ReturnValue_t ObjectManager::insert(object_id_t id, SystemObjectIF* object) {
   auto returnPair = objectList.emplace(id, object);
   if (returnPair.second) {
+    if (frozen) {
+      freezeObjectList();
+    }
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     // sif::debug << "ObjectManager::insert: Object " << std::hex
     //            << (int)id << std::dec << " inserted." << std::endl;
@@ -55,6 +299,9 @@ ReturnValue_t ObjectManager::insert(object_id_t id, SystemObjectIF* object) {
 ReturnValue_t ObjectManager::remove(object_id_t id) {
   if (this->getSystemObject(id) != NULL) {
     this->objectList.erase(id);
+    if (frozen) {
+      freezeObjectList();
+    }
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     // sif::debug << "ObjectManager::removeObject: Object " << std::hex
     //            << (int)id << std::dec << " removed." << std::endl;
@@ -70,6 +317,18 @@ ReturnValue_t ObjectManager::remove(object_id_t id) {
 }
 
 SystemObjectIF* ObjectManager::getSystemObject(object_id_t id) {
+  size_t index = 0;
+  if (findFrozenIndex(id, &index)) {
+    return frozenObjects[index];
+  }
+  if (frozen) {
+    return nullptr;
+  }
+#if FSFW_OBJ_MANAGER_INIT_THREADS == 1
+  if (initScheduler != nullptr) {
+    initScheduler->awaitInitialization(id);
+  }
+#endif
   auto listIter = this->objectList.find(id);
   if (listIter == this->objectList.end()) {
     return nullptr;
@@ -90,18 +349,52 @@ void ObjectManager::initialize() {
     return;
   }
   objectFactoryFunction(factoryArgs);
-  ReturnValue_t result = RETURN_FAILED;
-  uint32_t errorCount = 0;
+  // A list which was frozen by an earlier initialization is outdated now
+  frozen = false;
+  frozenIds.clear();
+  frozenObjects.clear();
+  clearCastCaches();
+  initDurations.clear();
+  initDurations.reserve(objectList.size());
   for (auto const& it : objectList) {
-    result = it.second->initialize();
-    if (result != RETURN_OK) {
+    initDurations.push_back({it.first, 0, 0});
+  }
+#if FSFW_OBJ_MANAGER_INIT_THREADS == 1
+  if (initThreads > 1) {
+    initializeObjectsInParallel();
+  } else
+#endif
+  {
+    initializeObjects();
+    checkObjectConnections();
+  }
+  freezeObjectList();
+}
+
+void ObjectManager::setInitializationThreads(uint8_t numberOfThreads) {
+  initThreads = numberOfThreads;
+}
+
+void ObjectManager::addInitDependency(object_id_t object, object_id_t dependency) {
+  initDependencies.emplace_back(object, dependency);
+}
+
+const std::vector<ObjectManager::InitDuration>& ObjectManager::getInitDurations() const {
+  return initDurations;
+}
+
+namespace {
+void printInitResults(const std::vector<ObjectManager::InitDuration>& objects,
+                      const std::vector<ReturnValue_t>& results) {
+  uint32_t errorCount = 0;
+  for (size_t idx = 0; idx < results.size(); idx++) {
+    if (results[idx] != HasReturnvaluesIF::RETURN_OK) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-      object_id_t var = it.first;
       sif::error << "ObjectManager::initialize: Object 0x" << std::hex << std::setw(8)
-                 << std::setfill('0') << var
+                 << std::setfill('0') << objects[idx].objectId
                  << " failed to "
                     "initialize with code 0x"
-                 << result << std::dec << std::setfill(' ') << std::endl;
+                 << results[idx] << std::dec << std::setfill(' ') << std::endl;
 #endif
       errorCount++;
     }
@@ -112,14 +405,17 @@ void ObjectManager::initialize() {
                << " failed initializations." << std::endl;
 #endif
   }
-  // Init was successful. Now check successful interconnections.
-  errorCount = 0;
-  for (auto const& it : objectList) {
-    result = it.second->checkObjectConnections();
-    if (result != RETURN_OK) {
+}
+
+void printConnectionCheckResults(const std::vector<ObjectManager::InitDuration>& objects,
+                                 const std::vector<ReturnValue_t>& results) {
+  uint32_t errorCount = 0;
+  for (size_t idx = 0; idx < results.size(); idx++) {
+    if (results[idx] != HasReturnvaluesIF::RETURN_OK) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-      sif::error << "ObjectManager::ObjectManager: Object 0x" << std::hex << (int)it.first
-                 << " connection check failed with code 0x" << result << std::dec << std::endl;
+      sif::error << "ObjectManager::ObjectManager: Object 0x" << std::hex
+                 << (int)objects[idx].objectId << " connection check failed with code 0x"
+                 << results[idx] << std::dec << std::endl;
 #endif
       errorCount++;
     }
@@ -131,6 +427,158 @@ void ObjectManager::initialize() {
 #endif
   }
 }
+}  // namespace
+
+void ObjectManager::initializeObjects() {
+  InitScheduler scheduler(*this);
+  for (size_t next = scheduler.takeNext(); next != NO_INDEX; next = scheduler.takeNext()) {
+    scheduler.start(next, 0);
+    scheduler.initializeNode(next);
+    scheduler.complete(next);
+  }
+  printInitResults(initDurations, scheduler.results);
+}
+
+void ObjectManager::checkObjectConnections() {
+  // Init was successful. Now check successful interconnections.
+  std::vector<ReturnValue_t> results(initDurations.size(), static_cast<ReturnValue_t>(RETURN_OK));
+  size_t idx = 0;
+  for (auto const& it : objectList) {
+    uint64_t start = 0;
+    Clock::getClock_usecs(&start);
+    results[idx] = it.second->checkObjectConnections();
+    initDurations[idx].connectionCheckUs = getDurationUs(start);
+    idx++;
+  }
+  printConnectionCheckResults(initDurations, results);
+}
+
+void ObjectManager::initializeObjectsInParallel() {
+#if FSFW_OBJ_MANAGER_INIT_THREADS == 1
+  InitScheduler scheduler(*this);
+  scheduler.waitingFor.assign(initThreads, NO_INDEX);
+  initScheduler = &scheduler;
+  std::vector<std::thread> threads;
+  for (size_t thread = 1; thread < initThreads; thread++) {
+    threads.emplace_back([&scheduler, thread]() { scheduler.work(thread); });
+  }
+  scheduler.work(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  initScheduler = nullptr;
+  printInitResults(initDurations, scheduler.results);
+
+  // The connection checks do not depend on each other
+  std::vector<SystemObjectIF*> objects;
+  objects.reserve(objectList.size());
+  for (auto const& it : objectList) {
+    objects.push_back(it.second);
+  }
+  std::vector<ReturnValue_t> results(objects.size(), static_cast<ReturnValue_t>(RETURN_OK));
+  std::atomic<size_t> nextObject{0};
+  auto checkConnections = [&]() {
+    for (size_t idx = nextObject++; idx < objects.size(); idx = nextObject++) {
+      uint64_t start = 0;
+      Clock::getClock_usecs(&start);
+      results[idx] = objects[idx]->checkObjectConnections();
+      initDurations[idx].connectionCheckUs = getDurationUs(start);
+    }
+  };
+  threads.clear();
+  for (size_t thread = 1; thread < initThreads; thread++) {
+    threads.emplace_back(checkConnections);
+  }
+  checkConnections();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  printConnectionCheckResults(initDurations, results);
+#endif
+}
+
+void ObjectManager::printInitDurations(size_t numberOfObjects) {
+  std::vector<InitDuration> slowest = initDurations;
+  numberOfObjects = std::min(numberOfObjects, slowest.size());
+  std::partial_sort(slowest.begin(), slowest.begin() + numberOfObjects, slowest.end(),
+                    [](const InitDuration& first, const InitDuration& second) {
+                      return first.initializeUs + first.connectionCheckUs >
+                             second.initializeUs + second.connectionCheckUs;
+                    });
+  for (size_t idx = 0; idx < numberOfObjects; idx++) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::info << "ObjectManager: Object 0x" << std::hex << std::setw(8) << std::setfill('0')
+              << slowest[idx].objectId << std::dec << std::setfill(' ') << " initialize "
+              << slowest[idx].initializeUs << " us, connection check "
+              << slowest[idx].connectionCheckUs << " us" << std::endl;
+#else
+    sif::printInfo("ObjectManager: Object 0x%08x initialize %lu us, connection check %lu us\n",
+                   static_cast<unsigned int>(slowest[idx].objectId),
+                   static_cast<unsigned long>(slowest[idx].initializeUs),
+                   static_cast<unsigned long>(slowest[idx].connectionCheckUs));
+#endif
+  }
+}
+
+void ObjectManager::freezeObjectList() {
+  clearCastCaches();
+  // The map is already sorted by the object IDs
+  frozenIds.clear();
+  frozenObjects.clear();
+  frozenIds.reserve(objectList.size());
+  frozenObjects.reserve(objectList.size());
+  for (auto const& it : objectList) {
+    frozenIds.push_back(it.first);
+    frozenObjects.push_back(it.second);
+  }
+  frozen = true;
+}
+
+bool ObjectManager::findFrozenIndex(object_id_t id, size_t* index) const {
+  size_t remaining = frozenIds.size();
+  if (remaining == 0) {
+    return false;
+  }
+  // Branchless binary search, the compiler uses conditional moves for the halving step
+  const object_id_t* base = frozenIds.data();
+  while (remaining > 1) {
+    size_t half = remaining / 2;
+    base = (base[half] <= id) ? base + half : base;
+    remaining -= half;
+  }
+  if (*base != id) {
+    return false;
+  }
+  *index = base - frozenIds.data();
+  return true;
+}
+
+std::atomic<void*>* ObjectManager::getCastCacheEntry(size_t slot, size_t index) {
+  if (slot >= MAX_CACHED_INTERFACES) {
+    return nullptr;
+  }
+  std::atomic<void*>* cache = castCaches[slot].load(std::memory_order_acquire);
+  if (cache == nullptr) {
+    // Allocated once per interface. If another task allocates the cache at the same time, the
+    // cache which is published first is used.
+    std::atomic<void*>* newCache = new std::atomic<void*>[frozenObjects.size()];
+    for (size_t idx = 0; idx < frozenObjects.size(); idx++) {
+      newCache[idx].store(UNRESOLVED_CAST, std::memory_order_relaxed);
+    }
+    if (castCaches[slot].compare_exchange_strong(cache, newCache, std::memory_order_acq_rel)) {
+      cache = newCache;
+    } else {
+      delete[] newCache;
+    }
+  }
+  return &cache[index];
+}
+
+void ObjectManager::clearCastCaches() {
+  for (auto& cache : castCaches) {
+    delete[] cache.exchange(nullptr, std::memory_order_acq_rel);
+  }
+}
 
 void ObjectManager::printList() {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
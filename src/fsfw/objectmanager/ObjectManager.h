@@ -1,7 +1,10 @@
 #ifndef FSFW_OBJECTMANAGER_OBJECTMANAGER_H_
 #define FSFW_OBJECTMANAGER_OBJECTMANAGER_H_
 
+#include <array>
+#include <atomic>
 #include <map>
+#include <vector>
 
 #include "ObjectManagerIF.h"
 #include "SystemObjectIF.h"
@@ -16,6 +19,20 @@
  * 			most of the system initialization.
  * 			As the system is static after initialization, no new objects are
  * 			created or inserted into the list after startup.
+ *
+ * 			At the end of #initialize, the object list is frozen into a sorted
+ * 			array which is searched with a binary search. The results of the casts
+ * 			in #get are cached for each object and requested interface, so repeated
+ * 			lookups do not allocate and do not need a dynamic_cast. Inserting or
+ * 			removing objects after the initialization rebuilds the frozen list and,
+ * 			like modifying the object list before, must not be done while other
+ * 			tasks look up objects.
+ *
+ * 			The objects are initialized in the order of their object IDs, unless
+ * 			other dependencies were declared with #addInitDependency. With
+ * 			#setInitializationThreads, independent objects are initialized in
+ * 			parallel on the host and Linux OSAL. See #setInitializationThreads for
+ * 			the requirements on the objects.
  * @ingroup system_objects
  * @author	Bastian Baetz
  */
@@ -30,8 +47,60 @@ class ObjectManager : public ObjectManagerIF {
    */
   static ObjectManager* instance();
 
+  //! Initialization duration of an object, measured by #initialize. With several threads, the
+  //! duration includes objects which were initialized because of a lookup of the object.
+  struct InitDuration {
+    object_id_t objectId;
+    uint32_t initializeUs;
+    uint32_t connectionCheckUs;
+  };
+
   void setObjectFactoryFunction(produce_function_t prodFunc, void* args);
 
+  /**
+   * @brief   Sets the number of threads which initialize the objects, including the thread
+   *          which calls #initialize. One thread is the default.
+   * @details
+   * Only the host and Linux OSAL support more than one thread, the other OSALs always use
+   * the calling thread.
+   *
+   * An object is only initialized after the objects it depends on. Besides the dependencies
+   * declared with #addInitDependency, a lookup with #get during the initialization of an object
+   * is treated as a dependency: if the looked up object is not initialized yet, it is
+   * initialized first or the lookup waits until another thread has initialized it. Cyclic
+   * lookups return the object without waiting, like in the sequential initialization.
+   *
+   * Objects must not be created during the initialization. Objects which are modified by the
+   * initialization of several other objects, like the EventManager, the HealthTable, the TC
+   * distributors or the subsystems, must be thread-safe. Otherwise, the modifying objects have
+   * to be ordered with #addInitDependency.
+   */
+  void setInitializationThreads(uint8_t numberOfThreads);
+
+  /**
+   * @brief   Declares that the object is initialized after the dependency.
+   * @details
+   * Can be called before #initialize, for example by the factory function. Dependencies on
+   * unknown objects are ignored. Cyclic dependencies are reported and broken in the order of
+   * the object IDs.
+   */
+  void addInitDependency(object_id_t object, object_id_t dependency);
+
+  /**
+   * @brief   Returns the durations of the initialization and the connection check of all
+   *          objects, measured by the last call of #initialize and sorted by object ID.
+   */
+  const std::vector<InitDuration>& getInitDurations() const;
+
+  /**
+   * @brief   Prints the objects with the longest initialization durations.
+   */
+  void printInitDurations(size_t numberOfObjects = 10);
+
+  /**
+   * @brief   Returns the object with the given ID cast to the requested interface.
+   * @return  nullptr if the object does not exist or does not implement the interface
+   */
   template <typename T>
   T* get(object_id_t id);
 
@@ -57,22 +126,94 @@ class ObjectManager : public ObjectManagerIF {
   produce_function_t objectFactoryFunction = nullptr;
   void* factoryArgs = nullptr;
 
- private:
+  /**
+   * @brief   Only the global #instance and derived managers, for example in tests, are
+   *          constructed.
+   */
   ObjectManager();
 
+ private:
+  //! Number of interfaces for which the casts are cached. Casts to other interfaces are
+  //! done with dynamic_cast on every lookup.
+  static constexpr size_t MAX_CACHED_INTERFACES = 64;
+
+  //! State of the initialization, only exists while #initialize runs
+  struct InitScheduler;
+
+  void initializeObjects();
+  void checkObjectConnections();
+  void initializeObjectsInParallel();
+
+  /**
+   * @brief   Copies the object list into the sorted frozen arrays and clears the cast caches.
+   */
+  void freezeObjectList();
+  /**
+   * @brief   Finds the index of an object in the frozen arrays.
+   * @return  False if the list is not frozen yet or the object does not exist
+   */
+  bool findFrozenIndex(object_id_t id, size_t* index) const;
+  /**
+   * @brief   Returns the cache entry of the object with the given index for the interface with
+   *          the given cache slot, or nullptr if the interface can not be cached.
+   */
+  std::atomic<void*>* getCastCacheEntry(size_t slot, size_t index);
+  void clearCastCaches();
+
+  template <typename T>
+  static size_t getCastCacheSlot();
+  //! Marks cache entries for which the cast was not done yet
+  static void* const UNRESOLVED_CAST;
+  static std::atomic<size_t> nextCastCacheSlot;
+
   /**
    * @brief	This is the map of all initialized objects in the manager.
    * @details	Objects in the List must inherit the SystemObjectIF.
    */
   std::map<object_id_t, SystemObjectIF*> objectList;
   static ObjectManager* objManagerInstance;
+
+  uint8_t initThreads = 1;
+  std::vector<std::pair<object_id_t, object_id_t>> initDependencies;
+  std::vector<InitDuration> initDurations;
+  InitScheduler* initScheduler = nullptr;
+
+  bool frozen = false;
+  //! Sorted object IDs and objects of the frozen list, kept separate for a compact search
+  std::vector<object_id_t> frozenIds;
+  std::vector<SystemObjectIF*> frozenObjects;
+  //! One lazily allocated array of cached casts per interface, indexed like frozenObjects
+  std::array<std::atomic<std::atomic<void*>*>, MAX_CACHED_INTERFACES> castCaches = {};
 };
 
 // Documentation can be found in the class method declaration above
 template <typename T>
 T* ObjectManager::get(object_id_t id) {
-  SystemObjectIF* temp = this->getSystemObject(id);
-  return dynamic_cast<T*>(temp);
+  size_t index = 0;
+  if (not findFrozenIndex(id, &index)) {
+    if (frozen) {
+      return nullptr;
+    }
+    return dynamic_cast<T*>(this->getSystemObject(id));
+  }
+  std::atomic<void*>* entry = getCastCacheEntry(getCastCacheSlot<T>(), index);
+  if (entry == nullptr) {
+    return dynamic_cast<T*>(frozenObjects[index]);
+  }
+  void* cachedObject = entry->load(std::memory_order_acquire);
+  if (cachedObject == UNRESOLVED_CAST) {
+    // Several tasks may resolve the same entry concurrently, but they store the same result
+    T* object = dynamic_cast<T*>(frozenObjects[index]);
+    entry->store(static_cast<void*>(object), std::memory_order_release);
+    return object;
+  }
+  return static_cast<T*>(cachedObject);
+}
+
+template <typename T>
+size_t ObjectManager::getCastCacheSlot() {
+  static const size_t slot = nextCastCacheSlot.fetch_add(1, std::memory_order_relaxed);
+  return slot;
 }
 
 #endif /* FSFW_OBJECTMANAGER_OBJECTMANAGER_H_ */
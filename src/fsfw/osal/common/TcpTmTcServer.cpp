@@ -9,6 +9,7 @@
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/platform.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
+#include "fsfw/serviceinterface/TraceChannel.h"
 #include "fsfw/tasks/TaskFactory.h"
 #include "fsfw/tmtcservices/SpacePacketParser.h"
 #include "fsfw/tmtcservices/TmTcMessage.h"
@@ -232,6 +233,7 @@ ReturnValue_t TcpTmTcServer::handleTcReception(uint8_t* spacePacket, size_t pack
 #endif /* FSFW_VERBOSE_LEVEL >= 1 */
     return result;
   }
+  trace::record(trace::RecordTypes::TC_RECEIVED, storeId.raw, getObjectId(), packetSize);
 
   TmTcMessage message(storeId);
 
@@ -288,6 +290,8 @@ ReturnValue_t TcpTmTcServer::handleTmSending(socket_t connSocket, bool& tmSent)
                           storeAccessor.size(), tcpConfig.tcpTmFlags);
     if (retval == static_cast<int>(storeAccessor.size())) {
       // Packet sent, clear FIFO entry
+      trace::record(trace::RecordTypes::TM_SENT, storeId.raw, getObjectId(),
+                    storeAccessor.size());
       tmtcBridge->tmFifo->pop();
       tmSent = true;
 
@@ -0,0 +1,141 @@
+#include "fsfw/osal/common/TraceRingFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "fsfw/serviceinterface/ServiceInterface.h"
+
+constexpr char TraceRingFile::MAGIC[8];
+
+static_assert(sizeof(TraceRingFile::FileHeader) == 64, "Unexpected trace file header size");
+static_assert(sizeof(TraceRingFile::Record) == 32, "Unexpected trace record size");
+
+TraceRingFile::TraceRingFile(std::string path, size_t capacity)
+    : path(std::move(path)), capacity(capacity) {
+  if (this->capacity == 0) {
+    this->capacity = 1;
+  }
+}
+
+TraceRingFile::~TraceRingFile() {
+  if (trace::getSink() == this) {
+    trace::setSink(nullptr);
+  }
+  close();
+}
+
+ReturnValue_t TraceRingFile::open(bool preserve) {
+  close();
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd < 0) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "TraceRingFile::open: Opening " << path << " failed with " << strerror(errno)
+                 << std::endl;
+#else
+    sif::printWarning("TraceRingFile::open: Opening %s failed with %s\n", path.c_str(),
+                      strerror(errno));
+#endif
+#endif
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  mappedSize = sizeof(FileHeader) + capacity * sizeof(Record);
+  void* mapping = MAP_FAILED;
+  if (ftruncate(fd, mappedSize) == 0) {
+    mapping = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  [[maybe_unused]] int error = errno;
+  // The mapping stays valid after the file descriptor was closed
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "TraceRingFile::open: Mapping " << path << " failed with " << strerror(error)
+                 << std::endl;
+#else
+    sif::printWarning("TraceRingFile::open: Mapping %s failed with %s\n", path.c_str(),
+                      strerror(error));
+#endif
+#endif
+    mappedSize = 0;
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+
+  header = static_cast<FileHeader*>(mapping);
+  records = reinterpret_cast<Record*>(static_cast<uint8_t*>(mapping) + sizeof(FileHeader));
+  if (not preserve or not isValidHeader()) {
+    std::memset(mapping, 0, mappedSize);
+    new (&header->writeIndex) std::atomic<uint64_t>(0);
+    for (size_t idx = 0; idx < capacity; idx++) {
+      new (&records[idx].sequence) std::atomic<uint32_t>(0);
+    }
+    header->version = FILE_VERSION;
+    header->recordSize = sizeof(Record);
+    header->capacity = capacity;
+    // The magic is written last, so a file which was only partially initialized is reset
+    std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void TraceRingFile::close() {
+  if (header != nullptr) {
+    msync(header, mappedSize, MS_ASYNC);
+    munmap(header, mappedSize);
+    header = nullptr;
+    records = nullptr;
+    mappedSize = 0;
+  }
+}
+
+void TraceRingFile::write(trace::RecordTypes type, uint32_t id, object_id_t objectId,
+                          uint32_t parameter1, uint32_t parameter2) {
+  if (records == nullptr) {
+    return;
+  }
+  // Clock::getClock_usecs takes a detour via timeval and floating point arithmetic
+  timespec now;
+  clock_gettime(CLOCK_REALTIME, &now);
+  uint64_t timestamp = static_cast<uint64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+  uint64_t index = header->writeIndex.fetch_add(1, std::memory_order_relaxed);
+  Record& record = records[index % capacity];
+  record.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  record.type = static_cast<uint8_t>(type);
+  record.id = id;
+  record.objectId = objectId;
+  record.timestampUs = timestamp;
+  record.parameter1 = parameter1;
+  record.parameter2 = parameter2;
+  record.sequence.store(static_cast<uint32_t>(index + 1), std::memory_order_release);
+}
+
+ReturnValue_t TraceRingFile::sync(bool blocking) {
+  if (header == nullptr) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  if (msync(header, mappedSize, blocking ? MS_SYNC : MS_ASYNC) != 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+uint64_t TraceRingFile::getRecordCount() const {
+  if (header == nullptr) {
+    return 0;
+  }
+  return header->writeIndex.load(std::memory_order_relaxed);
+}
+
+bool TraceRingFile::isValidHeader() const {
+  return std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) == 0 and
+         header->version == FILE_VERSION and header->recordSize == sizeof(Record) and
+         header->capacity == capacity;
+}
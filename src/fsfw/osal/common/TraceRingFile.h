@@ -0,0 +1,90 @@
+#ifndef FSFW_OSAL_COMMON_TRACERINGFILE_H_
+#define FSFW_OSAL_COMMON_TRACERINGFILE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../../returnvalues/HasReturnvaluesIF.h"
+#include "../../serviceinterface/TraceChannel.h"
+
+/**
+ * @brief   Trace sink which writes the trace records into a memory-mapped ring file
+ * @details
+ * The file is mapped with MAP_SHARED, so the records written so far remain in the file if the
+ * process crashes. Use #sync to also write the records to the medium. Writers only reserve a
+ * slot with an atomic increment and never block, so trace records can be written from any task.
+ *
+ * The file consists of a 64 byte FileHeader followed by the ring of 32 byte Records, both in
+ * host byte order. The sequence number of a record is written last and is zero while the
+ * record is written, which allows the decoder to skip incomplete records.
+ * The file can be decoded with the scripts/trace-decoder.py script.
+ */
+class TraceRingFile : public trace::TraceSinkIF {
+ public:
+  static constexpr uint32_t FILE_VERSION = 1;
+  static constexpr size_t DEFAULT_CAPACITY = 65536;
+
+  struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t capacity;
+    //! Total number of reserved records since the file was created
+    std::atomic<uint64_t> writeIndex;
+    uint8_t spare[32];
+  };
+
+  struct Record {
+    //! Lower 32 bits of the record index plus one, zero if the record is invalid
+    std::atomic<uint32_t> sequence;
+    uint8_t type;
+    uint8_t spare[3];
+    uint32_t id;
+    uint32_t objectId;
+    uint64_t timestampUs;
+    uint32_t parameter1;
+    uint32_t parameter2;
+  };
+
+  /**
+   * @param path      Path of the trace file
+   * @param capacity  Number of records in the ring
+   */
+  TraceRingFile(std::string path, size_t capacity = DEFAULT_CAPACITY);
+  ~TraceRingFile() override;
+
+  /**
+   * Creates and maps the trace file.
+   * @param preserve  If an existing file has the same layout, the new records are appended
+   *                  to the old ones. Otherwise, the file is reset.
+   */
+  ReturnValue_t open(bool preserve = true);
+  void close();
+
+  void write(trace::RecordTypes type, uint32_t id, object_id_t objectId, uint32_t parameter1,
+             uint32_t parameter2) override;
+
+  /**
+   * Writes the mapped file to the medium.
+   * @param blocking Wait until the data was written
+   */
+  ReturnValue_t sync(bool blocking = false);
+
+  //! Total number of records written into the file, including overwritten ones
+  uint64_t getRecordCount() const;
+
+ private:
+  static constexpr char MAGIC[8] = {'F', 'S', 'F', 'W', 'T', 'R', 'C', '1'};
+
+  std::string path;
+  size_t capacity;
+  size_t mappedSize = 0;
+  FileHeader* header = nullptr;
+  Record* records = nullptr;
+
+  bool isValidHeader() const;
+};
+
+#endif /* FSFW_OSAL_COMMON_TRACERINGFILE_H_ */
@@ -5,6 +5,7 @@
 #include "fsfw/osal/common/tcpipHelpers.h"
 #include "fsfw/platform.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
+#include "fsfw/serviceinterface/TraceChannel.h"
 
 #ifdef PLATFORM_WIN
 #include <winsock2.h>
@@ -89,6 +90,7 @@ ReturnValue_t UdpTcPollingTask::handleSuccessfullTcRead(size_t bytesRead) {
 #endif /* FSFW_VERBOSE_LEVEL >= 1 */
     return HasReturnvaluesIF::RETURN_FAILED;
   }
+  trace::record(trace::RecordTypes::TC_RECEIVED, storeId.raw, getObjectId(), bytesRead);
 
   TmTcMessage message(storeId);
 
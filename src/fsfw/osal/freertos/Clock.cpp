@@ -44,6 +44,8 @@ ReturnValue_t Clock::getClock_timeval(timeval* time) {
   return HasReturnvaluesIF::RETURN_OK;
 }
 
+ReturnValue_t Clock::getClockCoarse_timeval(timeval* time) { return getClock_timeval(time); }
+
 ReturnValue_t Clock::getUptime(timeval* uptime) {
   *uptime = getUptime();
 
@@ -74,6 +74,21 @@ ReturnValue_t Clock::getClock_timeval(timeval* time) {
 #endif
 }
 
+ReturnValue_t Clock::getClockCoarse_timeval(timeval* time) {
+#if defined(PLATFORM_UNIX) && defined(CLOCK_REALTIME_COARSE)
+  timespec timeUnix;
+  int status = clock_gettime(CLOCK_REALTIME_COARSE, &timeUnix);
+  if (status != 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  time->tv_sec = timeUnix.tv_sec;
+  time->tv_usec = timeUnix.tv_nsec / 1000;
+  return HasReturnvaluesIF::RETURN_OK;
+#else
+  return getClock_timeval(time);
+#endif
+}
+
 ReturnValue_t Clock::getClock_usecs(uint64_t* time) {
   if (time == nullptr) {
     return HasReturnvaluesIF::RETURN_FAILED;
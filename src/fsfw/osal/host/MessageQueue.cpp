@@ -50,6 +50,76 @@ ReturnValue_t MessageQueue::flush(uint32_t* count) {
   return HasReturnvaluesIF::RETURN_OK;
 }
 
+ReturnValue_t MessageQueue::receiveMessages(MessageQueueMessageIF* const* messages,
+                                            size_t maxMessages, size_t* received) {
+  if (messages == nullptr or received == nullptr) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  *received = 0;
+  MutexGuard mutexLock(queueLock, MutexIF::TimeoutType::WAITING, 20);
+  while (*received < maxMessages and not messageQueue.empty()) {
+    MessageQueueMessageIF* message = messages[*received];
+    std::copy(messageQueue.front().data(), messageQueue.front().data() + messageSize,
+              message->getBuffer());
+    messageQueue.pop();
+    this->last = message->getSender();
+    (*received)++;
+  }
+  if (*received == 0) {
+    return MessageQueueIF::EMPTY;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t MessageQueue::sendMessagesFrom(MessageQueueId_t sendTo,
+                                             MessageQueueMessageIF* const* messages, size_t count,
+                                             MessageQueueId_t sentFrom, size_t* sent,
+                                             bool ignoreFault) {
+  size_t sentMessages = 0;
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+  MessageQueue* targetQueue =
+      dynamic_cast<MessageQueue*>(QueueMapManager::instance()->getMessageQueue(sendTo));
+  if (messages == nullptr and count > 0) {
+    result = HasReturnvaluesIF::RETURN_FAILED;
+  } else if (targetQueue == nullptr) {
+    if (not ignoreFault) {
+      reportMessageNotSent(sendTo);
+    }
+    result = MessageQueueIF::DESTINATION_INVALID;
+  } else {
+    MutexGuard mutexLock(targetQueue->queueLock, MutexIF::TimeoutType::WAITING, 20);
+    for (; sentMessages < count; sentMessages++) {
+      MessageQueueMessageIF* message = messages[sentMessages];
+      if (message == nullptr or message->getMessageSize() > message->getMaximumMessageSize()) {
+        result = HasReturnvaluesIF::RETURN_FAILED;
+        break;
+      }
+      if (targetQueue->messageQueue.size() >= targetQueue->messageDepth) {
+        result = MessageQueueIF::FULL;
+        break;
+      }
+      message->setSender(sentFrom);
+      targetQueue->messageQueue.emplace(message->getBuffer(),
+                                        message->getBuffer() + message->getMaximumMessageSize());
+    }
+  }
+  if (result == MessageQueueIF::FULL and not ignoreFault) {
+    reportMessageNotSent(sendTo);
+  }
+  if (sent != nullptr) {
+    *sent = sentMessages;
+  }
+  return result;
+}
+
+void MessageQueue::reportMessageNotSent(MessageQueueId_t sendTo) {
+  InternalErrorReporterIF* internalErrorReporter =
+      ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
+  if (internalErrorReporter != nullptr) {
+    internalErrorReporter->queueMessageNotSentTo(sendTo);
+  }
+}
+
 // static core function to send messages.
 ReturnValue_t MessageQueue::sendMessageFromMessageQueue(MessageQueueId_t sendTo,
                                                         MessageQueueMessageIF* message,
@@ -69,11 +139,7 @@ ReturnValue_t MessageQueue::sendMessageFromMessageQueue(MessageQueueId_t sendTo,
       dynamic_cast<MessageQueue*>(QueueMapManager::instance()->getMessageQueue(sendTo));
   if (targetQueue == nullptr) {
     if (not ignoreFault) {
-      InternalErrorReporterIF* internalErrorReporter =
-          ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
-      if (internalErrorReporter != nullptr) {
-        internalErrorReporter->queueMessageNotSent();
-      }
+      reportMessageNotSent(sendTo);
     }
     return MessageQueueIF::DESTINATION_INVALID;
   }
@@ -84,11 +150,7 @@ ReturnValue_t MessageQueue::sendMessageFromMessageQueue(MessageQueueId_t sendTo,
            message->getMaximumMessageSize());
   } else {
     if (not ignoreFault) {
-      InternalErrorReporterIF* internalErrorReporter =
-          ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
-      if (internalErrorReporter != nullptr) {
-        internalErrorReporter->queueMessageNotSent();
-      }
+      reportMessageNotSent(sendTo);
     }
     return MessageQueueIF::FULL;
   }
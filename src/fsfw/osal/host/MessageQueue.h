@@ -76,6 +76,13 @@ class MessageQueue : public MessageQueueBase {
                                         bool ignoreFault = false) override;
   ReturnValue_t receiveMessage(MessageQueueMessageIF* message) override;
   ReturnValue_t flush(uint32_t* count) override;
+  //! Receives all messages with one lock of the queue
+  ReturnValue_t receiveMessages(MessageQueueMessageIF* const* messages, size_t maxMessages,
+                                size_t* received) override;
+  //! Looks up the destination once and sends all messages with one lock of the target queue
+  ReturnValue_t sendMessagesFrom(MessageQueueId_t sendTo, MessageQueueMessageIF* const* messages,
+                                 size_t count, MessageQueueId_t sentFrom, size_t* sent,
+                                 bool ignoreFault = false) override;
 
   ReturnValue_t lockQueue(MutexIF::TimeoutType timeoutType, dur_millis_t lockTimeout);
   ReturnValue_t unlockQueue();
@@ -106,6 +113,7 @@ class MessageQueue : public MessageQueueBase {
                                                    bool ignoreFault = false);
 
  private:
+  static void reportMessageNotSent(MessageQueueId_t sendTo);
   std::queue<std::vector<uint8_t>> messageQueue;
   size_t messageSize = 0;
   size_t messageDepth = 0;
@@ -8,7 +8,6 @@
 
 #include <fstream>
 
-#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 
 uint32_t Clock::getTicksPerSecond(void) {
@@ -50,7 +49,19 @@ ReturnValue_t Clock::getClock_timeval(timeval* time) {
     return HasReturnvaluesIF::RETURN_FAILED;
   }
   time->tv_sec = timeUnix.tv_sec;
-  time->tv_usec = timeUnix.tv_nsec / 1000.0;
+  time->tv_usec = timeUnix.tv_nsec / 1000;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t Clock::getClockCoarse_timeval(timeval* time) {
+  timespec timeUnix;
+  // Served by the vDSO without reading the clock source hardware
+  int status = clock_gettime(CLOCK_REALTIME_COARSE, &timeUnix);
+  if (status != 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  time->tv_sec = timeUnix.tv_sec;
+  time->tv_usec = timeUnix.tv_nsec / 1000;
   return HasReturnvaluesIF::RETURN_OK;
 }
 
@@ -115,22 +126,16 @@ ReturnValue_t Clock::getDateAndTime(TimeOfDay_t* time) {
     // TODO errno
     return HasReturnvaluesIF::RETURN_FAILED;
   }
-  ReturnValue_t result = checkOrCreateClockMutex();
-  if (result != HasReturnvaluesIF::RETURN_OK) {
-    return result;
-  }
-  MutexGuard helper(timeMutex);
-  // gmtime writes its output in a global buffer which is not Thread Safe
-  // Therefore we have to use a Mutex here
-  struct tm* timeInfo;
-  timeInfo = gmtime(&timeUnix.tv_sec);
-  time->year = timeInfo->tm_year + 1900;
-  time->month = timeInfo->tm_mon + 1;
-  time->day = timeInfo->tm_mday;
-  time->hour = timeInfo->tm_hour;
-  time->minute = timeInfo->tm_min;
-  time->second = timeInfo->tm_sec;
-  time->usecond = timeUnix.tv_nsec / 1000.0;
+  // gmtime_r writes to the given buffer, so the clock mutex is not required
+  struct tm timeInfo;
+  gmtime_r(&timeUnix.tv_sec, &timeInfo);
+  time->year = timeInfo.tm_year + 1900;
+  time->month = timeInfo.tm_mon + 1;
+  time->day = timeInfo.tm_mday;
+  time->hour = timeInfo.tm_hour;
+  time->minute = timeInfo.tm_min;
+  time->second = timeInfo.tm_sec;
+  time->usecond = timeUnix.tv_nsec / 1000;
 
   return HasReturnvaluesIF::RETURN_OK;
 }
@@ -213,7 +213,7 @@ ReturnValue_t MessageQueue::sendMessageFromMessageQueue(MessageQueueId_t sendTo,
       InternalErrorReporterIF* internalErrorReporter =
           ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
       if (internalErrorReporter != nullptr) {
-        internalErrorReporter->queueMessageNotSent();
+        internalErrorReporter->queueMessageNotSentTo(sendTo);
       }
     }
     switch (errno) {
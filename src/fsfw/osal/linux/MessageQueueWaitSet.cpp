@@ -0,0 +1,168 @@
+#include "fsfw/osal/linux/MessageQueueWaitSet.h"
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include "fsfw/osal/linux/unixUtility.h"
+
+MessageQueueWaitSet::MessageQueueWaitSet() {
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  if (epollFd < 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "MessageQueueWaitSet", "epoll_create1");
+    return;
+  }
+  wakeUpFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wakeUpFd < 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "MessageQueueWaitSet", "eventfd");
+    return;
+  }
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.u32 = WAKE_UP;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeUpFd, &event) != 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "MessageQueueWaitSet", "epoll_ctl");
+  }
+}
+
+MessageQueueWaitSet::~MessageQueueWaitSet() {
+  for (auto& source : sources) {
+    if (source.second.isTimer) {
+      close(source.second.fd);
+    }
+  }
+  if (wakeUpFd >= 0) {
+    close(wakeUpFd);
+  }
+  if (epollFd >= 0) {
+    close(epollFd);
+  }
+}
+
+ReturnValue_t MessageQueueWaitSet::addQueue(MessageQueueId_t queueId, uint32_t sourceId) {
+  // The ID of a Linux message queue is the message queue descriptor
+  return addSource(static_cast<int>(queueId), sourceId, false);
+}
+
+ReturnValue_t MessageQueueWaitSet::addFileDescriptor(int fd, uint32_t sourceId) {
+  return addSource(fd, sourceId, false);
+}
+
+ReturnValue_t MessageQueueWaitSet::addPeriodicTimer(uint32_t periodMs, uint32_t sourceId) {
+  if (periodMs == 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (timerFd < 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "addPeriodicTimer", "timerfd_create");
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  itimerspec timerSpec = {};
+  timerSpec.it_interval.tv_sec = periodMs / 1000;
+  timerSpec.it_interval.tv_nsec = (periodMs % 1000) * 1000000;
+  timerSpec.it_value = timerSpec.it_interval;
+  if (timerfd_settime(timerFd, 0, &timerSpec, nullptr) != 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "addPeriodicTimer", "timerfd_settime");
+    close(timerFd);
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  ReturnValue_t result = addSource(timerFd, sourceId, true);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    close(timerFd);
+  }
+  return result;
+}
+
+ReturnValue_t MessageQueueWaitSet::removeSource(uint32_t sourceId) {
+  auto iter = sources.find(sourceId);
+  if (iter == sources.end()) {
+    return INVALID_SOURCE_ID;
+  }
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, iter->second.fd, nullptr);
+  if (iter->second.isTimer) {
+    close(iter->second.fd);
+  }
+  sources.erase(iter);
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t MessageQueueWaitSet::wait(int timeoutMs, uint32_t* readySources, size_t maxSources,
+                                        size_t* readyCount) {
+  constexpr size_t MAX_EVENTS = 16;
+  if (readySources == nullptr or readyCount == nullptr or maxSources == 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  *readyCount = 0;
+  epoll_event events[MAX_EVENTS];
+  int maxEvents = static_cast<int>(maxSources < MAX_EVENTS ? maxSources : MAX_EVENTS);
+  int eventCount = 0;
+  do {
+    eventCount = epoll_wait(epollFd, events, maxEvents, timeoutMs < 0 ? -1 : timeoutMs);
+  } while (eventCount < 0 and errno == EINTR);
+  if (eventCount < 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "wait", "epoll_wait");
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  if (eventCount == 0) {
+    return WAIT_TIMEOUT;
+  }
+  for (int idx = 0; idx < eventCount; idx++) {
+    uint32_t sourceId = events[idx].data.u32;
+    uint64_t counter = 0;
+    if (sourceId == WAKE_UP) {
+      // Reading the eventfd resets it, multiple wake up calls are reported once
+      if (read(wakeUpFd, &counter, sizeof(counter)) != sizeof(counter)) {
+        continue;
+      }
+    } else {
+      auto iter = sources.find(sourceId);
+      if (iter != sources.end() and iter->second.isTimer) {
+        // Reading the timer resets it and returns the number of expirations since the last read
+        if (read(iter->second.fd, &counter, sizeof(counter)) != sizeof(counter)) {
+          continue;
+        }
+        iter->second.expirations = counter;
+      }
+    }
+    readySources[(*readyCount)++] = sourceId;
+  }
+  if (*readyCount == 0) {
+    return WAIT_TIMEOUT;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void MessageQueueWaitSet::wakeUp() {
+  uint64_t increment = 1;
+  if (write(wakeUpFd, &increment, sizeof(increment)) != sizeof(increment)) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "wakeUp", "write");
+  }
+}
+
+uint64_t MessageQueueWaitSet::getTimerExpirations(uint32_t sourceId) const {
+  auto iter = sources.find(sourceId);
+  if (iter == sources.end()) {
+    return 0;
+  }
+  return iter->second.expirations;
+}
+
+ReturnValue_t MessageQueueWaitSet::addSource(int fd, uint32_t sourceId, bool isTimer) {
+  if (sourceId == WAKE_UP or sources.find(sourceId) != sources.end()) {
+    return INVALID_SOURCE_ID;
+  }
+  epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.u32 = sourceId;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "addSource", "epoll_ctl");
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  Source source;
+  source.fd = fd;
+  source.isTimer = isTimer;
+  sources.emplace(sourceId, source);
+  return HasReturnvaluesIF::RETURN_OK;
+}
@@ -0,0 +1,121 @@
+#ifndef FSFW_OSAL_LINUX_MESSAGEQUEUEWAITSET_H_
+#define FSFW_OSAL_LINUX_MESSAGEQUEUEWAITSET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+#include "fsfw/ipc/MessageQueueIF.h"
+#include "fsfw/returnvalues/FwClassIds.h"
+#include "fsfw/returnvalues/HasReturnvaluesIF.h"
+
+/**
+ * @brief   Blocks on a set of message queues and file descriptors until one of them is ready.
+ * @details
+ * The Linux MessageQueue is non-blocking, so a task which serves several queues usually polls
+ * them once per period. This adds up to a full period of latency to every command and reply.
+ * On Linux, a message queue ID is a file descriptor which can be monitored with epoll, so a
+ * thread can instead sleep until the first message arrives in any of its queues.
+ *
+ * Every source is registered with a source ID chosen by the user, and #wait returns the IDs of
+ * all ready sources. Queues and file descriptors stay ready until they were read, so all
+ * messages of a ready queue should be received before waiting again. Periodic timers added
+ * with #addPeriodicTimer are read by the wait set itself and can be used to run periodic
+ * housekeeping work in the same thread.
+ *
+ * Sources should only be added and removed by the thread which waits. #wakeUp can be called
+ * from any thread, for example to stop the waiting thread.
+ *
+ * Example:
+ * @code
+ * waitSet.addQueue(commandQueue->getId(), COMMAND_QUEUE);
+ * waitSet.addPeriodicTimer(1000, HOUSEKEEPING_TIMER);
+ * while (true) {
+ *   uint32_t ready[4];
+ *   size_t readyCount = 0;
+ *   waitSet.wait(-1, ready, 4, &readyCount);
+ *   // Handle the ready sources
+ * }
+ * @endcode
+ */
+class MessageQueueWaitSet {
+ public:
+  static constexpr uint8_t CLASS_ID = CLASS_ID::LINUX_OSAL;
+
+  //! No source became ready before the timeout
+  static constexpr ReturnValue_t WAIT_TIMEOUT = HasReturnvaluesIF::makeReturnCode(CLASS_ID, 10);
+  //! The source ID is reserved, already in use or not known
+  static constexpr ReturnValue_t INVALID_SOURCE_ID =
+      HasReturnvaluesIF::makeReturnCode(CLASS_ID, 11);
+
+  //! Reserved source ID which is returned by #wait after #wakeUp was called
+  static constexpr uint32_t WAKE_UP = 0xffffffff;
+
+  MessageQueueWaitSet();
+  virtual ~MessageQueueWaitSet();
+
+  MessageQueueWaitSet(const MessageQueueWaitSet&) = delete;
+  MessageQueueWaitSet& operator=(const MessageQueueWaitSet&) = delete;
+
+  /**
+   * @brief   Adds a message queue of the Linux OSAL
+   * @param queueId   ID of the queue, as returned by MessageQueueIF::getId
+   * @param sourceId  ID which is returned by #wait if the queue contains messages
+   */
+  ReturnValue_t addQueue(MessageQueueId_t queueId, uint32_t sourceId);
+
+  /**
+   * @brief   Adds an arbitrary readable file descriptor, for example an eventfd or a socket.
+   * The file descriptor is not closed by the wait set.
+   */
+  ReturnValue_t addFileDescriptor(int fd, uint32_t sourceId);
+
+  /**
+   * @brief   Adds a timer which becomes ready periodically. The first expiration is one
+   *          period after this call.
+   */
+  ReturnValue_t addPeriodicTimer(uint32_t periodMs, uint32_t sourceId);
+
+  ReturnValue_t removeSource(uint32_t sourceId);
+
+  /**
+   * @brief   Waits until at least one source is ready.
+   * @param timeoutMs     Timeout in milliseconds. 0 only checks the sources, a negative value
+   *                      blocks until a source is ready.
+   * @param readySources  Array which is filled with the IDs of the ready sources
+   * @param maxSources    Size of the array. Further ready sources are returned by the next call.
+   * @param readyCount    Number of ready sources written to the array
+   * @return  WAIT_TIMEOUT if no source became ready before the timeout
+   */
+  ReturnValue_t wait(int timeoutMs, uint32_t* readySources, size_t maxSources,
+                     size_t* readyCount);
+
+  /**
+   * @brief   Lets the current or next #wait call return with the WAKE_UP source ID.
+   * Can be called from any thread.
+   */
+  void wakeUp();
+
+  /**
+   * @brief   Number of expirations of a periodic timer which were consumed by the last #wait
+   *          call which reported the timer. Values larger than one mean that periods were missed.
+   */
+  uint64_t getTimerExpirations(uint32_t sourceId) const;
+
+ private:
+  struct Source {
+    int fd = -1;
+    bool isTimer = false;
+    uint64_t expirations = 0;
+  };
+
+  static constexpr const char* CLASS_NAME = "MessageQueueWaitSet";
+
+  int epollFd = -1;
+  int wakeUpFd = -1;
+  std::map<uint32_t, Source> sources;
+
+  ReturnValue_t addSource(int fd, uint32_t sourceId, bool isTimer);
+};
+
+#endif /* FSFW_OSAL_LINUX_MESSAGEQUEUEWAITSET_H_ */
@@ -0,0 +1,371 @@
+#include "fsfw/osal/linux/SharedMemoryPool.h"
+
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include "fsfw/objectmanager/ObjectManager.h"
+#include "fsfw/serviceinterface/ServiceInterface.h"
+
+namespace {
+size_t align(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+}  // namespace
+
+SharedMemoryPool::SharedMemoryPool(object_id_t setObjectId, const char* name,
+                                   const LocalPool::LocalPoolConfig& poolConfig, Mode mode,
+                                   bool registered)
+    : SystemObject(setObjectId, registered), mode(mode) {
+  std::strncpy(this->name, name, MAX_NAME_LENGTH - 1);
+  if (poolConfig.empty() or poolConfig.size() > std::numeric_limits<max_subpools_t>::max()) {
+    configValid = false;
+  }
+  // The segment starts with the headers, followed by the size lists and the data of the pools
+  size_t offset = sizeof(SegmentHeader) + poolConfig.size() * sizeof(SubpoolHeader);
+  for (const auto& currentPoolConfig : poolConfig) {
+    Subpool subpool;
+    subpool.numberOfElements = currentPoolConfig.first;
+    subpool.elementSize = currentPoolConfig.second;
+    if (subpool.elementSize >= STORAGE_FREE) {
+      configValid = false;
+    }
+    offset = align(offset, ALIGNMENT);
+    subpool.sizeListOffset = offset;
+    offset += subpool.numberOfElements * sizeof(std::atomic<uint32_t>);
+    offset = align(offset, ALIGNMENT);
+    subpool.dataOffset = offset;
+    offset += subpool.numberOfElements * subpool.elementSize;
+    subpools.push_back(subpool);
+  }
+  segmentSize = offset;
+  map();
+}
+
+SharedMemoryPool::~SharedMemoryPool() {}
+
+ReturnValue_t SharedMemoryPool::map() {
+  if (not configValid) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "SharedMemoryPool::map: Invalid pool configuration" << std::endl;
+#else
+    sif::printError("SharedMemoryPool::map: Invalid pool configuration\n");
+#endif
+    return StorageManagerIF::POOL_TOO_LARGE;
+  }
+  if (segment.isMapped()) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  if (mode == Mode::CREATE) {
+    ReturnValue_t result = segment.create(name, segmentSize);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+    initializeSegment();
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+
+  ReturnValue_t result = segment.open(name);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  if (not hasSameLayout()) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "SharedMemoryPool::map: Layout of " << name << " does not match" << std::endl;
+#else
+    sif::printError("SharedMemoryPool::map: Layout of %s does not match\n", name);
+#endif
+    segment.close();
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  assignPointers();
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+bool SharedMemoryPool::isMapped() const { return segment.isMapped(); }
+
+ReturnValue_t SharedMemoryPool::addData(store_address_t* storeId, const uint8_t* data,
+                                        size_t size, bool ignoreFault) {
+  ReturnValue_t status = reserveSpace(size, storeId, ignoreFault);
+  if (status == RETURN_OK) {
+    const Subpool& subpool = subpools[storeId->poolIndex];
+    std::memcpy(subpool.data + storeId->packetIndex * subpool.elementSize, data, size);
+  }
+  return status;
+}
+
+ReturnValue_t SharedMemoryPool::getFreeElement(store_address_t* storeId, const size_t size,
+                                               uint8_t** pData, bool ignoreFault) {
+  ReturnValue_t status = reserveSpace(size, storeId, ignoreFault);
+  if (status == RETURN_OK) {
+    const Subpool& subpool = subpools[storeId->poolIndex];
+    *pData = subpool.data + storeId->packetIndex * subpool.elementSize;
+  } else {
+    *pData = nullptr;
+  }
+  return status;
+}
+
+ConstAccessorPair SharedMemoryPool::getData(store_address_t storeId) {
+  uint8_t* tempData = nullptr;
+  ConstStorageAccessor constAccessor(storeId, this);
+  ReturnValue_t status = modifyData(storeId, &tempData, &constAccessor.size_);
+  constAccessor.constDataPointer = tempData;
+  return ConstAccessorPair(status, std::move(constAccessor));
+}
+
+ReturnValue_t SharedMemoryPool::getData(store_address_t storeId,
+                                        ConstStorageAccessor& constAccessor) {
+  uint8_t* tempData = nullptr;
+  ReturnValue_t status = modifyData(storeId, &tempData, &constAccessor.size_);
+  constAccessor.assignStore(this);
+  constAccessor.constDataPointer = tempData;
+  return status;
+}
+
+ReturnValue_t SharedMemoryPool::getData(store_address_t storeId, const uint8_t** packetPtr,
+                                        size_t* size) {
+  uint8_t* tempData = nullptr;
+  ReturnValue_t status = modifyData(storeId, &tempData, size);
+  *packetPtr = tempData;
+  return status;
+}
+
+AccessorPair SharedMemoryPool::modifyData(store_address_t storeId) {
+  StorageAccessor accessor(storeId, this);
+  ReturnValue_t status = modifyData(storeId, &accessor.dataPointer, &accessor.size_);
+  accessor.assignConstPointer();
+  return AccessorPair(status, std::move(accessor));
+}
+
+ReturnValue_t SharedMemoryPool::modifyData(store_address_t storeId,
+                                           StorageAccessor& storeAccessor) {
+  storeAccessor.assignStore(this);
+  ReturnValue_t status = modifyData(storeId, &storeAccessor.dataPointer, &storeAccessor.size_);
+  storeAccessor.assignConstPointer();
+  return status;
+}
+
+ReturnValue_t SharedMemoryPool::modifyData(store_address_t storeId, uint8_t** packetPtr,
+                                           size_t* size) {
+  ReturnValue_t result = checkStoreId(storeId);
+  if (result != RETURN_OK) {
+    return result;
+  }
+  const Subpool& subpool = subpools[storeId.poolIndex];
+  uint32_t elementSize = subpool.sizeList[storeId.packetIndex].load(std::memory_order_acquire);
+  if (elementSize == STORAGE_FREE) {
+    return DATA_DOES_NOT_EXIST;
+  }
+  *packetPtr = subpool.data + storeId.packetIndex * subpool.elementSize;
+  *size = elementSize;
+  return RETURN_OK;
+}
+
+ReturnValue_t SharedMemoryPool::deleteData(store_address_t storeId) {
+  ReturnValue_t result = checkStoreId(storeId);
+  if (result != RETURN_OK) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "SharedMemoryPool::deleteData: Illegal store ID, no deletion!" << std::endl;
+#endif
+    return result;
+  }
+  subpools[storeId.poolIndex].sizeList[storeId.packetIndex].store(STORAGE_FREE,
+                                                                  std::memory_order_release);
+  return RETURN_OK;
+}
+
+ReturnValue_t SharedMemoryPool::deleteData(uint8_t* ptr, size_t size, store_address_t* storeId) {
+  store_address_t localId;
+  ReturnValue_t result = ILLEGAL_ADDRESS;
+  for (max_subpools_t idx = 0; idx < subpools.size() and isMapped(); idx++) {
+    const Subpool& subpool = subpools[idx];
+    uint8_t* end = subpool.data + subpool.numberOfElements * subpool.elementSize;
+    if (ptr >= subpool.data and ptr < end) {
+      localId.poolIndex = idx;
+      localId.packetIndex = (ptr - subpool.data) / subpool.elementSize;
+      result = deleteData(localId);
+      break;
+    }
+  }
+  if (storeId != nullptr) {
+    *storeId = localId;
+  }
+  return result;
+}
+
+size_t SharedMemoryPool::getTotalSize(size_t* additionalSize) {
+  size_t totalSize = 0;
+  size_t sizesSize = 0;
+  for (const auto& subpool : subpools) {
+    totalSize += subpool.elementSize * subpool.numberOfElements;
+    sizesSize += subpool.numberOfElements * sizeof(std::atomic<uint32_t>);
+  }
+  if (additionalSize != nullptr) {
+    *additionalSize = sizesSize;
+  }
+  return totalSize;
+}
+
+void SharedMemoryPool::getFillCount(uint8_t* buffer, uint8_t* bytesWritten) {
+  if (bytesWritten == nullptr or buffer == nullptr or not isMapped()) {
+    return;
+  }
+  uint16_t sum = 0;
+  size_t idx = 0;
+  for (; idx < subpools.size(); idx++) {
+    const Subpool& subpool = subpools[idx];
+    uint16_t reservedHits = 0;
+    for (uint16_t element = 0; element < subpool.numberOfElements; element++) {
+      if (subpool.sizeList[element].load(std::memory_order_relaxed) != STORAGE_FREE) {
+        reservedHits++;
+      }
+    }
+    buffer[idx] = static_cast<float>(reservedHits) / subpool.numberOfElements * 100;
+    *bytesWritten += 1;
+    sum += buffer[idx];
+  }
+  buffer[idx] = sum / subpools.size();
+  *bytesWritten += 1;
+}
+
+void SharedMemoryPool::clearStore() {
+  for (max_subpools_t idx = 0; idx < subpools.size(); idx++) {
+    clearSubPool(idx);
+  }
+}
+
+void SharedMemoryPool::clearSubPool(max_subpools_t poolIndex) {
+  if (poolIndex >= subpools.size() or not isMapped()) {
+    return;
+  }
+  const Subpool& subpool = subpools[poolIndex];
+  for (uint16_t element = 0; element < subpool.numberOfElements; element++) {
+    subpool.sizeList[element].store(STORAGE_FREE, std::memory_order_release);
+  }
+}
+
+ReturnValue_t SharedMemoryPool::initialize() {
+  ReturnValue_t result = SystemObject::initialize();
+  if (result != RETURN_OK) {
+    return result;
+  }
+  result = map();
+  if (result != RETURN_OK) {
+    return result;
+  }
+  internalErrorReporter =
+      ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
+  if (internalErrorReporter == nullptr) {
+    return ObjectManagerIF::INTERNAL_ERR_REPORTER_UNINIT;
+  }
+  return RETURN_OK;
+}
+
+SharedMemoryPool::max_subpools_t SharedMemoryPool::getNumberOfSubPools() const {
+  return subpools.size();
+}
+
+ReturnValue_t SharedMemoryPool::reserveSpace(size_t size, store_address_t* storeId,
+                                             bool ignoreFault) {
+  if (not isMapped()) {
+    return RETURN_FAILED;
+  }
+  ReturnValue_t status = DATA_TOO_LARGE;
+  // Like the LocalPool, the smallest fitting subpool is used
+  for (max_subpools_t idx = 0; idx < subpools.size(); idx++) {
+    if (subpools[idx].elementSize >= size) {
+      storeId->poolIndex = idx;
+      status = findEmpty(idx, size, &storeId->packetIndex);
+      break;
+    }
+  }
+  if (status == DATA_STORAGE_FULL and (not ignoreFault) and internalErrorReporter != nullptr) {
+    internalErrorReporter->storeFullWithId(getObjectId());
+  }
+  return status;
+}
+
+ReturnValue_t SharedMemoryPool::findEmpty(max_subpools_t poolIndex, size_t size,
+                                          uint16_t* element) {
+  const Subpool& subpool = subpools[poolIndex];
+  uint32_t startIndex = subpool.header->nextIndex.load(std::memory_order_relaxed);
+  for (uint32_t count = 0; count < subpool.numberOfElements; count++) {
+    uint32_t index = (startIndex + count) % subpool.numberOfElements;
+    uint32_t expected = STORAGE_FREE;
+    if (subpool.sizeList[index].load(std::memory_order_relaxed) == STORAGE_FREE and
+        subpool.sizeList[index].compare_exchange_strong(expected, size,
+                                                        std::memory_order_acquire)) {
+      subpool.header->nextIndex.store((index + 1) % subpool.numberOfElements,
+                                      std::memory_order_relaxed);
+      *element = index;
+      return RETURN_OK;
+    }
+  }
+  return DATA_STORAGE_FULL;
+}
+
+ReturnValue_t SharedMemoryPool::checkStoreId(store_address_t storeId) const {
+  if (not isMapped() or storeId.poolIndex >= subpools.size() or
+      storeId.packetIndex >= subpools[storeId.poolIndex].numberOfElements) {
+    return ILLEGAL_STORAGE_ID;
+  }
+  return RETURN_OK;
+}
+
+void SharedMemoryPool::initializeSegment() {
+  uint8_t* base = segment.getData();
+  auto* header = reinterpret_cast<SegmentHeader*>(base);
+  auto* subpoolHeaders = reinterpret_cast<SubpoolHeader*>(base + sizeof(SegmentHeader));
+  header->version = LAYOUT_VERSION;
+  header->numberOfSubpools = subpools.size();
+  for (size_t idx = 0; idx < subpools.size(); idx++) {
+    const Subpool& subpool = subpools[idx];
+    subpoolHeaders[idx].elementSize = subpool.elementSize;
+    subpoolHeaders[idx].numberOfElements = subpool.numberOfElements;
+    subpoolHeaders[idx].sizeListOffset = subpool.sizeListOffset;
+    subpoolHeaders[idx].dataOffset = subpool.dataOffset;
+    new (&subpoolHeaders[idx].nextIndex) std::atomic<uint32_t>(0);
+    auto* sizeList = reinterpret_cast<std::atomic<uint32_t>*>(base + subpool.sizeListOffset);
+    for (uint16_t element = 0; element < subpool.numberOfElements; element++) {
+      new (&sizeList[element]) std::atomic<uint32_t>(STORAGE_FREE);
+    }
+  }
+  assignPointers();
+  // The magic is written last, so other processes do not attach to a partially created pool
+  new (&header->magic) std::atomic<uint32_t>(0);
+  header->magic.store(MAGIC, std::memory_order_release);
+}
+
+bool SharedMemoryPool::hasSameLayout() const {
+  if (segment.getSize() < segmentSize) {
+    return false;
+  }
+  const uint8_t* base = segment.getData();
+  auto* header = reinterpret_cast<const SegmentHeader*>(base);
+  auto* subpoolHeaders = reinterpret_cast<const SubpoolHeader*>(base + sizeof(SegmentHeader));
+  if (header->magic.load(std::memory_order_acquire) != MAGIC or
+      header->version != LAYOUT_VERSION or header->numberOfSubpools != subpools.size()) {
+    return false;
+  }
+  for (size_t idx = 0; idx < subpools.size(); idx++) {
+    if (subpoolHeaders[idx].elementSize != subpools[idx].elementSize or
+        subpoolHeaders[idx].numberOfElements != subpools[idx].numberOfElements or
+        subpoolHeaders[idx].sizeListOffset != subpools[idx].sizeListOffset or
+        subpoolHeaders[idx].dataOffset != subpools[idx].dataOffset) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SharedMemoryPool::assignPointers() {
+  uint8_t* base = segment.getData();
+  auto* subpoolHeaders = reinterpret_cast<SubpoolHeader*>(base + sizeof(SegmentHeader));
+  for (size_t idx = 0; idx < subpools.size(); idx++) {
+    Subpool& subpool = subpools[idx];
+    subpool.header = &subpoolHeaders[idx];
+    subpool.sizeList = reinterpret_cast<std::atomic<uint32_t>*>(base + subpool.sizeListOffset);
+    subpool.data = base + subpool.dataOffset;
+  }
+}
@@ -0,0 +1,140 @@
+#ifndef FSFW_OSAL_LINUX_SHAREDMEMORYPOOL_H_
+#define FSFW_OSAL_LINUX_SHAREDMEMORYPOOL_H_
+
+#include <atomic>
+#include <vector>
+
+#include "fsfw/internalerror/InternalErrorReporterIF.h"
+#include "fsfw/objectmanager/SystemObject.h"
+#include "fsfw/osal/linux/SharedMemorySegment.h"
+#include "fsfw/storagemanager/LocalPool.h"
+#include "fsfw/storagemanager/StorageManagerIF.h"
+
+/**
+ * @brief   Store with the subpool layout of the LocalPool which lives in a POSIX shared
+ *          memory segment, so store IDs can be passed between processes.
+ * @details
+ * One process creates the pool, the other processes attach to it with the same name and
+ * configuration. A store ID which was obtained in one process refers to the same element in
+ * all processes, so packets can be handed over to another process without copying them, for
+ * example by sending the store ID with a SharedMessageQueue.
+ *
+ * Elements are reserved and freed with atomic operations on the size list inside the segment.
+ * The pool is therefore thread-safe and process-safe without a lock, but like with the
+ * LocalPool, only the process which owns a store ID may modify or delete the element. Deleted
+ * elements are not cleared.
+ */
+class SharedMemoryPool : public SystemObject, public StorageManagerIF {
+ public:
+  enum class Mode {
+    //! Create the segment, replacing an existing segment with the same name
+    CREATE,
+    //! Attach to a segment which was created by another process
+    ATTACH
+  };
+
+  /**
+   * @param name          Name of the shared memory segment. Must start with a slash.
+   * @param poolConfig    Subpool configuration. Must be the same in all processes.
+   * @param mode          Whether the pool is created or attached to. Attaching fails if the
+   *                      creating process did not create the pool yet, and can be retried
+   *                      with #map.
+   */
+  SharedMemoryPool(object_id_t setObjectId, const char* name,
+                   const LocalPool::LocalPoolConfig& poolConfig, Mode mode,
+                   bool registered = false);
+  virtual ~SharedMemoryPool();
+
+  /**
+   * @brief   Creates or attaches to the segment. Called by the constructor and by #initialize
+   *          if the pool is not mapped yet.
+   * @return  POOL_TOO_LARGE if the configuration is invalid, RETURN_FAILED if the segment
+   *          could not be mapped or has a different configuration
+   */
+  ReturnValue_t map();
+  bool isMapped() const;
+
+  ReturnValue_t addData(store_address_t* storeId, const uint8_t* data, size_t size,
+                        bool ignoreFault = false) override;
+  ReturnValue_t getFreeElement(store_address_t* storeId, const size_t size, uint8_t** pData,
+                               bool ignoreFault = false) override;
+
+  ConstAccessorPair getData(store_address_t storeId) override;
+  ReturnValue_t getData(store_address_t storeId, ConstStorageAccessor& constAccessor) override;
+  ReturnValue_t getData(store_address_t storeId, const uint8_t** packetPtr,
+                        size_t* size) override;
+
+  AccessorPair modifyData(store_address_t storeId) override;
+  ReturnValue_t modifyData(store_address_t storeId, StorageAccessor& storeAccessor) override;
+  ReturnValue_t modifyData(store_address_t storeId, uint8_t** packetPtr, size_t* size) override;
+
+  ReturnValue_t deleteData(store_address_t storeId) override;
+  ReturnValue_t deleteData(uint8_t* ptr, size_t size,
+                           store_address_t* storeId = nullptr) override;
+
+  size_t getTotalSize(size_t* additionalSize) override;
+  void getFillCount(uint8_t* buffer, uint8_t* bytesWritten) override;
+
+  void clearStore() override;
+  void clearSubPool(max_subpools_t poolIndex) override;
+
+  ReturnValue_t initialize() override;
+
+  max_subpools_t getNumberOfSubPools() const override;
+
+ private:
+  static constexpr uint32_t MAGIC = 0x46534d50;
+  static constexpr uint32_t LAYOUT_VERSION = 1;
+  static constexpr uint32_t STORAGE_FREE = 0xffffffff;
+  static constexpr size_t ALIGNMENT = 64;
+
+  static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                "Atomics in shared memory must be lock-free");
+
+  struct SegmentHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t numberOfSubpools;
+    uint32_t reserved;
+  };
+
+  struct SubpoolHeader {
+    uint64_t elementSize;
+    uint64_t numberOfElements;
+    uint64_t sizeListOffset;
+    uint64_t dataOffset;
+    //! Index at which the search for a free element starts
+    std::atomic<uint32_t> nextIndex;
+    uint32_t reserved;
+  };
+
+  struct Subpool {
+    size_t elementSize = 0;
+    uint16_t numberOfElements = 0;
+    size_t sizeListOffset = 0;
+    size_t dataOffset = 0;
+    SubpoolHeader* header = nullptr;
+    std::atomic<uint32_t>* sizeList = nullptr;
+    uint8_t* data = nullptr;
+  };
+
+  static constexpr const char* CLASS_NAME = "SharedMemoryPool";
+  static constexpr size_t MAX_NAME_LENGTH = 32;
+
+  char name[MAX_NAME_LENGTH] = {};
+  Mode mode;
+  bool configValid = true;
+  size_t segmentSize = 0;
+  SharedMemorySegment segment;
+  std::vector<Subpool> subpools;
+  InternalErrorReporterIF* internalErrorReporter = nullptr;
+
+  ReturnValue_t reserveSpace(size_t size, store_address_t* storeId, bool ignoreFault);
+  ReturnValue_t findEmpty(max_subpools_t poolIndex, size_t size, uint16_t* element);
+  ReturnValue_t checkStoreId(store_address_t storeId) const;
+  void initializeSegment();
+  bool hasSameLayout() const;
+  void assignPointers();
+};
+
+#endif /* FSFW_OSAL_LINUX_SHAREDMEMORYPOOL_H_ */
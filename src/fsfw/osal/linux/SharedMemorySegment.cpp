@@ -0,0 +1,82 @@
+#include "fsfw/osal/linux/SharedMemorySegment.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "fsfw/osal/linux/unixUtility.h"
+
+SharedMemorySegment::~SharedMemorySegment() { close(); }
+
+ReturnValue_t SharedMemorySegment::create(const char* name, size_t size) {
+  close();
+  if (name == nullptr or std::strlen(name) >= MAX_NAME_LENGTH or size == 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  shm_unlink(name);
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+  if (fd < 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "create", "shm_open");
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  if (ftruncate(fd, size) != 0) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "create", "ftruncate");
+    ::close(fd);
+    shm_unlink(name);
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  ReturnValue_t result = map(fd, size);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    shm_unlink(name);
+    return result;
+  }
+  std::strncpy(this->name, name, MAX_NAME_LENGTH - 1);
+  isOwner = true;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t SharedMemorySegment::open(const char* name) {
+  close();
+  if (name == nullptr) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  int fd = shm_open(name, O_RDWR, 0);
+  if (fd < 0) {
+    // Not an error if the creating process did not run yet
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  struct stat fileStatus;
+  if (fstat(fd, &fileStatus) != 0 or fileStatus.st_size == 0) {
+    ::close(fd);
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return map(fd, fileStatus.st_size);
+}
+
+void SharedMemorySegment::close() {
+  if (data != nullptr) {
+    munmap(data, size);
+    data = nullptr;
+    size = 0;
+  }
+  if (isOwner) {
+    shm_unlink(name);
+    isOwner = false;
+  }
+}
+
+ReturnValue_t SharedMemorySegment::map(int fd, size_t size) {
+  void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping stays valid after the file descriptor was closed
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    utility::printUnixErrorGeneric(CLASS_NAME, "map", "mmap");
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  data = static_cast<uint8_t*>(mapping);
+  this->size = size;
+  return HasReturnvaluesIF::RETURN_OK;
+}
@@ -0,0 +1,56 @@
+#ifndef FSFW_OSAL_LINUX_SHAREDMEMORYSEGMENT_H_
+#define FSFW_OSAL_LINUX_SHAREDMEMORYSEGMENT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fsfw/returnvalues/HasReturnvaluesIF.h"
+
+/**
+ * @brief   POSIX shared memory segment which is mapped into the address space of the process.
+ * @details
+ * The segment is created by one process and opened by name by the other processes. It may be
+ * mapped at a different address in each process, so data structures inside the segment must
+ * only use offsets instead of pointers. The creating process removes the name of the segment
+ * on destruction, processes which already opened the segment can still use it afterwards.
+ */
+class SharedMemorySegment {
+ public:
+  SharedMemorySegment() = default;
+  virtual ~SharedMemorySegment();
+
+  SharedMemorySegment(const SharedMemorySegment&) = delete;
+  SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+
+  /**
+   * @brief   Creates and maps a zero initialized segment.
+   * An existing segment with the same name, for example from a crashed previous run, is
+   * replaced.
+   * @param name  Name of the segment. Must start with a slash.
+   */
+  ReturnValue_t create(const char* name, size_t size);
+
+  /**
+   * @brief   Maps a segment which was created by another process.
+   */
+  ReturnValue_t open(const char* name);
+
+  void close();
+
+  bool isMapped() const { return data != nullptr; }
+  uint8_t* getData() const { return data; }
+  size_t getSize() const { return size; }
+
+ private:
+  static constexpr const char* CLASS_NAME = "SharedMemorySegment";
+  static constexpr size_t MAX_NAME_LENGTH = 32;
+
+  char name[MAX_NAME_LENGTH] = {};
+  bool isOwner = false;
+  uint8_t* data = nullptr;
+  size_t size = 0;
+
+  ReturnValue_t map(int fd, size_t size);
+};
+
+#endif /* FSFW_OSAL_LINUX_SHAREDMEMORYSEGMENT_H_ */
@@ -0,0 +1,342 @@
+#include "fsfw/osal/linux/SharedMessageQueue.h"
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <new>
+
+#include "fsfw/internalerror/InternalErrorReporterIF.h"
+#include "fsfw/objectmanager/ObjectManager.h"
+#include "fsfw/serviceinterface/ServiceInterface.h"
+
+namespace {
+constexpr size_t ALIGNMENT = 64;
+
+size_t align(size_t offset) { return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+uint64_t getMonotonicTimeMs() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+}
+}  // namespace
+
+SharedMessageQueueDomain::SharedMessageQueueDomain(const char* name, uint16_t numberOfQueues,
+                                                   uint32_t queueDepth, Mode mode)
+    : numberOfQueues(numberOfQueues), mode(mode) {
+  std::strncpy(this->name, name, MAX_NAME_LENGTH - 1);
+  // The positions wrap around, so the depth has to be a power of two
+  while (this->queueDepth < queueDepth and this->queueDepth < 0x80000000) {
+    this->queueDepth <<= 1;
+  }
+  map();
+}
+
+SharedMessageQueueDomain::~SharedMessageQueueDomain() {}
+
+ReturnValue_t SharedMessageQueueDomain::map() {
+  if (segment.isMapped()) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  if (numberOfQueues == 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  size_t segmentSize = align(sizeof(SegmentHeader)) + numberOfQueues * getRingSize();
+  if (mode == Mode::CREATE) {
+    ReturnValue_t result = segment.create(name, segmentSize);
+    if (result == HasReturnvaluesIF::RETURN_OK) {
+      initializeSegment();
+    }
+    return result;
+  }
+  ReturnValue_t result = segment.open(name);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  auto* header = reinterpret_cast<SegmentHeader*>(segment.getData());
+  if (segment.getSize() < segmentSize or
+      header->magic.load(std::memory_order_acquire) != MAGIC or
+      header->version != LAYOUT_VERSION or header->numberOfQueues != numberOfQueues or
+      header->queueDepth != queueDepth) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "SharedMessageQueueDomain::map: Layout of " << name << " does not match"
+               << std::endl;
+#else
+    sif::printError("SharedMessageQueueDomain::map: Layout of %s does not match\n", name);
+#endif
+    segment.close();
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+size_t SharedMessageQueueDomain::getRingSize() const {
+  return align(sizeof(RingHeader) + queueDepth * sizeof(Cell));
+}
+
+SharedMessageQueueDomain::RingHeader* SharedMessageQueueDomain::getRing(
+    uint16_t queueIndex) const {
+  return reinterpret_cast<RingHeader*>(segment.getData() + align(sizeof(SegmentHeader)) +
+                                       queueIndex * getRingSize());
+}
+
+SharedMessageQueueDomain::Cell* SharedMessageQueueDomain::getCells(uint16_t queueIndex) const {
+  return reinterpret_cast<Cell*>(reinterpret_cast<uint8_t*>(getRing(queueIndex)) +
+                                 sizeof(RingHeader));
+}
+
+void SharedMessageQueueDomain::initializeSegment() {
+  auto* header = reinterpret_cast<SegmentHeader*>(segment.getData());
+  header->version = LAYOUT_VERSION;
+  header->numberOfQueues = numberOfQueues;
+  header->queueDepth = queueDepth;
+  for (uint16_t queueIndex = 0; queueIndex < numberOfQueues; queueIndex++) {
+    RingHeader* ring = getRing(queueIndex);
+    new (&ring->enqueuePosition) std::atomic<uint32_t>(0);
+    new (&ring->publishCount) std::atomic<uint32_t>(0);
+    new (&ring->dequeuePosition) std::atomic<uint32_t>(0);
+    new (&ring->waiters) std::atomic<uint32_t>(0);
+    Cell* cells = getCells(queueIndex);
+    for (uint32_t idx = 0; idx < queueDepth; idx++) {
+      new (&cells[idx].sequence) std::atomic<uint32_t>(idx);
+    }
+  }
+  // The magic is written last, so other processes do not attach to a partially created domain
+  new (&header->magic) std::atomic<uint32_t>(0);
+  header->magic.store(MAGIC, std::memory_order_release);
+}
+
+SharedMessageQueue::SharedMessageQueue(SharedMessageQueueDomain& domain, uint16_t queueIndex,
+                                       MqArgs* args)
+    : MessageQueueBase(getQueueId(queueIndex), MessageQueueIF::NO_QUEUE, args),
+      domain(domain),
+      queueIndex(queueIndex) {
+  if (queueIndex >= domain.getNumberOfQueues()) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "SharedMessageQueue: Queue index " << queueIndex << " is invalid" << std::endl;
+#else
+    sif::printError("SharedMessageQueue: Queue index %d is invalid\n", queueIndex);
+#endif
+  }
+}
+
+SharedMessageQueue::~SharedMessageQueue() {}
+
+MessageQueueId_t SharedMessageQueue::getQueueId(uint16_t queueIndex) {
+  return QUEUE_ID_FLAG | queueIndex;
+}
+
+ReturnValue_t SharedMessageQueue::receiveMessage(MessageQueueMessageIF* message) {
+  size_t received = 0;
+  return receiveMessages(&message, 1, &received);
+}
+
+ReturnValue_t SharedMessageQueue::receiveMessages(MessageQueueMessageIF* const* messages,
+                                                  size_t maxMessages, size_t* received) {
+  if (messages == nullptr or received == nullptr or not domain.isMapped() or
+      queueIndex >= domain.getNumberOfQueues()) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  *received = 0;
+  SharedMessageQueueDomain::RingHeader* ring = domain.getRing(queueIndex);
+  SharedMessageQueueDomain::Cell* cells = domain.getCells(queueIndex);
+  const uint32_t mask = domain.queueDepth - 1;
+  ReturnValue_t result = MessageQueueIF::EMPTY;
+  // There is only one receiver, so the dequeue position can not change concurrently and is
+  // only published once for the whole batch
+  uint32_t position = ring->dequeuePosition.load(std::memory_order_relaxed);
+  while (*received < maxMessages) {
+    MessageQueueMessageIF* message = messages[*received];
+    SharedMessageQueueDomain::Cell& cell = cells[position & mask];
+    uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (message == nullptr or static_cast<int32_t>(sequence - (position + 1)) < 0) {
+      break;
+    }
+    bool messageFits = cell.size <= message->getMaximumMessageSize();
+    if (messageFits) {
+      std::memcpy(message->getBuffer(), cell.data, cell.size);
+      message->setMessageSize(cell.size);
+      this->last = message->getSender();
+    }
+    // Release the cell for the next round of the ring
+    cell.sequence.store(position + mask + 1, std::memory_order_release);
+    position++;
+    if (not messageFits) {
+      result = HasReturnvaluesIF::RETURN_FAILED;
+      break;
+    }
+    (*received)++;
+  }
+  ring->dequeuePosition.store(position, std::memory_order_relaxed);
+  if (*received > 0) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  return result;
+}
+
+ReturnValue_t SharedMessageQueue::flush(uint32_t* count) {
+  MessageQueueMessage message;
+  uint32_t flushed = 0;
+  while (receiveMessage(&message) == HasReturnvaluesIF::RETURN_OK) {
+    flushed++;
+  }
+  if (count != nullptr) {
+    *count = flushed;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t SharedMessageQueue::sendMessageFrom(MessageQueueId_t sendTo,
+                                                  MessageQueueMessageIF* message,
+                                                  MessageQueueId_t sentFrom, bool ignoreFault) {
+  return sendMessagesFrom(sendTo, &message, 1, sentFrom, nullptr, ignoreFault);
+}
+
+ReturnValue_t SharedMessageQueue::sendMessagesFrom(MessageQueueId_t sendTo,
+                                                   MessageQueueMessageIF* const* messages,
+                                                   size_t count, MessageQueueId_t sentFrom,
+                                                   size_t* sent, bool ignoreFault) {
+  if (sent != nullptr) {
+    *sent = 0;
+  }
+  if (messages == nullptr and count > 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  uint32_t destination = sendTo & ~QUEUE_ID_FLAG;
+  if ((sendTo & QUEUE_ID_FLAG) == 0 or destination >= domain.getNumberOfQueues() or
+      not domain.isMapped()) {
+    return MessageQueueIF::DESTINATION_INVALID;
+  }
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+  // Only the messages before the first invalid message are sent
+  size_t validMessages = 0;
+  for (; validMessages < count; validMessages++) {
+    MessageQueueMessageIF* message = messages[validMessages];
+    if (message == nullptr or message->getMessageSize() > MessageQueueMessage::MAX_MESSAGE_SIZE) {
+      result = HasReturnvaluesIF::RETURN_FAILED;
+      break;
+    }
+  }
+  if (validMessages == 0) {
+    return result;
+  }
+
+  SharedMessageQueueDomain::RingHeader* ring = domain.getRing(destination);
+  SharedMessageQueueDomain::Cell* cells = domain.getCells(destination);
+  const uint32_t mask = domain.queueDepth - 1;
+  size_t maxClaim = validMessages < domain.queueDepth ? validMessages : domain.queueDepth;
+  uint32_t position = ring->enqueuePosition.load(std::memory_order_relaxed);
+  uint32_t claimed = 0;
+  while (true) {
+    // The receiver frees the cells in order, so the free cells after the enqueue position can
+    // be claimed against other senders with one exchange
+    claimed = 0;
+    int32_t difference = 0;
+    while (claimed < maxClaim) {
+      SharedMessageQueueDomain::Cell& cell = cells[(position + claimed) & mask];
+      difference = static_cast<int32_t>(cell.sequence.load(std::memory_order_acquire) -
+                                        (position + claimed));
+      if (difference != 0) {
+        break;
+      }
+      claimed++;
+    }
+    if (claimed > 0) {
+      if (ring->enqueuePosition.compare_exchange_weak(position, position + claimed,
+                                                      std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (difference < 0) {
+      if (not ignoreFault) {
+        reportMessageNotSent(sendTo);
+      }
+      return MessageQueueIF::FULL;
+    } else {
+      position = ring->enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+  for (uint32_t idx = 0; idx < claimed; idx++) {
+    MessageQueueMessageIF* message = messages[idx];
+    SharedMessageQueueDomain::Cell& cell = cells[(position + idx) & mask];
+    message->setSender(sentFrom);
+    cell.size = message->getMessageSize();
+    std::memcpy(cell.data, message->getBuffer(), cell.size);
+    cell.sequence.store(position + idx + 1, std::memory_order_release);
+  }
+  ring->publishCount.fetch_add(claimed, std::memory_order_release);
+
+  // Pairs with the fence in waitForMessage, so either the receiver sees the messages or the
+  // sender sees the waiting receiver
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (ring->waiters.load(std::memory_order_relaxed) != 0) {
+    syscall(SYS_futex, &ring->publishCount, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+  }
+  if (sent != nullptr) {
+    *sent = claimed;
+  }
+  if (claimed < validMessages) {
+    // The queue was full before the remaining valid messages could be sent
+    if (not ignoreFault) {
+      reportMessageNotSent(sendTo);
+    }
+    return MessageQueueIF::FULL;
+  }
+  return result;
+}
+
+ReturnValue_t SharedMessageQueue::waitForMessage(int timeoutMs) {
+  if (not domain.isMapped() or queueIndex >= domain.getNumberOfQueues()) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  if (not isEmpty()) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  SharedMessageQueueDomain::RingHeader* ring = domain.getRing(queueIndex);
+  uint64_t deadline = getMonotonicTimeMs() + (timeoutMs > 0 ? timeoutMs : 0);
+  ReturnValue_t result = MessageQueueIF::EMPTY;
+  ring->waiters.fetch_add(1, std::memory_order_relaxed);
+  while (true) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t observedCount = ring->publishCount.load(std::memory_order_acquire);
+    if (not isEmpty()) {
+      result = HasReturnvaluesIF::RETURN_OK;
+      break;
+    }
+    timespec timeout = {};
+    timespec* timeoutPtr = nullptr;
+    if (timeoutMs >= 0) {
+      uint64_t now = getMonotonicTimeMs();
+      if (now >= deadline) {
+        break;
+      }
+      timeout.tv_sec = (deadline - now) / 1000;
+      timeout.tv_nsec = ((deadline - now) % 1000) * 1000000;
+      timeoutPtr = &timeout;
+    }
+    // Returns immediately if a message was published after the count was read
+    syscall(SYS_futex, &ring->publishCount, FUTEX_WAIT, observedCount, timeoutPtr, nullptr, 0);
+  }
+  ring->waiters.fetch_sub(1, std::memory_order_relaxed);
+  return result;
+}
+
+void SharedMessageQueue::reportMessageNotSent(MessageQueueId_t sendTo) {
+  InternalErrorReporterIF* internalErrorReporter =
+      ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
+  if (internalErrorReporter != nullptr) {
+    internalErrorReporter->queueMessageNotSentTo(sendTo);
+  }
+}
+
+bool SharedMessageQueue::isEmpty() const {
+  SharedMessageQueueDomain::RingHeader* ring = domain.getRing(queueIndex);
+  SharedMessageQueueDomain::Cell* cells = domain.getCells(queueIndex);
+  uint32_t position = ring->dequeuePosition.load(std::memory_order_relaxed);
+  uint32_t sequence =
+      cells[position & (domain.queueDepth - 1)].sequence.load(std::memory_order_acquire);
+  return static_cast<int32_t>(sequence - (position + 1)) < 0;
+}
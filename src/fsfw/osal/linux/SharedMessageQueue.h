@@ -0,0 +1,157 @@
+#ifndef FSFW_OSAL_LINUX_SHAREDMESSAGEQUEUE_H_
+#define FSFW_OSAL_LINUX_SHAREDMESSAGEQUEUE_H_
+
+#include <atomic>
+
+#include "fsfw/ipc/MessageQueueBase.h"
+#include "fsfw/ipc/MessageQueueMessage.h"
+#include "fsfw/osal/linux/SharedMemorySegment.h"
+
+/**
+ * @brief   Set of message queues in a POSIX shared memory segment which can be used by
+ *          several processes.
+ * @details
+ * The domain contains a fixed number of queues which are identified by their index, so the
+ * processes have to agree on the queue indexes like they agree on object IDs. One process
+ * creates the domain, the other processes attach to it with the same name and configuration.
+ * Each queue is a bounded lock-free ring, so any number of threads and processes can send to
+ * a queue while one thread receives from it.
+ */
+class SharedMessageQueueDomain {
+ public:
+  enum class Mode {
+    //! Create the segment, replacing an existing segment with the same name
+    CREATE,
+    //! Attach to a segment which was created by another process
+    ATTACH
+  };
+
+  /**
+   * @param name              Name of the shared memory segment. Must start with a slash.
+   * @param numberOfQueues    Number of queues in the domain
+   * @param queueDepth        Number of messages per queue, rounded up to a power of two
+   * @param mode              Whether the domain is created or attached to. Attaching fails if
+   *                          the creating process did not create the domain yet, and can be
+   *                          retried with #map.
+   */
+  SharedMessageQueueDomain(const char* name, uint16_t numberOfQueues, uint32_t queueDepth,
+                           Mode mode);
+  virtual ~SharedMessageQueueDomain();
+
+  ReturnValue_t map();
+  bool isMapped() const { return segment.isMapped(); }
+  uint16_t getNumberOfQueues() const { return numberOfQueues; }
+
+ private:
+  friend class SharedMessageQueue;
+
+  static constexpr uint32_t MAGIC = 0x46534d51;
+  static constexpr uint32_t LAYOUT_VERSION = 1;
+  static constexpr size_t MAX_NAME_LENGTH = 32;
+
+  static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                "Atomics in shared memory must be lock-free");
+
+  struct SegmentHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t numberOfQueues;
+    uint32_t queueDepth;
+  };
+
+  //! The positions are placed in separate cache lines to avoid false sharing
+  struct alignas(64) RingHeader {
+    alignas(64) std::atomic<uint32_t> enqueuePosition;
+    //! Incremented after each published message, used to wake up the receiver with a futex
+    std::atomic<uint32_t> publishCount;
+    alignas(64) std::atomic<uint32_t> dequeuePosition;
+    //! Number of threads blocking in SharedMessageQueue::waitForMessage
+    std::atomic<uint32_t> waiters;
+  };
+
+  struct Cell {
+    std::atomic<uint32_t> sequence;
+    uint32_t size;
+    uint8_t data[MessageQueueMessage::MAX_MESSAGE_SIZE];
+  };
+
+  char name[MAX_NAME_LENGTH] = {};
+  uint16_t numberOfQueues;
+  uint32_t queueDepth = 1;
+  Mode mode;
+  SharedMemorySegment segment;
+
+  size_t getRingSize() const;
+  RingHeader* getRing(uint16_t queueIndex) const;
+  Cell* getCells(uint16_t queueIndex) const;
+  void initializeSegment();
+};
+
+/**
+ * @brief   Message queue in a SharedMessageQueueDomain.
+ * @details
+ * The queue can send messages to all queues of the same domain, also to queues which are
+ * received by other processes. Together with the SharedMemoryPool, this allows passing store
+ * IDs of packets between processes. Queue IDs of other OSAL queues are not valid destinations.
+ *
+ * Like the Linux MessageQueue, receiving does not block. #waitForMessage can be used to block
+ * until a message arrives.
+ */
+class SharedMessageQueue : public MessageQueueBase {
+ public:
+  //! Flag which distinguishes the IDs of shared queues from the IDs of other queues
+  static constexpr MessageQueueId_t QUEUE_ID_FLAG = 0x80000000;
+
+  /**
+   * @param domain        Domain containing the queue. Must be mapped before the queue is used.
+   * @param queueIndex    Index of the queue which is received by this object. Each queue
+   *                      must only be received by one object.
+   */
+  SharedMessageQueue(SharedMessageQueueDomain& domain, uint16_t queueIndex,
+                     MqArgs* args = nullptr);
+  virtual ~SharedMessageQueue();
+
+  SharedMessageQueue(const SharedMessageQueue&) = delete;
+  SharedMessageQueue& operator=(const SharedMessageQueue&) = delete;
+
+  /**
+   * @brief   Returns the queue ID of the queue with the given index in a domain.
+   */
+  static MessageQueueId_t getQueueId(uint16_t queueIndex);
+
+  ReturnValue_t receiveMessage(MessageQueueMessageIF* message) override;
+  ReturnValue_t flush(uint32_t* count) override;
+  ReturnValue_t sendMessageFrom(MessageQueueId_t sendTo, MessageQueueMessageIF* message,
+                                MessageQueueId_t sentFrom, bool ignoreFault = false) override;
+
+  /**
+   * @brief   Receives the messages with one update of the dequeue position.
+   */
+  ReturnValue_t receiveMessages(MessageQueueMessageIF* const* messages, size_t maxMessages,
+                                size_t* received) override;
+  /**
+   * @brief   Reserves the free cells for all messages with one exchange, so the messages are
+   *          stored contiguously even if other senders send to the same queue concurrently.
+   */
+  ReturnValue_t sendMessagesFrom(MessageQueueId_t sendTo, MessageQueueMessageIF* const* messages,
+                                 size_t count, MessageQueueId_t sentFrom, size_t* sent,
+                                 bool ignoreFault = false) override;
+
+  /**
+   * @brief   Blocks until the queue contains a message.
+   * @param timeoutMs     Timeout in milliseconds. A negative value blocks indefinitely.
+   * @return  MessageQueueIF::EMPTY if no message arrived before the timeout
+   */
+  ReturnValue_t waitForMessage(int timeoutMs);
+
+ private:
+  static constexpr const char* CLASS_NAME = "SharedMessageQueue";
+
+  SharedMessageQueueDomain& domain;
+  uint16_t queueIndex;
+
+  bool isEmpty() const;
+  static void reportMessageNotSent(MessageQueueId_t sendTo);
+};
+
+#endif /* FSFW_OSAL_LINUX_SHAREDMESSAGEQUEUE_H_ */
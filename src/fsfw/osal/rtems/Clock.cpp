@@ -67,6 +67,8 @@ ReturnValue_t Clock::getClock_timeval(timeval* time) {
   }
 }
 
+ReturnValue_t Clock::getClockCoarse_timeval(timeval* time) { return getClock_timeval(time); }
+
 ReturnValue_t Clock::getUptime(timeval* uptime) {
   // According to docs.rtems.org for rtems 5 this method is more accurate than
   // rtems_clock_get_ticks_since_boot
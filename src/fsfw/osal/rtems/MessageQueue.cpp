@@ -60,7 +60,7 @@ ReturnValue_t MessageQueue::sendMessageFrom(MessageQueueId_t sendTo, MessageQueu
           ObjectManager::instance()->get<InternalErrorReporterIF>(objects::INTERNAL_ERROR_REPORTER);
     }
     if (internalErrorReporter != nullptr) {
-      internalErrorReporter->queueMessageNotSent();
+      internalErrorReporter->queueMessageNotSentTo(sendTo);
     }
   }
 
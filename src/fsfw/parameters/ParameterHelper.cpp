@@ -2,6 +2,21 @@
 
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/parameters/ParameterMessage.h"
+#include "fsfw/timemanager/Clock.h"
+
+namespace {
+
+uint32_t getElapsedUs(uint64_t startUs) {
+  uint64_t nowUs = 0;
+  Clock::getClock_usecs(&nowUs);
+  if (nowUs < startUs) {
+    return 0;
+  }
+  uint64_t elapsedUs = nowUs - startUs;
+  return elapsedUs > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(elapsedUs);
+}
+
+}  // namespace
 
 ParameterHelper::ParameterHelper(ReceivesParameterMessagesIF* owner) : owner(owner) {}
 
@@ -17,10 +32,7 @@ ReturnValue_t ParameterHelper::handleParameterMessage(CommandMessage* message) {
   switch (message->getCommand()) {
     case ParameterMessage::CMD_PARAMETER_DUMP: {
       ParameterWrapper description;
-      uint8_t domain = HasParametersIF::getDomain(ParameterMessage::getParameterId(message));
-      uint8_t uniqueIdentifier =
-          HasParametersIF::getUniqueIdentifierId(ParameterMessage::getParameterId(message));
-      result = owner->getParameter(domain, uniqueIdentifier, &description, &description, 0);
+      result = getDumpDescription(ParameterMessage::getParameterId(message), &description);
       if (result == HasReturnvaluesIF::RETURN_OK) {
         result = sendParameter(message->getSender(), ParameterMessage::getParameterId(message),
                                &description);
@@ -36,10 +48,6 @@ ReturnValue_t ParameterHelper::handleParameterMessage(CommandMessage* message) {
           message, &parameterId, &ptc, &pfc, &rows, &columns);
       Type type(Type::getActualType(ptc, pfc));
 
-      uint8_t domain = HasParametersIF::getDomain(parameterId);
-      uint8_t uniqueIdentifier = HasParametersIF::getUniqueIdentifierId(parameterId);
-      uint16_t linearIndex = HasParametersIF::getIndex(parameterId);
-
       ConstStorageAccessor accessor(storeId);
       result = storage->getData(storeId, accessor);
       if (result != HasReturnvaluesIF::RETURN_OK) {
@@ -57,13 +65,7 @@ ReturnValue_t ParameterHelper::handleParameterMessage(CommandMessage* message) {
       }
 
       ParameterWrapper ownerWrapper;
-      result =
-          owner->getParameter(domain, uniqueIdentifier, &ownerWrapper, &streamWrapper, linearIndex);
-      if (result != HasReturnvaluesIF::RETURN_OK) {
-        return result;
-      }
-
-      result = ownerWrapper.copyFrom(&streamWrapper, linearIndex);
+      result = loadParameter(parameterId, &streamWrapper, &ownerWrapper);
       if (result != HasReturnvaluesIF::RETURN_OK) {
         return result;
       }
@@ -72,6 +74,12 @@ ReturnValue_t ParameterHelper::handleParameterMessage(CommandMessage* message) {
                              &ownerWrapper);
       break;
     }
+    case ParameterMessage::CMD_PARAMETER_BULK_LOAD:
+      result = handleBulkLoad(message);
+      break;
+    case ParameterMessage::CMD_PARAMETER_BULK_DUMP:
+      result = handleBulkDump(message);
+      break;
     default:
       return HasReturnvaluesIF::RETURN_FAILED;
   }
@@ -114,6 +122,161 @@ ReturnValue_t ParameterHelper::sendParameter(MessageQueueId_t to, uint32_t id,
   return HasReturnvaluesIF::RETURN_OK;
 }
 
+ReturnValue_t ParameterHelper::loadParameter(ParameterId_t parameterId,
+                                             const ParameterWrapper* streamWrapper,
+                                             ParameterWrapper* ownerWrapper) {
+  uint8_t domain = HasParametersIF::getDomain(parameterId);
+  uint8_t uniqueIdentifier = HasParametersIF::getUniqueIdentifierId(parameterId);
+  uint16_t linearIndex = HasParametersIF::getIndex(parameterId);
+  ReturnValue_t result =
+      owner->getParameter(domain, uniqueIdentifier, ownerWrapper, streamWrapper, linearIndex);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  return ownerWrapper->copyFrom(streamWrapper, linearIndex);
+}
+
+ReturnValue_t ParameterHelper::loadParameterFromStream(const uint8_t** stream,
+                                                       size_t* streamSize) {
+  ParameterId_t parameterId = 0;
+  uint32_t packedParamSettings = 0;
+  ReturnValue_t result = SerializeAdapter::deSerialize(&parameterId, stream, streamSize,
+                                                       SerializeIF::Endianness::BIG);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  result = SerializeAdapter::deSerialize(&packedParamSettings, stream, streamSize,
+                                         SerializeIF::Endianness::BIG);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  Type type(Type::getActualType(packedParamSettings >> 24 & 0xff,
+                                packedParamSettings >> 16 & 0xff));
+  uint8_t rows = packedParamSettings >> 8 & 0xff;
+  uint8_t columns = packedParamSettings & 0xff;
+  size_t dataSize = static_cast<size_t>(type.getSize()) * rows * columns;
+  if (*streamSize < dataSize) {
+    return SerializeIF::STREAM_TOO_SHORT;
+  }
+
+  ParameterWrapper streamWrapper;
+  result = streamWrapper.set(type, rows, columns, *stream, dataSize);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  *stream += dataSize;
+  *streamSize -= dataSize;
+
+  ParameterWrapper ownerWrapper;
+  return loadParameter(parameterId, &streamWrapper, &ownerWrapper);
+}
+
+ReturnValue_t ParameterHelper::getDumpDescription(ParameterId_t parameterId,
+                                                  ParameterWrapper* description) {
+  uint8_t domain = HasParametersIF::getDomain(parameterId);
+  uint8_t uniqueIdentifier = HasParametersIF::getUniqueIdentifierId(parameterId);
+  return owner->getParameter(domain, uniqueIdentifier, description, description, 0);
+}
+
+ReturnValue_t ParameterHelper::handleBulkLoad(const CommandMessage* message) {
+  uint64_t startUs = 0;
+  Clock::getClock_usecs(&startUs);
+
+  store_address_t storeId = ParameterMessage::getStoreId(message);
+  ConstStorageAccessor accessor(storeId);
+  ReturnValue_t result = storage->getData(storeId, accessor);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+
+  // Parameters which were loaded before a failure stay loaded, the reply contains their number
+  const uint8_t* stream = accessor.data();
+  size_t streamSize = accessor.size();
+  uint32_t numberOfParameters = 0;
+  while (streamSize > 0) {
+    result = loadParameterFromStream(&stream, &streamSize);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      break;
+    }
+    numberOfParameters++;
+  }
+
+  CommandMessage reply;
+  ParameterMessage::setParameterBulkLoadReply(&reply, numberOfParameters, result,
+                                              getElapsedUs(startUs));
+  MessageQueueSenderIF::sendMessage(message->getSender(), &reply, ownerQueueId);
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t ParameterHelper::handleBulkDump(const CommandMessage* message) {
+  uint64_t startUs = 0;
+  Clock::getClock_usecs(&startUs);
+
+  store_address_t requestId = ParameterMessage::getStoreId(message);
+  ConstStorageAccessor accessor(requestId);
+  ReturnValue_t result = storage->getData(requestId, accessor);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  if (accessor.size() % sizeof(ParameterId_t) != 0) {
+    return SerializeIF::STREAM_TOO_SHORT;
+  }
+  uint32_t numberOfParameters = accessor.size() / sizeof(ParameterId_t);
+
+  // The size of the reply is determined first, so a single store element can be used
+  size_t replySize = 0;
+  const uint8_t* ids = accessor.data();
+  size_t idsSize = accessor.size();
+  for (uint32_t idx = 0; idx < numberOfParameters; idx++) {
+    ParameterId_t parameterId = 0;
+    SerializeAdapter::deSerialize(&parameterId, &ids, &idsSize, SerializeIF::Endianness::BIG);
+    ParameterWrapper description;
+    result = getDumpDescription(parameterId, &description);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+    replySize += sizeof(ParameterId_t) + description.getSerializedSize();
+  }
+
+  store_address_t replyId;
+  uint8_t* storeElement = nullptr;
+  result = storage->getFreeElement(&replyId, replySize, &storeElement);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+
+  size_t serializedSize = 0;
+  ids = accessor.data();
+  idsSize = accessor.size();
+  for (uint32_t idx = 0; idx < numberOfParameters; idx++) {
+    ParameterId_t parameterId = 0;
+    SerializeAdapter::deSerialize(&parameterId, &ids, &idsSize, SerializeIF::Endianness::BIG);
+    ParameterWrapper description;
+    result = getDumpDescription(parameterId, &description);
+    if (result == HasReturnvaluesIF::RETURN_OK) {
+      result = SerializeAdapter::serialize(&parameterId, &storeElement, &serializedSize,
+                                           replySize, SerializeIF::Endianness::BIG);
+    }
+    if (result == HasReturnvaluesIF::RETURN_OK) {
+      result = description.serialize(&storeElement, &serializedSize, replySize,
+                                     SerializeIF::Endianness::BIG);
+    }
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      storage->deleteData(replyId);
+      return result;
+    }
+  }
+
+  CommandMessage reply;
+  ParameterMessage::setParameterBulkDumpReply(&reply, numberOfParameters, replyId,
+                                              getElapsedUs(startUs));
+  result = MessageQueueSenderIF::sendMessage(message->getSender(), &reply, ownerQueueId);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    storage->deleteData(replyId);
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
 ReturnValue_t ParameterHelper::initialize() {
   ownerQueueId = owner->getCommandQueue();
 
@@ -10,6 +10,9 @@
  * @details
  * This class simplfies handling of parameter messages, which are sent
  * to a class which implements ReceivesParameterMessagesIF.
+ *
+ * Besides single parameters, the helper handles bulk loads and dumps of many parameters
+ * with one message. The bulk replies contain the processing time of the whole batch.
  */
 class ParameterHelper {
  public:
@@ -30,6 +33,14 @@ class ParameterHelper {
   ReturnValue_t sendParameter(MessageQueueId_t to, uint32_t id,
                               const ParameterWrapper *description);
 
+  ReturnValue_t loadParameter(ParameterId_t parameterId, const ParameterWrapper *streamWrapper,
+                              ParameterWrapper *ownerWrapper);
+  ReturnValue_t loadParameterFromStream(const uint8_t **stream, size_t *streamSize);
+  ReturnValue_t getDumpDescription(ParameterId_t parameterId, ParameterWrapper *description);
+
+  ReturnValue_t handleBulkLoad(const CommandMessage *message);
+  ReturnValue_t handleBulkDump(const CommandMessage *message);
+
   void rejectCommand(MessageQueueId_t to, ReturnValue_t reason, Command_t initialCommand);
 };
 
@@ -47,10 +47,59 @@ store_address_t ParameterMessage::getParameterLoadCommand(const CommandMessage*
   return message->getParameter2();
 }
 
+void ParameterMessage::setParameterBulkLoadCommand(CommandMessage* message,
+                                                   store_address_t storeId) {
+  message->setCommand(CMD_PARAMETER_BULK_LOAD);
+  message->setParameter2(storeId.raw);
+}
+
+void ParameterMessage::setParameterBulkDumpCommand(CommandMessage* message,
+                                                   store_address_t storeId) {
+  message->setCommand(CMD_PARAMETER_BULK_DUMP);
+  message->setParameter2(storeId.raw);
+}
+
+void ParameterMessage::setParameterBulkLoadReply(CommandMessage* message,
+                                                 uint32_t numberOfParameters, ReturnValue_t result,
+                                                 uint32_t durationUs) {
+  message->setCommand(REPLY_PARAMETER_BULK_LOAD);
+  message->setParameter(numberOfParameters);
+  message->setParameter2(result);
+  message->setParameter3(durationUs);
+}
+
+void ParameterMessage::getParameterBulkLoadReply(const CommandMessage* message,
+                                                 uint32_t* numberOfParameters,
+                                                 ReturnValue_t* result, uint32_t* durationUs) {
+  *numberOfParameters = message->getParameter();
+  *result = message->getParameter2();
+  *durationUs = message->getParameter3();
+}
+
+void ParameterMessage::setParameterBulkDumpReply(CommandMessage* message,
+                                                 uint32_t numberOfParameters,
+                                                 store_address_t storeId, uint32_t durationUs) {
+  message->setCommand(REPLY_PARAMETER_BULK_DUMP);
+  message->setParameter(numberOfParameters);
+  message->setParameter2(storeId.raw);
+  message->setParameter3(durationUs);
+}
+
+store_address_t ParameterMessage::getParameterBulkDumpReply(const CommandMessage* message,
+                                                            uint32_t* numberOfParameters,
+                                                            uint32_t* durationUs) {
+  *numberOfParameters = message->getParameter();
+  *durationUs = message->getParameter3();
+  return message->getParameter2();
+}
+
 void ParameterMessage::clear(CommandMessage* message) {
   switch (message->getCommand()) {
     case CMD_PARAMETER_LOAD:
-    case REPLY_PARAMETER_DUMP: {
+    case REPLY_PARAMETER_DUMP:
+    case CMD_PARAMETER_BULK_LOAD:
+    case CMD_PARAMETER_BULK_DUMP:
+    case REPLY_PARAMETER_BULK_DUMP: {
       StorageManagerIF* ipcStore =
           ObjectManager::instance()->get<StorageManagerIF>(objects::IPC_STORE);
       if (ipcStore != NULL) {
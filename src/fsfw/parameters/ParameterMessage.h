@@ -18,6 +18,13 @@
  *     is the number of columns. For single variable parameters, this will
  *     be [1, 1].
  *
+ * The bulk commands transfer many parameters of one object with a single message. The
+ * parameters are stored back-to-back in one store element, all fields in big endian:
+ *  - Bulk load: Each entry consists of the 4-byte parameter ID, the 4-byte parameter
+ *    settings described above and the parameter data.
+ *  - Bulk dump: The command contains the 4-byte parameter IDs. Each entry of the reply
+ *    consists of the 4-byte parameter ID followed by the serialized ParameterWrapper,
+ *    which is the same format as the one of the single parameter dump reply.
  */
 class ParameterMessage {
  private:
@@ -28,6 +35,14 @@ class ParameterMessage {
   static const Command_t CMD_PARAMETER_LOAD = MAKE_COMMAND_ID(0x01);
   static const Command_t CMD_PARAMETER_DUMP = MAKE_COMMAND_ID(0x02);
   static const Command_t REPLY_PARAMETER_DUMP = MAKE_COMMAND_ID(0x03);
+  static const Command_t CMD_PARAMETER_BULK_LOAD = MAKE_COMMAND_ID(0x04);
+  static const Command_t CMD_PARAMETER_BULK_DUMP = MAKE_COMMAND_ID(0x05);
+  //! Parameter 1: Number of loaded parameters, parameter 2: Result of the first failed
+  //! parameter or RETURN_OK, parameter 3: Processing time of the batch in microseconds.
+  static const Command_t REPLY_PARAMETER_BULK_LOAD = MAKE_COMMAND_ID(0x06);
+  //! Parameter 1: Number of dumped parameters, parameter 2: Store ID of the dumped parameters,
+  //! parameter 3: Processing time of the batch in microseconds.
+  static const Command_t REPLY_PARAMETER_BULK_DUMP = MAKE_COMMAND_ID(0x07);
 
   static ParameterId_t getParameterId(const CommandMessage* message);
   static store_address_t getStoreId(const CommandMessage* message);
@@ -55,6 +70,21 @@ class ParameterMessage {
                                                  ParameterId_t* parameterId, uint8_t* ptc,
                                                  uint8_t* pfc, uint8_t* rows, uint8_t* columns);
 
+  static void setParameterBulkLoadCommand(CommandMessage* message, store_address_t storeId);
+  static void setParameterBulkDumpCommand(CommandMessage* message, store_address_t storeId);
+
+  static void setParameterBulkLoadReply(CommandMessage* message, uint32_t numberOfParameters,
+                                        ReturnValue_t result, uint32_t durationUs);
+  static void getParameterBulkLoadReply(const CommandMessage* message,
+                                        uint32_t* numberOfParameters, ReturnValue_t* result,
+                                        uint32_t* durationUs);
+
+  static void setParameterBulkDumpReply(CommandMessage* message, uint32_t numberOfParameters,
+                                        store_address_t storeId, uint32_t durationUs);
+  static store_address_t getParameterBulkDumpReply(const CommandMessage* message,
+                                                   uint32_t* numberOfParameters,
+                                                   uint32_t* durationUs);
+
   static void clear(CommandMessage* message);
 };
 
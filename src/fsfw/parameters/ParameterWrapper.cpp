@@ -1,8 +1,40 @@
 #include "fsfw/parameters/ParameterWrapper.h"
 
+#include <cstring>
+
 #include "fsfw/FSFW.h"
+#include "fsfw/osal/Endiness.h"
+#include "fsfw/serialize/EndianConverter.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 
+namespace {
+
+bool requiresByteSwap(SerializeIF::Endianness endianness) {
+  switch (endianness) {
+    case SerializeIF::Endianness::BIG:
+      return BYTE_ORDER_SYSTEM != BIG_ENDIAN;
+    case SerializeIF::Endianness::LITTLE:
+      return BYTE_ORDER_SYSTEM != LITTLE_ENDIAN;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Copies a block of elements and swaps the byte order of each element if required.
+ * Only the element size is relevant for this, so the copy does not depend on the actual type.
+ */
+void copyElements(uint8_t *out, const uint8_t *in, size_t count, uint8_t elementSize,
+                  bool swapBytes) {
+  if (not swapBytes) {
+    std::memcpy(out, in, count * elementSize);
+    return;
+  }
+  EndianConverter::swapArray(out, in, elementSize, count);
+}
+
+}  // namespace
+
 ParameterWrapper::ParameterWrapper() : pointsToStream(false), type(Type::UNKNOWN_TYPE) {}
 
 ParameterWrapper::ParameterWrapper(Type type, uint8_t rows, uint8_t columns, void *data)
@@ -45,36 +77,7 @@ ReturnValue_t ParameterWrapper::serialize(uint8_t **buffer, size_t *size, size_t
   if (readonlyData == nullptr) {
     return NOT_SET;
   }
-  switch (type) {
-    case Type::UINT8_T:
-      result = serializeData<uint8_t>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::INT8_T:
-      result = serializeData<int8_t>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::UINT16_T:
-      result = serializeData<uint16_t>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::INT16_T:
-      result = serializeData<int16_t>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::UINT32_T:
-      result = serializeData<uint32_t>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::INT32_T:
-      result = serializeData<int32_t>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::FLOAT:
-      result = serializeData<float>(buffer, size, maxSize, streamEndianness);
-      break;
-    case Type::DOUBLE:
-      result = serializeData<double>(buffer, size, maxSize, streamEndianness);
-      break;
-    default:
-      result = UNKNOWN_DATATYPE;
-      break;
-  }
-  return result;
+  return serializeData(buffer, size, maxSize, streamEndianness);
 }
 
 size_t ParameterWrapper::getSerializedSize() const {
@@ -87,48 +90,55 @@ size_t ParameterWrapper::getSerializedSize() const {
   return serializedSize;
 }
 
-template <typename T>
 ReturnValue_t ParameterWrapper::serializeData(uint8_t **buffer, size_t *size, size_t maxSize,
                                               Endianness streamEndianness) const {
-  const T *element = (const T *)readonlyData;
-  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
-  uint16_t dataSize = columns * rows;
-  while (dataSize != 0) {
-    result = SerializeAdapter::serialize(element, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    element++;
-    dataSize--;
+  uint8_t typeSize = type.getSize();
+  if (typeSize == 0) {
+    return UNKNOWN_DATATYPE;
   }
-  return result;
+  size_t dataSize = static_cast<size_t>(rows) * columns * typeSize;
+  if (*size + dataSize > maxSize) {
+    return SerializeIF::BUFFER_TOO_SHORT;
+  }
+  // Data which points to a stream was set from a big endian stream
+  bool swapBytes = requiresByteSwap(streamEndianness);
+  if (pointsToStream) {
+    swapBytes = swapBytes != requiresByteSwap(SerializeIF::Endianness::BIG);
+  }
+  copyElements(*buffer, static_cast<const uint8_t *>(readonlyData),
+               static_cast<size_t>(rows) * columns, typeSize, swapBytes);
+  *buffer += dataSize;
+  *size += dataSize;
+  return HasReturnvaluesIF::RETURN_OK;
 }
 
-template <typename T>
 ReturnValue_t ParameterWrapper::deSerializeData(uint8_t startingRow, uint8_t startingColumn,
                                                 const void *from, uint8_t fromRows,
                                                 uint8_t fromColumns) {
-  // treat from as a continuous Stream as we copy all of it
-  const uint8_t *fromAsStream = reinterpret_cast<const uint8_t *>(from);
-  size_t streamSize = fromRows * fromColumns * sizeof(T);
-
-  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
-
+  uint8_t typeSize = type.getSize();
+  if (typeSize == 0) {
+    return UNKNOWN_DATATYPE;
+  }
+  // treat from as a continuous big endian stream as we copy all of it
+  const uint8_t *fromAsStream = static_cast<const uint8_t *>(from);
+  uint8_t *typedData = static_cast<uint8_t *>(data);
+  bool swapBytes = requiresByteSwap(SerializeIF::Endianness::BIG);
+  size_t rowSize = static_cast<size_t>(fromColumns) * typeSize;
+
+  if (startingColumn == 0 and fromColumns == columns) {
+    // The target rows are contiguous, so the whole block can be converted at once
+    copyElements(typedData + static_cast<size_t>(startingRow) * rowSize, fromAsStream,
+                 static_cast<size_t>(fromRows) * fromColumns, typeSize, swapBytes);
+    return HasReturnvaluesIF::RETURN_OK;
+  }
   for (uint8_t fromRow = 0; fromRow < fromRows; fromRow++) {
     // get the start element of this row in data
-    uint16_t offset = (((startingRow + fromRow) * static_cast<uint16_t>(columns)) + startingColumn);
-    T *dataWithDataType = static_cast<T *>(data) + offset;
-
-    for (uint8_t fromColumn = 0; fromColumn < fromColumns; fromColumn++) {
-      result = SerializeAdapter::deSerialize(dataWithDataType + fromColumn, &fromAsStream,
-                                             &streamSize, SerializeIF::Endianness::BIG);
-      if (result != HasReturnvaluesIF::RETURN_OK) {
-        return result;
-      }
-    }
+    size_t offset =
+        ((startingRow + fromRow) * static_cast<size_t>(columns) + startingColumn) * typeSize;
+    copyElements(typedData + offset, fromAsStream, fromColumns, typeSize, swapBytes);
+    fromAsStream += rowSize;
   }
-
-  return result;
+  return HasReturnvaluesIF::RETURN_OK;
 }
 
 ReturnValue_t ParameterWrapper::deSerialize(const uint8_t **buffer, size_t *size,
@@ -156,7 +166,7 @@ ReturnValue_t ParameterWrapper::set(Type type, uint8_t rows, uint8_t columns, co
   this->columns = columns;
 
   size_t expectedSize = type.getSize() * rows * columns;
-  if (expectedSize < dataSize) {
+  if (dataSize < expectedSize) {
     return SerializeIF::STREAM_TOO_SHORT;
   }
 
@@ -264,58 +274,25 @@ ReturnValue_t ParameterWrapper::copyFrom(const ParameterWrapper *from,
   }
 
   uint8_t typeSize = type.getSize();
+  if (typeSize == 0) {
+    return UNKNOWN_DATATYPE;
+  }
 
-  ReturnValue_t result = HasReturnvaluesIF::RETURN_FAILED;
   // copy data
   if (from->pointsToStream) {
-    switch (type) {
-      case Type::UINT8_T:
-        result = deSerializeData<uint8_t>(startingRow, startingColumn, from->readonlyData,
-                                          from->rows, from->columns);
-        break;
-      case Type::INT8_T:
-        result = deSerializeData<int8_t>(startingRow, startingColumn, from->readonlyData,
-                                         from->rows, from->columns);
-        break;
-      case Type::UINT16_T:
-        result = deSerializeData<uint16_t>(startingRow, startingColumn, from->readonlyData,
-                                           from->rows, from->columns);
-        break;
-      case Type::INT16_T:
-        result = deSerializeData<int16_t>(startingRow, startingColumn, from->readonlyData,
-                                          from->rows, from->columns);
-        break;
-      case Type::UINT32_T:
-        result = deSerializeData<uint32_t>(startingRow, startingColumn, from->readonlyData,
-                                           from->rows, from->columns);
-        break;
-      case Type::INT32_T:
-        result = deSerializeData<int32_t>(startingRow, startingColumn, from->readonlyData,
-                                          from->rows, from->columns);
-        break;
-      case Type::FLOAT:
-        result = deSerializeData<float>(startingRow, startingColumn, from->readonlyData, from->rows,
-                                        from->columns);
-        break;
-      case Type::DOUBLE:
-        result = deSerializeData<double>(startingRow, startingColumn, from->readonlyData,
-                                         from->rows, from->columns);
-        break;
-      default:
-        result = UNKNOWN_DATATYPE;
-        break;
-    }
-  } else {
-    // need a type to do arithmetic
-    uint8_t *typedData = static_cast<uint8_t *>(data);
-    for (uint8_t fromRow = 0; fromRow < from->rows; fromRow++) {
-      size_t offset =
-          (((startingRow + fromRow) * static_cast<uint16_t>(columns)) + startingColumn) * typeSize;
-      std::memcpy(typedData + offset, from->readonlyData, typeSize * from->columns);
-    }
+    return deSerializeData(startingRow, startingColumn, from->readonlyData, from->rows,
+                           from->columns);
   }
-
-  return result;
+  // need a type to do arithmetic
+  uint8_t *typedData = static_cast<uint8_t *>(data);
+  const uint8_t *fromData = static_cast<const uint8_t *>(from->readonlyData);
+  size_t fromRowSize = static_cast<size_t>(from->columns) * typeSize;
+  for (uint8_t fromRow = 0; fromRow < from->rows; fromRow++) {
+    size_t offset =
+        ((startingRow + fromRow) * static_cast<size_t>(columns) + startingColumn) * typeSize;
+    std::memcpy(typedData + offset, fromData + fromRow * fromRowSize, fromRowSize);
+  }
+  return HasReturnvaluesIF::RETURN_OK;
 }
 
 void ParameterWrapper::convertLinearIndexToRowAndColumn(uint16_t index, uint8_t *row,
@@ -153,11 +153,9 @@ class ParameterWrapper : public SerializeIF {
   void *data = nullptr;
   const void *readonlyData = nullptr;
 
-  template <typename T>
   ReturnValue_t serializeData(uint8_t **buffer, size_t *size, size_t maxSize,
                               Endianness streamEndianness) const;
 
-  template <typename T>
   ReturnValue_t deSerializeData(uint8_t startingRow, uint8_t startingColumn, const void *from,
                                 uint8_t fromRows, uint8_t fromColumns);
 };
@@ -2,9 +2,13 @@
 #define MISSION_PUS_SERVICE11TELECOMMANDSCHEDULING_H_
 
 #include <etl/multimap.h>
+#include <etl/unordered_map.h>
 #include <fsfw/tmtcservices/PusServiceBase.h>
 #include <fsfw/tmtcservices/TmTcMessage.h>
 
+#include <cstdio>
+#include <string>
+
 #include "fsfw/FSFW.h"
 #include "fsfw/returnvalues/FwClassIds.h"
 
@@ -31,6 +35,15 @@
  *
  * Groups are not supported.
  * This service remains always enabled. Sending a disable-request has no effect.
+ *
+ * The scheduled TCs are additionally indexed by their request ID, which has to be unique.
+ * If bulk insertion is enabled, TC[11,4] contains the number of activities N followed by N
+ * pairs of release time and TC, as specified by ECSS. Otherwise, it contains a single release
+ * time and TC.
+ *
+ * Optionally, all changes of the schedule are written to a persistence file before they are
+ * applied (write-ahead log). The schedule is restored from this file in #initialize and the
+ * file is compacted regularly.
  */
 template <size_t MAX_NUM_TCS>
 class Service11TelecommandScheduling final : public PusServiceBase {
@@ -43,6 +56,14 @@ class Service11TelecommandScheduling final : public PusServiceBase {
       HasReturnvaluesIF::makeReturnCode(CLASS_ID, 2);
   static constexpr ReturnValue_t INVALID_RELATIVE_TIME =
       HasReturnvaluesIF::makeReturnCode(CLASS_ID, 3);
+  static constexpr ReturnValue_t REQUEST_ID_ALREADY_SCHEDULED =
+      HasReturnvaluesIF::makeReturnCode(CLASS_ID, 4);
+  static constexpr ReturnValue_t SCHEDULE_FULL = HasReturnvaluesIF::makeReturnCode(CLASS_ID, 5);
+  static constexpr ReturnValue_t TC_TOO_LARGE_TO_PERSIST =
+      HasReturnvaluesIF::makeReturnCode(CLASS_ID, 6);
+
+  //! Maximum size of a scheduled TC while the persistence file is used
+  static constexpr size_t MAX_PERSISTED_TC_SIZE = 2048;
 
   static constexpr uint8_t SUBSYSTEM_ID = SUBSYSTEM_ID::PUS_SERVICE_11;
 
@@ -84,6 +105,22 @@ class Service11TelecommandScheduling final : public PusServiceBase {
   void enableExpiredTcDeletion();
   void disableExpiredTcDeletion();
 
+  /**
+   * Parse the number of activities in TC[11,4] and insert all contained activities.
+   * The insertion is rejected completely if one of the activities can not be inserted.
+   */
+  void enableBulkInsertion();
+  void disableBulkInsertion();
+
+  /**
+   * Set the path of the persistence file. Needs to be called before #initialize.
+   * The TC store needs to be able to hold all restored TCs. TCs larger than
+   * #MAX_PERSISTED_TC_SIZE are rejected with #TC_TOO_LARGE_TO_PERSIST.
+   */
+  void setPersistenceFile(std::string path);
+
+  size_t getNumberOfScheduledTcs() const;
+
   /** PusServiceBase overrides */
   ReturnValue_t handleRequest(uint8_t subservice) override;
   ReturnValue_t performService() override;
@@ -96,7 +133,23 @@ class Service11TelecommandScheduling final : public PusServiceBase {
     store_address_t storeAddr;  // uint16
   };
 
+  enum class LogRecordType : uint8_t { INSERT = 1, DELETE = 2, TIMESHIFT = 3 };
+
+  /**
+   * Record of the persistence file in host byte order. Insertion records are followed by the TC.
+   */
+  struct LogRecord {
+    LogRecordType type{};
+    uint8_t spare[3]{};
+    uint32_t seconds{};
+    uint64_t requestId{};
+    uint32_t length{};
+    uint32_t spare2{};
+  };
+
   static constexpr uint16_t DEFAULT_RELEASE_TIME_MARGIN = 5;
+  //! The file is compacted if it contains this many more records than scheduled TCs
+  static constexpr size_t COMPACTION_THRESHOLD = 256;
 
   // minimum release time offset to insert into schedule
   const uint16_t RELEASE_TIME_MARGIN_SECONDS = 5;
@@ -107,6 +160,7 @@ class Service11TelecommandScheduling final : public PusServiceBase {
   bool schedulingEnabled = false;
   bool deleteExpiredTcWhenDisabled = true;
   bool debugMode = false;
+  bool bulkInsertion = false;
   StorageManagerIF* tcStore = nullptr;
   AcceptsTelecommandsIF* tcRecipient = nullptr;
   MessageQueueId_t recipientMsgQueueId = 0;
@@ -117,10 +171,35 @@ class Service11TelecommandScheduling final : public PusServiceBase {
    */
   using TelecommandMap = etl::multimap<uint32_t, TelecommandStruct, MAX_NUM_TCS>;
   using TcMapIter = typename TelecommandMap::iterator;
+  using RequestIdMap = etl::unordered_map<uint64_t, TcMapIter, MAX_NUM_TCS>;
 
   TelecommandMap telecommandMap;
+  RequestIdMap requestIdMap;
+
+  std::string persistencePath;
+  std::FILE* persistenceFile = nullptr;
+  //! Number of records in the persistence file
+  size_t persistedRecords = 0;
 
   ReturnValue_t handleResetCommand();
+  /**
+   * @brief Stores the TC and inserts it into the schedule.
+   * @param log Write an insertion record into the persistence file
+   */
+  ReturnValue_t insertActivity(uint32_t releaseTime, const uint8_t* tc, size_t tcSize, bool log);
+  /**
+   * @brief Deletes the TC from the store and removes it from the schedule.
+   */
+  ReturnValue_t deleteActivity(TcMapIter it, bool log);
+  /**
+   * @brief Removes the TC from the schedule without deleting it from the store.
+   */
+  void eraseActivity(TcMapIter it, bool log);
+  void timeshiftActivity(TcMapIter it, uint32_t relativeTime, bool log);
+  /**
+   * @return Iterator to the TC with the request ID or the end iterator of the map
+   */
+  TcMapIter findActivity(uint64_t requestId);
   /**
    * @brief Logic to be performed on an incoming TC[11,4].
    * @return RETURN_OK if successful
@@ -192,6 +271,21 @@ class Service11TelecommandScheduling final : public PusServiceBase {
                                      TcMapIter& itEnd);
 
   ReturnValue_t handleInvalidData(const char* ctx);
+
+  void writeLogRecord(LogRecordType type, uint64_t requestId, uint32_t seconds,
+                      const uint8_t* tc = nullptr, uint32_t tcSize = 0);
+  /**
+   * @brief Writes the records of the current request to the medium and compacts the file if
+   * required.
+   */
+  void commitPersistenceFile();
+  ReturnValue_t syncPersistenceFile();
+  ReturnValue_t restoreFromPersistenceFile();
+  /**
+   * @brief Writes a new persistence file which only contains the insertion records of the
+   * currently scheduled TCs.
+   */
+  ReturnValue_t compactPersistenceFile();
   /**
    * @brief Prints content of multimap. Use for simple debugging only.
    */
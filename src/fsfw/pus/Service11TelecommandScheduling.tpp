@@ -1,12 +1,18 @@
 #pragma once
 
 #include <cstddef>
+#include <utility>
 
 #include "fsfw/objectmanager/ObjectManager.h"
+#include "fsfw/platform.h"
 #include "fsfw/serialize/SerializeAdapter.h"
 #include "fsfw/serviceinterface.h"
 #include "fsfw/tmtcservices/AcceptsTelecommandsIF.h"
 
+#ifdef PLATFORM_UNIX
+#include <unistd.h>
+#endif
+
 static constexpr auto DEF_END = SerializeIF::Endianness::BIG;
 
 template <size_t MAX_NUM_TCS>
@@ -19,7 +25,11 @@ inline Service11TelecommandScheduling<MAX_NUM_TCS>::Service11TelecommandScheduli
       tcRecipient(tcRecipient) {}
 
 template <size_t MAX_NUM_TCS>
-inline Service11TelecommandScheduling<MAX_NUM_TCS>::~Service11TelecommandScheduling() = default;
+inline Service11TelecommandScheduling<MAX_NUM_TCS>::~Service11TelecommandScheduling() {
+  if (persistenceFile != nullptr) {
+    std::fclose(persistenceFile);
+  }
+}
 
 template <size_t MAX_NUM_TCS>
 inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::handleRequest(
@@ -37,6 +47,7 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::handleRequest(
   if (data == nullptr) {
     return handleInvalidData("handleRequest");
   }
+  ReturnValue_t result = RETURN_OK;
   switch (subservice) {
     case Subservice::ENABLE_SCHEDULING: {
       schedulingEnabled = true;
@@ -47,22 +58,29 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::handleRequest(
       break;
     }
     case Subservice::RESET_SCHEDULING: {
-      return handleResetCommand();
+      result = handleResetCommand();
+      break;
     }
     case Subservice::INSERT_ACTIVITY:
-      return doInsertActivity(data, size);
+      result = doInsertActivity(data, size);
+      break;
     case Subservice::DELETE_ACTIVITY:
-      return doDeleteActivity(data, size);
+      result = doDeleteActivity(data, size);
+      break;
     case Subservice::FILTER_DELETE_ACTIVITY:
-      return doFilterDeleteActivity(data, size);
+      result = doFilterDeleteActivity(data, size);
+      break;
     case Subservice::TIMESHIFT_ACTIVITY:
-      return doTimeshiftActivity(data, size);
+      result = doTimeshiftActivity(data, size);
+      break;
     case Subservice::FILTER_TIMESHIFT_ACTIVITY:
-      return doFilterTimeshiftActivity(data, size);
+      result = doFilterTimeshiftActivity(data, size);
+      break;
     default:
       return AcceptsTelecommandsIF::INVALID_SUBSERVICE;
   }
-  return RETURN_OK;
+  commitPersistenceFile();
+  return result;
 }
 
 template <size_t MAX_NUM_TCS>
@@ -77,6 +95,7 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::performService
   // TODO: Optionally limit the max number of released TCs per cycle?
   // NOTE: The iterator is increased in the loop here. Increasing the iterator as for-loop arg
   // does not work in this case as we are deleting the current element here.
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
   for (auto it = telecommandMap.begin(); it != telecommandMap.end();) {
     if (it->first <= tNow.tv_sec) {
       if (schedulingEnabled) {
@@ -85,7 +104,8 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::performService
         auto sendRet = this->requestQueue->sendMessage(recipientMsgQueueId, &releaseMsg, false);
 
         if (sendRet != HasReturnvaluesIF::RETURN_OK) {
-          return sendRet;
+          result = sendRet;
+          break;
         }
         if (debugMode) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
@@ -94,16 +114,18 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::performService
           sif::printInfo("Released TC & erased it from TC map\n");
 #endif
         }
-        telecommandMap.erase(it++);
+        eraseActivity(it++, true);
       } else if (deleteExpiredTcWhenDisabled) {
-        telecommandMap.erase(it++);
+        eraseActivity(it++, true);
       }
       continue;
     }
-    it++;
+    // The map is sorted by release time, so no further TCs are due
+    break;
   }
 
-  return HasReturnvaluesIF::RETURN_OK;
+  commitPersistenceFile();
+  return result;
 }
 
 template <size_t MAX_NUM_TCS>
@@ -123,6 +145,9 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::initialize() {
   }
   recipientMsgQueueId = tcRecipient->getRequestQueue();
 
+  if (not persistencePath.empty()) {
+    return restoreFromPersistenceFile();
+  }
   return res;
 }
 
@@ -143,38 +168,145 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::handleResetCom
     }
   }
   telecommandMap.clear();
+  requestIdMap.clear();
+  if (not persistencePath.empty()) {
+    return compactPersistenceFile();
+  }
   return RETURN_OK;
 }
 
 template <size_t MAX_NUM_TCS>
 inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doInsertActivity(
     const uint8_t *data, size_t size) {
-  uint32_t timestamp = 0;
-  ReturnValue_t result = SerializeAdapter::deSerialize(&timestamp, &data, &size, DEF_END);
+  uint32_t numActivities = 1;
+  ReturnValue_t result = RETURN_OK;
+  if (bulkInsertion) {
+    result = SerializeAdapter::deSerialize(&numActivities, &data, &size, DEF_END);
+    if (result != RETURN_OK) {
+      return result;
+    }
+  }
+  const uint8_t *activities = data;
+  timeval tNow = {};
+  Clock::getClock_timeval(&tNow);
+
+  uint32_t inserted = 0;
+  for (; inserted < numActivities; inserted++) {
+    uint32_t timestamp = 0;
+    result = SerializeAdapter::deSerialize(&timestamp, &data, &size, DEF_END);
+    if (result != RETURN_OK) {
+      break;
+    }
+
+    // Insert possible if sched. time is above margin
+    // (See requirement for Time margin)
+    if (timestamp - tNow.tv_sec <= RELEASE_TIME_MARGIN_SECONDS) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+      sif::warning << "Service11TelecommandScheduling::doInsertActivity: Release time too close to "
+                      "current time"
+                   << std::endl;
+#else
+      sif::printWarning(
+          "Service11TelecommandScheduling::doInsertActivity: Release time too close to current "
+          "time\n");
+#endif
+      result = RETURN_FAILED;
+      break;
+    }
+
+    // Without bulk insertion, the remaining data is the TC. Otherwise, the TC length is
+    // retrieved from the space packet header.
+    size_t tcSize = size;
+    if (bulkInsertion) {
+      if (size < TcPacketPus::TC_PACKET_MIN_SIZE) {
+        result = handleInvalidData("doInsertActivity");
+        break;
+      }
+      tcSize = ((data[4] << 8) | data[5]) + 7;
+      if (tcSize > size) {
+        result = handleInvalidData("doInsertActivity");
+        break;
+      }
+    }
+    result = insertActivity(timestamp, data, tcSize, true);
+    if (result != RETURN_OK) {
+      break;
+    }
+    data += tcSize;
+    size -= tcSize;
+  }
+
   if (result != RETURN_OK) {
+    // Roll back the activities of this TC which were already inserted
+    for (uint32_t idx = 0; idx < inserted; idx++) {
+      activities += sizeof(uint32_t);
+      uint64_t requestId = getRequestIdFromDataTC(activities);
+      TcMapIter it = findActivity(requestId);
+      if (it != telecommandMap.end()) {
+        deleteActivity(it, true);
+      }
+      activities += ((activities[4] << 8) | activities[5]) + 7;
+    }
     return result;
   }
 
-  // Insert possible if sched. time is above margin
-  // (See requirement for Time margin)
-  timeval tNow = {};
-  Clock::getClock_timeval(&tNow);
-  if (timestamp - tNow.tv_sec <= RELEASE_TIME_MARGIN_SECONDS) {
+  if (debugMode) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::info << "PUS11::doInsertActivity: Inserted into Multimap:" << std::endl;
+#else
+    sif::printInfo("PUS11::doInsertActivity: Inserted into Multimap:\n");
+#endif
+    debugPrintMultimapContent();
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+template <size_t MAX_NUM_TCS>
+inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::insertActivity(
+    uint32_t releaseTime, const uint8_t *tc, size_t tcSize, bool log) {
+  if (telecommandMap.full()) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "Service11TelecommandScheduling::insertActivity: Schedule is full"
+                 << std::endl;
+#else
+    sif::printWarning("Service11TelecommandScheduling::insertActivity: Schedule is full\n");
+#endif
+#endif
+    return SCHEDULE_FULL;
+  }
+  if (tcSize < TcPacketPus::TC_PACKET_MIN_SIZE) {
+    return handleInvalidData("insertActivity");
+  }
+  if (log and persistenceFile != nullptr and tcSize > MAX_PERSISTED_TC_SIZE) {
+    // The TC could not be restored from the persistence file
+#if FSFW_VERBOSE_LEVEL >= 1
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-    sif::warning << "Service11TelecommandScheduling::doInsertActivity: Release time too close to "
-                    "current time"
+    sif::warning << "Service11TelecommandScheduling::insertActivity: TC too large to persist"
+                 << std::endl;
+#else
+    sif::printWarning("Service11TelecommandScheduling::insertActivity: TC too large to persist\n");
+#endif
+#endif
+    return TC_TOO_LARGE_TO_PERSIST;
+  }
+  uint64_t newRequestId = getRequestIdFromDataTC(tc);
+  if (requestIdMap.find(newRequestId) != requestIdMap.end()) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "Service11TelecommandScheduling::insertActivity: Request ID already scheduled"
                  << std::endl;
 #else
     sif::printWarning(
-        "Service11TelecommandScheduling::doInsertActivity: Release time too close to current "
-        "time\n");
+        "Service11TelecommandScheduling::insertActivity: Request ID already scheduled\n");
 #endif
-    return RETURN_FAILED;
+#endif
+    return REQUEST_ID_ALREADY_SCHEDULED;
   }
 
   // store currentPacket and receive the store address
   store_address_t addr{};
-  if (tcStore->addData(&addr, data, size) != RETURN_OK ||
+  if (tcStore->addData(&addr, tc, tcSize) != RETURN_OK ||
       addr.raw == storeId::INVALID_STORE_ADDRESS) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::error << "Service11TelecommandScheduling::doInsertActivity: Adding data to TC Store failed"
@@ -186,27 +318,63 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doInsertActivi
     return RETURN_FAILED;
   }
 
+  if (log) {
+    writeLogRecord(LogRecordType::INSERT, newRequestId, releaseTime, tc, tcSize);
+  }
+
   // insert into multimap with new store address
-  TelecommandStruct tc;
-  tc.seconds = timestamp;
-  tc.storeAddr = addr;
-  tc.requestId =
-      getRequestIdFromDataTC(data);  // TODO: Missing sanity check of the returned request id
-
-  auto it = telecommandMap.insert(std::pair<uint32_t, TelecommandStruct>(timestamp, tc));
-  if (it == telecommandMap.end()) {
-    return RETURN_FAILED;
+  TelecommandStruct tcStruct;
+  tcStruct.seconds = releaseTime;
+  tcStruct.storeAddr = addr;
+  tcStruct.requestId = newRequestId;
+  auto it = telecommandMap.insert(std::pair<uint32_t, TelecommandStruct>(releaseTime, tcStruct));
+  requestIdMap.insert(std::make_pair(newRequestId, it));
+  return RETURN_OK;
+}
+
+template <size_t MAX_NUM_TCS>
+inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::deleteActivity(TcMapIter it,
+                                                                                bool log) {
+  // delete packet from store
+  ReturnValue_t result = tcStore->deleteData(it->second.storeAddr);
+  eraseActivity(it, log);
+  return result;
+}
+
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::eraseActivity(TcMapIter it, bool log) {
+  if (log) {
+    writeLogRecord(LogRecordType::DELETE, it->second.requestId, it->first);
   }
+  requestIdMap.erase(it->second.requestId);
+  telecommandMap.erase(it);
+}
 
-  if (debugMode) {
-#if FSFW_CPP_OSTREAM_ENABLED == 1
-    sif::info << "PUS11::doInsertActivity: Inserted into Multimap:" << std::endl;
-#else
-    sif::printInfo("PUS11::doInsertActivity: Inserted into Multimap:\n");
-#endif
-    debugPrintMultimapContent();
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::timeshiftActivity(TcMapIter it,
+                                                                          uint32_t relativeTime,
+                                                                          bool log) {
+  // temporarily hold the item
+  TelecommandStruct tempTc(it->second);
+  uint32_t tempKey = it->first + relativeTime;
+  if (log) {
+    writeLogRecord(LogRecordType::TIMESHIFT, tempTc.requestId, tempKey);
   }
-  return HasReturnvaluesIF::RETURN_OK;
+
+  // delete old entry from the mm and then insert it again as new entry
+  telecommandMap.erase(it);
+  tempTc.seconds = tempKey;
+  requestIdMap[tempTc.requestId] = telecommandMap.insert(std::make_pair(tempKey, tempTc));
+}
+
+template <size_t MAX_NUM_TCS>
+inline typename Service11TelecommandScheduling<MAX_NUM_TCS>::TcMapIter
+Service11TelecommandScheduling<MAX_NUM_TCS>::findActivity(uint64_t requestId) {
+  auto indexIt = requestIdMap.find(requestId);
+  if (indexIt == requestIdMap.end()) {
+    return telecommandMap.end();
+  }
+  return indexIt->second;
 }
 
 template <size_t MAX_NUM_TCS>
@@ -228,32 +396,21 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doDeleteActivi
 #endif
   }
 
-  TcMapIter tcToDelete;     // handle to the TC to be deleted, can be used if counter is valid
-  int tcToDeleteCount = 0;  // counter of all found TCs. Should be 1.
-
-  for (auto it = telecommandMap.begin(); it != telecommandMap.end(); it++) {
-    if (it->second.requestId == requestId) {
-      tcToDelete = it;
-      tcToDeleteCount++;
-    }
-  }
-
-  // check if 1 explicit TC is found via request ID
-  if (tcToDeleteCount == 0 || tcToDeleteCount > 1) {
+  TcMapIter tcToDelete = findActivity(requestId);
+  if (tcToDelete == telecommandMap.end()) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-    sif::warning << "Service11TelecommandScheduling::doDeleteActivity: No or more than 1 TC found. "
+    sif::warning << "Service11TelecommandScheduling::doDeleteActivity: No TC found. "
                     "Cannot explicitly delete TC"
                  << std::endl;
 #else
     sif::printWarning(
-        "Service11TelecommandScheduling::doDeleteActivity: No or more than 1 TC found. "
-        "Cannot explicitly delete TC");
+        "Service11TelecommandScheduling::doDeleteActivity: No TC found. "
+        "Cannot explicitly delete TC\n");
 #endif
     return RETURN_FAILED;
   }
 
-  // delete packet from store
-  if (tcStore->deleteData(tcToDelete->second.storeAddr) != RETURN_OK) {
+  if (deleteActivity(tcToDelete, true) != RETURN_OK) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::error << "Service11TelecommandScheduling::doDeleteActivity: Could not delete TC from Store"
                << std::endl;
@@ -264,7 +421,6 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doDeleteActivi
     return RETURN_FAILED;
   }
 
-  telecommandMap.erase(tcToDelete);
   if (debugMode) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::info << "PUS11::doDeleteActivity: Deleted TC from map" << std::endl;
@@ -289,9 +445,9 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doFilterDelete
   }
 
   int deletedTCs = 0;
-  for (TcMapIter it = itBegin; it != itEnd; it++) {
+  for (TcMapIter it = itBegin; it != itEnd;) {
     // delete packet from store
-    if (tcStore->deleteData(it->second.storeAddr) != RETURN_OK) {
+    if (deleteActivity(it++, true) != RETURN_OK) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
       sif::error << "Service11TelecommandScheduling::doFilterDeleteActivity: Could not delete TC "
                     "from Store"
@@ -306,15 +462,6 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doFilterDelete
     deletedTCs++;
   }
 
-  // NOTE: Spec says this function erases all elements including itBegin but not itEnd,
-  // see here: https://www.cplusplus.com/reference/map/multimap/erase/
-  // Therefore we need to increase itEnd by 1. (Note that end() returns the "past-the-end" iterator)
-  if (itEnd != telecommandMap.end()) {
-    itEnd++;
-  }
-
-  telecommandMap.erase(itBegin, itEnd);
-
   if (debugMode) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::info << "PUS11::doFilterDeleteActivity: Deleted " << deletedTCs << " TCs" << std::endl;
@@ -354,42 +501,23 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doTimeshiftAct
 #endif
   }
 
-  // NOTE: Despite having C++17 ETL multimap has no member function extract :(
-
-  TcMapIter tcToTimeshiftIt;
-  int tcToTimeshiftCount = 0;
-
-  for (auto it = telecommandMap.begin(); it != telecommandMap.end(); it++) {
-    if (it->second.requestId == requestId) {
-      tcToTimeshiftIt = it;
-      tcToTimeshiftCount++;
-    }
-  }
-
-  if (tcToTimeshiftCount == 0 || tcToTimeshiftCount > 1) {
+  TcMapIter tcToTimeshiftIt = findActivity(requestId);
+  if (tcToTimeshiftIt == telecommandMap.end()) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-    sif::warning << "Service11TelecommandScheduling::doTimeshiftActivity: Either 0 or more than 1 "
-                    "TCs found. No explicit timeshifting "
-                    "possible"
+    sif::warning << "Service11TelecommandScheduling::doTimeshiftActivity: No TC found. "
+                    "No explicit timeshifting possible"
                  << std::endl;
 
 #else
     sif::printWarning(
-        "Service11TelecommandScheduling::doTimeshiftActivity: Either 0 or more than 1 TCs found. "
+        "Service11TelecommandScheduling::doTimeshiftActivity: No TC found. "
         "No explicit timeshifting possible\n");
 #endif
     return TIMESHIFTING_NOT_POSSIBLE;
   }
 
-  // temporarily hold the item
-  TelecommandStruct tempTc(tcToTimeshiftIt->second);
-  uint32_t tempKey = tcToTimeshiftIt->first + relativeTime;
-
-  // delete old entry from the mm
-  telecommandMap.erase(tcToTimeshiftIt);
-
-  // and then insert it again as new entry
-  telecommandMap.insert(std::make_pair(tempKey, tempTc));
+  // NOTE: Despite having C++17 ETL multimap has no member function extract :(
+  timeshiftActivity(tcToTimeshiftIt, relativeTime, true);
 
   if (debugMode) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
@@ -424,18 +552,23 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::doFilterTimesh
     return result;
   }
 
+  // The range is processed backwards. The shifted TCs are inserted behind their old position,
+  // so they are not visited again.
   int shiftedItemsCount = 0;
-  for (auto it = itBegin; it != itEnd;) {
-    // temporarily hold the item
-    TelecommandStruct tempTc(it->second);
-    uint32_t tempKey = it->first + relativeTime;
-
-    // delete the old entry from the mm
-    telecommandMap.erase(it++);
-
-    // and then insert it again as new entry
-    telecommandMap.insert(std::make_pair(tempKey, tempTc));
-    shiftedItemsCount++;
+  if (itBegin != itEnd) {
+    TcMapIter current = itEnd;
+    --current;
+    bool last = false;
+    while (not last) {
+      last = (current == itBegin);
+      TcMapIter previous = current;
+      if (not last) {
+        --previous;
+      }
+      timeshiftActivity(current, relativeTime, true);
+      shiftedItemsCount++;
+      current = previous;
+    }
   }
 
   if (debugMode) {
@@ -534,11 +667,7 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::getMapFilterFr
         return result;
       }
 
-      itBegin = telecommandMap.begin();
-      while (itBegin->first < fromTimestamp && itBegin != telecommandMap.end()) {
-        itBegin++;
-      }
-
+      itBegin = telecommandMap.lower_bound(fromTimestamp);
       itEnd = telecommandMap.end();
       break;
     }
@@ -550,10 +679,7 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::getMapFilterFr
         return result;
       }
       itBegin = telecommandMap.begin();
-      itEnd = telecommandMap.begin();
-      while (itEnd->first <= toTimestamp && itEnd != telecommandMap.end()) {
-        itEnd++;
-      }
+      itEnd = telecommandMap.upper_bound(toTimestamp);
       break;
     }
 
@@ -571,15 +697,11 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::getMapFilterFr
       if (result != RETURN_OK) {
         return result;
       }
-      itBegin = telecommandMap.begin();
-      itEnd = telecommandMap.begin();
-
-      while (itBegin->first < fromTimestamp && itBegin != telecommandMap.end()) {
-        itBegin++;
-      }
-      while (itEnd->first <= toTimestamp && itEnd != telecommandMap.end()) {
-        itEnd++;
+      if (fromTimestamp > toTimestamp) {
+        return RETURN_FAILED;
       }
+      itBegin = telecommandMap.lower_bound(fromTimestamp);
+      itEnd = telecommandMap.upper_bound(toTimestamp);
       break;
     }
 
@@ -588,7 +710,8 @@ inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::getMapFilterFr
   }
 
   // additional security check, this should never be true
-  if (itBegin->first > itEnd->first) {
+  if (itBegin != telecommandMap.end() and itEnd != telecommandMap.end() and
+      itBegin->first > itEnd->first) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
 #else
     sif::printError("11::GetMapFilterFromData: itBegin > itEnd\n");
@@ -643,3 +766,184 @@ template <size_t MAX_NUM_TCS>
 inline void Service11TelecommandScheduling<MAX_NUM_TCS>::disableExpiredTcDeletion() {
   deleteExpiredTcWhenDisabled = false;
 }
+
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::enableBulkInsertion() {
+  bulkInsertion = true;
+}
+
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::disableBulkInsertion() {
+  bulkInsertion = false;
+}
+
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::setPersistenceFile(std::string path) {
+  persistencePath = std::move(path);
+}
+
+template <size_t MAX_NUM_TCS>
+inline size_t Service11TelecommandScheduling<MAX_NUM_TCS>::getNumberOfScheduledTcs() const {
+  return telecommandMap.size();
+}
+
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::writeLogRecord(LogRecordType type,
+                                                                       uint64_t requestId,
+                                                                       uint32_t seconds,
+                                                                       const uint8_t *tc,
+                                                                       uint32_t tcSize) {
+  if (persistenceFile == nullptr) {
+    return;
+  }
+  LogRecord record;
+  record.type = type;
+  record.seconds = seconds;
+  record.requestId = requestId;
+  record.length = tcSize;
+  if (std::fwrite(&record, sizeof(record), 1, persistenceFile) != 1 or
+      (tcSize > 0 and std::fwrite(tc, 1, tcSize, persistenceFile) != tcSize)) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "Service11TelecommandScheduling::writeLogRecord: Writing to "
+                 << persistencePath << " failed, persistence disabled" << std::endl;
+#else
+    sif::printWarning(
+        "Service11TelecommandScheduling::writeLogRecord: Writing to %s failed, persistence "
+        "disabled\n",
+        persistencePath.c_str());
+#endif
+#endif
+    std::fclose(persistenceFile);
+    persistenceFile = nullptr;
+    return;
+  }
+  persistedRecords++;
+}
+
+template <size_t MAX_NUM_TCS>
+inline void Service11TelecommandScheduling<MAX_NUM_TCS>::commitPersistenceFile() {
+  if (persistenceFile == nullptr) {
+    return;
+  }
+  if (persistedRecords > telecommandMap.size() + COMPACTION_THRESHOLD) {
+    compactPersistenceFile();
+    return;
+  }
+  if (syncPersistenceFile() != RETURN_OK) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "Service11TelecommandScheduling::commitPersistenceFile: Syncing "
+                 << persistencePath << " failed" << std::endl;
+#else
+    sif::printWarning("Service11TelecommandScheduling::commitPersistenceFile: Syncing %s failed\n",
+                      persistencePath.c_str());
+#endif
+#endif
+  }
+}
+
+template <size_t MAX_NUM_TCS>
+inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::syncPersistenceFile() {
+  if (std::fflush(persistenceFile) != 0) {
+    return RETURN_FAILED;
+  }
+#ifdef PLATFORM_UNIX
+  if (fsync(fileno(persistenceFile)) != 0) {
+    return RETURN_FAILED;
+  }
+#endif
+  return RETURN_OK;
+}
+
+template <size_t MAX_NUM_TCS>
+inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::restoreFromPersistenceFile() {
+  std::FILE *file = std::fopen(persistencePath.c_str(), "rb");
+  if (file != nullptr) {
+    LogRecord record;
+    uint8_t tc[MAX_PERSISTED_TC_SIZE];
+    // Replay stops at the first incomplete record, which can be left by a reset while writing
+    while (std::fread(&record, sizeof(record), 1, file) == 1) {
+      if (record.type == LogRecordType::INSERT) {
+        if (record.length > sizeof(tc)) {
+          // Can only be written by older versions which did not limit the TC size. The TC is
+          // dropped, but the following records are still replayed.
+          if (std::fseek(file, record.length, SEEK_CUR) != 0) {
+            break;
+          }
+          continue;
+        }
+        if (std::fread(tc, 1, record.length, file) != record.length) {
+          break;
+        }
+        insertActivity(record.seconds, tc, record.length, false);
+        continue;
+      }
+      TcMapIter it = findActivity(record.requestId);
+      if (it == telecommandMap.end()) {
+        continue;
+      }
+      if (record.type == LogRecordType::DELETE) {
+        deleteActivity(it, false);
+      } else if (record.type == LogRecordType::TIMESHIFT) {
+        timeshiftActivity(it, record.seconds - it->first, false);
+      } else {
+        break;
+      }
+    }
+    std::fclose(file);
+    if (debugMode) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+      sif::info << "PUS11::restoreFromPersistenceFile: Restored " << telecommandMap.size()
+                << " TCs" << std::endl;
+#else
+      sif::printInfo("PUS11::restoreFromPersistenceFile: Restored %d TCs\n",
+                     static_cast<int>(telecommandMap.size()));
+#endif
+    }
+  }
+  // Start with a compact file which does not contain incomplete records
+  return compactPersistenceFile();
+}
+
+template <size_t MAX_NUM_TCS>
+inline ReturnValue_t Service11TelecommandScheduling<MAX_NUM_TCS>::compactPersistenceFile() {
+  if (persistenceFile != nullptr) {
+    std::fclose(persistenceFile);
+  }
+  persistedRecords = 0;
+  std::string tempPath = persistencePath + ".tmp";
+  persistenceFile = std::fopen(tempPath.c_str(), "wb");
+  if (persistenceFile == nullptr) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "Service11TelecommandScheduling::compactPersistenceFile: Opening " << tempPath
+                 << " failed, persistence disabled" << std::endl;
+#else
+    sif::printWarning(
+        "Service11TelecommandScheduling::compactPersistenceFile: Opening %s failed, persistence "
+        "disabled\n",
+        tempPath.c_str());
+#endif
+#endif
+    return RETURN_FAILED;
+  }
+  for (const auto &entry : telecommandMap) {
+    const uint8_t *tc = nullptr;
+    size_t tcSize = 0;
+    if (tcStore->getData(entry.second.storeAddr, &tc, &tcSize) == RETURN_OK) {
+      writeLogRecord(LogRecordType::INSERT, entry.second.requestId, entry.first, tc, tcSize);
+    }
+  }
+  // The new file is on the medium before it replaces the old one. It stays open for appending
+  // after it was renamed.
+  if (persistenceFile == nullptr or syncPersistenceFile() != RETURN_OK or
+      std::rename(tempPath.c_str(), persistencePath.c_str()) != 0) {
+    if (persistenceFile != nullptr) {
+      std::fclose(persistenceFile);
+      persistenceFile = nullptr;
+    }
+    return RETURN_FAILED;
+  }
+  return RETURN_OK;
+}
@@ -20,6 +20,8 @@ ReturnValue_t Service20ParameterManagement::isValidSubservice(uint8_t subservice
   switch (static_cast<Subservice>(subservice)) {
     case Subservice::PARAMETER_LOAD:
     case Subservice::PARAMETER_DUMP:
+    case Subservice::PARAMETER_BULK_LOAD:
+    case Subservice::PARAMETER_BULK_DUMP:
       return HasReturnvaluesIF::RETURN_OK;
     default:
 #if FSFW_CPP_OSTREAM_ENABLED == 1
@@ -97,6 +99,14 @@ ReturnValue_t Service20ParameterManagement::prepareCommand(CommandMessage* messa
     case Subservice::PARAMETER_LOAD: {
       return prepareLoadCommand(message, tcData, tcDataLen);
     } break;
+    case Subservice::PARAMETER_BULK_LOAD: {
+      return prepareBulkCommand(message, ParameterMessage::CMD_PARAMETER_BULK_LOAD, tcData,
+                                tcDataLen);
+    }
+    case Subservice::PARAMETER_BULK_DUMP: {
+      return prepareBulkCommand(message, ParameterMessage::CMD_PARAMETER_BULK_DUMP, tcData,
+                                tcDataLen);
+    }
     default:
       return HasReturnvaluesIF::RETURN_FAILED;
   }
@@ -161,6 +171,30 @@ ReturnValue_t Service20ParameterManagement::prepareLoadCommand(CommandMessage* m
   return HasReturnvaluesIF::RETURN_OK;
 }
 
+ReturnValue_t Service20ParameterManagement::prepareBulkCommand(CommandMessage* message,
+                                                               Command_t command,
+                                                               const uint8_t* tcData,
+                                                               size_t tcDataLen) {
+  /* The parameter data is already in the format expected by the ParameterHelper, so it
+  is copied into the store as a whole */
+  if (tcDataLen <= sizeof(object_id_t)) {
+    return CommandingServiceBase::INVALID_TC;
+  }
+  tcData += sizeof(object_id_t);
+  tcDataLen -= sizeof(object_id_t);
+  store_address_t storeAddress;
+  ReturnValue_t result = IPCStore->addData(&storeAddress, tcData, tcDataLen);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  if (command == ParameterMessage::CMD_PARAMETER_BULK_LOAD) {
+    ParameterMessage::setParameterBulkLoadCommand(message, storeAddress);
+  } else {
+    ParameterMessage::setParameterBulkDumpCommand(message, storeAddress);
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
 ReturnValue_t Service20ParameterManagement::handleReply(const CommandMessage* reply,
                                                         Command_t previousCommand, uint32_t* state,
                                                         CommandMessage* optionalNextCommand,
@@ -180,6 +214,31 @@ ReturnValue_t Service20ParameterManagement::handleReply(const CommandMessage* re
       sendTmPacket(static_cast<uint8_t>(Subservice::PARAMETER_DUMP_REPLY), &parameterReply);
       return HasReturnvaluesIF::RETURN_OK;
     }
+    case ParameterMessage::REPLY_PARAMETER_BULK_DUMP: {
+      uint32_t numberOfParameters = 0;
+      uint32_t durationUs = 0;
+      store_address_t storeId =
+          ParameterMessage::getParameterBulkDumpReply(reply, &numberOfParameters, &durationUs);
+      ConstAccessorPair parameterData = IPCStore->getData(storeId);
+      if (parameterData.first != HasReturnvaluesIF::RETURN_OK) {
+        return HasReturnvaluesIF::RETURN_FAILED;
+      }
+      ParameterBulkDumpReply bulkReply(objectId, numberOfParameters, durationUs,
+                                       parameterData.second.data(), parameterData.second.size());
+      sendTmPacket(static_cast<uint8_t>(Subservice::PARAMETER_BULK_DUMP_REPLY), &bulkReply);
+      return HasReturnvaluesIF::RETURN_OK;
+    }
+    case ParameterMessage::REPLY_PARAMETER_BULK_LOAD: {
+      uint32_t numberOfParameters = 0;
+      ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+      uint32_t durationUs = 0;
+      ParameterMessage::getParameterBulkLoadReply(reply, &numberOfParameters, &result,
+                                                  &durationUs);
+      ParameterBulkLoadReport report(objectId, numberOfParameters, result, durationUs);
+      sendTmPacket(static_cast<uint8_t>(Subservice::PARAMETER_BULK_LOAD_REPORT), &report);
+      // A partially loaded batch leads to a failure verification with the reason
+      return result;
+    }
     default:
       return CommandingServiceBase::INVALID_REPLY;
   }
@@ -45,11 +45,21 @@ class Service20ParameterManagement : public CommandingServiceBase {
                                    size_t tcDataLen);
   ReturnValue_t prepareLoadCommand(CommandMessage* message, const uint8_t* tcData,
                                    size_t tcDataLen);
+  ReturnValue_t prepareBulkCommand(CommandMessage* message, Command_t command,
+                                   const uint8_t* tcData, size_t tcDataLen);
 
   enum class Subservice {
     PARAMETER_LOAD = 128,        //!< [EXPORT] : Load a Parameter
     PARAMETER_DUMP = 129,        //!< [EXPORT] : Dump a Parameter
     PARAMETER_DUMP_REPLY = 130,  //!< [EXPORT] : Dump a Parameter
+    //! [EXPORT] : Load many parameters of one object. The TC data contains the object ID
+    //! followed by the parameters in the bulk load format described in ParameterMessage.
+    PARAMETER_BULK_LOAD = 131,
+    //! [EXPORT] : Dump many parameters of one object. The TC data contains the object ID
+    //! followed by the 4 byte parameter IDs.
+    PARAMETER_BULK_DUMP = 132,
+    PARAMETER_BULK_DUMP_REPLY = 133,   //!< [EXPORT] : Reply to a bulk parameter dump
+    PARAMETER_BULK_LOAD_REPORT = 134,  //!< [EXPORT] : Report of a bulk parameter load
   };
 };
 
@@ -8,7 +8,7 @@
  *  packet structures in Mission Information Base (MIB).
  */
 
-#include "../../serialize/SerializeAdapter.h"
+#include "../../serialize/SerialStruct.h"
 #include "../../tmtcservices/VerificationCodes.h"
 
 /**
@@ -40,46 +40,23 @@ class FailureReport : public SerializeIF {  //!< [EXPORT] : [SUBSERVICE] 2, 4, 6
    */
   virtual ReturnValue_t serialize(uint8_t** buffer, size_t* size, size_t maxSize,
                                   SerializeIF::Endianness streamEndianness) const override {
-    ReturnValue_t result =
-        SerializeAdapter::serialize(&packetId, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    result = SerializeAdapter::serialize(&packetSequenceControl, buffer, size, maxSize,
-                                         streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
     if (failureSubtype == tc_verification::PROGRESS_FAILURE) {
-      result = SerializeAdapter::serialize(&stepNumber, buffer, size, maxSize, streamEndianness);
-      if (result != HasReturnvaluesIF::RETURN_OK) {
-        return result;
-      }
-    }
-    result = SerializeAdapter::serialize(&errorCode, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    result = SerializeAdapter::serialize(&errorParameter1, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
+      return serial::serializeFields(buffer, size, maxSize, streamEndianness, packetId,
+                                     packetSequenceControl, stepNumber, errorCode,
+                                     errorParameter1, errorParameter2);
     }
-
-    result = SerializeAdapter::serialize(&errorParameter2, buffer, size, maxSize, streamEndianness);
-    return result;
+    return serial::serializeFields(buffer, size, maxSize, streamEndianness, packetId,
+                                   packetSequenceControl, errorCode, errorParameter1,
+                                   errorParameter2);
   }
 
   virtual size_t getSerializedSize() const {
-    size_t size = 0;
-    size += SerializeAdapter::getSerializedSize(&packetId);
-    size += sizeof(packetSequenceControl);
     if (failureSubtype == tc_verification::PROGRESS_FAILURE) {
-      size += SerializeAdapter::getSerializedSize(&stepNumber);
+      return serial::serializedSize(packetId, packetSequenceControl, stepNumber, errorCode,
+                                    errorParameter1, errorParameter2);
     }
-    size += SerializeAdapter::getSerializedSize(&errorCode);
-    size += SerializeAdapter::getSerializedSize(&errorParameter1);
-    size += SerializeAdapter::getSerializedSize(&errorParameter2);
-    return size;
+    return serial::serializedSize(packetId, packetSequenceControl, errorCode, errorParameter1,
+                                  errorParameter2);
   }
 
   /**
@@ -120,33 +97,19 @@ class SuccessReport : public SerializeIF {  //!< [EXPORT] : [SUBSERVICE] 1, 3, 5
 
   virtual ReturnValue_t serialize(uint8_t** buffer, size_t* size, size_t maxSize,
                                   SerializeIF::Endianness streamEndianness) const override {
-    ReturnValue_t result =
-        SerializeAdapter::serialize(&packetId, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    result = SerializeAdapter::serialize(&packetSequenceControl, buffer, size, maxSize,
-                                         streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
     if (subtype == tc_verification::PROGRESS_SUCCESS) {
-      result = SerializeAdapter::serialize(&stepNumber, buffer, size, maxSize, streamEndianness);
-      if (result != HasReturnvaluesIF::RETURN_OK) {
-        return result;
-      }
+      return serial::serializeFields(buffer, size, maxSize, streamEndianness, packetId,
+                                     packetSequenceControl, stepNumber);
     }
-    return result;
+    return serial::serializeFields(buffer, size, maxSize, streamEndianness, packetId,
+                                   packetSequenceControl);
   }
 
   virtual size_t getSerializedSize() const override {
-    size_t size = 0;
-    size += SerializeAdapter::getSerializedSize(&packetId);
-    size += sizeof(packetSequenceControl);
     if (subtype == tc_verification::PROGRESS_SUCCESS) {
-      size += SerializeAdapter::getSerializedSize(&stepNumber);
+      return serial::serializedSize(packetId, packetSequenceControl, stepNumber);
     }
-    return size;
+    return serial::serializedSize(packetId, packetSequenceControl);
   }
 
   ReturnValue_t deSerialize(const uint8_t** buffer, size_t* size,
@@ -103,7 +103,7 @@ class ParameterCommand
   SerializeElement<uint16_t> ccsdsType = 0;
   SerializeElement<uint8_t> rows = 0;
   SerializeElement<uint8_t> columns = 0;
-  SerializeElement<SerialBufferAdapter<uint8_t>> parameterBuffer;
+  SerializeElement<SerialBufferAdapter<uint32_t>> parameterBuffer;
 };
 
 class ParameterLoadCommand : public ParameterCommand {
@@ -119,4 +119,59 @@ class ParameterDumpReply : public ParameterCommand {
       : ParameterCommand(objectId, parameterId, parameterBuffer, parameterBufferSize) {}
 };
 
+/**
+ * @brief   Reply to a bulk parameter dump. The parameter buffer contains the dumped
+ *          parameters in the format described in ParameterMessage.
+ */
+class ParameterBulkDumpReply
+    : public SerialLinkedListAdapter<SerializeIF> {  //!< [EXPORT] : [SUBSERVICE] 133
+ public:
+  ParameterBulkDumpReply(object_id_t objectId, uint32_t numberOfParameters, uint32_t durationUs,
+                         const uint8_t* parameterBuffer, size_t parameterBufferSize)
+      : objectId(objectId),
+        numberOfParameters(numberOfParameters),
+        durationUs(durationUs),
+        parameterBuffer(parameterBuffer, parameterBufferSize) {
+    setStart(&this->objectId);
+    this->objectId.setNext(&this->numberOfParameters);
+    this->numberOfParameters.setNext(&this->durationUs);
+    this->durationUs.setNext(&this->parameterBuffer);
+  }
+
+ private:
+  SerializeElement<object_id_t> objectId;
+  SerializeElement<uint32_t> numberOfParameters;
+  //! [EXPORT] : [COMMENT] Processing time of the batch in microseconds
+  SerializeElement<uint32_t> durationUs;
+  SerializeElement<SerialBufferAdapter<uint32_t>> parameterBuffer;
+};
+
+/**
+ * @brief   Report of a bulk parameter load
+ */
+class ParameterBulkLoadReport
+    : public SerialLinkedListAdapter<SerializeIF> {  //!< [EXPORT] : [SUBSERVICE] 134
+ public:
+  ParameterBulkLoadReport(object_id_t objectId, uint32_t numberOfParameters,
+                          ReturnValue_t result, uint32_t durationUs)
+      : objectId(objectId),
+        numberOfParameters(numberOfParameters),
+        result(result),
+        durationUs(durationUs) {
+    setStart(&this->objectId);
+    this->objectId.setNext(&this->numberOfParameters);
+    this->numberOfParameters.setNext(&this->result);
+    this->result.setNext(&this->durationUs);
+  }
+
+ private:
+  SerializeElement<object_id_t> objectId;
+  //! [EXPORT] : [COMMENT] Number of parameters which were loaded successfully
+  SerializeElement<uint32_t> numberOfParameters;
+  //! [EXPORT] : [COMMENT] Result of the first parameter which could not be loaded
+  SerializeElement<ReturnValue_t> result;
+  //! [EXPORT] : [COMMENT] Processing time of the batch in microseconds
+  SerializeElement<uint32_t> durationUs;
+};
+
 #endif /* FSFW_PUS_SERVICEPACKETS_SERVICE20PACKETS_H_ */
@@ -1,7 +1,7 @@
 #ifndef FSFW_PUS_SERVICEPACKETS_SERVICE5PACKETS_H_
 #define FSFW_PUS_SERVICEPACKETS_SERVICE5PACKETS_H_
 
-#include "../../serialize/SerializeAdapter.h"
+#include "../../serialize/SerialStruct.h"
 #include "../../tmtcservices/VerificationCodes.h"
 
 /**
@@ -26,33 +26,12 @@ class EventReport : public SerializeIF {  //!< [EXPORT] : [SUBSERVICE] 1, 2, 3,
 
   virtual ReturnValue_t serialize(uint8_t** buffer, size_t* size, size_t maxSize,
                                   SerializeIF::Endianness streamEndianness) const override {
-    ReturnValue_t result =
-        SerializeAdapter::serialize(&reportId, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    result = SerializeAdapter::serialize(&objectId, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    result = SerializeAdapter::serialize(&parameter1, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    result = SerializeAdapter::serialize(&parameter2, buffer, size, maxSize, streamEndianness);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      return result;
-    }
-    return result;
+    return serial::serializeFields(buffer, size, maxSize, streamEndianness, reportId, objectId,
+                                   parameter1, parameter2);
   }
 
   virtual size_t getSerializedSize() const override {
-    uint32_t size = 0;
-    size += SerializeAdapter::getSerializedSize(&reportId);
-    size += SerializeAdapter::getSerializedSize(&objectId);
-    size += SerializeAdapter::getSerializedSize(&parameter1);
-    size += SerializeAdapter::getSerializedSize(&parameter2);
-    return size;
+    return serial::serializedSize(reportId, objectId, parameter1, parameter2);
   }
 
   virtual ReturnValue_t deSerialize(const uint8_t** buffer, size_t* size,
@@ -6,7 +6,7 @@
 #include "../../serialize/SerialBufferAdapter.h"
 #include "../../serialize/SerialFixedArrayListAdapter.h"
 #include "../../serialize/SerialLinkedListAdapter.h"
-#include "../../serialize/SerializeElement.h"
+#include "../../serialize/SerialStruct.h"
 
 /**
  * @brief Subservice 128
@@ -46,26 +46,18 @@ class DirectCommand
  *   3. Data
  * @ingroup spacepackets
  */
-class DataReply : public SerialLinkedListAdapter<SerializeIF> {  //!< [EXPORT] : [SUBSERVICE] 130
+class DataReply  //!< [EXPORT] : [SUBSERVICE] 130
+    : public SerialStruct<object_id_t, ActionId_t, SerialBufferAdapter<uint16_t>> {
  public:
   typedef uint16_t typeOfMaxDataSize;
   static const uint16_t MAX_DATA_LENGTH = sizeof(typeOfMaxDataSize);
   DataReply(object_id_t objectId_, ActionId_t actionId_, const uint8_t* replyDataBuffer_ = NULL,
             uint16_t replyDataSize_ = 0)
-      : objectId(objectId_), actionId(actionId_), replyData(replyDataBuffer_, replyDataSize_) {
-    setLinks();
-  }
+      : SerialStruct(objectId_, actionId_,
+                     SerialBufferAdapter<uint16_t>(replyDataBuffer_, replyDataSize_)) {}
 
- private:
-  DataReply(const DataReply& reply);
-  void setLinks() {
-    setStart(&objectId);
-    objectId.setNext(&actionId);
-    actionId.setNext(&replyData);
-  }
-  SerializeElement<object_id_t> objectId;
-  SerializeElement<ActionId_t> actionId;
-  SerializeElement<SerialBufferAdapter<uint16_t>> replyData;
+  DataReply(const DataReply& reply) = delete;
+  DataReply& operator=(const DataReply& reply) = delete;
 };
 
 /**
@@ -74,7 +66,7 @@ class DataReply : public SerialLinkedListAdapter<SerializeIF> {  //!< [EXPORT] :
  * Not used yet. Telecommand Verification takes care of this.
  * @ingroup spacepackets
  */
-class DirectReply : public SerialLinkedListAdapter<SerializeIF> {  //!< [EXPORT] : [SUBSERVICE] 132
+class DirectReply : public SerializeIF {  //!< [EXPORT] : [SUBSERVICE] 132
  public:
   typedef uint16_t typeOfMaxDataSize;
   static const uint16_t MAX_DATA_LENGTH = sizeof(typeOfMaxDataSize);
@@ -85,25 +77,41 @@ class DirectReply : public SerialLinkedListAdapter<SerializeIF> {  //!< [EXPORT]
         objectId(objectId_),
         actionId(actionId_),
         returnCode(returnCode_),
-        step(step_) {
-    setLinks();
+        step(step_) {}
+
+  ReturnValue_t serialize(uint8_t** buffer, size_t* size, size_t maxSize,
+                          Endianness streamEndianness) const override {
+    if (isStep) {
+      return serial::serializeFields(buffer, size, maxSize, streamEndianness, objectId, actionId,
+                                     returnCode, step);
+    }
+    return serial::serializeFields(buffer, size, maxSize, streamEndianness, objectId, actionId,
+                                   returnCode);
   }
 
- private:
-  void setLinks() {
-    setStart(&objectId);
-    objectId.setNext(&actionId);
-    actionId.setNext(&returnCode);
+  size_t getSerializedSize() const override {
+    if (isStep) {
+      return serial::serializedSize(objectId, actionId, returnCode, step);
+    }
+    return serial::serializedSize(objectId, actionId, returnCode);
+  }
+
+  ReturnValue_t deSerialize(const uint8_t** buffer, size_t* size,
+                            Endianness streamEndianness) override {
     if (isStep) {
-      returnCode.setNext(&step);
+      return serial::deSerializeFields(buffer, size, streamEndianness, objectId, actionId,
+                                       returnCode, step);
     }
+    return serial::deSerializeFields(buffer, size, streamEndianness, objectId, actionId,
+                                     returnCode);
   }
 
-  bool isStep;                                 //!< [EXPORT] : [IGNORE]
-  SerializeElement<object_id_t> objectId;      //!< [EXPORT] : [IGNORE]
-  SerializeElement<ActionId_t> actionId;       //!< [EXPORT] : [IGNORE]
-  SerializeElement<ReturnValue_t> returnCode;  //!< [EXPORT] : [IGNORE]
-  SerializeElement<uint8_t> step;              //!< [EXPORT] : [OPTIONAL] [IGNORE]
+ private:
+  bool isStep;               //!< [EXPORT] : [IGNORE]
+  object_id_t objectId;      //!< [EXPORT] : [IGNORE]
+  ActionId_t actionId;       //!< [EXPORT] : [IGNORE]
+  ReturnValue_t returnCode;  //!< [EXPORT] : [IGNORE]
+  uint8_t step;              //!< [EXPORT] : [OPTIONAL] [IGNORE]
 };
 
 #endif /* FSFW_PUS_SERVICEPACKETS_SERVICE8PACKETS_H_ */
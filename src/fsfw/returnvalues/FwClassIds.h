@@ -83,6 +83,7 @@ enum : uint8_t {
   MGM_LIS3MDL,                    // MGMLIS3
   MGM_RM3100,                     // MGMRM3100
   SPACE_PACKET_PARSER,            // SPPA
+  HAL_UIO,                        // HUIO
   FW_CLASS_ID_COUNT               // [EXPORT] : [END]
 
 };
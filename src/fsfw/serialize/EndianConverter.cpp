@@ -0,0 +1,111 @@
+#include "fsfw/serialize/EndianConverter.h"
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+inline uint16_t reverseBytes(uint16_t value) {
+  return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+inline uint32_t reverseBytes(uint32_t value) {
+  return (value >> 24) | ((value >> 8) & 0x0000ff00) | ((value << 8) & 0x00ff0000) |
+         (value << 24);
+}
+
+inline uint64_t reverseBytes(uint64_t value) {
+  return (static_cast<uint64_t>(reverseBytes(static_cast<uint32_t>(value))) << 32) |
+         reverseBytes(static_cast<uint32_t>(value >> 32));
+}
+
+/**
+ * Swaps the elements one by one. The shift pattern is compiled to a single byte swap
+ * instruction by common compilers, memcpy takes care of unaligned buffers.
+ */
+template <typename RAW>
+void swapScalar(uint8_t *out, const uint8_t *in, size_t count) {
+  for (size_t idx = 0; idx < count; idx++) {
+    RAW value;
+    std::memcpy(&value, in + idx * sizeof(RAW), sizeof(RAW));
+    value = reverseBytes(value);
+    std::memcpy(out + idx * sizeof(RAW), &value, sizeof(RAW));
+  }
+}
+
+/**
+ * Swaps all 16 byte blocks of the array with vector instructions if available.
+ * @return Number of elements which were swapped
+ */
+template <size_t SIZE>
+size_t swapVector(uint8_t *out, const uint8_t *in, size_t count) {
+  constexpr size_t BLOCK_SIZE = 16;
+  size_t blocks = count * SIZE / BLOCK_SIZE;
+#if defined(__SSSE3__)
+  uint8_t shuffle[BLOCK_SIZE];
+  for (size_t idx = 0; idx < BLOCK_SIZE; idx++) {
+    shuffle[idx] = static_cast<uint8_t>(idx - idx % SIZE + SIZE - 1 - idx % SIZE);
+  }
+  const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(shuffle));
+  for (size_t block = 0; block < blocks; block++) {
+    __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + block * BLOCK_SIZE));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + block * BLOCK_SIZE),
+                     _mm_shuffle_epi8(data, mask));
+  }
+#elif defined(__ARM_NEON)
+  for (size_t block = 0; block < blocks; block++) {
+    uint8x16_t data = vld1q_u8(in + block * BLOCK_SIZE);
+    if (SIZE == 2) {
+      data = vrev16q_u8(data);
+    } else if (SIZE == 4) {
+      data = vrev32q_u8(data);
+    } else {
+      data = vrev64q_u8(data);
+    }
+    vst1q_u8(out + block * BLOCK_SIZE, data);
+  }
+#else
+  blocks = 0;
+#endif
+  return blocks * BLOCK_SIZE / SIZE;
+}
+
+template <typename RAW>
+void swapElements(uint8_t *out, const uint8_t *in, size_t count) {
+  size_t swapped = swapVector<sizeof(RAW)>(out, in, count);
+  swapScalar<RAW>(out + swapped * sizeof(RAW), in + swapped * sizeof(RAW), count - swapped);
+}
+
+}  // namespace
+
+void EndianConverter::swapArray(uint8_t *out, const uint8_t *in, size_t elementSize,
+                                size_t count) {
+  switch (elementSize) {
+    case 1:
+      copyArray(out, in, count);
+      break;
+    case 2:
+      swapElements<uint16_t>(out, in, count);
+      break;
+    case 4:
+      swapElements<uint32_t>(out, in, count);
+      break;
+    case 8:
+      swapElements<uint64_t>(out, in, count);
+      break;
+    default:
+      // Swapping from both ends at once also works if in and out are the same
+      for (size_t idx = 0; idx < count * elementSize; idx += elementSize) {
+        for (size_t byte = 0; byte < (elementSize + 1) / 2; byte++) {
+          uint8_t low = in[idx + byte];
+          uint8_t high = in[idx + elementSize - byte - 1];
+          out[idx + byte] = high;
+          out[idx + elementSize - byte - 1] = low;
+        }
+      }
+      break;
+  }
+}
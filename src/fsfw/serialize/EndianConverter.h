@@ -119,6 +119,52 @@ class EndianConverter {
     return;
 #endif
   }
+
+  /**
+   * Convert an array of elements between big endian and machine endian.
+   * Each element of elementSize bytes is converted like a single variable. Converting the
+   * whole array at once allows using vector instructions for elements of 2, 4 and 8 bytes.
+   * In and out may point to the same buffer but must not overlap otherwise.
+   */
+  static void convertBigEndianArray(uint8_t *out, const uint8_t *in, size_t elementSize,
+                                    size_t count) {
+#ifndef BYTE_ORDER_SYSTEM
+#error BYTE_ORDER_SYSTEM not defined
+#elif BYTE_ORDER_SYSTEM == LITTLE_ENDIAN
+    swapArray(out, in, elementSize, count);
+#elif BYTE_ORDER_SYSTEM == BIG_ENDIAN
+    copyArray(out, in, elementSize * count);
+#endif
+  }
+
+  /**
+   * Convert an array of elements between little endian and machine endian.
+   * See #convertBigEndianArray.
+   */
+  static void convertLittleEndianArray(uint8_t *out, const uint8_t *in, size_t elementSize,
+                                       size_t count) {
+#ifndef BYTE_ORDER_SYSTEM
+#error BYTE_ORDER_SYSTEM not defined
+#elif BYTE_ORDER_SYSTEM == BIG_ENDIAN
+    swapArray(out, in, elementSize, count);
+#elif BYTE_ORDER_SYSTEM == LITTLE_ENDIAN
+    copyArray(out, in, elementSize * count);
+#endif
+  }
+
+  /**
+   * Reverse the byte order of each element of an array, independent of the machine endian.
+   * Uses SSSE3 or NEON instructions if they are enabled for the target.
+   * In and out may point to the same buffer but must not overlap otherwise.
+   */
+  static void swapArray(uint8_t *out, const uint8_t *in, size_t elementSize, size_t count);
+
+ private:
+  static void copyArray(uint8_t *out, const uint8_t *in, size_t size) {
+    if (out != in) {
+      memcpy(out, in, size);
+    }
+  }
 };
 
 #endif /* FSFW_SERIALIZE_ENDIANCONVERTER_H_ */
@@ -4,7 +4,7 @@
 #include <utility>
 
 #include "../container/ArrayList.h"
-#include "SerializeIF.h"
+#include "SerializeAdapter.h"
 
 /**
  * Also serializes length field !
@@ -25,26 +25,17 @@ class SerialArrayListAdapter : public SerializeIF {
                                  size_t maxSize, Endianness streamEndianness) {
     ReturnValue_t result =
         SerializeAdapter::serialize(&list->size, buffer, size, maxSize, streamEndianness);
-    count_t i = 0;
-    while ((result == HasReturnvaluesIF::RETURN_OK) && (i < list->size)) {
-      result =
-          SerializeAdapter::serialize(&list->entries[i], buffer, size, maxSize, streamEndianness);
-      ++i;
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
     }
-    return result;
+    return SerializeAdapter::serializeArray(list->entries, list->size, buffer, size, maxSize,
+                                            streamEndianness);
   }
 
   virtual size_t getSerializedSize() const { return getSerializedSize(adaptee); }
 
   static uint32_t getSerializedSize(const ArrayList<T, count_t>* list) {
-    uint32_t printSize = sizeof(count_t);
-    count_t i = 0;
-
-    for (i = 0; i < list->size; ++i) {
-      printSize += SerializeAdapter::getSerializedSize(&list->entries[i]);
-    }
-
-    return printSize;
+    return sizeof(count_t) + SerializeAdapter::getSerializedArraySize(list->entries, list->size);
   }
 
   virtual ReturnValue_t deSerialize(const uint8_t** buffer, size_t* size,
@@ -64,12 +55,8 @@ class SerialArrayListAdapter : public SerializeIF {
     }
 
     list->size = tempSize;
-    count_t i = 0;
-    while ((result == HasReturnvaluesIF::RETURN_OK) && (i < list->size)) {
-      result = SerializeAdapter::deSerialize(&list->front()[i], buffer, size, streamEndianness);
-      ++i;
-    }
-    return result;
+    return SerializeAdapter::deSerializeArray(list->front(), list->size, buffer, size,
+                                              streamEndianness);
   }
 
  private:
@@ -0,0 +1,336 @@
+#ifndef FSFW_SERIALIZE_SERIALSTRUCT_H_
+#define FSFW_SERIALIZE_SERIALSTRUCT_H_
+
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "SerializeAdapter.h"
+
+/**
+ * @brief   Compile-time serialization of a fixed sequence of fields
+ * @details
+ * An alternative to the SerialLinkedListAdapter which does not need a runtime linked list
+ * and a virtual call per field. The sequence of fields is given as a parameter pack, so the
+ * serialized size of all plain fields is known at compile time. The remaining buffer size is
+ * checked once for the whole sequence and the plain fields are then written with unrolled
+ * stores. Fields which implement the SerializeIF, like the SerialBufferAdapter, can be mixed
+ * in and are serialized with their own functions.
+ *
+ * The wire format is the same as the one of a SerialLinkedListAdapter with the same sequence
+ * of SerializeElement members.
+ * @ingroup serialize
+ */
+namespace serial {
+
+namespace detail {
+
+template <typename T>
+constexpr bool isPlain() {
+  return not std::is_base_of<SerializeIF, T>::value;
+}
+
+template <typename T>
+size_t fieldSize(const T& field) {
+  if constexpr (isPlain<T>()) {
+    return sizeof(T);
+  } else {
+    return field.getSerializedSize();
+  }
+}
+
+template <size_t SIZE>
+struct RawType {};
+template <>
+struct RawType<1> {
+  using type = uint8_t;
+};
+template <>
+struct RawType<2> {
+  using type = uint16_t;
+};
+template <>
+struct RawType<4> {
+  using type = uint32_t;
+};
+template <>
+struct RawType<8> {
+  using type = uint64_t;
+};
+
+template <typename T>
+constexpr bool hasRawType() {
+  return sizeof(T) == 1 or sizeof(T) == 2 or sizeof(T) == 4 or sizeof(T) == 8;
+}
+
+/**
+ * The bytes are written with shifts instead of the byte reversal loop of the
+ * EndianConverter, which compilers merge into a single byte swap and store.
+ */
+template <SerializeIF::Endianness ENDIANNESS, typename T, size_t... IDX>
+void writeBytes(uint8_t* destination, const T& value, std::index_sequence<IDX...>) {
+  using Raw = typename RawType<sizeof(T)>::type;
+  Raw raw;
+  std::memcpy(&raw, &value, sizeof(T));
+  if constexpr (ENDIANNESS == SerializeIF::Endianness::BIG) {
+    ((destination[IDX] = static_cast<uint8_t>(raw >> (8 * (sizeof(T) - 1 - IDX)))), ...);
+  } else {
+    ((destination[IDX] = static_cast<uint8_t>(raw >> (8 * IDX))), ...);
+  }
+}
+
+template <SerializeIF::Endianness ENDIANNESS, typename T, size_t... IDX>
+void readBytes(T& value, const uint8_t* source, std::index_sequence<IDX...>) {
+  using Raw = typename RawType<sizeof(T)>::type;
+  Raw raw;
+  if constexpr (ENDIANNESS == SerializeIF::Endianness::BIG) {
+    raw = static_cast<Raw>(((static_cast<Raw>(source[IDX]) << (8 * (sizeof(T) - 1 - IDX))) | ...));
+  } else {
+    raw = static_cast<Raw>(((static_cast<Raw>(source[IDX]) << (8 * IDX)) | ...));
+  }
+  std::memcpy(&value, &raw, sizeof(T));
+}
+
+template <SerializeIF::Endianness ENDIANNESS, typename T>
+void writePlain(uint8_t* destination, const T& value) {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "If a type needs to be serialized it must be a child of "
+                "SerializeIF or trivially copy-able");
+  if constexpr (ENDIANNESS == SerializeIF::Endianness::MACHINE or not hasRawType<T>()) {
+    T tmp = value;
+    if constexpr (ENDIANNESS == SerializeIF::Endianness::BIG) {
+      tmp = EndianConverter::convertBigEndian<T>(value);
+    } else if constexpr (ENDIANNESS == SerializeIF::Endianness::LITTLE) {
+      tmp = EndianConverter::convertLittleEndian<T>(value);
+    }
+    std::memcpy(destination, &tmp, sizeof(T));
+  } else {
+    writeBytes<ENDIANNESS>(destination, value, std::make_index_sequence<sizeof(T)>());
+  }
+}
+
+template <SerializeIF::Endianness ENDIANNESS, typename T>
+void readPlain(T& value, const uint8_t* source) {
+  if constexpr (ENDIANNESS == SerializeIF::Endianness::MACHINE or not hasRawType<T>()) {
+    std::memcpy(&value, source, sizeof(T));
+    if constexpr (ENDIANNESS == SerializeIF::Endianness::BIG) {
+      value = EndianConverter::convertBigEndian<T>(value);
+    } else if constexpr (ENDIANNESS == SerializeIF::Endianness::LITTLE) {
+      value = EndianConverter::convertLittleEndian<T>(value);
+    }
+  } else {
+    readBytes<ENDIANNESS>(value, source, std::make_index_sequence<sizeof(T)>());
+  }
+}
+
+template <typename... FIELDS>
+constexpr bool allPlain() {
+  return (isPlain<FIELDS>() and ...);
+}
+
+/**
+ * Used if not all fields are plain. The plain fields check the remaining size themselves,
+ * because the size of the other fields is only known by their own implementation.
+ */
+template <SerializeIF::Endianness ENDIANNESS, typename T>
+ReturnValue_t storeField(const T& field, uint8_t** buffer, size_t* size, size_t maxSize) {
+  if constexpr (isPlain<T>()) {
+    if (*size + sizeof(T) > maxSize) {
+      return SerializeIF::BUFFER_TOO_SHORT;
+    }
+    writePlain<ENDIANNESS>(*buffer, field);
+    *buffer += sizeof(T);
+    *size += sizeof(T);
+    return HasReturnvaluesIF::RETURN_OK;
+  } else {
+    return field.serialize(buffer, size, maxSize, ENDIANNESS);
+  }
+}
+
+template <SerializeIF::Endianness ENDIANNESS, typename T>
+ReturnValue_t loadField(T& field, const uint8_t** buffer, size_t* size) {
+  if constexpr (isPlain<T>()) {
+    if (*size < sizeof(T)) {
+      return SerializeIF::STREAM_TOO_SHORT;
+    }
+    readPlain<ENDIANNESS>(field, *buffer);
+    *buffer += sizeof(T);
+    *size -= sizeof(T);
+    return HasReturnvaluesIF::RETURN_OK;
+  } else {
+    return field.deSerialize(buffer, size, ENDIANNESS);
+  }
+}
+
+/**
+ * If all fields are plain, the size was already checked for the whole sequence. The buffer
+ * and size are then only updated once, so the compiler can merge the stores.
+ */
+template <SerializeIF::Endianness ENDIANNESS, typename... FIELDS>
+ReturnValue_t store(uint8_t** buffer, size_t* size, size_t maxSize, const FIELDS&... fields) {
+  if constexpr (allPlain<FIELDS...>()) {
+    uint8_t* destination = *buffer;
+    size_t offset = 0;
+    ((writePlain<ENDIANNESS>(destination + offset, fields), offset += sizeof(FIELDS)), ...);
+    *buffer += offset;
+    *size += offset;
+    return HasReturnvaluesIF::RETURN_OK;
+  } else {
+    ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+    // The fold expression stops at the first failing field
+    (((result = storeField<ENDIANNESS>(fields, buffer, size, maxSize)) ==
+      HasReturnvaluesIF::RETURN_OK) and
+     ...);
+    return result;
+  }
+}
+
+template <SerializeIF::Endianness ENDIANNESS, typename... FIELDS>
+ReturnValue_t load(const uint8_t** buffer, size_t* size, FIELDS&... fields) {
+  if constexpr (allPlain<FIELDS...>()) {
+    const uint8_t* source = *buffer;
+    size_t offset = 0;
+    ((readPlain<ENDIANNESS>(fields, source + offset), offset += sizeof(FIELDS)), ...);
+    *buffer += offset;
+    *size -= offset;
+    return HasReturnvaluesIF::RETURN_OK;
+  } else {
+    ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+    (((result = loadField<ENDIANNESS>(fields, buffer, size)) == HasReturnvaluesIF::RETURN_OK) and
+     ...);
+    return result;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * Serialized size of a sequence of plain fields, known at compile time.
+ */
+template <typename... FIELDS>
+constexpr size_t fixedSize() {
+  static_assert(detail::allPlain<FIELDS...>(),
+                "Only plain fields have a serialized size known at compile time");
+  return (sizeof(FIELDS) + ... + 0);
+}
+
+/**
+ * Serialized size of a sequence of fields. Folds to a constant if all fields are plain.
+ */
+template <typename... FIELDS>
+size_t serializedSize(const FIELDS&... fields) {
+  return (detail::fieldSize(fields) + ... + 0);
+}
+
+/**
+ * Serializes the fields in the given order. The interface is the same as the one of
+ * SerializeIF::serialize. Nothing is written if the buffer is too short for all fields.
+ */
+template <typename... FIELDS>
+ReturnValue_t serializeFields(uint8_t** buffer, size_t* size, size_t maxSize,
+                              SerializeIF::Endianness streamEndianness, const FIELDS&... fields) {
+  size_t ignoredSize = 0;
+  if (size == nullptr) {
+    size = &ignoredSize;
+  }
+  size_t newSize = *size + serializedSize(fields...);
+  if (newSize > maxSize or newSize < *size) {
+    return SerializeIF::BUFFER_TOO_SHORT;
+  }
+  switch (streamEndianness) {
+    case SerializeIF::Endianness::BIG:
+      return detail::store<SerializeIF::Endianness::BIG>(buffer, size, maxSize, fields...);
+    case SerializeIF::Endianness::LITTLE:
+      return detail::store<SerializeIF::Endianness::LITTLE>(buffer, size, maxSize, fields...);
+    default:
+    case SerializeIF::Endianness::MACHINE:
+      return detail::store<SerializeIF::Endianness::MACHINE>(buffer, size, maxSize, fields...);
+  }
+}
+
+/**
+ * Deserializes the fields in the given order. The interface is the same as the one of
+ * SerializeIF::deSerialize.
+ */
+template <typename... FIELDS>
+ReturnValue_t deSerializeFields(const uint8_t** buffer, size_t* size,
+                                SerializeIF::Endianness streamEndianness, FIELDS&... fields) {
+  if constexpr (detail::allPlain<FIELDS...>()) {
+    if (*size < fixedSize<FIELDS...>()) {
+      return SerializeIF::STREAM_TOO_SHORT;
+    }
+  }
+  switch (streamEndianness) {
+    case SerializeIF::Endianness::BIG:
+      return detail::load<SerializeIF::Endianness::BIG>(buffer, size, fields...);
+    case SerializeIF::Endianness::LITTLE:
+      return detail::load<SerializeIF::Endianness::LITTLE>(buffer, size, fields...);
+    default:
+    case SerializeIF::Endianness::MACHINE:
+      return detail::load<SerializeIF::Endianness::MACHINE>(buffer, size, fields...);
+  }
+}
+
+}  // namespace serial
+
+/**
+ * @brief   Structure whose fields are declared as a type list and serialized in that order
+ *          with the serial::serializeFields functions.
+ * @details
+ * Example:
+ * @code
+ * class Report : public SerialStruct<object_id_t, uint32_t, uint8_t> {
+ *  public:
+ *   enum Fields { OBJECT_ID, PARAMETER, FLAGS };
+ *   Report(object_id_t objectId, uint32_t parameter, uint8_t flags)
+ *       : SerialStruct(objectId, parameter, flags) {}
+ *   object_id_t getObjectId() const { return get<OBJECT_ID>(); }
+ * };
+ * @endcode
+ * @ingroup serialize
+ */
+template <typename... FIELDS>
+class SerialStruct : public SerializeIF {
+ public:
+  SerialStruct() = default;
+  explicit SerialStruct(FIELDS... values) : fields(std::move(values)...) {}
+
+  template <size_t INDEX>
+  const auto& get() const {
+    return std::get<INDEX>(fields);
+  }
+
+  template <size_t INDEX>
+  auto& get() {
+    return std::get<INDEX>(fields);
+  }
+
+  ReturnValue_t serialize(uint8_t** buffer, size_t* size, size_t maxSize,
+                          Endianness streamEndianness) const override {
+    return std::apply(
+        [&](const FIELDS&... values) {
+          return serial::serializeFields(buffer, size, maxSize, streamEndianness, values...);
+        },
+        fields);
+  }
+
+  size_t getSerializedSize() const override {
+    return std::apply([](const FIELDS&... values) { return serial::serializedSize(values...); },
+                      fields);
+  }
+
+  ReturnValue_t deSerialize(const uint8_t** buffer, size_t* size,
+                            Endianness streamEndianness) override {
+    return std::apply(
+        [&](FIELDS&... values) {
+          return serial::deSerializeFields(buffer, size, streamEndianness, values...);
+        },
+        fields);
+  }
+
+ private:
+  std::tuple<FIELDS...> fields;
+};
+
+#endif /* FSFW_SERIALIZE_SERIALSTRUCT_H_ */
@@ -155,6 +155,52 @@ class SerializeAdapter {
     return result;
   }
 
+  /**
+   * @brief   Serializes an array of trivially copy-able types or children of SerializeIF.
+   * @details
+   * For trivially copy-able types, the remaining size is only checked once and the whole
+   * array is converted in a single pass, which is considerably faster than serializing each
+   * element on its own. Nothing is written if the buffer is too short.
+   *
+   * @param[in] objects: Array to serialize
+   * @param[in] count: Number of elements of the array
+   * @return
+   *      - @c BUFFER_TOO_SHORT The given buffer in is too short
+   *      - @c RETURN_OK Successful serialization
+   */
+  template <typename T>
+  static ReturnValue_t serializeArray(const T *objects, size_t count, uint8_t **buffer,
+                                      size_t *size, size_t maxSize,
+                                      SerializeIF::Endianness streamEndianness) {
+    InternalSerializeAdapter<T, std::is_base_of<SerializeIF, T>::value> adapter;
+    return adapter.serializeArray(objects, count, buffer, size, maxSize, streamEndianness);
+  }
+
+  template <typename T>
+  static size_t getSerializedArraySize(const T *objects, size_t count) {
+    InternalSerializeAdapter<T, std::is_base_of<SerializeIF, T>::value> adapter;
+    return adapter.getSerializedArraySize(objects, count);
+  }
+
+  /**
+   * @brief   Deserializes an array of trivially copy-able types or children of SerializeIF.
+   * @details
+   * Counterpart of #serializeArray. Nothing is read if the stream is too short for the
+   * trivially copy-able elements.
+   *
+   * @param[out] objects: Array to deserialize into
+   * @param[in] count: Number of elements to deserialize
+   * @return
+   *  - @c STREAM_TOO_SHORT The input stream is too short to deSerialize the array
+   *  - @c RETURN_OK Successful deserialization
+   */
+  template <typename T>
+  static ReturnValue_t deSerializeArray(T *objects, size_t count, const uint8_t **buffer,
+                                        size_t *size, SerializeIF::Endianness streamEndianness) {
+    InternalSerializeAdapter<T, std::is_base_of<SerializeIF, T>::value> adapter;
+    return adapter.deSerializeArray(objects, count, buffer, size, streamEndianness);
+  }
+
  private:
   /**
    * Internal template to deduce the right function calls at compile time
@@ -233,6 +279,52 @@ class SerializeAdapter {
     }
 
     uint32_t getSerializedSize(const T *object) { return sizeof(T); }
+
+    ReturnValue_t serializeArray(const T *objects, size_t count, uint8_t **buffer, size_t *size,
+                                 size_t maxSize, SerializeIF::Endianness streamEndianness) {
+      size_t ignoredSize = 0;
+      if (size == nullptr) {
+        size = &ignoredSize;
+      }
+      // Written this way to avoid an integer overflow of the required size
+      if (*size > maxSize or count > (maxSize - *size) / sizeof(T)) {
+        return SerializeIF::BUFFER_TOO_SHORT;
+      }
+      convertArray(*buffer, reinterpret_cast<const uint8_t *>(objects), count, streamEndianness);
+      *size += count * sizeof(T);
+      *buffer += count * sizeof(T);
+      return HasReturnvaluesIF::RETURN_OK;
+    }
+
+    size_t getSerializedArraySize(const T *objects, size_t count) { return count * sizeof(T); }
+
+    ReturnValue_t deSerializeArray(T *objects, size_t count, const uint8_t **buffer, size_t *size,
+                                   SerializeIF::Endianness streamEndianness) {
+      if (count > *size / sizeof(T)) {
+        return SerializeIF::STREAM_TOO_SHORT;
+      }
+      convertArray(reinterpret_cast<uint8_t *>(objects), *buffer, count, streamEndianness);
+      *size -= count * sizeof(T);
+      *buffer += count * sizeof(T);
+      return HasReturnvaluesIF::RETURN_OK;
+    }
+
+   private:
+    static void convertArray(uint8_t *out, const uint8_t *in, size_t count,
+                             SerializeIF::Endianness streamEndianness) {
+      switch (streamEndianness) {
+        case SerializeIF::Endianness::BIG:
+          EndianConverter::convertBigEndianArray(out, in, sizeof(T), count);
+          break;
+        case SerializeIF::Endianness::LITTLE:
+          EndianConverter::convertLittleEndianArray(out, in, sizeof(T), count);
+          break;
+        default:
+        case SerializeIF::Endianness::MACHINE:
+          std::memcpy(out, in, count * sizeof(T));
+          break;
+      }
+    }
   };
 
   /**
@@ -257,6 +349,32 @@ class SerializeAdapter {
                               SerializeIF::Endianness streamEndianness) {
       return object->deSerialize(buffer, size, streamEndianness);
     }
+
+    ReturnValue_t serializeArray(const T *objects, size_t count, uint8_t **buffer, size_t *size,
+                                 size_t maxSize, SerializeIF::Endianness streamEndianness) const {
+      ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+      for (size_t idx = 0; idx < count and result == HasReturnvaluesIF::RETURN_OK; idx++) {
+        result = serialize(&objects[idx], buffer, size, maxSize, streamEndianness);
+      }
+      return result;
+    }
+
+    size_t getSerializedArraySize(const T *objects, size_t count) const {
+      size_t serializedSize = 0;
+      for (size_t idx = 0; idx < count; idx++) {
+        serializedSize += objects[idx].getSerializedSize();
+      }
+      return serializedSize;
+    }
+
+    ReturnValue_t deSerializeArray(T *objects, size_t count, const uint8_t **buffer, size_t *size,
+                                   SerializeIF::Endianness streamEndianness) {
+      ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+      for (size_t idx = 0; idx < count and result == HasReturnvaluesIF::RETURN_OK; idx++) {
+        result = objects[idx].deSerialize(buffer, size, streamEndianness);
+      }
+      return result;
+    }
   };
 };
 
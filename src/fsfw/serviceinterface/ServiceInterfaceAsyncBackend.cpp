@@ -0,0 +1,708 @@
+#include "fsfw/serviceinterface/ServiceInterfaceAsyncBackend.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "fsfw/tasks/TaskFactory.h"
+#include "fsfw/timemanager/Clock.h"
+
+#if FSFW_DISABLE_PRINTOUT == 0
+// Implemented in ServiceInterfacePrinter.cpp
+size_t fsfwPrintPreamble(char* bufferPosition, sif::PrintLevel printType,
+                         const Clock::TimeOfDay_t& now);
+void fsfwPrintBuffer(char* bufferPosition, size_t len, size_t bufferSize);
+#endif
+
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+// to be implemented by bsp
+extern "C" void printChar(const char*, bool errStream);
+#endif
+
+namespace {
+
+constexpr size_t RECORD_ALIGNMENT = 8;
+//! Conversion specifications are copied into a buffer of this size to be terminated
+constexpr size_t SPEC_BUFFER_SIZE = 24;
+
+size_t alignRecordSize(size_t size) {
+  return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+}
+
+enum class LengthModifiers { NONE, HH, H, L, LL, J, Z, T, LONG_DOUBLE };
+
+enum class ArgTypes {
+  NONE,
+  INT,
+  LONG,
+  LONG_LONG,
+  INTMAX,
+  SIZE,
+  PTRDIFF,
+  UNSIGNED,
+  UNSIGNED_LONG,
+  UNSIGNED_LONG_LONG,
+  UINTMAX,
+  DOUBLE,
+  LONG_DOUBLE,
+  POINTER,
+  STRING,
+  UNSUPPORTED
+};
+
+struct ConversionSpec {
+  const char* start = nullptr;
+  size_t len = 0;
+  uint8_t starCount = 0;
+  ArgTypes argType = ArgTypes::NONE;
+};
+
+/**
+ * Parses the conversion specification starting at the given '%' character.
+ * @return Position after the conversion specification
+ */
+const char* parseSpec(const char* pos, ConversionSpec& spec) {
+  spec = ConversionSpec();
+  spec.start = pos;
+  pos++;
+  if (*pos == '%') {
+    spec.len = 2;
+    return pos + 1;
+  }
+  while (*pos != '\0' and std::strchr("-+ #0", *pos) != nullptr) {
+    pos++;
+  }
+  if (*pos == '*') {
+    spec.starCount++;
+    pos++;
+  } else {
+    while (*pos >= '0' and *pos <= '9') {
+      pos++;
+    }
+  }
+  if (*pos == '.') {
+    pos++;
+    if (*pos == '*') {
+      spec.starCount++;
+      pos++;
+    } else {
+      while (*pos >= '0' and *pos <= '9') {
+        pos++;
+      }
+    }
+  }
+  LengthModifiers length = LengthModifiers::NONE;
+  if (*pos == 'h') {
+    pos++;
+    length = LengthModifiers::H;
+    if (*pos == 'h') {
+      pos++;
+      length = LengthModifiers::HH;
+    }
+  } else if (*pos == 'l') {
+    pos++;
+    length = LengthModifiers::L;
+    if (*pos == 'l') {
+      pos++;
+      length = LengthModifiers::LL;
+    }
+  } else if (*pos == 'j') {
+    pos++;
+    length = LengthModifiers::J;
+  } else if (*pos == 'z') {
+    pos++;
+    length = LengthModifiers::Z;
+  } else if (*pos == 't') {
+    pos++;
+    length = LengthModifiers::T;
+  } else if (*pos == 'L') {
+    pos++;
+    length = LengthModifiers::LONG_DOUBLE;
+  }
+
+  switch (*pos) {
+    case 'd':
+    case 'i': {
+      switch (length) {
+        case LengthModifiers::L:
+          spec.argType = ArgTypes::LONG;
+          break;
+        case LengthModifiers::LL:
+          spec.argType = ArgTypes::LONG_LONG;
+          break;
+        case LengthModifiers::J:
+          spec.argType = ArgTypes::INTMAX;
+          break;
+        case LengthModifiers::Z:
+          spec.argType = ArgTypes::SIZE;
+          break;
+        case LengthModifiers::T:
+          spec.argType = ArgTypes::PTRDIFF;
+          break;
+        case LengthModifiers::LONG_DOUBLE:
+          spec.argType = ArgTypes::UNSUPPORTED;
+          break;
+        default:
+          spec.argType = ArgTypes::INT;
+          break;
+      }
+      break;
+    }
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X': {
+      switch (length) {
+        case LengthModifiers::L:
+          spec.argType = ArgTypes::UNSIGNED_LONG;
+          break;
+        case LengthModifiers::LL:
+          spec.argType = ArgTypes::UNSIGNED_LONG_LONG;
+          break;
+        case LengthModifiers::J:
+          spec.argType = ArgTypes::UINTMAX;
+          break;
+        case LengthModifiers::Z:
+          spec.argType = ArgTypes::SIZE;
+          break;
+        case LengthModifiers::T:
+          spec.argType = ArgTypes::PTRDIFF;
+          break;
+        case LengthModifiers::LONG_DOUBLE:
+          spec.argType = ArgTypes::UNSUPPORTED;
+          break;
+        default:
+          spec.argType = ArgTypes::UNSIGNED;
+          break;
+      }
+      break;
+    }
+    case 'c': {
+      spec.argType = (length == LengthModifiers::NONE) ? ArgTypes::INT : ArgTypes::UNSUPPORTED;
+      break;
+    }
+    case 's': {
+      spec.argType = (length == LengthModifiers::NONE) ? ArgTypes::STRING : ArgTypes::UNSUPPORTED;
+      break;
+    }
+    case 'p': {
+      spec.argType = ArgTypes::POINTER;
+      break;
+    }
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A': {
+      spec.argType =
+          (length == LengthModifiers::LONG_DOUBLE) ? ArgTypes::LONG_DOUBLE : ArgTypes::DOUBLE;
+      break;
+    }
+    default: {
+      // %n, wide characters and invalid conversions
+      spec.argType = ArgTypes::UNSUPPORTED;
+      return pos;
+    }
+  }
+  pos++;
+  spec.len = pos - spec.start;
+  return pos;
+}
+
+template <typename T>
+bool storeArg(uint8_t* argBuf, size_t maxSize, size_t& argLen, T value) {
+  if (argLen + sizeof(T) > maxSize) {
+    return false;
+  }
+  std::memcpy(argBuf + argLen, &value, sizeof(T));
+  argLen += sizeof(T);
+  return true;
+}
+
+template <typename T>
+bool loadArg(const uint8_t* args, size_t argLen, size_t& argPos, T& value) {
+  if (argPos + sizeof(T) > argLen) {
+    return false;
+  }
+  std::memcpy(&value, args + argPos, sizeof(T));
+  argPos += sizeof(T);
+  return true;
+}
+
+int formatSpec(char* out, size_t outSize, const char* spec, ...) {
+  va_list args;
+  va_start(args, spec);
+  int written = vsnprintf(out, outSize, spec, args);
+  va_end(args);
+  return written;
+}
+
+template <typename T>
+int formatArg(char* out, size_t outSize, const char* spec, const int* stars, uint8_t starCount,
+              T value) {
+  switch (starCount) {
+    case 0:
+      return formatSpec(out, outSize, spec, value);
+    case 1:
+      return formatSpec(out, outSize, spec, stars[0], value);
+    default:
+      return formatSpec(out, outSize, spec, stars[0], stars[1], value);
+  }
+}
+
+template <typename T>
+int loadAndFormatArg(char* out, size_t outSize, const char* spec, const int* stars,
+                     uint8_t starCount, const uint8_t* args, size_t argLen, size_t& argPos) {
+  T value;
+  if (not loadArg(args, argLen, argPos, value)) {
+    return -1;
+  }
+  return formatArg(out, outSize, spec, stars, starCount, value);
+}
+
+}  // namespace
+
+std::atomic<ServiceInterfaceAsyncBackend*> ServiceInterfaceAsyncBackend::activeBackend{nullptr};
+std::atomic<uint32_t> ServiceInterfaceAsyncBackend::activeProducers{0};
+std::atomic<uint32_t> ServiceInterfaceAsyncBackend::generationCounter{0};
+
+ServiceInterfaceAsyncBackend::ServiceInterfaceAsyncBackend(size_t ringSize, size_t maxThreads)
+    : generation(++generationCounter), ringSize(alignRecordSize(ringSize)), rings(maxThreads) {
+  for (auto& ring : rings) {
+    ring.buffer.resize(this->ringSize);
+  }
+  activeBackend = this;
+}
+
+ServiceInterfaceAsyncBackend::~ServiceInterfaceAsyncBackend() {
+  activeBackend = nullptr;
+  // A producer which loaded the back-end before it was reset might still store a record.
+  // Producers increment the counter before loading the back-end, so new producers see nullptr.
+  while (activeProducers != 0) {
+    TaskFactory::delayTask(1);
+  }
+  drain();
+}
+
+ServiceInterfaceAsyncBackend* ServiceInterfaceAsyncBackend::instance() { return activeBackend; }
+
+ReturnValue_t ServiceInterfaceAsyncBackend::performOperation(uint8_t opCode) {
+  drain();
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+size_t ServiceInterfaceAsyncBackend::drain() {
+  size_t printedRecords = 0;
+  size_t usedRings = assignedRings;
+  if (usedRings > rings.size()) {
+    usedRings = rings.size();
+  }
+  for (size_t idx = 0; idx < usedRings; idx++) {
+    printedRecords += drainRing(rings[idx]);
+  }
+  return printedRecords;
+}
+
+bool ServiceInterfaceAsyncBackend::logFormatted(sif::PrintLevel level, const char* fmt,
+                                                va_list args) {
+  activeProducers++;
+  ServiceInterfaceAsyncBackend* backend = activeBackend;
+  bool stored = (backend != nullptr) and backend->storeFormatted(level, fmt, args);
+  activeProducers--;
+  return stored;
+}
+
+bool ServiceInterfaceAsyncBackend::logText(const char* preamble, size_t preambleLen,
+                                           const char* text, size_t textLen, bool errStream) {
+  activeProducers++;
+  ServiceInterfaceAsyncBackend* backend = activeBackend;
+  bool stored =
+      (backend != nullptr) and backend->storeText(preamble, preambleLen, text, textLen, errStream);
+  activeProducers--;
+  return stored;
+}
+
+bool ServiceInterfaceAsyncBackend::storeFormatted(sif::PrintLevel level, const char* fmt,
+                                                  va_list args) {
+  ThreadRing* ring = getThreadRing();
+  if (ring == nullptr) {
+    return false;
+  }
+  uint8_t argBuf[MAX_ARGS_SIZE];
+  size_t argLen = 0;
+  va_list argsCopy;
+  va_copy(argsCopy, args);
+  bool captured = captureArgs(fmt, argsCopy, argBuf, sizeof(argBuf), &argLen);
+  va_end(argsCopy);
+  if (not captured) {
+    return false;
+  }
+
+  RecordHeader* header = reserve(*ring, argLen);
+  if (header == nullptr) {
+    ring->droppedRecords++;
+    return true;
+  }
+  header->type = RecordTypes::FORMATTED;
+  header->level = level;
+  header->errStream = false;
+  header->fmt = fmt;
+  std::memcpy(reinterpret_cast<uint8_t*>(header) + sizeof(RecordHeader), argBuf, argLen);
+  commit(*ring, header);
+  return true;
+}
+
+bool ServiceInterfaceAsyncBackend::storeText(const char* preamble, size_t preambleLen,
+                                             const char* text, size_t textLen, bool errStream) {
+  ThreadRing* ring = getThreadRing();
+  if (ring == nullptr) {
+    return false;
+  }
+  RecordHeader* header = reserve(*ring, preambleLen + textLen);
+  if (header == nullptr) {
+    ring->droppedRecords++;
+    return true;
+  }
+  header->type = RecordTypes::TEXT;
+  header->level = sif::PrintLevel::NONE;
+  header->errStream = errStream;
+  header->fmt = nullptr;
+  uint8_t* payload = reinterpret_cast<uint8_t*>(header) + sizeof(RecordHeader);
+  std::memcpy(payload, preamble, preambleLen);
+  std::memcpy(payload + preambleLen, text, textLen);
+  commit(*ring, header);
+  return true;
+}
+
+uint32_t ServiceInterfaceAsyncBackend::getDroppedRecords() const {
+  uint32_t droppedRecords = 0;
+  for (const auto& ring : rings) {
+    droppedRecords += ring.droppedRecords;
+  }
+  return droppedRecords;
+}
+
+bool ServiceInterfaceAsyncBackend::formatDeferred(char* out, size_t outSize, const char* fmt,
+                                                  va_list args) {
+  uint8_t argBuf[MAX_ARGS_SIZE];
+  size_t argLen = 0;
+  va_list argsCopy;
+  va_copy(argsCopy, args);
+  bool captured = captureArgs(fmt, argsCopy, argBuf, sizeof(argBuf), &argLen);
+  va_end(argsCopy);
+  if (not captured or outSize == 0) {
+    return false;
+  }
+  formatArgs(fmt, argBuf, argLen, out, outSize);
+  return true;
+}
+
+ServiceInterfaceAsyncBackend::ThreadRing* ServiceInterfaceAsyncBackend::getThreadRing() {
+  // The generation detects a ring buffer assigned by a previous back-end instance
+  static thread_local uint32_t threadGeneration = 0;
+  static thread_local ThreadRing* threadRing = nullptr;
+  if (threadGeneration != generation) {
+    threadGeneration = generation;
+    size_t ringIdx = assignedRings++;
+    threadRing = (ringIdx < rings.size()) ? &rings[ringIdx] : nullptr;
+  }
+  return threadRing;
+}
+
+ServiceInterfaceAsyncBackend::RecordHeader* ServiceInterfaceAsyncBackend::reserve(
+    ThreadRing& ring, size_t payloadLen) {
+  size_t recordSize = alignRecordSize(sizeof(RecordHeader) + payloadLen);
+  if (payloadLen > UINT16_MAX or recordSize > ringSize / 2) {
+    return nullptr;
+  }
+  size_t writeCount = ring.writeCount.load(std::memory_order_relaxed);
+  size_t freeSpace = ringSize - (writeCount - ring.readCount.load(std::memory_order_acquire));
+  size_t writeIdx = writeCount % ringSize;
+  // Records are contiguous. If the record does not fit at the end, the end is skipped
+  size_t padding = 0;
+  if (ringSize - writeIdx < recordSize) {
+    padding = ringSize - writeIdx;
+  }
+  if (freeSpace < padding + recordSize) {
+    return nullptr;
+  }
+  if (padding > 0) {
+    // Record size fields are 8 byte aligned, so there is enough space for the fields
+    RecordHeader* paddingRecord = reinterpret_cast<RecordHeader*>(ring.buffer.data() + writeIdx);
+    paddingRecord->size = padding;
+    paddingRecord->type = RecordTypes::PADDING;
+    writeIdx = 0;
+  }
+  ring.pendingPadding = padding;
+  RecordHeader* header = reinterpret_cast<RecordHeader*>(ring.buffer.data() + writeIdx);
+  header->size = recordSize;
+  header->payloadLen = payloadLen;
+  timeval now;
+  Clock::getClock_timeval(&now);
+  header->seconds = now.tv_sec;
+  header->microseconds = now.tv_usec;
+  return header;
+}
+
+void ServiceInterfaceAsyncBackend::commit(ThreadRing& ring, RecordHeader* header) {
+  size_t writeCount = ring.writeCount.load(std::memory_order_relaxed);
+  ring.writeCount.store(writeCount + ring.pendingPadding + header->size,
+                        std::memory_order_release);
+}
+
+size_t ServiceInterfaceAsyncBackend::drainRing(ThreadRing& ring) {
+  size_t printedRecords = 0;
+  size_t readCount = ring.readCount.load(std::memory_order_relaxed);
+  size_t writeCount = ring.writeCount.load(std::memory_order_acquire);
+  while (readCount != writeCount) {
+    const RecordHeader* header =
+        reinterpret_cast<const RecordHeader*>(ring.buffer.data() + readCount % ringSize);
+    if (header->type != RecordTypes::PADDING) {
+      printRecord(*header, reinterpret_cast<const uint8_t*>(header) + sizeof(RecordHeader));
+      printedRecords++;
+    }
+    readCount += header->size;
+    ring.readCount.store(readCount, std::memory_order_release);
+  }
+
+  uint32_t droppedRecords = ring.droppedRecords;
+  if (droppedRecords != ring.reportedDrops) {
+#if FSFW_DISABLE_PRINTOUT == 0
+    Clock::TimeOfDay_t now;
+    Clock::getDateAndTime(&now);
+    size_t len = fsfwPrintPreamble(printBuffer, sif::PrintLevel::WARNING_LEVEL, now);
+    len += snprintf(printBuffer + len, sizeof(printBuffer) - len,
+                    "ServiceInterfaceAsyncBackend: %lu log records dropped\n",
+                    static_cast<unsigned long>(droppedRecords - ring.reportedDrops));
+    fsfwPrintBuffer(printBuffer, len, sizeof(printBuffer));
+#endif
+    ring.reportedDrops = droppedRecords;
+  }
+  return printedRecords;
+}
+
+void ServiceInterfaceAsyncBackend::printRecord(const RecordHeader& header,
+                                               const uint8_t* payload) {
+  if (header.type == RecordTypes::TEXT) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    const char* text = reinterpret_cast<const char*>(payload);
+    for (size_t idx = 0; idx < header.payloadLen; idx++) {
+      printChar(text + idx, header.errStream);
+    }
+#endif
+    return;
+  }
+#if FSFW_DISABLE_PRINTOUT == 0
+  timeval time;
+  time.tv_sec = header.seconds;
+  time.tv_usec = header.microseconds;
+  Clock::TimeOfDay_t timeOfDay;
+  Clock::convertTimevalToTimeOfDay(&time, &timeOfDay);
+  size_t len =
+      fsfwPrintPreamble(printBuffer, static_cast<sif::PrintLevel>(header.level), timeOfDay);
+  len += formatArgs(header.fmt, payload, header.payloadLen, printBuffer + len,
+                    sizeof(printBuffer) - len);
+  fsfwPrintBuffer(printBuffer, len, sizeof(printBuffer));
+#endif
+}
+
+bool ServiceInterfaceAsyncBackend::captureArgs(const char* fmt, va_list args, uint8_t* argBuf,
+                                               size_t maxSize, size_t* argLen) {
+  ConversionSpec spec;
+  size_t len = 0;
+  bool stored = true;
+  const char* pos = std::strchr(fmt, '%');
+  while (pos != nullptr and stored) {
+    pos = parseSpec(pos, spec);
+    if (spec.len >= SPEC_BUFFER_SIZE) {
+      stored = false;
+      break;
+    }
+    for (uint8_t idx = 0; idx < spec.starCount and stored; idx++) {
+      stored = storeArg(argBuf, maxSize, len, va_arg(args, int));
+    }
+    switch (spec.argType) {
+      case ArgTypes::NONE:
+        break;
+      case ArgTypes::INT:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, int));
+        break;
+      case ArgTypes::LONG:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, long));
+        break;
+      case ArgTypes::LONG_LONG:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, long long));
+        break;
+      case ArgTypes::INTMAX:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, intmax_t));
+        break;
+      case ArgTypes::SIZE:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, size_t));
+        break;
+      case ArgTypes::PTRDIFF:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, ptrdiff_t));
+        break;
+      case ArgTypes::UNSIGNED:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, unsigned int));
+        break;
+      case ArgTypes::UNSIGNED_LONG:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, unsigned long));
+        break;
+      case ArgTypes::UNSIGNED_LONG_LONG:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, unsigned long long));
+        break;
+      case ArgTypes::UINTMAX:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, uintmax_t));
+        break;
+      case ArgTypes::DOUBLE:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, double));
+        break;
+      case ArgTypes::LONG_DOUBLE:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, long double));
+        break;
+      case ArgTypes::POINTER:
+        stored = storeArg(argBuf, maxSize, len, va_arg(args, void*));
+        break;
+      case ArgTypes::STRING: {
+        const char* str = va_arg(args, const char*);
+        if (str == nullptr) {
+          str = "(null)";
+        }
+        // Strings which do not fit completely are formatted by the caller
+        size_t strLen = strnlen(str, maxSize);
+        stored = storeArg(argBuf, maxSize, len, static_cast<uint16_t>(strLen));
+        if (stored and len + strLen <= maxSize) {
+          std::memcpy(argBuf + len, str, strLen);
+          len += strLen;
+        } else {
+          stored = false;
+        }
+        break;
+      }
+      case ArgTypes::UNSUPPORTED:
+        stored = false;
+        break;
+    }
+    if (stored) {
+      pos = std::strchr(pos, '%');
+    }
+  }
+  *argLen = len;
+  return stored;
+}
+
+size_t ServiceInterfaceAsyncBackend::formatArgs(const char* fmt, const uint8_t* args,
+                                                size_t argLen, char* out, size_t outSize) {
+  char specBuf[SPEC_BUFFER_SIZE];
+  int stars[2] = {};
+  size_t argPos = 0;
+  size_t len = 0;
+  ConversionSpec spec;
+  const char* pos = fmt;
+  while (*pos != '\0' and len + 1 < outSize) {
+    const char* specStart = std::strchr(pos, '%');
+    size_t literalLen = (specStart == nullptr) ? std::strlen(pos) : specStart - pos;
+    if (literalLen > outSize - len - 1) {
+      literalLen = outSize - len - 1;
+    }
+    std::memcpy(out + len, pos, literalLen);
+    len += literalLen;
+    if (specStart == nullptr or len + 1 >= outSize) {
+      break;
+    }
+    pos = parseSpec(specStart, spec);
+    if (spec.argType == ArgTypes::NONE) {
+      out[len++] = '%';
+      continue;
+    }
+    if (spec.len >= sizeof(specBuf)) {
+      break;
+    }
+    std::memcpy(specBuf, spec.start, spec.len);
+    specBuf[spec.len] = '\0';
+    for (uint8_t idx = 0; idx < spec.starCount; idx++) {
+      loadArg(args, argLen, argPos, stars[idx]);
+    }
+
+    char* argOut = out + len;
+    size_t argOutSize = outSize - len;
+    int written = -1;
+    switch (spec.argType) {
+      case ArgTypes::INT:
+        written = loadAndFormatArg<int>(argOut, argOutSize, specBuf, stars, spec.starCount, args,
+                                        argLen, argPos);
+        break;
+      case ArgTypes::LONG:
+        written = loadAndFormatArg<long>(argOut, argOutSize, specBuf, stars, spec.starCount, args,
+                                         argLen, argPos);
+        break;
+      case ArgTypes::LONG_LONG:
+        written = loadAndFormatArg<long long>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                              args, argLen, argPos);
+        break;
+      case ArgTypes::INTMAX:
+        written = loadAndFormatArg<intmax_t>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                             args, argLen, argPos);
+        break;
+      case ArgTypes::SIZE:
+        written = loadAndFormatArg<size_t>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                           args, argLen, argPos);
+        break;
+      case ArgTypes::PTRDIFF:
+        written = loadAndFormatArg<ptrdiff_t>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                              args, argLen, argPos);
+        break;
+      case ArgTypes::UNSIGNED:
+        written = loadAndFormatArg<unsigned int>(argOut, argOutSize, specBuf, stars,
+                                                 spec.starCount, args, argLen, argPos);
+        break;
+      case ArgTypes::UNSIGNED_LONG:
+        written = loadAndFormatArg<unsigned long>(argOut, argOutSize, specBuf, stars,
+                                                  spec.starCount, args, argLen, argPos);
+        break;
+      case ArgTypes::UNSIGNED_LONG_LONG:
+        written = loadAndFormatArg<unsigned long long>(argOut, argOutSize, specBuf, stars,
+                                                       spec.starCount, args, argLen, argPos);
+        break;
+      case ArgTypes::UINTMAX:
+        written = loadAndFormatArg<uintmax_t>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                              args, argLen, argPos);
+        break;
+      case ArgTypes::DOUBLE:
+        written = loadAndFormatArg<double>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                           args, argLen, argPos);
+        break;
+      case ArgTypes::LONG_DOUBLE:
+        written = loadAndFormatArg<long double>(argOut, argOutSize, specBuf, stars,
+                                                spec.starCount, args, argLen, argPos);
+        break;
+      case ArgTypes::POINTER:
+        written = loadAndFormatArg<void*>(argOut, argOutSize, specBuf, stars, spec.starCount,
+                                          args, argLen, argPos);
+        break;
+      case ArgTypes::STRING: {
+        uint16_t strLen = 0;
+        char str[MAX_ARGS_SIZE + 1];
+        if (loadArg(args, argLen, argPos, strLen) and argPos + strLen <= argLen) {
+          std::memcpy(str, args + argPos, strLen);
+          str[strLen] = '\0';
+          argPos += strLen;
+          written = formatArg(argOut, argOutSize, specBuf, stars, spec.starCount,
+                              static_cast<const char*>(str));
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    if (written < 0) {
+      break;
+    }
+    // snprintf returns the untruncated length
+    len += (static_cast<size_t>(written) < argOutSize) ? written : argOutSize - 1;
+  }
+  out[len] = '\0';
+  return len;
+}
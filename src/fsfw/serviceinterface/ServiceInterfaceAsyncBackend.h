@@ -0,0 +1,146 @@
+#ifndef FSFW_SERVICEINTERFACE_SERVICEINTERFACEASYNCBACKEND_H_
+#define FSFW_SERVICEINTERFACE_SERVICEINTERFACEASYNCBACKEND_H_
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ServiceInterfacePrinter.h"
+#include "fsfw/tasks/ExecutableObjectIF.h"
+
+/**
+ * @brief   Asynchronous back-end for the printf style sif functions and the sif streams
+ * @details
+ * Once an instance of this class exists, log output is not written to the terminal by the
+ * calling task anymore. Instead, every thread writes its log records into its own lock-free
+ * single producer, single consumer ring buffer, which is assigned on the first log call of the
+ * thread. The records are printed by #performOperation, so this object should be added to a
+ * low priority periodic task.
+ *
+ * For the printf style functions, formatting is deferred: only the format string pointer, the
+ * timestamp and the binary arguments are stored. String arguments are copied completely, so the
+ * format string itself needs to have static storage duration, which is the case for string
+ * literals. Format strings with conversions which can not be captured, or with arguments which
+ * need more than MAX_ARGS_SIZE bytes, are formatted by the caller. The output is therefore the
+ * same as the synchronous output. Stream output is stored as text when the stream is flushed.
+ *
+ * If the ring buffer of a thread is full, the record is dropped and counted. If all ring
+ * buffers are assigned, additional threads fall back to synchronous printing.
+ * Only one instance of this class may exist at a time. The destructor waits until no thread is
+ * storing a record anymore, so the instance can be destroyed while other threads are logging.
+ */
+class ServiceInterfaceAsyncBackend : public ExecutableObjectIF {
+ public:
+  static constexpr size_t DEFAULT_RING_SIZE = 4096;
+  static constexpr size_t DEFAULT_MAX_THREADS = 16;
+  //! Maximum size of the binary arguments of a single record, including copied strings
+  static constexpr size_t MAX_ARGS_SIZE = 256;
+
+  /**
+   * Allocates all ring buffers and routes the log output through this back-end.
+   * @param ringSize    Size of the ring buffer of every thread in bytes
+   * @param maxThreads  Maximum number of threads with an own ring buffer
+   */
+  ServiceInterfaceAsyncBackend(size_t ringSize = DEFAULT_RING_SIZE,
+                               size_t maxThreads = DEFAULT_MAX_THREADS);
+  /**
+   * Prints all remaining records and restores synchronous printing.
+   */
+  ~ServiceInterfaceAsyncBackend() override;
+
+  /**
+   * @return Active back-end or nullptr if log output is printed synchronously. Only for
+   * checking whether a back-end is active, records are stored with #logFormatted and #logText.
+   */
+  static ServiceInterfaceAsyncBackend* instance();
+
+  /**
+   * Prints all pending records of all threads.
+   */
+  ReturnValue_t performOperation(uint8_t opCode) override;
+  /**
+   * Prints all pending records of all threads.
+   * @return Number of printed records
+   */
+  size_t drain();
+
+  /**
+   * Stores a printf style record in the active back-end. Used by the sif print functions.
+   * @return false if no back-end is active or if the record could not be stored by the back-end
+   *         and needs to be printed synchronously.
+   */
+  static bool logFormatted(sif::PrintLevel level, const char* fmt, va_list args);
+  /**
+   * Stores an already formatted text in the active back-end. Used by the sif streams.
+   * @return false if no back-end is active or if the text could not be stored by the back-end
+   *         and needs to be printed synchronously.
+   */
+  static bool logText(const char* preamble, size_t preambleLen, const char* text, size_t textLen,
+                      bool errStream);
+
+  //! Number of records which were dropped because a ring buffer was full
+  uint32_t getDroppedRecords() const;
+
+  /**
+   * Formats the arguments like vsnprintf, but by capturing and formatting them like the
+   * deferred records. Can be used to check that a format string is printed correctly.
+   * @return false if the arguments can not be captured, so the record would be formatted by
+   *         the caller.
+   */
+  static bool formatDeferred(char* out, size_t outSize, const char* fmt, va_list args);
+
+ private:
+  enum class RecordTypes : uint8_t { PADDING, FORMATTED, TEXT };
+
+  //! The size and type fields come first because padding records only contain these fields
+  struct RecordHeader {
+    uint32_t size;
+    RecordTypes type;
+    uint8_t level;
+    bool errStream;
+    uint16_t payloadLen;
+    uint32_t seconds;
+    uint32_t microseconds;
+    const char* fmt;
+  };
+
+  struct ThreadRing {
+    std::vector<uint8_t> buffer;
+    std::atomic<size_t> writeCount{0};
+    std::atomic<size_t> readCount{0};
+    std::atomic<uint32_t> droppedRecords{0};
+    //! Only used by the producer
+    size_t pendingPadding = 0;
+    //! Only used by the consumer
+    uint32_t reportedDrops = 0;
+  };
+
+  static std::atomic<ServiceInterfaceAsyncBackend*> activeBackend;
+  //! Number of threads which may use the active back-end. The destructor waits for zero.
+  static std::atomic<uint32_t> activeProducers;
+  static std::atomic<uint32_t> generationCounter;
+
+  uint32_t generation;
+  size_t ringSize;
+  std::vector<ThreadRing> rings;
+  std::atomic<size_t> assignedRings{0};
+  char printBuffer[fsfwconfig::FSFW_PRINT_BUFFER_SIZE];
+
+  bool storeFormatted(sif::PrintLevel level, const char* fmt, va_list args);
+  bool storeText(const char* preamble, size_t preambleLen, const char* text, size_t textLen,
+                 bool errStream);
+  ThreadRing* getThreadRing();
+  RecordHeader* reserve(ThreadRing& ring, size_t payloadLen);
+  void commit(ThreadRing& ring, RecordHeader* header);
+  size_t drainRing(ThreadRing& ring);
+  void printRecord(const RecordHeader& header, const uint8_t* payload);
+
+  static bool captureArgs(const char* fmt, va_list args, uint8_t* argBuf, size_t maxSize,
+                          size_t* argLen);
+  static size_t formatArgs(const char* fmt, const uint8_t* args, size_t argLen, char* out,
+                           size_t outSize);
+};
+
+#endif /* FSFW_SERVICEINTERFACE_SERVICEINTERFACEASYNCBACKEND_H_ */
@@ -6,6 +6,7 @@
 
 #include <cstring>
 
+#include "fsfw/serviceinterface/ServiceInterfaceAsyncBackend.h"
 #include "fsfw/serviceinterface/serviceInterfaceDefintions.h"
 #include "fsfw/timemanager/Clock.h"
 
@@ -113,6 +114,11 @@ int ServiceInterfaceBuffer::sync(void) {
 
   size_t preambleSize = 0;
   std::string* preamble = getPreamble(&preambleSize);
+  if (ServiceInterfaceAsyncBackend::logText(preamble->data(), preambleSize, pbase(),
+                                            pptr() - pbase(), errStream)) {
+    setp(buf, buf + BUF_SIZE - 1);
+    return 0;
+  }
   // Write logMessage and time
   this->putChars(preamble->data(), preamble->data() + preambleSize);
   // Handle output
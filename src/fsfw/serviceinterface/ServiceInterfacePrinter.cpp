@@ -4,6 +4,7 @@
 #include <cstdint>
 
 #include "fsfw/FSFW.h"
+#include "fsfw/serviceinterface/ServiceInterfaceAsyncBackend.h"
 #include "fsfw/serviceinterface/serviceInterfaceDefintions.h"
 #include "fsfw/timemanager/Clock.h"
 
@@ -18,27 +19,9 @@ static bool addCrAtEnd = false;
 
 uint8_t printBuffer[fsfwconfig::FSFW_PRINT_BUFFER_SIZE];
 
-void fsfwPrint(sif::PrintLevel printType, const char *fmt, va_list arg) {
-#if defined(WIN32) && FSFW_COLORED_OUTPUT == 1
-  if (not consoleInitialized) {
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    DWORD dwMode = 0;
-    GetConsoleMode(hOut, &dwMode);
-    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-    SetConsoleMode(hOut, dwMode);
-  }
-  consoleInitialized = true;
-#endif
-
+size_t fsfwPrintPreamble(char *bufferPosition, sif::PrintLevel printType,
+                         const Clock::TimeOfDay_t &now) {
   size_t len = 0;
-  char *bufferPosition = reinterpret_cast<char *>(printBuffer);
-
-  /* Check logger level */
-  if (printType == sif::PrintLevel::NONE or printType > printLevel) {
-    return;
-  }
-
-  /* Log message to terminal */
 
 #if FSFW_COLORED_OUTPUT == 1
   if (printType == sif::PrintLevel::INFO_LEVEL) {
@@ -70,22 +53,60 @@ void fsfwPrint(sif::PrintLevel printType, const char *fmt, va_list arg) {
   len += sprintf(bufferPosition + len, sif::ANSI_COLOR_RESET);
 #endif
 
-  Clock::TimeOfDay_t now;
-  Clock::getDateAndTime(&now);
   /*
    * Log current time to terminal if desired.
    */
   len += sprintf(bufferPosition + len, " | %lu:%02lu:%02lu.%03lu | ", (unsigned long)now.hour,
                  (unsigned long)now.minute, (unsigned long)now.second,
                  (unsigned long)now.usecond / 1000);
+  return len;
+}
 
-  len += vsnprintf(bufferPosition + len, sizeof(printBuffer) - len, fmt, arg);
-
+void fsfwPrintBuffer(char *bufferPosition, size_t len, size_t bufferSize) {
   if (addCrAtEnd) {
+    /* Leave space for the carriage return if the text was truncated */
+    if (len > bufferSize - 2) {
+      len = bufferSize - 2;
+    }
     len += sprintf(bufferPosition + len, "\r");
   }
 
-  printf("%s", printBuffer);
+  printf("%s", bufferPosition);
+}
+
+void fsfwPrint(sif::PrintLevel printType, const char *fmt, va_list arg) {
+#if defined(WIN32) && FSFW_COLORED_OUTPUT == 1
+  if (not consoleInitialized) {
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+  }
+  consoleInitialized = true;
+#endif
+
+  size_t len = 0;
+  char *bufferPosition = reinterpret_cast<char *>(printBuffer);
+
+  /* Check logger level */
+  if (printType == sif::PrintLevel::NONE or printType > printLevel) {
+    return;
+  }
+
+  /* Defer the printout if the asynchronous back-end is used */
+  if (ServiceInterfaceAsyncBackend::logFormatted(printType, fmt, arg)) {
+    return;
+  }
+
+  /* Log message to terminal */
+  Clock::TimeOfDay_t now;
+  Clock::getDateAndTime(&now);
+  len += fsfwPrintPreamble(bufferPosition, printType, now);
+
+  len += vsnprintf(bufferPosition + len, sizeof(printBuffer) - len, fmt, arg);
+
+  fsfwPrintBuffer(bufferPosition, len, sizeof(printBuffer));
 }
 
 void sif::printInfo(const char *fmt, ...) {
@@ -0,0 +1,7 @@
+#include "fsfw/serviceinterface/TraceChannel.h"
+
+std::atomic<trace::TraceSinkIF*> trace::detail::activeSink{nullptr};
+
+void trace::setSink(TraceSinkIF* sink) { detail::activeSink.store(sink, std::memory_order_release); }
+
+trace::TraceSinkIF* trace::getSink() { return detail::activeSink.load(std::memory_order_acquire); }
@@ -0,0 +1,67 @@
+#ifndef FSFW_SERVICEINTERFACE_TRACECHANNEL_H_
+#define FSFW_SERVICEINTERFACE_TRACECHANNEL_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "fsfw/objectmanager/SystemObjectIF.h"
+
+/**
+ * @brief   Binary trace channel for high frequency diagnostics
+ * @details
+ * Trace points store a small fixed-size binary record instead of formatting text, so they can
+ * stay enabled on the hot path. The records are passed to the active TraceSinkIF, for example
+ * the TraceRingFile, and are decoded offline with the scripts/trace-decoder.py script.
+ * If no sink is set, a trace point only costs a single atomic load.
+ */
+namespace trace {
+
+enum class RecordTypes : uint8_t {
+  //! ID: Event, parameters: event parameters
+  EVENT = 0,
+  //! ID: Device command ID, parameter 1: command length
+  DEVICE_COMMAND = 1,
+  //! ID: Device command ID of the pending command, parameter 1: reply length
+  DEVICE_REPLY = 2,
+  //! ID: Store index of the packet, parameter 1: packet length
+  TC_RECEIVED = 3,
+  //! ID: Store index of the packet, parameter 1: packet length
+  TM_SENT = 4,
+  //! Types starting from this value can be used by the mission
+  USER = 0x80
+};
+
+class TraceSinkIF {
+ public:
+  virtual ~TraceSinkIF() {}
+
+  /**
+   * Stores a single trace record. Can be called by multiple threads concurrently and must not
+   * block.
+   */
+  virtual void write(RecordTypes type, uint32_t id, object_id_t objectId, uint32_t parameter1,
+                     uint32_t parameter2) = 0;
+};
+
+namespace detail {
+extern std::atomic<TraceSinkIF*> activeSink;
+}
+
+/**
+ * Set the sink all trace records are written to. Pass nullptr to disable tracing.
+ * The sink needs to outlive all trace calls after it was unset.
+ */
+void setSink(TraceSinkIF* sink);
+TraceSinkIF* getSink();
+
+inline void record(RecordTypes type, uint32_t id, object_id_t objectId, uint32_t parameter1 = 0,
+                   uint32_t parameter2 = 0) {
+  TraceSinkIF* sink = detail::activeSink.load(std::memory_order_acquire);
+  if (sink != nullptr) {
+    sink->write(type, id, objectId, parameter1, parameter2);
+  }
+}
+
+}  // namespace trace
+
+#endif /* FSFW_SERVICEINTERFACE_TRACECHANNEL_H_ */
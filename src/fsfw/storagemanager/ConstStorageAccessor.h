@@ -23,6 +23,7 @@ class ConstStorageAccessor {
   //! StorageManager classes have exclusive access to private variables.
   friend class PoolManager;
   friend class LocalPool;
+  friend class SharedMemoryPool;
 
  public:
   /**
@@ -120,7 +120,7 @@ ReturnValue_t LocalPool::deleteData(store_address_t storeId) {
   ReturnValue_t status = RETURN_OK;
   size_type pageSize = getSubpoolElementSize(storeId.poolIndex);
   if ((pageSize != 0) and (storeId.packetIndex < numberOfElements[storeId.poolIndex])) {
-    uint16_t packetPosition = getRawPosition(storeId);
+    size_type packetPosition = getRawPosition(storeId);
     uint8_t* ptr = &store[storeId.poolIndex][packetPosition];
     std::memset(ptr, 0, pageSize);
     // Set free list
@@ -228,7 +228,7 @@ ReturnValue_t LocalPool::reserveSpace(const size_t size, store_address_t* storeI
     sizeLists[storeId->poolIndex][storeId->packetIndex] = size;
   } else {
     if ((not ignoreFault) and (internalErrorReporter != nullptr)) {
-      internalErrorReporter->storeFull();
+      internalErrorReporter->storeFullWithId(getObjectId());
     }
   }
   return status;
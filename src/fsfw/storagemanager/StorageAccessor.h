@@ -12,6 +12,7 @@ class StorageAccessor : public ConstStorageAccessor {
   //! StorageManager classes have exclusive access to private variables.
   friend class PoolManager;
   friend class LocalPool;
+  friend class SharedMemoryPool;
 
  public:
   StorageAccessor(store_address_t storeId);
@@ -1,5 +1,7 @@
 #include "fsfw/subsystem/SubsystemBase.h"
 
+#include "fsfw/ipc/MutexFactory.h"
+#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/ipc/QueueFactory.h"
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
@@ -12,9 +14,14 @@ SubsystemBase::SubsystemBase(object_id_t setObjectId, object_id_t parent, Mode_t
                                                                 CommandMessage::MAX_MESSAGE_SIZE)),
       healthHelper(this, setObjectId),
       modeHelper(this),
-      parentId(parent) {}
+      parentId(parent) {
+  childrenMapMutex = MutexFactory::instance()->createMutex();
+}
 
-SubsystemBase::~SubsystemBase() { QueueFactory::instance()->deleteMessageQueue(commandQueue); }
+SubsystemBase::~SubsystemBase() {
+  QueueFactory::instance()->deleteMessageQueue(commandQueue);
+  MutexFactory::instance()->deleteMutex(childrenMapMutex);
+}
 
 ReturnValue_t SubsystemBase::registerChild(object_id_t objectId) {
   ChildInfo info;
@@ -38,6 +45,7 @@ ReturnValue_t SubsystemBase::registerChild(object_id_t objectId) {
   info.submode = SUBMODE_NONE;
   info.healthChanged = false;
 
+  MutexGuard mg(childrenMapMutex);
   auto resultPair = childrenMap.emplace(objectId, info);
   if (not resultPair.second) {
     return COULD_NOT_INSERT_CHILD;
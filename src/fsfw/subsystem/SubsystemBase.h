@@ -7,6 +7,7 @@
 #include "../health/HasHealthIF.h"
 #include "../health/HealthHelper.h"
 #include "../ipc/MessageQueueIF.h"
+#include "../ipc/MutexIF.h"
 #include "../modes/HasModesIF.h"
 #include "../objectmanager/SystemObject.h"
 #include "../returnvalues/HasReturnvaluesIF.h"
@@ -86,6 +87,8 @@ class SubsystemBase : public SystemObject,
 
   typedef std::map<object_id_t, ChildInfo> ChildrenMap;
   ChildrenMap childrenMap;
+  //! Children may register concurrently during a parallel object initialization
+  MutexIF *childrenMapMutex = nullptr;
 
   void checkCommandQueue();
 
@@ -1,5 +1,6 @@
 #include "fsfw/tcdistribution/CCSDSDistributor.h"
 
+#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 #include "fsfw/tmtcpacket/SpacePacketBase.h"
@@ -60,6 +61,7 @@ MessageQueueId_t CCSDSDistributor::getRequestQueue() { return tcQueue->getId();
 
 ReturnValue_t CCSDSDistributor::registerApplication(AcceptsTelecommandsIF* application) {
   ReturnValue_t returnValue = RETURN_OK;
+  MutexGuard mg(queueMapMutex);
   auto insertPair =
       this->queueMap.emplace(application->getIdentifier(), application->getRequestQueue());
   if (not insertPair.second) {
@@ -70,6 +72,7 @@ ReturnValue_t CCSDSDistributor::registerApplication(AcceptsTelecommandsIF* appli
 
 ReturnValue_t CCSDSDistributor::registerApplication(uint16_t apid, MessageQueueId_t id) {
   ReturnValue_t returnValue = RETURN_OK;
+  MutexGuard mg(queueMapMutex);
   auto insertPair = this->queueMap.emplace(apid, id);
   if (not insertPair.second) {
     returnValue = RETURN_FAILED;
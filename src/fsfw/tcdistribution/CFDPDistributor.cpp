@@ -1,5 +1,6 @@
 #include "fsfw/tcdistribution/CFDPDistributor.h"
 
+#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/tcdistribution/CCSDSDistributorIF.h"
 #include "fsfw/tmtcpacket/cfdp/CFDPPacketStored.h"
@@ -82,6 +83,7 @@ ReturnValue_t CFDPDistributor::registerHandler(AcceptsTelecommandsIF* handler) {
 #endif
 #endif
   MessageQueueId_t queue = handler->getRequestQueue();
+  MutexGuard mg(queueMapMutex);
   auto returnPair = queueMap.emplace(handlerId, queue);
   if (not returnPair.second) {
 #if FSFW_VERBOSE_LEVEL >= 1
@@ -1,5 +1,6 @@
 #include "fsfw/tcdistribution/PUSDistributor.h"
 
+#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 #include "fsfw/tcdistribution/CCSDSDistributorIF.h"
@@ -87,6 +88,7 @@ ReturnValue_t PUSDistributor::registerService(AcceptsTelecommandsIF* service) {
 #endif
 #endif
   MessageQueueId_t queue = service->getRequestQueue();
+  MutexGuard mg(queueMapMutex);
   auto returnPair = queueMap.emplace(serviceId, queue);
   if (not returnPair.second) {
 #if FSFW_VERBOSE_LEVEL >= 1
@@ -1,14 +1,20 @@
 #include "fsfw/tcdistribution/TcDistributor.h"
 
+#include "fsfw/ipc/MutexFactory.h"
+#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/ipc/QueueFactory.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 #include "fsfw/tmtcservices/TmTcMessage.h"
 
 TcDistributor::TcDistributor(object_id_t objectId) : SystemObject(objectId) {
   tcQueue = QueueFactory::instance()->createMessageQueue(DISTRIBUTER_MAX_PACKETS);
+  queueMapMutex = MutexFactory::instance()->createMutex();
 }
 
-TcDistributor::~TcDistributor() { QueueFactory::instance()->deleteMessageQueue(tcQueue); }
+TcDistributor::~TcDistributor() {
+  QueueFactory::instance()->deleteMessageQueue(tcQueue);
+  MutexFactory::instance()->deleteMutex(queueMapMutex);
+}
 
 ReturnValue_t TcDistributor::performOperation(uint8_t opCode) {
   ReturnValue_t status = RETURN_OK;
@@ -24,16 +30,26 @@ ReturnValue_t TcDistributor::performOperation(uint8_t opCode) {
 }
 
 ReturnValue_t TcDistributor::handlePacket() {
-  TcMqMapIter queueMapIt = this->selectDestination();
+  bool destinationFound = false;
+  MessageQueueId_t destination = MessageQueueIF::NO_QUEUE;
+  {
+    MutexGuard mg(queueMapMutex);
+    TcMqMapIter queueMapIt = this->selectDestination();
+    if (queueMapIt != this->queueMap.end()) {
+      destinationFound = true;
+      destination = queueMapIt->second;
+    }
+  }
   ReturnValue_t returnValue = RETURN_FAILED;
-  if (queueMapIt != this->queueMap.end()) {
-    returnValue = this->tcQueue->sendMessage(queueMapIt->second, &this->currentMessage);
+  if (destinationFound) {
+    returnValue = this->tcQueue->sendMessage(destination, &this->currentMessage);
   }
   return this->callbackAfterSending(returnValue);
 }
 
 void TcDistributor::print() {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
+  MutexGuard mg(queueMapMutex);
   sif::debug << "Distributor content is: " << std::endl << "ID\t| Message Queue ID" << std::endl;
   sif::debug << std::setfill('0') << std::setw(8) << std::hex;
   for (const auto& queueMapIter : queueMap) {
@@ -4,6 +4,7 @@
 #include <map>
 
 #include "fsfw/ipc/MessageQueueIF.h"
+#include "fsfw/ipc/MutexIF.h"
 #include "fsfw/objectmanager/ObjectManagerIF.h"
 #include "fsfw/objectmanager/SystemObject.h"
 #include "fsfw/returnvalues/HasReturnvaluesIF.h"
@@ -84,6 +85,12 @@ class TcDistributor : public SystemObject, public ExecutableObjectIF, public Has
    * classes.
    */
   TcMessageQueueMap queueMap;
+  /**
+   * Protects the queueMap. Receivers may register during a parallel
+   * initialization of the object manager, so the child classes have to lock
+   * it when they insert into the map.
+   */
+  MutexIF* queueMapMutex = nullptr;
   /**
    * This method shall unpack the routing information from the incoming
    * packet and select the map entry which represents the packet's target.
@@ -1,11 +1,88 @@
 #include "fsfw/timemanager/CCSDSTime.h"
 
+#include <cctype>
 #include <cinttypes>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 #include "fsfw/FSFW.h"
 
+namespace {
+
+//! Layouts of the ASCII time codes up to the seconds, 'd' stands for a decimal digit
+constexpr char ASCII_CODE_A_LAYOUT[] = "dddd-dd-ddTdd:dd:";
+constexpr char ASCII_CODE_B_LAYOUT[] = "dddd-dddTdd:dd:";
+//! Fraction digits of the seconds which can be converted without losing precision
+constexpr size_t MAX_FRACTION_DIGITS = 13;
+constexpr double POWERS_OF_TEN[MAX_FRACTION_DIGITS + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13};
+
+inline bool isDigit(uint8_t character) { return static_cast<uint8_t>(character - '0') <= 9; }
+
+template <size_t N>
+bool matchesLayout(const uint8_t* from, const char (&layout)[N]) {
+  bool mismatch = false;
+  for (size_t idx = 0; idx < N - 1; idx++) {
+    mismatch |= (layout[idx] == 'd') ? not isDigit(from[idx]) : (from[idx] != layout[idx]);
+  }
+  return not mismatch;
+}
+
+uint16_t parseDigits(const uint8_t* from, size_t digits) {
+  uint16_t value = 0;
+  for (size_t idx = 0; idx < digits; idx++) {
+    value = value * 10 + (from[idx] - '0');
+  }
+  return value;
+}
+
+/**
+ * Parses the seconds with the same result as the %f conversion of sscanf.
+ * @return false if sscanf could read more characters than the length or the value is not
+ *         guaranteed to be rounded like strtof rounds it
+ */
+bool parseSeconds(const uint8_t* from, size_t length, float* second) {
+  if (length < 2 or not isDigit(from[0]) or not isDigit(from[1])) {
+    return false;
+  }
+  uint64_t mantissa = parseDigits(from, 2);
+  size_t fractionDigits = 0;
+  size_t pos = 2;
+  if (pos < length and from[pos] == '.') {
+    pos++;
+    for (; pos < length and isDigit(from[pos]); pos++) {
+      if (fractionDigits == MAX_FRACTION_DIGITS) {
+        return false;
+      }
+      mantissa = mantissa * 10 + (from[pos] - '0');
+      fractionDigits++;
+    }
+  }
+  // sscanf would continue with more digits or an exponent
+  if (pos >= length or isDigit(from[pos]) or from[pos] == 'e' or from[pos] == 'E') {
+    return false;
+  }
+  // The mantissa and the power of ten are exact, so the quotient is correctly rounded. Rounding
+  // it to float gives the correctly rounded float, like strtof, unless the quotient is exactly
+  // halfway between two floats. In this case, only the bit below the float precision is set.
+  double value = static_cast<double>(mantissa) / POWERS_OF_TEN[fractionDigits];
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x1fffffff) == 0x10000000) {
+    return false;
+  }
+  *second = static_cast<float>(value);
+  return true;
+}
+
+void assignSeconds(Clock::TimeOfDay_t* to, float second) {
+  to->second = second;
+  to->usecond = (second - floor(second)) * 1000000;
+}
+
+}  // namespace
+
 ReturnValue_t CCSDSTime::convertToCcsds(Ccs_seconds* to, const Clock::TimeOfDay_t* from) {
   ReturnValue_t result = checkTimeOfDay(from);
   if (result != RETURN_OK) {
@@ -152,6 +229,59 @@ ReturnValue_t CCSDSTime::convertFromASCII(Clock::TimeOfDay_t* to, const uint8_t*
   if (length < 19) {
     return RETURN_FAILED;
   }
+  // sscanf expects a number after optional whitespace, so binary time codes are rejected
+  // by their P-field without scanning them
+  size_t idx = 0;
+  while (idx < length and std::isspace(from[idx])) {
+    idx++;
+  }
+  if (idx < length and not isDigit(from[idx]) and from[idx] != '+' and from[idx] != '-') {
+    return UNSUPPORTED_TIME_FORMAT;
+  }
+  ReturnValue_t result = RETURN_OK;
+  if (idx == 0 and parseASCII(to, from, length, &result)) {
+    return result;
+  }
+  return scanASCII(to, from, length);
+}
+
+bool CCSDSTime::parseASCII(Clock::TimeOfDay_t* to, const uint8_t* from, uint8_t length,
+                           ReturnValue_t* result) {
+  bool codeA = matchesLayout(from, ASCII_CODE_A_LAYOUT);
+  if (not codeA and not matchesLayout(from, ASCII_CODE_B_LAYOUT)) {
+    return false;
+  }
+  size_t secondsOffset = codeA ? sizeof(ASCII_CODE_A_LAYOUT) - 1 : sizeof(ASCII_CODE_B_LAYOUT) - 1;
+  float second = 0;
+  if (not parseSeconds(from + secondsOffset, length - secondsOffset, &second)) {
+    return false;
+  }
+  uint16_t year = parseDigits(from, 4);
+  if (codeA) {
+    to->year = year;
+    to->month = parseDigits(from + 5, 2);
+    to->day = parseDigits(from + 8, 2);
+    to->hour = parseDigits(from + 11, 2);
+    to->minute = parseDigits(from + 14, 2);
+  } else {
+    uint8_t month = 0;
+    uint8_t day = 0;
+    if (convertDaysOfYear(parseDigits(from + 5, 3), year, &month, &day) != RETURN_OK) {
+      *result = RETURN_FAILED;
+      return true;
+    }
+    to->year = year;
+    to->month = month;
+    to->day = day;
+    to->hour = parseDigits(from + 9, 2);
+    to->minute = parseDigits(from + 12, 2);
+  }
+  assignSeconds(to, second);
+  *result = RETURN_OK;
+  return true;
+}
+
+ReturnValue_t CCSDSTime::scanASCII(Clock::TimeOfDay_t* to, const uint8_t* from, uint8_t length) {
   // Newlib nano can't parse uint8, see SCNu8 documentation and https://sourceware.org/newlib/README
   // Suggestion: use uint16 all the time. This should work on all systems.
 #if FSFW_NO_C99_IO == 1
@@ -172,8 +302,7 @@ ReturnValue_t CCSDSTime::convertFromASCII(Clock::TimeOfDay_t* to, const uint8_t*
     to->day = day;
     to->hour = hour;
     to->minute = minute;
-    to->second = second;
-    to->usecond = (second - floor(second)) * 1000000;
+    assignSeconds(to, second);
     return RETURN_OK;
   }
 
@@ -195,8 +324,7 @@ ReturnValue_t CCSDSTime::convertFromASCII(Clock::TimeOfDay_t* to, const uint8_t*
     to->day = tempDay;
     to->hour = hour;
     to->minute = minute;
-    to->second = second;
-    to->usecond = (second - floor(second)) * 1000000;
+    assignSeconds(to, second);
     return RETURN_OK;
   }
   // Warning: Compiler/Linker fails ambiguously if library does not implement
@@ -218,8 +346,7 @@ ReturnValue_t CCSDSTime::convertFromASCII(Clock::TimeOfDay_t* to, const uint8_t*
     to->day = day;
     to->hour = hour;
     to->minute = minute;
-    to->second = second;
-    to->usecond = (second - floor(second)) * 1000000;
+    assignSeconds(to, second);
     return RETURN_OK;
   }
 
@@ -237,8 +364,7 @@ ReturnValue_t CCSDSTime::convertFromASCII(Clock::TimeOfDay_t* to, const uint8_t*
     to->day = tempDay;
     to->hour = hour;
     to->minute = minute;
-    to->second = second;
-    to->usecond = (second - floor(second)) * 1000000;
+    assignSeconds(to, second);
     return RETURN_OK;
   }
 #endif
@@ -289,57 +415,21 @@ ReturnValue_t CCSDSTime::checkCcs(const uint8_t* time, uint8_t length) {
 
 ReturnValue_t CCSDSTime::convertDaysOfYear(uint16_t dayofYear, uint16_t year, uint8_t* month,
                                            uint8_t* day) {
-  if (isLeapYear(year)) {
-    if (dayofYear > 366) {
-      return INVALID_DAY_OF_YEAR;
-    }
-  } else {
-    if (dayofYear > 365) {
-      return INVALID_DAY_OF_YEAR;
-    }
-  }
-  *month = 1;
-  if (dayofYear <= 31) {
-    *day = dayofYear;
-    return RETURN_OK;
-  }
-  *month += 1;
-  dayofYear -= 31;
-  if (isLeapYear(year)) {
-    if (dayofYear <= 29) {
-      *day = dayofYear;
-      return RETURN_OK;
-    }
-    *month += 1;
-    dayofYear -= 29;
-  } else {
-    if (dayofYear <= 28) {
-      *day = dayofYear;
-      return RETURN_OK;
-    }
-    *month += 1;
-    dayofYear -= 28;
-  }
-  while (*month <= 12) {
-    if (dayofYear <= 31) {
-      *day = dayofYear;
-      return RETURN_OK;
-    }
-    *month += 1;
-    dayofYear -= 31;
-
-    if (*month == 8) {
-      continue;
-    }
-
-    if (dayofYear <= 30) {
-      *day = dayofYear;
-      return RETURN_OK;
-    }
-    *month += 1;
-    dayofYear -= 30;
-  }
-  return INVALID_DAY_OF_YEAR;
+  static constexpr uint16_t DAYS_BEFORE_MONTH[2][13] = {
+      {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+      {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366}};
+  const uint16_t* daysBeforeMonth = DAYS_BEFORE_MONTH[isLeapYear(year)];
+  if (dayofYear > daysBeforeMonth[12]) {
+    return INVALID_DAY_OF_YEAR;
+  }
+  // Count the months which end before the day
+  uint8_t monthIndex = 0;
+  for (uint8_t idx = 1; idx < 12; idx++) {
+    monthIndex += dayofYear > daysBeforeMonth[idx];
+  }
+  *month = monthIndex + 1;
+  *day = dayofYear - daysBeforeMonth[monthIndex];
+  return RETURN_OK;
 }
 
 bool CCSDSTime::isLeapYear(uint32_t year) {
@@ -415,6 +505,46 @@ ReturnValue_t CCSDSTime::convertFromCcsds(timeval* to, const uint8_t* from, size
   }
 }
 
+ReturnValue_t CCSDSTime::convertFromCcsds(timeval* to, const uint8_t* const* from, size_t count,
+                                          size_t maxLength, size_t* converted) {
+  ReturnValue_t result = RETURN_OK;
+  size_t idx = 0;
+  for (; idx < count; idx++) {
+    size_t foundLength = 0;
+    result = convertFromCcsds(&to[idx], from[idx], &foundLength, maxLength);
+    if (result != RETURN_OK) {
+      break;
+    }
+  }
+  if (converted != nullptr) {
+    *converted = idx;
+  }
+  return result;
+}
+
+ReturnValue_t CCSDSTime::convertFromCcsds(uint64_t* toUsecs, const uint8_t* const* from,
+                                          size_t count, size_t maxLength, size_t* converted) {
+  ReturnValue_t result = RETURN_OK;
+  size_t idx = 0;
+  for (; idx < count; idx++) {
+    timeval time;
+    size_t foundLength = 0;
+    result = convertFromCcsds(&time, from[idx], &foundLength, maxLength);
+    if (result != RETURN_OK) {
+      break;
+    }
+    if (time.tv_sec < 0) {
+      result = TIME_DOES_NOT_FIT_FORMAT;
+      break;
+    }
+    toUsecs[idx] = static_cast<uint64_t>(time.tv_sec) * 1000000 + time.tv_usec;
+  }
+  if (converted != nullptr) {
+    *converted = idx;
+  }
+  return result;
+}
+
 ReturnValue_t CCSDSTime::convertFromCUC(timeval* to, const uint8_t* from, size_t* foundLength,
                                         size_t maxLength) {
   if (maxLength < 1) {
@@ -487,6 +617,8 @@ ReturnValue_t CCSDSTime::checkTimeOfDay(const Clock::TimeOfDay_t* time) {
 
 ReturnValue_t CCSDSTime::convertFromCDS(timeval* to, const uint8_t* from, size_t* foundLength,
                                         size_t maxLength) {
+  // Length of the submillisecond field, the reserved value 0b11 is treated like no field
+  static constexpr uint8_t SUBMILLISECONDS_LENGTH[4] = {0, 2, 4, 0};
   uint8_t pField = *from;
   from++;
   // Check epoch
@@ -494,16 +626,10 @@ ReturnValue_t CCSDSTime::convertFromCDS(timeval* to, const uint8_t* from, size_t
     return NOT_ENOUGH_INFORMATION_FOR_TARGET_FORMAT;
   }
   // Check length
-  uint8_t expectedLength = 7;  // Including p-Field.
-  bool extendedDays = pField & 0b100;
-  if (extendedDays) {
-    expectedLength += 1;
-  }
-  if ((pField & 0b11) == 0b01) {
-    expectedLength += 2;
-  } else if ((pField & 0b11) == 0b10) {
-    expectedLength += 4;
-  }
+  uint8_t extendedDays = (pField >> 2) & 0b1;
+  uint8_t submillisecondsLength = SUBMILLISECONDS_LENGTH[pField & 0b11];
+  // Including p-Field.
+  uint8_t expectedLength = 7 + extendedDays + submillisecondsLength;
   if (foundLength != NULL) {
     *foundLength = expectedLength;
   }
@@ -511,14 +637,11 @@ ReturnValue_t CCSDSTime::convertFromCDS(timeval* to, const uint8_t* from, size_t
     return LENGTH_MISMATCH;
   }
   // Check and count days
-  uint32_t days = 0;
+  uint32_t days = (from[0] << 8) + from[1];
   if (extendedDays) {
-    days = (from[0] << 16) + (from[1] << 8) + from[2];
-    from += 3;
-  } else {
-    days = (from[0] << 8) + from[1];
-    from += 2;
+    days = (days << 8) + from[2];
   }
+  from += 2 + extendedDays;
   // Move to POSIX epoch.
   if (days <= DAYS_CCSDS_TO_UNIX_EPOCH) {
     return INVALID_TIME_FORMAT;
@@ -529,16 +652,14 @@ ReturnValue_t CCSDSTime::convertFromCDS(timeval* to, const uint8_t* from, size_t
   from += 4;
   to->tv_sec += (msDay / 1000);
   to->tv_usec = (msDay % 1000) * 1000;
-  if ((pField & 0b11) == 0b01) {
-    uint16_t usecs = (from[0] << 16) + from[1];
-    from += 2;
+  if (submillisecondsLength == 2) {
+    uint16_t usecs = (from[0] << 8) + from[1];
     if (usecs > 999) {
       return INVALID_TIME_FORMAT;
     }
     to->tv_usec += usecs;
-  } else if ((pField & 0b11) == 0b10) {
+  } else if (submillisecondsLength == 4) {
     uint32_t picosecs = (from[0] << 24) + (from[1] << 16) + (from[2] << 8) + from[3];
-    from += 4;
     if (picosecs > 999999) {
       return INVALID_TIME_FORMAT;
     }
@@ -161,6 +161,31 @@ class CCSDSTime : public HasReturnvaluesIF {
    */
   static ReturnValue_t convertFromCcsds(timeval *to, uint8_t const *from, size_t *foundLength,
                                         size_t maxLength);
+
+  /**
+   * Converts several time codes in any format supported by #convertFromCcsds, for example the
+   * time tags of archived packets. The conversion stops at the first time code which can not
+   * be converted.
+   *
+   * @param to Array with space for count timevals
+   * @param from Pointers to the time codes
+   * @param count Number of time codes
+   * @param maxLength Maximum length of each time code
+   * @param converted Number of converted time codes, can be nullptr if unused
+   * @return - @c RETURN_OK if all time codes were converted
+   *         - The error of the first time code which could not be converted otherwise
+   */
+  static ReturnValue_t convertFromCcsds(timeval *to, const uint8_t *const *from, size_t count,
+                                        size_t maxLength, size_t *converted = nullptr);
+  /**
+   * Like the batch conversion to timeval, but returns the microseconds since the Unix epoch
+   * like Clock::getClock_usecs.
+   *
+   * @return - @c TIME_DOES_NOT_FIT_FORMAT for time codes before the Unix epoch
+   */
+  static ReturnValue_t convertFromCcsds(uint64_t *toUsecs, const uint8_t *const *from,
+                                        size_t count, size_t maxLength,
+                                        size_t *converted = nullptr);
   /**
    * @brief Currently unsupported conversion due to leapseconds
    *
@@ -205,11 +230,24 @@ class CCSDSTime : public HasReturnvaluesIF {
   static ReturnValue_t convertFromCCS(Clock::TimeOfDay_t *to, uint8_t const *from,
                                       size_t *foundLength, size_t maxLength);
 
+  /**
+   * Parses the CCSDS ASCII time code A (yyyy-mm-ddThh:mm:ss.dZ) or B (yyyy-dddThh:mm:ss.dZ).
+   *
+   * Time codes with exactly this layout are parsed directly, other input which sscanf would
+   * accept is passed on to it. The results are the same in both cases.
+   */
   static ReturnValue_t convertFromASCII(Clock::TimeOfDay_t *to, uint8_t const *from,
                                         uint8_t length);
 
   static uint32_t subsecondsToMicroseconds(uint16_t subseconds);
 
+  static const uint32_t SECONDS_PER_DAY = 24 * 60 * 60;
+  static const uint32_t SECONDS_PER_NON_LEAP_YEAR = SECONDS_PER_DAY * 365;
+  static const uint32_t DAYS_CCSDS_TO_UNIX_EPOCH =
+      4383;  //!< Time difference between CCSDS and POSIX epoch. This is exact, because leap-seconds
+             //!< where not introduced before 1972.
+  static const uint32_t SECONDS_CCSDS_TO_UNIX_EPOCH = DAYS_CCSDS_TO_UNIX_EPOCH * SECONDS_PER_DAY;
+
  private:
   CCSDSTime(){};
   virtual ~CCSDSTime(){};
@@ -226,12 +264,14 @@ class CCSDSTime : public HasReturnvaluesIF {
 
   static ReturnValue_t checkTimeOfDay(const Clock::TimeOfDay_t *time);
 
-  static const uint32_t SECONDS_PER_DAY = 24 * 60 * 60;
-  static const uint32_t SECONDS_PER_NON_LEAP_YEAR = SECONDS_PER_DAY * 365;
-  static const uint32_t DAYS_CCSDS_TO_UNIX_EPOCH =
-      4383;  //!< Time difference between CCSDS and POSIX epoch. This is exact, because leap-seconds
-             //!< where not introduced before 1972.
-  static const uint32_t SECONDS_CCSDS_TO_UNIX_EPOCH = DAYS_CCSDS_TO_UNIX_EPOCH * SECONDS_PER_DAY;
+  /**
+   * Parses ASCII time codes which have exactly the layout of the code A or B.
+   * @return false if the input has a different layout and has to be parsed with sscanf
+   */
+  static bool parseASCII(Clock::TimeOfDay_t *to, uint8_t const *from, uint8_t length,
+                         ReturnValue_t *result);
+  static ReturnValue_t scanASCII(Clock::TimeOfDay_t *to, uint8_t const *from, uint8_t length);
+
   /**
    * @param dayofYear
    * @param year
@@ -1,6 +1,7 @@
 #ifndef FSFW_TIMEMANAGER_CLOCK_H_
 #define FSFW_TIMEMANAGER_CLOCK_H_
 
+#include <atomic>
 #include <cstdint>
 
 #include "clockDefinitions.h"
@@ -57,6 +58,15 @@ class Clock {
    * @return @c RETURN_OK on success. Otherwise, the OS failure code is returned.
    */
   static ReturnValue_t getClock_timeval(timeval *time);
+  /**
+   * Returns the system clock like #getClock_timeval, but may use a faster clock source with a
+   * lower resolution. On Linux, this reads CLOCK_REALTIME_COARSE, which is updated with the
+   * scheduler tick (usually every 1 to 10 ms) and does not need to read a hardware counter.
+   * The other OSALs return the same time as #getClock_timeval.
+   * @param time	A pointer to a timeval struct where the current time is stored.
+   * @return @c RETURN_OK on success. Otherwise, the OS failure code is returned.
+   */
+  static ReturnValue_t getClockCoarse_timeval(timeval *time);
 
   /**
    * Get the time since boot in a timeval struct
@@ -153,7 +163,7 @@ class Clock {
   /**
    * Get the Leap Seconds since 1972
    *
-   * Setter must be called before
+   * Setter must be called before. Reading the leap seconds does not lock the clock mutex.
    *
    * @param[out] leapSeconds_
    * @return
@@ -172,8 +182,8 @@ class Clock {
   static ReturnValue_t checkOrCreateClockMutex();
 
   static MutexIF *timeMutex;
-  static uint16_t leapSeconds;
-  static bool leapSecondsSet;
+  static std::atomic<uint16_t> leapSeconds;
+  static std::atomic<bool> leapSecondsSet;
 };
 
 #endif /* FSFW_TIMEMANAGER_CLOCK_H_ */
@@ -3,9 +3,9 @@
 #include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/timemanager/Clock.h"
 
-uint16_t Clock::leapSeconds = 0;
+std::atomic<uint16_t> Clock::leapSeconds{0};
 MutexIF* Clock::timeMutex = nullptr;
-bool Clock::leapSecondsSet = false;
+std::atomic<bool> Clock::leapSecondsSet{false};
 
 ReturnValue_t Clock::convertUTCToTT(timeval utc, timeval* tt) {
   uint16_t leapSeconds;
@@ -27,27 +27,20 @@ ReturnValue_t Clock::convertUTCToTT(timeval utc, timeval* tt) {
 }
 
 ReturnValue_t Clock::setLeapSeconds(const uint16_t leapSeconds_) {
-  if (checkOrCreateClockMutex() != HasReturnvaluesIF::RETURN_OK) {
-    return HasReturnvaluesIF::RETURN_FAILED;
-  }
-  MutexGuard helper(timeMutex);
-
-  leapSeconds = leapSeconds_;
-  leapSecondsSet = true;
+  // The leap seconds are a single value, so they are exchanged atomically instead of locking
+  // the clock mutex for every UTC to TT conversion
+  leapSeconds.store(leapSeconds_, std::memory_order_relaxed);
+  leapSecondsSet.store(true, std::memory_order_release);
 
   return HasReturnvaluesIF::RETURN_OK;
 }
 
 ReturnValue_t Clock::getLeapSeconds(uint16_t* leapSeconds_) {
-  if (not leapSecondsSet) {
+  if (not leapSecondsSet.load(std::memory_order_acquire)) {
     return HasReturnvaluesIF::RETURN_FAILED;
   }
-  if (checkOrCreateClockMutex() != HasReturnvaluesIF::RETURN_OK) {
-    return HasReturnvaluesIF::RETURN_FAILED;
-  }
-  MutexGuard helper(timeMutex);
 
-  *leapSeconds_ = leapSeconds;
+  *leapSeconds_ = leapSeconds.load(std::memory_order_relaxed);
 
   return HasReturnvaluesIF::RETURN_OK;
 }
@@ -4,20 +4,70 @@
 
 #include "fsfw/timemanager/Clock.h"
 
-TimeStamper::TimeStamper(object_id_t objectId) : SystemObject(objectId) {}
+TimeStamper::TimeStamper(object_id_t objectId, ClockSource clockSource)
+    : SystemObject(objectId), clockSource(clockSource) {}
 
 ReturnValue_t TimeStamper::addTimeStamp(uint8_t* buffer, const uint8_t maxSize) {
-  if (maxSize < TimeStamperIF::MISSION_TIMESTAMP_SIZE) {
+  if (maxSize < TimeStamperIF::MISSION_TIMESTAMP_SIZE or
+      maxSize < sizeof(CCSDSTime::CDS_short)) {
     return HasReturnvaluesIF::RETURN_FAILED;
   }
 
   timeval now;
-  Clock::getClock_timeval(&now);
-  CCSDSTime::CDS_short cds;
-  ReturnValue_t result = CCSDSTime::convertToCcsds(&cds, &now);
+  ReturnValue_t result = readClock(&now);
   if (result != HasReturnvaluesIF::RETURN_OK) {
     return result;
   }
-  std::memcpy(buffer, &cds, sizeof(cds));
-  return result;
+  if (now.tv_sec < 0) {
+    return CCSDSTime::TIME_DOES_NOT_FIT_FORMAT;
+  }
+
+  uint32_t cache = dayCache.load(std::memory_order_relaxed);
+  uint64_t dayStart = static_cast<uint64_t>(cache >> 16) * CCSDSTime::SECONDS_PER_DAY;
+  uint64_t secondsOfDay = static_cast<uint64_t>(now.tv_sec) - dayStart;
+  if (secondsOfDay >= CCSDSTime::SECONDS_PER_DAY) {
+    // Only the first timestamp of a day needs the division, the other ones reuse the day
+    uint64_t unixDays = static_cast<uint64_t>(now.tv_sec) / CCSDSTime::SECONDS_PER_DAY;
+    uint64_t ccsdsDays = unixDays + CCSDSTime::DAYS_CCSDS_TO_UNIX_EPOCH;
+    if (ccsdsDays > 0xffff) {
+      // Date is beyond year 2137
+      return CCSDSTime::TIME_DOES_NOT_FIT_FORMAT;
+    }
+    // The Unix days are smaller than the CCSDS days, so they fit into 16 bits as well
+    cache = (static_cast<uint32_t>(unixDays) << 16) | static_cast<uint32_t>(ccsdsDays);
+    dayCache.store(cache, std::memory_order_relaxed);
+    secondsOfDay = now.tv_sec - unixDays * CCSDSTime::SECONDS_PER_DAY;
+  }
+
+  uint32_t msDay = secondsOfDay * 1000 + now.tv_usec / 1000;
+  buffer[0] = CCSDSTime::P_FIELD_CDS_SHORT;
+  buffer[1] = (cache >> 8) & 0xff;
+  buffer[2] = cache & 0xff;
+  buffer[3] = (msDay >> 24) & 0xff;
+  buffer[4] = (msDay >> 16) & 0xff;
+  buffer[5] = (msDay >> 8) & 0xff;
+  buffer[6] = msDay & 0xff;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TimeStamper::addTimeStamps(uint8_t* const* buffers, size_t count,
+                                         const uint8_t maxSize) {
+  if (count == 0) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  ReturnValue_t result = addTimeStamp(buffers[0], maxSize);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  for (size_t idx = 1; idx < count; idx++) {
+    std::memcpy(buffers[idx], buffers[0], TimeStamperIF::MISSION_TIMESTAMP_SIZE);
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TimeStamper::readClock(timeval* time) {
+  if (clockSource == ClockSource::COARSE) {
+    return Clock::getClockCoarse_timeval(time);
+  }
+  return Clock::getClock_timeval(time);
 }
@@ -1,6 +1,8 @@
 #ifndef FSFW_TIMEMANAGER_TIMESTAMPER_H_
 #define FSFW_TIMEMANAGER_TIMESTAMPER_H_
 
+#include <atomic>
+
 #include "../objectmanager/SystemObject.h"
 #include "CCSDSTime.h"
 #include "TimeStamperIF.h"
@@ -12,16 +14,29 @@
  * This time stamper uses the CCSDS CDC short timestamp as a fault timestamp.
  * This timestamp has a size of 8 bytes. A custom timestamp can be used by
  * overriding the #addTimeStamp function.
+ *
+ * The day field of the timestamp is cached, so the stamper only has to compute the
+ * milliseconds of the day as long as the clock stays in the same day. The cache is a single
+ * atomic value, so stamping does not lock a mutex and stays thread-safe.
  * @ingroup utility
  */
 class TimeStamper : public TimeStamperIF, public SystemObject {
  public:
+  enum class ClockSource {
+    //! Clock::getClock_timeval, with the full resolution of the system clock
+    PRECISE,
+    //! Clock::getClockCoarse_timeval, which is faster but only updated with the scheduler tick
+    COARSE
+  };
+
   /**
    * @brief   Default constructor which also registers the time stamper as a
    *          system object so it can be found with the #objectManager.
    * @param objectId
+   * @param clockSource   Clock which is read for each timestamp. The coarse clock can be used
+   *                      if a resolution of a few milliseconds is sufficient.
    */
-  TimeStamper(object_id_t objectId);
+  TimeStamper(object_id_t objectId, ClockSource clockSource = ClockSource::PRECISE);
 
   /**
    * Adds a CCSDS CDC short 8 byte timestamp to the given buffer.
@@ -31,6 +46,25 @@ class TimeStamper : public TimeStamperIF, public SystemObject {
    * @return
    */
   virtual ReturnValue_t addTimeStamp(uint8_t* buffer, const uint8_t maxSize);
+
+  /**
+   * Reads the clock once and gives all buffers the same timestamp. The timestamp is created
+   * with #addTimeStamp for the first buffer and copied to the other buffers.
+   */
+  ReturnValue_t addTimeStamps(uint8_t* const* buffers, size_t count,
+                              const uint8_t maxSize) override;
+
+ protected:
+  /**
+   * Reads the time for the next timestamp from the configured clock source.
+   */
+  virtual ReturnValue_t readClock(timeval* time);
+
+ private:
+  ClockSource clockSource;
+  //! Days since the Unix epoch of the cached day in the upper and the CCSDS day in the lower
+  //! 16 bits, so the cache is lock-free on 32-bit targets. Initialized with the Unix epoch.
+  std::atomic<uint32_t> dayCache{CCSDSTime::DAYS_CCSDS_TO_UNIX_EPOCH};
 };
 
 #endif /* FSFW_TIMEMANAGER_TIMESTAMPER_H_ */
@@ -3,6 +3,8 @@
 
 #include <FSFWConfig.h>
 
+#include <cstddef>
+
 #include "../returnvalues/HasReturnvaluesIF.h"
 
 /**
@@ -21,6 +23,27 @@ class TimeStamperIF {
   static const uint8_t MISSION_TIMESTAMP_SIZE = fsfwconfig::FSFW_MISSION_TIMESTAMP_SIZE;
 
   virtual ReturnValue_t addTimeStamp(uint8_t* buffer, const uint8_t maxSize) = 0;
+
+  /**
+   * Adds a timestamp to several buffers, for example to all packets which are generated in one
+   * cycle. The default implementation stamps each buffer on its own, implementations can read
+   * the clock only once and give all buffers the same timestamp.
+   * @param buffers   Buffers which receive the timestamp
+   * @param count     Number of buffers
+   * @param maxSize   Size available for the timestamp in each buffer
+   * @return  The first error which occurred, RETURN_OK if all buffers were stamped
+   */
+  virtual ReturnValue_t addTimeStamps(uint8_t* const* buffers, size_t count,
+                                      const uint8_t maxSize) {
+    for (size_t idx = 0; idx < count; idx++) {
+      ReturnValue_t result = addTimeStamp(buffers[idx], maxSize);
+      if (result != HasReturnvaluesIF::RETURN_OK) {
+        return result;
+      }
+    }
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+
   virtual ~TimeStamperIF() {}
 };
 
@@ -0,0 +1,672 @@
+#include "fsfw/tmstorage/TmStoreFileBackend.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#include "fsfw/globalfunctions/timevalOperations.h"
+#include "fsfw/ipc/MessageQueueSenderIF.h"
+#include "fsfw/objectmanager/ObjectManager.h"
+#include "fsfw/parameters/ParameterWrapper.h"
+#include "fsfw/platform.h"
+#include "fsfw/serialize/SerializeAdapter.h"
+#include "fsfw/serviceinterface/ServiceInterface.h"
+
+#ifdef PLATFORM_UNIX
+#include <unistd.h>
+#endif
+
+TmStoreFileBackend::TmStoreFileBackend(object_id_t objectId, object_id_t frontendId,
+                                       std::string directory, std::string prefix,
+                                       uint32_t maxSegmentSize, uint32_t maxSegments)
+    : SystemObject(objectId),
+      frontendId(frontendId),
+      directory(std::move(directory)),
+      prefix(std::move(prefix)),
+      maxSegmentSize(maxSegmentSize),
+      maxSegments(maxSegments),
+      readBuffer(MAX_PACKET_SIZE) {
+  if (this->maxSegments < 2) {
+    this->maxSegments = 2;
+  }
+}
+
+TmStoreFileBackend::~TmStoreFileBackend() {
+  commit();
+  closeFiles();
+}
+
+void TmStoreFileBackend::setGroupCommitPackets(uint16_t packets) { groupCommitPackets = packets; }
+
+void TmStoreFileBackend::setPacketsPerFetch(uint16_t packets) { packetsPerFetch = packets; }
+
+ReturnValue_t TmStoreFileBackend::initialize() {
+  ReturnValue_t result = SystemObject::initialize();
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  frontend = ObjectManager::instance()->get<TmStoreFrontendIF>(frontendId);
+  if (frontend == nullptr) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "TmStoreFileBackend::initialize: Invalid TM store front-end" << std::endl;
+#else
+    sif::printError("TmStoreFileBackend::initialize: Invalid TM store front-end\n");
+#endif
+    return ObjectManagerIF::CHILD_INIT_FAILED;
+  }
+  ipcStore = ObjectManager::instance()->get<StorageManagerIF>(objects::IPC_STORE);
+  if (ipcStore == nullptr) {
+    return ObjectManagerIF::CHILD_INIT_FAILED;
+  }
+  Clock::getUptime(&lastRateCheck);
+  result = loadSegments();
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    triggerEvent(STORE_INIT_FAILED, result, 0);
+  }
+  if (segments.empty() or result != HasReturnvaluesIF::RETURN_OK) {
+    // Segment files which are not covered by a valid meta file are stale
+    deleteAllSegments();
+    triggerEvent(STORE_INIT_EMPTY, 0, 0);
+    result = openActiveSegment(0);
+  } else {
+    result = openActiveSegment(segments.back().number);
+  }
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    triggerEvent(STORE_INIT_FAILED, result, 1);
+    return result;
+  }
+  updateOldestPacket();
+  ready = true;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::performOperation(uint8_t opCode) {
+  if (pendingCommits > 0) {
+    return commit();
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::storePacket(TmPacketMinimal* tmPacket) {
+  if (not ready) {
+    return NOT_READY;
+  }
+  if (tmPacket == nullptr) {
+    return NULL_REQUESTED;
+  }
+  size_t packetSize = tmPacket->getFullSize();
+  if (packetSize > MAX_PACKET_SIZE or packetSize > maxSegmentSize) {
+    return TOO_LARGE;
+  }
+  if (segments.back().size + packetSize > maxSegmentSize) {
+    ReturnValue_t result = rollSegment();
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      triggerEvent(STORE_WRITE_FAILED, result, 0);
+      return result;
+    }
+  }
+  Segment& active = segments.back();
+
+  timeval packetTime = {};
+  if (tmPacket->getPacketTime(&packetTime) != HasReturnvaluesIF::RETURN_OK) {
+    Clock::getClock_timeval(&packetTime);
+  }
+  IndexEntry entry;
+  entry.seconds = packetTime.tv_sec;
+  entry.microseconds = packetTime.tv_usec;
+  entry.segment = active.number;
+  entry.offset = active.size;
+  entry.length = packetSize;
+  entry.apid = tmPacket->getAPID();
+  entry.service = tmPacket->getService();
+  entry.subservice = tmPacket->getSubService();
+
+  if (std::fwrite(tmPacket->getWholeData(), 1, packetSize, dataFile) != packetSize or
+      std::fwrite(&entry, sizeof(entry), 1, indexFile) != 1) {
+    triggerEvent(STORE_WRITE_FAILED, HasReturnvaluesIF::RETURN_FAILED,
+                 tmPacket->getPacketSequenceCount());
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  active.size += packetSize;
+  active.packets++;
+  index.push_back(entry);
+  storedBytes += packetSize;
+  bytesSinceRateCheck += packetSize;
+  youngestPacket.setContent(tmPacket);
+  if (index.size() == 1) {
+    oldestPacket.setContent(tmPacket);
+  }
+
+  pendingCommits++;
+  if (pendingCommits >= groupCommitPackets) {
+    return commit();
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::commit() {
+  if (dataFile == nullptr or indexFile == nullptr) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  pendingCommits = 0;
+  // The data is on the medium before the index is flushed, so a committed index record never
+  // refers to data which was lost in a crash
+  ReturnValue_t result = syncFile(dataFile);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    triggerEvent(STORE_WRITE_FAILED, result, 1);
+    return result;
+  }
+  result = syncFile(indexFile);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    triggerEvent(STORE_WRITE_FAILED, result, 2);
+  }
+  return result;
+}
+
+ReturnValue_t TmStoreFileBackend::syncFile(std::FILE* file) {
+  if (std::fflush(file) != 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+#ifdef PLATFORM_UNIX
+  if (fsync(fileno(file)) != 0) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+#endif
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::setFetchLimitTime(const timeval* loverLimit,
+                                                    const timeval* upperLimit) {
+  if (loverLimit == nullptr or upperLimit == nullptr) {
+    return NULL_REQUESTED;
+  }
+  if (*upperLimit < *loverLimit) {
+    return INVALID_REQUEST;
+  }
+  auto start = std::lower_bound(
+      index.begin(), index.end(), *loverLimit,
+      [](const IndexEntry& entry, const timeval& time) { return isBefore(entry, time); });
+  auto end = std::upper_bound(
+      start, index.end(), *upperLimit,
+      [](const timeval& time, const IndexEntry& entry) { return isAfter(entry, time); });
+  fetchStart = firstPacketNumber + (start - index.begin());
+  fetchEnd = firstPacketNumber + (end - index.begin());
+  fetchCursor = fetchStart;
+  if (fetchStart == fetchEnd) {
+    return EMPTY;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::setFetchLimitBlocks(uint32_t startAddress,
+                                                      uint32_t endAddress) {
+  if (endAddress < startAddress) {
+    return INVALID_REQUEST;
+  }
+  uint32_t storedEnd = firstPacketNumber + index.size();
+  if (startAddress >= storedEnd or endAddress < firstPacketNumber) {
+    return BLOCK_NOT_FOUND;
+  }
+  fetchStart = std::max(startAddress, firstPacketNumber);
+  fetchEnd = (endAddress >= storedEnd) ? storedEnd : endAddress + 1;
+  fetchCursor = fetchStart;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::fetchPackets(bool fromBegin) {
+  if (not ready) {
+    return NOT_READY;
+  }
+  if (fromBegin) {
+    fetchCursor = fetchStart;
+  }
+  clampFetchWindow();
+  if (fetchCursor >= fetchEnd) {
+    return EMPTY;
+  }
+  for (uint16_t count = 0; count < packetsPerFetch and fetchCursor < fetchEnd; count++) {
+    const IndexEntry& entry = index[fetchCursor - firstPacketNumber];
+    ReturnValue_t result = readPacket(entry, readBuffer.data());
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      frontend->handleRetrievalFailed(result, fetchCursor);
+      triggerEvent(STORE_READ_FAILED, result, fetchCursor);
+      return DUMP_ERROR;
+    }
+    TmPacketMinimal packet(readBuffer.data());
+    result = frontend->packetRetrieved(&packet, fetchCursor);
+    fetchCursor++;
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return HasReturnvaluesIF::RETURN_OK;
+    }
+  }
+  if (fetchCursor >= fetchEnd) {
+    frontend->noMorePacketsInStore();
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::initializeStore(object_id_t dumpTarget) {
+  triggerEvent(STORE_INITIALIZE, 0, 0);
+  resetStore(true, true, true);
+  if (dataFile == nullptr) {
+    triggerEvent(STORE_INIT_FAILED, HasReturnvaluesIF::RETURN_FAILED, 0);
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  triggerEvent(INIT_DONE, 0, 0);
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::dumpIndex(store_address_t* storeId) {
+  if (storeId == nullptr) {
+    return NULL_REQUESTED;
+  }
+  const size_t serializedSize = segments.size() * 5 * sizeof(uint32_t);
+  uint8_t* buffer = nullptr;
+  ReturnValue_t result = ipcStore->getFreeElement(storeId, serializedSize, &buffer);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  size_t size = 0;
+  uint32_t packetNumber = firstPacketNumber;
+  auto entryIter = index.begin();
+  for (const auto& segment : segments) {
+    uint32_t firstTime = 0;
+    uint32_t lastTime = 0;
+    if (segment.packets > 0) {
+      firstTime = entryIter->seconds;
+      entryIter += segment.packets;
+      lastTime = (entryIter - 1)->seconds;
+    }
+    const uint32_t fields[5] = {segment.number, segment.packets, packetNumber, firstTime,
+                                lastTime};
+    for (const auto& field : fields) {
+      result = SerializeAdapter::serialize(&field, &buffer, &size, serializedSize,
+                                           SerializeIF::Endianness::NETWORK);
+      if (result != HasReturnvaluesIF::RETURN_OK) {
+        ipcStore->deleteData(*storeId);
+        return result;
+      }
+    }
+    packetNumber += segment.packets;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::deleteBlocks(uint32_t startAddress, uint32_t endAddress) {
+  if (endAddress < startAddress or startAddress > firstPacketNumber) {
+    return INVALID_REQUEST;
+  }
+  uint32_t deleted = 0;
+  while (not index.empty()) {
+    // Index not being empty means there is always a non-empty segment after an empty one
+    const Segment& oldest = segments.front();
+    if (oldest.packets > 0 and firstPacketNumber + oldest.packets - 1 > endAddress) {
+      break;
+    }
+    deleted += oldest.packets;
+    deleteOldestSegment();
+  }
+  triggerEvent(DELETION_FINISHED, deleted, 0);
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::deleteTime(const timeval* timeUntil, uint32_t* deletedPackets) {
+  if (timeUntil == nullptr) {
+    return NULL_REQUESTED;
+  }
+  uint32_t deleted = 0;
+  while (not index.empty()) {
+    const Segment& oldest = segments.front();
+    if (oldest.packets > 0 and isAfter(index[oldest.packets - 1], *timeUntil)) {
+      break;
+    }
+    deleted += oldest.packets;
+    deleteOldestSegment();
+  }
+  if (deletedPackets != nullptr) {
+    *deletedPackets = deleted;
+  }
+  triggerEvent(DELETION_FINISHED, deleted, 0);
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void TmStoreFileBackend::resetStore(bool clearStore, bool resetWrite, bool resetRead) {
+  if (clearStore) {
+    uint32_t nextSegment = segments.empty() ? 0 : segments.back().number + 1;
+    deleteAllSegments();
+    if (openActiveSegment(nextSegment) != HasReturnvaluesIF::RETURN_OK) {
+      ready = false;
+    }
+    updateOldestPacket();
+    youngestPacket.reset();
+  } else if (resetWrite and not index.empty()) {
+    rollSegment();
+  }
+  if (resetRead or clearStore) {
+    fetchStart = firstPacketNumber;
+    fetchEnd = firstPacketNumber;
+    fetchCursor = firstPacketNumber;
+  }
+}
+
+bool TmStoreFileBackend::isReady() { return ready; }
+
+uint32_t TmStoreFileBackend::availableData() {
+  clampFetchWindow();
+  return fetchEnd - fetchCursor;
+}
+
+float TmStoreFileBackend::getPercentageFilled() const {
+  return 100.0 * storedBytes / (static_cast<float>(maxSegmentSize) * maxSegments);
+}
+
+uint32_t TmStoreFileBackend::getStoredPacketsCount() const { return index.size(); }
+
+TmPacketInformation* TmStoreFileBackend::getOldestPacket() { return &oldestPacket; }
+
+TmPacketInformation* TmStoreFileBackend::getYoungestPacket() { return &youngestPacket; }
+
+float TmStoreFileBackend::getDataRate() {
+  timeval now = {};
+  Clock::getUptime(&now);
+  timeval elapsed = now - lastRateCheck;
+  double seconds = elapsed.tv_sec + elapsed.tv_usec / 1000000.0;
+  float rate = 0.0;
+  if (seconds > 0) {
+    rate = bytesSinceRateCheck / seconds;
+  }
+  bytesSinceRateCheck = 0;
+  lastRateCheck = now;
+  return rate;
+}
+
+ReturnValue_t TmStoreFileBackend::getParameter(uint8_t domainId, uint8_t uniqueIdentifier,
+                                               ParameterWrapper* parameterWrapper,
+                                               const ParameterWrapper* newValues,
+                                               uint16_t startAtIndex) {
+  if (domainId != 0) {
+    return INVALID_DOMAIN_ID;
+  }
+  switch (static_cast<ParameterIds>(uniqueIdentifier)) {
+    case ParameterIds::GROUP_COMMIT_PACKETS:
+      parameterWrapper->set(groupCommitPackets);
+      break;
+    case ParameterIds::PACKETS_PER_FETCH:
+      parameterWrapper->set(packetsPerFetch);
+      break;
+    default:
+      return INVALID_IDENTIFIER_ID;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+std::string TmStoreFileBackend::segmentPath(uint32_t number, const char* suffix) const {
+  return directory + "/" + prefix + "_" + std::to_string(number) + suffix;
+}
+
+std::string TmStoreFileBackend::metaPath() const { return directory + "/" + prefix + ".meta"; }
+
+ReturnValue_t TmStoreFileBackend::loadSegments() {
+  std::FILE* meta = std::fopen(metaPath().c_str(), "rb");
+  if (meta == nullptr) {
+    // Fresh store
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  uint32_t metaFields[3] = {};
+  size_t readFields = std::fread(metaFields, sizeof(uint32_t), 3, meta);
+  std::fclose(meta);
+  if (readFields != 3 or metaFields[1] < metaFields[0] or
+      metaFields[1] - metaFields[0] >= maxSegments) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  firstPacketNumber = metaFields[2];
+  for (uint32_t number = metaFields[0]; number <= metaFields[1]; number++) {
+    ReturnValue_t result = loadSegment(number);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::loadSegment(uint32_t number) {
+  Segment segment;
+  segment.number = number;
+  std::FILE* data = std::fopen(segmentPath(number, ".tm").c_str(), "rb");
+  if (data == nullptr) {
+    // Segment was created in the meta file, but the data file was never written
+    segments.push_back(segment);
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  std::fseek(data, 0, SEEK_END);
+  long dataSize = std::ftell(data);
+  std::fclose(data);
+
+  std::FILE* indexIn = std::fopen(segmentPath(number, ".idx").c_str(), "rb");
+  if (indexIn != nullptr) {
+    IndexEntry entry;
+    while (std::fread(&entry, sizeof(entry), 1, indexIn) == 1) {
+      if (entry.segment != number or entry.offset != segment.size or
+          static_cast<long>(entry.offset) + entry.length > dataSize) {
+        // Torn write during a crash. Everything after this entry is discarded.
+        break;
+      }
+      segment.size += entry.length;
+      segment.packets++;
+      index.push_back(entry);
+    }
+    std::fclose(indexIn);
+  }
+  storedBytes += segment.size;
+  segments.push_back(segment);
+  if (static_cast<long>(segment.size) != dataSize) {
+    triggerEvent(STORE_CONTENT_CORRUPTED, number, segment.size);
+    // Cut off data without index entry so appended packets line up with the index again.
+    std::vector<uint8_t> validData(segment.size);
+    data = std::fopen(segmentPath(number, ".tm").c_str(), "rb");
+    if (data == nullptr or std::fread(validData.data(), 1, segment.size, data) != segment.size) {
+      if (data != nullptr) {
+        std::fclose(data);
+      }
+      return HasReturnvaluesIF::RETURN_FAILED;
+    }
+    std::fclose(data);
+    data = std::fopen(segmentPath(number, ".tm").c_str(), "wb");
+    if (data == nullptr) {
+      return HasReturnvaluesIF::RETURN_FAILED;
+    }
+    std::fwrite(validData.data(), 1, segment.size, data);
+    std::fclose(data);
+    std::FILE* indexOut = std::fopen(segmentPath(number, ".idx").c_str(), "wb");
+    if (indexOut == nullptr) {
+      return HasReturnvaluesIF::RETURN_FAILED;
+    }
+    std::fwrite(&index[index.size() - segment.packets], sizeof(IndexEntry), segment.packets,
+                indexOut);
+    std::fclose(indexOut);
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::writeMeta() {
+  // The new content is on the medium before it replaces the old meta file, so a crash leaves
+  // either the old or the new meta file
+  std::string tempPath = metaPath() + ".tmp";
+  std::FILE* meta = std::fopen(tempPath.c_str(), "wb");
+  if (meta == nullptr) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  uint32_t metaFields[3] = {segments.front().number, segments.back().number, firstPacketNumber};
+  size_t written = std::fwrite(metaFields, sizeof(uint32_t), 3, meta);
+  ReturnValue_t result = syncFile(meta);
+  std::fclose(meta);
+  if (written != 3 or result != HasReturnvaluesIF::RETURN_OK or
+      std::rename(tempPath.c_str(), metaPath().c_str()) != 0) {
+    std::remove(tempPath.c_str());
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t TmStoreFileBackend::openActiveSegment(uint32_t number) {
+  if (segments.empty() or segments.back().number != number) {
+    Segment segment;
+    segment.number = number;
+    segments.push_back(segment);
+  }
+  dataFile = std::fopen(segmentPath(number, ".tm").c_str(), "ab");
+  indexFile = std::fopen(segmentPath(number, ".idx").c_str(), "ab");
+  if (dataFile == nullptr or indexFile == nullptr) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "TmStoreFileBackend: Could not open segment " << segmentPath(number, ".tm")
+               << std::endl;
+#else
+    sif::printError("TmStoreFileBackend: Could not open segment %s\n",
+                    segmentPath(number, ".tm").c_str());
+#endif
+    closeFiles();
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return writeMeta();
+}
+
+ReturnValue_t TmStoreFileBackend::rollSegment() {
+  commit();
+  closeFiles();
+  ReturnValue_t result = openActiveSegment(segments.back().number + 1);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  while (segments.size() > maxSegments) {
+    deleteOldestSegment();
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void TmStoreFileBackend::closeFiles() {
+  if (dataFile != nullptr) {
+    std::fclose(dataFile);
+    dataFile = nullptr;
+  }
+  if (indexFile != nullptr) {
+    std::fclose(indexFile);
+    indexFile = nullptr;
+  }
+  if (readFile != nullptr) {
+    std::fclose(readFile);
+    readFile = nullptr;
+  }
+}
+
+void TmStoreFileBackend::deleteOldestSegment() {
+  if (segments.size() == 1) {
+    // Never delete the active segment, start a new one first
+    rollSegment();
+  }
+  Segment oldest = segments.front();
+  if (readFile != nullptr and readSegment == oldest.number) {
+    std::fclose(readFile);
+    readFile = nullptr;
+  }
+  std::remove(segmentPath(oldest.number, ".tm").c_str());
+  std::remove(segmentPath(oldest.number, ".idx").c_str());
+  index.erase(index.begin(), index.begin() + oldest.packets);
+  firstPacketNumber += oldest.packets;
+  storedBytes -= oldest.size;
+  segments.pop_front();
+  writeMeta();
+  clampFetchWindow();
+  updateOldestPacket();
+}
+
+void TmStoreFileBackend::deleteAllSegments() {
+  closeFiles();
+  // The files are looked up in the directory instead of the segment list, which does not know
+  // the segments on the medium if the meta file could not be loaded
+  std::error_code error;
+  std::filesystem::directory_iterator entry(directory, error);
+  for (; not error and entry != std::filesystem::directory_iterator(); entry.increment(error)) {
+    if (isSegmentFile(entry->path().filename().string())) {
+      std::filesystem::remove(entry->path(), error);
+    }
+  }
+  firstPacketNumber += index.size();
+  segments.clear();
+  index.clear();
+  storedBytes = 0;
+  pendingCommits = 0;
+}
+
+bool TmStoreFileBackend::isSegmentFile(const std::string& fileName) const {
+  // <prefix>_<n>.tm or <prefix>_<n>.idx
+  if (fileName.size() <= prefix.size() + 1 or fileName.compare(0, prefix.size(), prefix) != 0 or
+      fileName[prefix.size()] != '_') {
+    return false;
+  }
+  size_t suffixStart = fileName.find('.', prefix.size() + 1);
+  if (suffixStart == std::string::npos or suffixStart == prefix.size() + 1) {
+    return false;
+  }
+  for (size_t idx = prefix.size() + 1; idx < suffixStart; idx++) {
+    if (fileName[idx] < '0' or fileName[idx] > '9') {
+      return false;
+    }
+  }
+  return fileName.compare(suffixStart, std::string::npos, ".tm") == 0 or
+         fileName.compare(suffixStart, std::string::npos, ".idx") == 0;
+}
+
+ReturnValue_t TmStoreFileBackend::readPacket(const IndexEntry& entry, uint8_t* buffer) {
+  if (entry.length > MAX_PACKET_SIZE) {
+    return TOO_LARGE;
+  }
+  if (entry.segment == segments.back().number and pendingCommits > 0) {
+    std::fflush(dataFile);
+  }
+  if (readFile == nullptr or readSegment != entry.segment) {
+    if (readFile != nullptr) {
+      std::fclose(readFile);
+    }
+    readFile = std::fopen(segmentPath(entry.segment, ".tm").c_str(), "rb");
+    if (readFile == nullptr) {
+      return BLOCK_NOT_FOUND;
+    }
+    readSegment = entry.segment;
+  }
+  if (std::fseek(readFile, entry.offset, SEEK_SET) != 0 or
+      std::fread(buffer, 1, entry.length, readFile) != entry.length) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+void TmStoreFileBackend::updateOldestPacket() {
+  if (index.empty() or
+      readPacket(index.front(), readBuffer.data()) != HasReturnvaluesIF::RETURN_OK) {
+    oldestPacket.reset();
+    return;
+  }
+  TmPacketMinimal packet(readBuffer.data());
+  oldestPacket.setContent(&packet);
+}
+
+void TmStoreFileBackend::clampFetchWindow() {
+  uint32_t storedEnd = firstPacketNumber + index.size();
+  fetchStart = std::max(fetchStart, firstPacketNumber);
+  fetchCursor = std::max(fetchCursor, fetchStart);
+  fetchEnd = std::min(fetchEnd, storedEnd);
+}
+
+bool TmStoreFileBackend::isBefore(const IndexEntry& entry, const timeval& time) {
+  if (entry.seconds != time.tv_sec) {
+    return entry.seconds < time.tv_sec;
+  }
+  return entry.microseconds < static_cast<uint32_t>(time.tv_usec);
+}
+
+bool TmStoreFileBackend::isAfter(const IndexEntry& entry, const timeval& time) {
+  if (entry.seconds != time.tv_sec) {
+    return entry.seconds > time.tv_sec;
+  }
+  return entry.microseconds > static_cast<uint32_t>(time.tv_usec);
+}
@@ -0,0 +1,219 @@
+#ifndef FSFW_TMSTORAGE_TMSTOREFILEBACKEND_H_
+#define FSFW_TMSTORAGE_TMSTOREFILEBACKEND_H_
+
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "TmStoreBackendIF.h"
+#include "TmStoreFrontendIF.h"
+#include "TmStorePackets.h"
+#include "fsfw/objectmanager/SystemObject.h"
+#include "tmStorageConf.h"
+
+/**
+ * @brief   Reference implementation of the TM store back-end which stores packets in
+ *          append-only segment files on a file system.
+ * @details
+ * Packets are appended to the active segment file `<directory>/<prefix>_<n>.tm`. For every
+ * packet, a fixed-size index record (time, APID, service, location) is appended to the
+ * companion file `<directory>/<prefix>_<n>.idx` and kept in memory. The record layout is
+ * host-local and not meant to be exchanged between machines. The segment range is tracked in
+ * `<directory>/<prefix>.meta`, so the index can be rebuilt quickly in #initialize. The meta file
+ * is replaced atomically. If it can not be loaded, all segment files of the store are deleted.
+ *
+ * Writes are not flushed for every packet. Instead, the files are flushed (and synced to the
+ * medium on UNIX platforms) once a configurable number of packets is pending, or at the latest
+ * in the next #performOperation call (group commit). After a crash, index records which point
+ * beyond the end of their segment file are discarded on start-up.
+ *
+ * Segments are the unit of deletion, similar to the blocks of the IndexedRingMemoryArray. If the
+ * configured maximum number of segments is exceeded, the oldest segment is dropped.
+ *
+ * Fetch limits set with #setFetchLimitTime are resolved with a binary search on the index,
+ * assuming that packet timestamps are non-decreasing. Block addresses used by
+ * #setFetchLimitBlocks, #deleteBlocks and reported with TmStoreFrontendIF::packetRetrieved are
+ * absolute packet numbers which stay valid when old segments are deleted.
+ *
+ * The timestamp of a packet is retrieved with TmPacketMinimal::getPacketTime. If no timestamp
+ * interpreter was set, the current system time is used instead.
+ */
+class TmStoreFileBackend : public SystemObject, public TmStoreBackendIF {
+ public:
+  static constexpr uint32_t DEFAULT_MAX_SEGMENT_SIZE = 4 * 1024 * 1024;
+  static constexpr uint32_t DEFAULT_MAX_SEGMENTS = 64;
+  static constexpr uint16_t DEFAULT_GROUP_COMMIT_PACKETS = 64;
+  static constexpr uint16_t DEFAULT_PACKETS_PER_FETCH = 32;
+  static constexpr size_t MAX_PACKET_SIZE = 2048;
+
+  enum class ParameterIds : uint8_t {
+    GROUP_COMMIT_PACKETS = 0,
+    PACKETS_PER_FETCH = 1,
+  };
+
+  /**
+   * Index record which is stored for every packet.
+   */
+  struct IndexEntry {
+    uint32_t seconds = 0;
+    uint32_t microseconds = 0;
+    uint32_t segment = 0;
+    uint32_t offset = 0;
+    uint16_t length = 0;
+    uint16_t apid = 0;
+    uint8_t service = 0;
+    uint8_t subservice = 0;
+    uint8_t spare[2] = {};
+  };
+
+  /**
+   * @param objectId
+   * @param frontendId  Object ID of the TmStoreFrontendIF receiving the fetched packets
+   * @param directory   Directory the segment files are stored in. Needs to exist.
+   * @param prefix      File name prefix of all files belonging to this store
+   * @param maxSegmentSize    Maximum size of a single segment file in bytes
+   * @param maxSegments       Maximum number of segments. The oldest segment is deleted
+   *                          if a new segment would exceed this number.
+   */
+  TmStoreFileBackend(object_id_t objectId, object_id_t frontendId, std::string directory,
+                     std::string prefix = "tmstore",
+                     uint32_t maxSegmentSize = DEFAULT_MAX_SEGMENT_SIZE,
+                     uint32_t maxSegments = DEFAULT_MAX_SEGMENTS);
+  ~TmStoreFileBackend() override;
+
+  /**
+   * Number of stored packets after which the files are flushed and synced.
+   * A value of 0 or 1 commits every packet.
+   */
+  void setGroupCommitPackets(uint16_t packets);
+  /**
+   * Maximum number of packets passed to the front-end in a single #fetchPackets call.
+   */
+  void setPacketsPerFetch(uint16_t packets);
+
+  ReturnValue_t initialize() override;
+  /**
+   * Commits pending writes.
+   */
+  ReturnValue_t performOperation(uint8_t opCode) override;
+
+  ReturnValue_t storePacket(TmPacketMinimal* tmPacket) override;
+  ReturnValue_t setFetchLimitTime(const timeval* loverLimit, const timeval* upperLimit) override;
+  ReturnValue_t setFetchLimitBlocks(uint32_t startAddress, uint32_t endAddress) override;
+  /**
+   * Pass the next packets inside the fetch limits to the front-end. The front-end stops the
+   * fetch by returning anything other than RETURN_OK in TmStoreFrontendIF::packetRetrieved.
+   * Once all packets were retrieved, TmStoreFrontendIF::noMorePacketsInStore is called.
+   * @param fromBegin Restart at the beginning of the fetch limits
+   * @return
+   *  - @c EMPTY if no packets lie within the fetch limits
+   *  - @c DUMP_ERROR if a packet could not be read
+   */
+  ReturnValue_t fetchPackets(bool fromBegin = false) override;
+  /**
+   * Deletes all stored content and starts with an empty store.
+   */
+  ReturnValue_t initializeStore(object_id_t dumpTarget) override;
+  /**
+   * Writes a catalogue of all segments into the IPC store. For each segment, the segment
+   * number, the number of packets, the first packet number and the time of the first and the
+   * last packet (seconds only) are serialized as big endian uint32_t.
+   */
+  ReturnValue_t dumpIndex(store_address_t* storeId) override;
+  /**
+   * Deletes the oldest segments which only contain packets with numbers up to endAddress.
+   * Deletion always starts at the oldest segment, so startAddress may not be larger than the
+   * first stored packet number.
+   */
+  ReturnValue_t deleteBlocks(uint32_t startAddress, uint32_t endAddress) override;
+  /**
+   * Deletes the oldest segments which only contain packets older than or equal to timeUntil.
+   */
+  ReturnValue_t deleteTime(const timeval* timeUntil, uint32_t* deletedPackets) override;
+  void resetStore(bool clearStore, bool resetWrite, bool resetRead) override;
+  bool isReady() override;
+  uint32_t availableData() override;
+  float getPercentageFilled() const override;
+  uint32_t getStoredPacketsCount() const override;
+  TmPacketInformation* getOldestPacket() override;
+  TmPacketInformation* getYoungestPacket() override;
+  /**
+   * @return Stored bytes per second since the last call of this function
+   */
+  float getDataRate() override;
+
+  ReturnValue_t getParameter(uint8_t domainId, uint8_t uniqueIdentifier,
+                             ParameterWrapper* parameterWrapper, const ParameterWrapper* newValues,
+                             uint16_t startAtIndex) override;
+
+  /**
+   * Flushes all pending writes to the files and syncs them on UNIX platforms.
+   */
+  ReturnValue_t commit();
+
+ private:
+  struct Segment {
+    uint32_t number = 0;
+    uint32_t size = 0;
+    uint32_t packets = 0;
+  };
+
+  object_id_t frontendId;
+  TmStoreFrontendIF* frontend = nullptr;
+  StorageManagerIF* ipcStore = nullptr;
+
+  std::string directory;
+  std::string prefix;
+  uint32_t maxSegmentSize;
+  uint32_t maxSegments;
+  uint16_t groupCommitPackets = DEFAULT_GROUP_COMMIT_PACKETS;
+  uint16_t packetsPerFetch = DEFAULT_PACKETS_PER_FETCH;
+
+  bool ready = false;
+  std::deque<Segment> segments;
+  std::deque<IndexEntry> index;
+  //! Absolute packet number of the first entry in the index
+  uint32_t firstPacketNumber = 0;
+
+  std::FILE* dataFile = nullptr;
+  std::FILE* indexFile = nullptr;
+  uint16_t pendingCommits = 0;
+
+  std::FILE* readFile = nullptr;
+  uint32_t readSegment = 0;
+
+  //! Fetch window and cursor, all absolute packet numbers. End is exclusive.
+  uint32_t fetchStart = 0;
+  uint32_t fetchEnd = 0;
+  uint32_t fetchCursor = 0;
+
+  TmPacketInformation oldestPacket;
+  TmPacketInformation youngestPacket;
+  uint64_t storedBytes = 0;
+  uint64_t bytesSinceRateCheck = 0;
+  timeval lastRateCheck = {};
+  std::vector<uint8_t> readBuffer;
+
+  std::string segmentPath(uint32_t number, const char* suffix) const;
+  std::string metaPath() const;
+
+  ReturnValue_t loadSegments();
+  ReturnValue_t loadSegment(uint32_t number);
+  ReturnValue_t writeMeta();
+  ReturnValue_t openActiveSegment(uint32_t number);
+  ReturnValue_t rollSegment();
+  void closeFiles();
+  static ReturnValue_t syncFile(std::FILE* file);
+  void deleteOldestSegment();
+  void deleteAllSegments();
+  bool isSegmentFile(const std::string& fileName) const;
+
+  ReturnValue_t readPacket(const IndexEntry& entry, uint8_t* buffer);
+  void updateOldestPacket();
+  void clampFetchWindow();
+  static bool isBefore(const IndexEntry& entry, const timeval& time);
+  static bool isAfter(const IndexEntry& entry, const timeval& time);
+};
+
+#endif /* FSFW_TMSTORAGE_TMSTOREFILEBACKEND_H_ */
@@ -4,6 +4,7 @@
 #include "fsfw/ipc/QueueFactory.h"
 #include "fsfw/objectmanager/ObjectManager.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
+#include "fsfw/serviceinterface/TraceChannel.h"
 
 #define TMTCBRIDGE_WIRETAPPING 0
 
@@ -16,6 +17,9 @@ TmTcBridge::TmTcBridge(object_id_t objectId, object_id_t tcDestination, object_i
 
 {
   tmTcReceptionQueue = QueueFactory::instance()->createMessageQueue(TMTC_RECEPTION_QUEUE_DEPTH);
+  for (size_t idx = 0; idx < tmBatch.size(); idx++) {
+    tmBatchPointers[idx] = &tmBatch[idx];
+  }
 }
 
 TmTcBridge::~TmTcBridge() { QueueFactory::instance()->deleteMessageQueue(tmTcReceptionQueue); }
@@ -128,38 +132,46 @@ ReturnValue_t TmTcBridge::handleTm() {
 }
 
 ReturnValue_t TmTcBridge::handleTmQueue() {
-  TmTcMessage message;
   const uint8_t* data = nullptr;
   size_t size = 0;
+  size_t received = 0;
   ReturnValue_t status = HasReturnvaluesIF::RETURN_OK;
-  for (ReturnValue_t result = tmTcReceptionQueue->receiveMessage(&message);
-       result == HasReturnvaluesIF::RETURN_OK;
-       result = tmTcReceptionQueue->receiveMessage(&message)) {
+  while (tmTcReceptionQueue->receiveMessages(tmBatchPointers.data(), tmBatchPointers.size(),
+                                             &received) == HasReturnvaluesIF::RETURN_OK) {
+    for (size_t idx = 0; idx < received; idx++) {
+      TmTcMessage& message = tmBatch[idx];
 #if FSFW_VERBOSE_LEVEL >= 3
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-    sif::info << "Sent packet counter: " << static_cast<int>(packetSentCounter) << std::endl;
+      sif::info << "Sent packet counter: " << static_cast<int>(packetSentCounter) << std::endl;
 #else
-    sif::printInfo("Sent packet counter: %d\n", packetSentCounter);
+      sif::printInfo("Sent packet counter: %d\n", packetSentCounter);
 #endif
 #endif /* FSFW_VERBOSE_LEVEL >= 3 */
 
-    if (communicationLinkUp == false or packetSentCounter >= sentPacketsPerCycle) {
-      storeDownlinkData(&message);
-      continue;
+      if (communicationLinkUp == false or packetSentCounter >= sentPacketsPerCycle) {
+        storeDownlinkData(&message);
+        continue;
+      }
+
+      ReturnValue_t result = tmStore->getData(message.getStorageId(), &data, &size);
+      if (result != HasReturnvaluesIF::RETURN_OK) {
+        status = result;
+        continue;
+      }
+
+      result = sendTm(data, size);
+      if (result != HasReturnvaluesIF::RETURN_OK) {
+        status = result;
+      } else {
+        trace::record(trace::RecordTypes::TM_SENT, message.getStorageId().raw, getObjectId(),
+                      size);
+        tmStore->deleteData(message.getStorageId());
+        packetSentCounter++;
+      }
     }
-
-    result = tmStore->getData(message.getStorageId(), &data, &size);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      status = result;
-      continue;
-    }
-
-    result = sendTm(data, size);
-    if (result != HasReturnvaluesIF::RETURN_OK) {
-      status = result;
-    } else {
-      tmStore->deleteData(message.getStorageId());
-      packetSentCounter++;
+    if (received < tmBatchPointers.size()) {
+      // The queue was read completely
+      break;
     }
   }
   return status;
@@ -218,6 +230,8 @@ ReturnValue_t TmTcBridge::handleStoredTm() {
       sif::error << "TMTC Bridge: Could not send stored downlink data" << std::endl;
 #endif
       status = result;
+    } else {
+      trace::record(trace::RecordTypes::TM_SENT, storeId.raw, getObjectId(), size);
     }
     packetSentCounter++;
 
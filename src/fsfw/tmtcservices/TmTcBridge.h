@@ -1,6 +1,8 @@
 #ifndef FSFW_TMTCSERVICES_TMTCBRIDGE_H_
 #define FSFW_TMTCSERVICES_TMTCBRIDGE_H_
 
+#include <array>
+
 #include "AcceptsTelecommandsIF.h"
 #include "AcceptsTelemetryIF.h"
 #include "fsfw/container/DynamicFIFO.h"
@@ -17,6 +19,8 @@ class TmTcBridge : public AcceptsTelemetryIF,
                    public SystemObject {
  public:
   static constexpr uint8_t TMTC_RECEPTION_QUEUE_DEPTH = 20;
+  //! Number of TM messages which are read from the reception queue at once
+  static constexpr uint8_t TM_RECEPTION_BATCH_SIZE = 10;
   static constexpr uint8_t LIMIT_STORED_DATA_SENT_PER_CYCLE = 15;
   static constexpr uint8_t LIMIT_DOWNLINK_PACKETS_STORED = 200;
 
@@ -81,6 +85,9 @@ class TmTcBridge : public AcceptsTelemetryIF,
   //! Used to send and receive TMTC messages.
   //! The TmTcMessage class is used to transport messages between tasks.
   MessageQueueIF* tmTcReceptionQueue = nullptr;
+  //! Messages and message pointers used to read the reception queue in batches
+  std::array<TmTcMessage, TM_RECEPTION_BATCH_SIZE> tmBatch;
+  std::array<MessageQueueMessageIF*, TM_RECEPTION_BATCH_SIZE> tmBatchPointers = {};
 
   StorageManagerIF* tmStore = nullptr;
   StorageManagerIF* tcStore = nullptr;
@@ -0,0 +1,17 @@
+#include "GpioMessage.h"
+
+void GpioMessage::setEdgeEvent(CommandMessage* message, const gpio::EdgeEvent& event) {
+  message->setCommand(EDGE_EVENT);
+  message->setParameter((static_cast<uint32_t>(event.gpioId) << 16) |
+                        (static_cast<uint32_t>(event.level) & 0xffff));
+  message->setParameter2(static_cast<uint32_t>(event.timestamp.tv_sec));
+  message->setParameter3(static_cast<uint32_t>(event.timestamp.tv_nsec));
+}
+
+void GpioMessage::getEdgeEvent(const CommandMessage* message, gpio::EdgeEvent* event) {
+  uint32_t parameter = message->getParameter();
+  event->gpioId = parameter >> 16;
+  event->level = static_cast<gpio::Levels>(parameter & 0xffff);
+  event->timestamp.tv_sec = message->getParameter2();
+  event->timestamp.tv_nsec = message->getParameter3();
+}
@@ -0,0 +1,26 @@
+#ifndef COMMON_GPIO_GPIOMESSAGE_H_
+#define COMMON_GPIO_GPIOMESSAGE_H_
+
+#include <fsfw/ipc/CommandMessage.h>
+
+#include "gpioDefinitions.h"
+
+/**
+ * @brief   Messages sent by GPIO interfaces, for example to notify a device handler about
+ *          an edge on one of its input GPIOs.
+ */
+class GpioMessage {
+ private:
+  GpioMessage();
+
+ public:
+  static const uint8_t MESSAGE_ID = messagetypes::GPIO;
+  //! Parameter 1: GPIO ID in the upper and level in the lower 16 bits, parameter 2 and 3:
+  //! Seconds and nanoseconds of the event timestamp.
+  static const Command_t EDGE_EVENT = MAKE_COMMAND_ID(1);
+
+  static void setEdgeEvent(CommandMessage* message, const gpio::EdgeEvent& event);
+  static void getEdgeEvent(const CommandMessage* message, gpio::EdgeEvent* event);
+};
+
+#endif /* COMMON_GPIO_GPIOMESSAGE_H_ */
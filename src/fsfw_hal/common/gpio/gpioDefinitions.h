@@ -1,6 +1,7 @@
 #ifndef COMMON_GPIO_GPIODEFINITIONS_H_
 #define COMMON_GPIO_GPIODEFINITIONS_H_
 
+#include <ctime>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -23,8 +24,19 @@ enum class GpioTypes {
   CALLBACK
 };
 
+//! Edges of an input GPIO which are reported as edge events
+enum class EdgeDetection { NONE, RISING, FALLING, BOTH };
+
 static constexpr gpioId_t NO_GPIO = -1;
 
+struct EdgeEvent {
+  gpioId_t gpioId = NO_GPIO;
+  //! HIGH for a rising edge, LOW for a falling edge
+  Levels level = Levels::NONE;
+  //! Timestamp of the edge as reported by the kernel
+  timespec timestamp = {};
+};
+
 using gpio_cb_t = void (*)(gpioId_t gpioId, gpio::GpioOperation gpioOp, gpio::Levels value,
                            void* args);
 
@@ -43,6 +55,8 @@ using gpio_cb_t = void (*)(gpioId_t gpioId, gpio::GpioOperation gpioOp, gpio::Le
  *                      Only required for output GPIOs.
  * @param lineHandle    The handle returned by gpiod_chip_get_line will be later written to this
  *                      pointer.
+ * @param edgeDetection Only for input GPIOs. If set, the GPIO interface reports the
+ *                      specified edges as edge events instead of only providing the line level.
  */
 class GpioBase {
  public:
@@ -74,6 +88,7 @@ class GpiodRegularBase : public GpioBase {
 
   int lineNum = 0;
   struct gpiod_line* lineHandle = nullptr;
+  gpio::EdgeDetection edgeDetection = gpio::EdgeDetection::NONE;
 };
 
 class GpiodRegularByChip : public GpiodRegularBase {
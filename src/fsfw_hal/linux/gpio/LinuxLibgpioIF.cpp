@@ -1,20 +1,46 @@
 #include "LinuxLibgpioIF.h"
 
+#include <errno.h>
 #include <gpiod.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <unistd.h>
 
+#include <cstring>
 #include <utility>
 
+#include "fsfw/ipc/CommandMessage.h"
+#include "fsfw/ipc/MessageQueueSenderIF.h"
+#include "fsfw/ipc/MutexFactory.h"
+#include "fsfw/ipc/MutexGuard.h"
 #include "fsfw/serviceinterface/ServiceInterface.h"
 #include "fsfw_hal/common/gpio/GpioCookie.h"
+#include "fsfw_hal/common/gpio/GpioMessage.h"
 #include "fsfw_hal/common/gpio/gpioDefinitions.h"
 
-LinuxLibgpioIF::LinuxLibgpioIF(object_id_t objectId) : SystemObject(objectId) {}
+LinuxLibgpioIF::LinuxLibgpioIF(object_id_t objectId) : SystemObject(objectId) {
+  eventMutex = MutexFactory::instance()->createMutex();
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  stopEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (epollFd >= 0 and stopEventFd >= 0) {
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, stopEventFd, &event);
+  }
+}
 
 LinuxLibgpioIF::~LinuxLibgpioIF() {
   for (auto& config : gpioMap) {
     delete (config.second);
   }
+  if (epollFd >= 0) {
+    close(epollFd);
+  }
+  if (stopEventFd >= 0) {
+    close(stopEventFd);
+  }
+  MutexFactory::instance()->deleteMutex(eventMutex);
 }
 
 ReturnValue_t LinuxLibgpioIF::addGpios(GpioCookie* gpioCookie) {
@@ -181,6 +207,9 @@ ReturnValue_t LinuxLibgpioIF::configureRegularGpio(gpioId_t gpioId, struct gpiod
       break;
     }
     case (gpio::Direction::IN): {
+      if (regularGpio.edgeDetection != gpio::EdgeDetection::NONE) {
+        return requestEdgeEvents(gpioId, lineHandle, regularGpio);
+      }
       result = gpiod_line_request_input(lineHandle, consumer.c_str());
       break;
     }
@@ -190,20 +219,19 @@ ReturnValue_t LinuxLibgpioIF::configureRegularGpio(gpioId_t gpioId, struct gpiod
 #endif
       return GPIO_INVALID_INSTANCE;
     }
-
-      if (result < 0) {
+  }
+  if (result < 0) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
-        sif::error << "LinuxLibgpioIF::configureRegularGpio: Failed to request line " << lineNum
-                   << " from GPIO instance with ID: " << gpioId << std::endl;
+    sif::error << "LinuxLibgpioIF::configureRegularGpio: Failed to request line " << lineNum
+               << " from GPIO instance with ID: " << gpioId << std::endl;
 #else
-        sif::printError(
-            "LinuxLibgpioIF::configureRegularGpio: "
-            "Failed to request line %d from GPIO instance with ID: %d\n",
-            lineNum, gpioId);
+    sif::printError(
+        "LinuxLibgpioIF::configureRegularGpio: "
+        "Failed to request line %d from GPIO instance with ID: %d\n",
+        lineNum, gpioId);
 #endif
-        gpiod_line_release(lineHandle);
-        return RETURN_FAILED;
-      }
+    gpiod_line_release(lineHandle);
+    return RETURN_FAILED;
   }
   /**
    * Write line handle to GPIO configuration instance so it can later be used to set or
@@ -213,6 +241,200 @@ ReturnValue_t LinuxLibgpioIF::configureRegularGpio(gpioId_t gpioId, struct gpiod
   return RETURN_OK;
 }
 
+ReturnValue_t LinuxLibgpioIF::requestEdgeEvents(gpioId_t gpioId, struct gpiod_line* lineHandle,
+                                                GpiodRegularBase& regularGpio) {
+  const char* consumer = regularGpio.consumer.c_str();
+  int result = 0;
+  switch (regularGpio.edgeDetection) {
+    case (gpio::EdgeDetection::RISING): {
+      result = gpiod_line_request_rising_edge_events(lineHandle, consumer);
+      break;
+    }
+    case (gpio::EdgeDetection::FALLING): {
+      result = gpiod_line_request_falling_edge_events(lineHandle, consumer);
+      break;
+    }
+    case (gpio::EdgeDetection::BOTH): {
+      result = gpiod_line_request_both_edges_events(lineHandle, consumer);
+      break;
+    }
+    default: {
+      return GPIO_INVALID_INSTANCE;
+    }
+  }
+  if (result < 0) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "LinuxLibgpioIF::requestEdgeEvents: Failed to request edge events for line "
+               << regularGpio.lineNum << " from GPIO instance with ID: " << gpioId << std::endl;
+#else
+    sif::printError(
+        "LinuxLibgpioIF::requestEdgeEvents: Failed to request edge events for line %d "
+        "from GPIO instance with ID: %d\n",
+        regularGpio.lineNum, gpioId);
+#endif
+    gpiod_line_release(lineHandle);
+    return RETURN_FAILED;
+  }
+  if (addEdgeEventListener(gpioId, lineHandle) != RETURN_OK) {
+    gpiod_line_release(lineHandle);
+    return RETURN_FAILED;
+  }
+  regularGpio.lineHandle = lineHandle;
+  return RETURN_OK;
+}
+
+ReturnValue_t LinuxLibgpioIF::addEdgeEventListener(gpioId_t gpioId,
+                                                   struct gpiod_line* lineHandle) {
+  int fileDescriptor = gpiod_line_event_get_fd(lineHandle);
+  EdgeEventListener* listener = nullptr;
+  {
+    MutexGuard mg(eventMutex);
+    listener = &edgeEventListeners[gpioId];
+    listener->gpioId = gpioId;
+    listener->fileDescriptor = fileDescriptor;
+  }
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.ptr = listener;
+  if (fileDescriptor < 0 or epollFd < 0 or
+      epoll_ctl(epollFd, EPOLL_CTL_ADD, fileDescriptor, &event) != 0) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "LinuxLibgpioIF::addEdgeEventListener: Adding GPIO " << gpioId
+                 << " to the event loop failed with error code " << errno << ": "
+                 << strerror(errno) << std::endl;
+#else
+    sif::printWarning(
+        "LinuxLibgpioIF::addEdgeEventListener: Adding GPIO %d to the event loop failed with "
+        "error code %d: %s\n",
+        gpioId, errno, strerror(errno));
+#endif
+    MutexGuard mg(eventMutex);
+    edgeEventListeners.erase(gpioId);
+    return RETURN_FAILED;
+  }
+  return RETURN_OK;
+}
+
+ReturnValue_t LinuxLibgpioIF::registerEdgeEventListener(gpioId_t gpioId,
+                                                        MessageQueueId_t queueId) {
+  MutexGuard mg(eventMutex);
+  auto listenerIter = edgeEventListeners.find(gpioId);
+  if (listenerIter == edgeEventListeners.end()) {
+    return NO_EDGE_DETECTION;
+  }
+  listenerIter->second.queueId = queueId;
+  return RETURN_OK;
+}
+
+ReturnValue_t LinuxLibgpioIF::registerEdgeEventListener(gpioId_t gpioId, SemaphoreIF* semaphore) {
+  MutexGuard mg(eventMutex);
+  auto listenerIter = edgeEventListeners.find(gpioId);
+  if (listenerIter == edgeEventListeners.end()) {
+    return NO_EDGE_DETECTION;
+  }
+  listenerIter->second.semaphore = semaphore;
+  return RETURN_OK;
+}
+
+ReturnValue_t LinuxLibgpioIF::getLastEdgeEvent(gpioId_t gpioId, gpio::EdgeEvent* event,
+                                               uint32_t* eventCount) {
+  if (event == nullptr) {
+    return RETURN_FAILED;
+  }
+  MutexGuard mg(eventMutex);
+  auto listenerIter = edgeEventListeners.find(gpioId);
+  if (listenerIter == edgeEventListeners.end()) {
+    return NO_EDGE_DETECTION;
+  }
+  *event = listenerIter->second.lastEvent;
+  if (eventCount != nullptr) {
+    *eventCount = listenerIter->second.eventCount;
+  }
+  return RETURN_OK;
+}
+
+ReturnValue_t LinuxLibgpioIF::performOperation(uint8_t opCode) {
+  struct epoll_event events[MAX_EPOLL_EVENTS];
+  while (not eventLoopStopped) {
+    int readyFds = epoll_wait(epollFd, events, MAX_EPOLL_EVENTS, -1);
+    if (readyFds < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+      sif::warning << "LinuxLibgpioIF::performOperation: epoll_wait failed with code " << errno
+                   << ": " << strerror(errno) << std::endl;
+#else
+      sif::printWarning("LinuxLibgpioIF::performOperation: epoll_wait failed with code %d: %s\n",
+                        errno, strerror(errno));
+#endif
+#endif
+      return RETURN_FAILED;
+    }
+    for (int idx = 0; idx < readyFds; idx++) {
+      // The stop event file descriptor has no listener assigned
+      if (events[idx].data.ptr != nullptr) {
+        handleEdgeEvent(*static_cast<EdgeEventListener*>(events[idx].data.ptr));
+      }
+    }
+  }
+  return RETURN_OK;
+}
+
+void LinuxLibgpioIF::stopEventLoop() {
+  eventLoopStopped = true;
+  uint64_t wakeUp = 1;
+  if (write(stopEventFd, &wakeUp, sizeof(wakeUp)) != sizeof(wakeUp)) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "LinuxLibgpioIF::stopEventLoop: Waking up event loop failed" << std::endl;
+#endif
+  }
+}
+
+void LinuxLibgpioIF::handleEdgeEvent(EdgeEventListener& listener) {
+  struct gpiod_line_event lineEvent;
+  if (gpiod_line_event_read_fd(listener.fileDescriptor, &lineEvent) != 0) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "LinuxLibgpioIF::handleEdgeEvent: Reading event of GPIO " << listener.gpioId
+                 << " failed" << std::endl;
+#else
+    sif::printWarning("LinuxLibgpioIF::handleEdgeEvent: Reading event of GPIO %d failed\n",
+                      listener.gpioId);
+#endif
+#endif
+    return;
+  }
+  gpio::EdgeEvent event;
+  event.gpioId = listener.gpioId;
+  if (lineEvent.event_type == GPIOD_LINE_EVENT_RISING_EDGE) {
+    event.level = gpio::Levels::HIGH;
+  } else {
+    event.level = gpio::Levels::LOW;
+  }
+  event.timestamp = lineEvent.ts;
+
+  MessageQueueId_t queueId = MessageQueueIF::NO_QUEUE;
+  SemaphoreIF* semaphore = nullptr;
+  {
+    MutexGuard mg(eventMutex);
+    listener.lastEvent = event;
+    listener.eventCount++;
+    queueId = listener.queueId;
+    semaphore = listener.semaphore;
+  }
+  if (queueId != MessageQueueIF::NO_QUEUE) {
+    CommandMessage message;
+    GpioMessage::setEdgeEvent(&message, event);
+    // A full queue of the listener must not stop the event loop
+    MessageQueueSenderIF::sendMessage(queueId, &message, MessageQueueIF::NO_QUEUE, true);
+  }
+  if (semaphore != nullptr) {
+    semaphore->release();
+  }
+}
+
 ReturnValue_t LinuxLibgpioIF::pullHigh(gpioId_t gpioId) {
   gpioMapIter = gpioMap.find(gpioId);
   if (gpioMapIter == gpioMap.end()) {
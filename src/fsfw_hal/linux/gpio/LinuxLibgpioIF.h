@@ -1,8 +1,15 @@
 #ifndef LINUX_GPIO_LINUXLIBGPIOIF_H_
 #define LINUX_GPIO_LINUXLIBGPIOIF_H_
 
+#include <atomic>
+#include <unordered_map>
+
+#include "fsfw/ipc/MessageQueueIF.h"
+#include "fsfw/ipc/MutexIF.h"
 #include "fsfw/objectmanager/SystemObject.h"
 #include "fsfw/returnvalues/FwClassIds.h"
+#include "fsfw/tasks/ExecutableObjectIF.h"
+#include "fsfw/tasks/SemaphoreIF.h"
 #include "fsfw_hal/common/gpio/GpioIF.h"
 
 class GpioCookie;
@@ -12,10 +19,16 @@ class GpiodRegularIF;
  * @brief	This class implements the GpioIF for a linux based system.
  * @details
  * This implementation is based on the libgpiod lib which requires Linux 4.8 or higher.
+ *
+ * Input GPIOs with GpiodRegularBase::edgeDetection set are requested as libgpiod line events.
+ * Their event file descriptors are monitored with epoll in #performOperation, which requires
+ * the LinuxLibgpioIF to be scheduled in a dedicated task. Each edge is forwarded to the
+ * listener registered with #registerEdgeEventListener as a GpioMessage::EDGE_EVENT message or
+ * by releasing a semaphore, so device handlers do not need to poll the line level.
  * @note
  * The Petalinux SDK from Xilinx supports libgpiod since Petalinux 2019.1.
  */
-class LinuxLibgpioIF : public GpioIF, public SystemObject {
+class LinuxLibgpioIF : public GpioIF, public SystemObject, public ExecutableObjectIF {
  public:
   static const uint8_t gpioRetvalId = CLASS_ID::HAL_GPIO;
 
@@ -31,6 +44,11 @@ class LinuxLibgpioIF : public GpioIF, public SystemObject {
       HasReturnvaluesIF::makeReturnCode(gpioRetvalId, 5);
   static constexpr ReturnValue_t GPIO_INIT_FAILED =
       HasReturnvaluesIF::makeReturnCode(gpioRetvalId, 6);
+  //! The GPIO was not configured with edge detection
+  static constexpr ReturnValue_t NO_EDGE_DETECTION =
+      HasReturnvaluesIF::makeReturnCode(gpioRetvalId, 7);
+
+  static constexpr int MAX_EPOLL_EVENTS = 16;
 
   LinuxLibgpioIF(object_id_t objectId);
   virtual ~LinuxLibgpioIF();
@@ -40,7 +58,48 @@ class LinuxLibgpioIF : public GpioIF, public SystemObject {
   ReturnValue_t pullLow(gpioId_t gpioId) override;
   ReturnValue_t readGpio(gpioId_t gpioId, int* gpioState) override;
 
+  /**
+   * @brief   Sends a GpioMessage::EDGE_EVENT message to the given queue for each edge of the
+   *          GPIO. Pass MessageQueueIF::NO_QUEUE to remove the queue listener.
+   * @return  NO_EDGE_DETECTION if the GPIO was not added with edge detection
+   */
+  ReturnValue_t registerEdgeEventListener(gpioId_t gpioId, MessageQueueId_t queueId);
+  /**
+   * @brief   Releases the given semaphore for each edge of the GPIO. The event itself can be
+   *          retrieved with #getLastEdgeEvent. Pass nullptr to remove the semaphore listener.
+   * @return  NO_EDGE_DETECTION if the GPIO was not added with edge detection
+   */
+  ReturnValue_t registerEdgeEventListener(gpioId_t gpioId, SemaphoreIF* semaphore);
+
+  /**
+   * @brief   Retrieves the most recent edge event of a GPIO.
+   * @param eventCount    Optional, number of edges received since the GPIO was added
+   */
+  ReturnValue_t getLastEdgeEvent(gpioId_t gpioId, gpio::EdgeEvent* event,
+                                 uint32_t* eventCount = nullptr);
+
+  /**
+   * @brief   Event loop for all GPIOs with edge detection. This function blocks until
+   *          #stopEventLoop is called.
+   */
+  ReturnValue_t performOperation(uint8_t opCode) override;
+
+  /**
+   * @brief   Stops the event loop. The loop can not be restarted afterwards.
+   */
+  void stopEventLoop();
+
  private:
+  struct EdgeEventListener {
+    gpioId_t gpioId = gpio::NO_GPIO;
+    //! Event file descriptor of the requested line, owned by libgpiod
+    int fileDescriptor = -1;
+    MessageQueueId_t queueId = MessageQueueIF::NO_QUEUE;
+    SemaphoreIF* semaphore = nullptr;
+    gpio::EdgeEvent lastEvent;
+    uint32_t eventCount = 0;
+  };
+
   static const size_t MAX_CHIPNAME_LENGTH = 11;
   static const int LINE_NOT_EXISTS = 0;
   static const int LINE_ERROR = -1;
@@ -50,6 +109,16 @@ class LinuxLibgpioIF : public GpioIF, public SystemObject {
   GpioUnorderedMap gpioMap;
   GpioUnorderedMapIter gpioMapIter;
 
+  //! Listeners of all GPIOs with edge detection. Elements are never removed, so the epoll
+  //! events can point to them.
+  std::unordered_map<gpioId_t, EdgeEventListener> edgeEventListeners;
+  //! Protects the listener targets and the last events which are accessed by the event loop
+  MutexIF* eventMutex = nullptr;
+  int epollFd = -1;
+  /** Used to wake up the event loop when it is stopped */
+  int stopEventFd = -1;
+  std::atomic<bool> eventLoopStopped{false};
+
   /**
    * @brief	This functions drives line of a GPIO specified by the GPIO ID.
    *
@@ -63,6 +132,10 @@ class LinuxLibgpioIF : public GpioIF, public SystemObject {
   ReturnValue_t configureGpioByLineName(gpioId_t gpioId, GpiodRegularByLineName& gpioByLineName);
   ReturnValue_t configureRegularGpio(gpioId_t gpioId, struct gpiod_chip* chip,
                                      GpiodRegularBase& regularGpio, std::string failOutput);
+  ReturnValue_t requestEdgeEvents(gpioId_t gpioId, struct gpiod_line* lineHandle,
+                                  GpiodRegularBase& regularGpio);
+  ReturnValue_t addEdgeEventListener(gpioId_t gpioId, struct gpiod_line* lineHandle);
+  void handleEdgeEvent(EdgeEventListener& listener);
 
   /**
    * @brief	This function checks if GPIOs are already registered and whether
@@ -98,6 +98,26 @@ ReturnValue_t I2cComIF::sendMessage(CookieIF* cookie, const uint8_t* sendData, s
     return HasReturnvaluesIF::RETURN_FAILED;
   }
 
+  I2cInstance& instance = i2cDeviceMapIter->second;
+  if (instance.transferQueued) {
+    // Keep the order of the transfers of this device
+    flushTransferQueue();
+  }
+  if (i2cCookie->isCombinedTransfer()) {
+    if (instance.writePending) {
+      // The previous write was not followed by a read request
+      instance.requestLen = 0;
+      performCombinedTransfer(i2cCookie, instance);
+    }
+    if (instance.sendBuffer.size() < sendLen) {
+      instance.sendBuffer.resize(sendLen);
+    }
+    std::memcpy(instance.sendBuffer.data(), sendData, sendLen);
+    instance.sendLen = sendLen;
+    instance.writePending = true;
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+
   deviceFile = i2cCookie->getDeviceFile();
   UnixFileGuard fileHelper(deviceFile, &fd, O_RDWR, "I2cComIF::sendMessage");
   if (fileHelper.getOpenResult() != HasReturnvaluesIF::RETURN_OK) {
@@ -131,11 +151,11 @@ ReturnValue_t I2cComIF::requestReceiveMessage(CookieIF* cookie, size_t requestLe
   int fd;
   std::string deviceFile;
 
-  if (requestLen == 0) {
+  I2cCookie* i2cCookie = dynamic_cast<I2cCookie*>(cookie);
+  if (requestLen == 0 and (i2cCookie == nullptr or not i2cCookie->isCombinedTransfer())) {
     return HasReturnvaluesIF::RETURN_OK;
   }
 
-  I2cCookie* i2cCookie = dynamic_cast<I2cCookie*>(cookie);
   if (i2cCookie == nullptr) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::error << "I2cComIF::requestReceiveMessage: Invalid I2C Cookie!" << std::endl;
@@ -155,6 +175,31 @@ ReturnValue_t I2cComIF::requestReceiveMessage(CookieIF* cookie, size_t requestLe
     return HasReturnvaluesIF::RETURN_FAILED;
   }
 
+  I2cInstance& instance = i2cDeviceMapIter->second;
+  if (transferQueueEnabled or i2cCookie->isCombinedTransfer()) {
+    if (requestLen > instance.replyBuffer.size()) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+      sif::warning << "I2cComIF::requestReceiveMessage: Requested length " << requestLen
+                   << " larger than maximum reply length" << std::endl;
+#else
+      sif::printWarning(
+          "I2cComIF::requestReceiveMessage: Requested length %zu larger than maximum reply "
+          "length\n",
+          requestLen);
+#endif
+#endif
+      instance.replyLen = 0;
+      return HasReturnvaluesIF::RETURN_FAILED;
+    }
+    instance.requestLen = requestLen;
+    instance.replyLen = 0;
+    if (transferQueueEnabled) {
+      return queueTransfer(i2cCookie, instance);
+    }
+    return performCombinedTransfer(i2cCookie, instance);
+  }
+
   deviceFile = i2cCookie->getDeviceFile();
   UnixFileGuard fileHelper(deviceFile, &fd, O_RDWR, "I2cComIF::requestReceiveMessage");
   if (fileHelper.getOpenResult() != HasReturnvaluesIF::RETURN_OK) {
@@ -212,10 +257,16 @@ ReturnValue_t I2cComIF::readReceivedMessage(CookieIF* cookie, uint8_t** buffer,
 #endif
     return HasReturnvaluesIF::RETURN_FAILED;
   }
-  *buffer = i2cDeviceMapIter->second.replyBuffer.data();
-  *size = i2cDeviceMapIter->second.replyLen;
+  I2cInstance& instance = i2cDeviceMapIter->second;
+  if (instance.transferQueued) {
+    flushTransferQueue();
+  }
+  *buffer = instance.replyBuffer.data();
+  *size = instance.replyLen;
 
-  return HasReturnvaluesIF::RETURN_OK;
+  ReturnValue_t result = instance.queuedTransferResult;
+  instance.queuedTransferResult = HasReturnvaluesIF::RETURN_OK;
+  return result;
 }
 
 ReturnValue_t I2cComIF::openDevice(std::string deviceFile, address_t i2cAddress,
@@ -235,3 +286,212 @@ ReturnValue_t I2cComIF::openDevice(std::string deviceFile, address_t i2cAddress,
   }
   return HasReturnvaluesIF::RETURN_OK;
 }
+
+void I2cComIF::setTransferQueueMode(bool enable, size_t maxQueuedTransfers) {
+  if (transferQueueEnabled and not enable) {
+    flushTransferQueue();
+  }
+  if (maxQueuedTransfers == 0) {
+    maxQueuedTransfers = 1;
+  }
+  transferQueueEnabled = enable;
+  this->maxQueuedTransfers = maxQueuedTransfers;
+  transferQueue.reserve(maxQueuedTransfers);
+  batchCookies.reserve(maxQueuedTransfers);
+  batchMessages.reserve(I2C_RDWR_IOCTL_MAX_MSGS);
+}
+
+ReturnValue_t I2cComIF::flushTransferQueue() {
+  ReturnValue_t status = HasReturnvaluesIF::RETURN_OK;
+  for (size_t idx = 0; idx < transferQueue.size(); idx++) {
+    if (transferQueue[idx] == nullptr) {
+      continue;
+    }
+    ReturnValue_t result = flushBusTransfers(idx);
+    if (result != HasReturnvaluesIF::RETURN_OK and status == HasReturnvaluesIF::RETURN_OK) {
+      status = result;
+    }
+  }
+  transferQueue.clear();
+  return status;
+}
+
+size_t I2cComIF::getQueuedTransfers() const { return transferQueue.size(); }
+
+void I2cComIF::getTransferStatistics(TransferStatistics& statistics) const {
+  statistics = this->statistics;
+}
+
+void I2cComIF::resetTransferStatistics() { statistics = TransferStatistics(); }
+
+ReturnValue_t I2cComIF::queueTransfer(I2cCookie* i2cCookie, I2cInstance& instance) {
+  instance.queuedTransferResult = HasReturnvaluesIF::RETURN_OK;
+  if (not instance.writePending and instance.requestLen == 0) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  if (not instance.transferQueued) {
+    instance.transferQueued = true;
+    transferQueue.push_back(i2cCookie);
+  }
+  if (transferQueue.size() >= maxQueuedTransfers) {
+    // The results of the flushed transfers are reported with readReceivedMessage
+    flushTransferQueue();
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t I2cComIF::performCombinedTransfer(I2cCookie* i2cCookie, I2cInstance& instance) {
+  int fd = 0;
+  UnixFileGuard fileHelper(i2cCookie->getDeviceFile(), &fd, O_RDWR,
+                           "I2cComIF::performCombinedTransfer");
+  ReturnValue_t result = fileHelper.getOpenResult();
+  if (result == HasReturnvaluesIF::RETURN_OK) {
+    batchMessages.clear();
+    size_t numberOfMessages = addTransferMessages(i2cCookie, instance);
+    result = submitMessages(fd, batchMessages.data(), numberOfMessages);
+    batchMessages.clear();
+  }
+  finishTransfer(instance, result);
+  return result;
+}
+
+ReturnValue_t I2cComIF::flushBusTransfers(size_t firstIdx) {
+  std::string deviceFile = transferQueue[firstIdx]->getDeviceFile();
+  int fd = 0;
+  UnixFileGuard fileHelper(deviceFile, &fd, O_RDWR, "I2cComIF::flushTransferQueue");
+  ReturnValue_t openResult = fileHelper.getOpenResult();
+
+  ReturnValue_t status = openResult;
+  batchMessages.clear();
+  batchCookies.clear();
+  for (size_t idx = firstIdx; idx < transferQueue.size(); idx++) {
+    I2cCookie* i2cCookie = transferQueue[idx];
+    if (i2cCookie == nullptr or i2cCookie->getDeviceFile() != deviceFile) {
+      continue;
+    }
+    transferQueue[idx] = nullptr;
+    auto iter = i2cDeviceMap.find(i2cCookie->getAddress());
+    if (iter == i2cDeviceMap.end()) {
+      continue;
+    }
+    if (openResult != HasReturnvaluesIF::RETURN_OK) {
+      iter->second.queuedTransferResult = openResult;
+      finishTransfer(iter->second, openResult);
+      continue;
+    }
+    // Each transfer consists of up to two messages
+    if (batchMessages.size() + 2 > I2C_RDWR_IOCTL_MAX_MSGS) {
+      ReturnValue_t result = submitBatch(fd);
+      if (result != HasReturnvaluesIF::RETURN_OK and status == HasReturnvaluesIF::RETURN_OK) {
+        status = result;
+      }
+    }
+    addTransferMessages(i2cCookie, iter->second);
+    batchCookies.push_back(i2cCookie);
+  }
+  ReturnValue_t result = submitBatch(fd);
+  if (result != HasReturnvaluesIF::RETURN_OK and status == HasReturnvaluesIF::RETURN_OK) {
+    status = result;
+  }
+  return status;
+}
+
+ReturnValue_t I2cComIF::submitBatch(int fileDescriptor) {
+  if (batchCookies.empty()) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  ReturnValue_t status =
+      submitMessages(fileDescriptor, batchMessages.data(), batchMessages.size());
+  if (status != HasReturnvaluesIF::RETURN_OK and batchCookies.size() > 1) {
+    // The driver does not report how many messages were performed before the failure, so all
+    // transfers are repeated one by one and only the failing devices report an error
+    status = HasReturnvaluesIF::RETURN_OK;
+    size_t messageIdx = 0;
+    for (I2cCookie* i2cCookie : batchCookies) {
+      I2cInstance& instance = i2cDeviceMap.find(i2cCookie->getAddress())->second;
+      size_t numberOfMessages = (instance.writePending ? 1 : 0) + (instance.requestLen > 0 ? 1 : 0);
+      ReturnValue_t result =
+          submitMessages(fileDescriptor, &batchMessages[messageIdx], numberOfMessages);
+      messageIdx += numberOfMessages;
+      instance.queuedTransferResult = result;
+      finishTransfer(instance, result);
+      if (result != HasReturnvaluesIF::RETURN_OK and status == HasReturnvaluesIF::RETURN_OK) {
+        status = result;
+      }
+    }
+  } else {
+    for (I2cCookie* i2cCookie : batchCookies) {
+      I2cInstance& instance = i2cDeviceMap.find(i2cCookie->getAddress())->second;
+      instance.queuedTransferResult = status;
+      finishTransfer(instance, status);
+    }
+  }
+  batchMessages.clear();
+  batchCookies.clear();
+  return status;
+}
+
+ReturnValue_t I2cComIF::submitMessages(int fileDescriptor, i2c_msg* messages,
+                                       size_t numberOfMessages) {
+  if (numberOfMessages == 0) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  i2c_rdwr_ioctl_data transfer = {};
+  transfer.msgs = messages;
+  transfer.nmsgs = numberOfMessages;
+  statistics.driverCalls++;
+  if (ioctl(fileDescriptor, I2C_RDWR, &transfer) != static_cast<int>(numberOfMessages)) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "I2cComIF::submitMessages: I2C_RDWR transfer failed with error code "
+                 << errno << ". Error description: " << strerror(errno) << std::endl;
+#else
+    sif::printWarning(
+        "I2cComIF::submitMessages: I2C_RDWR transfer failed with error code %d. "
+        "Error description: %s\n",
+        errno, strerror(errno));
+#endif
+#endif
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  for (size_t idx = 0; idx < numberOfMessages; idx++) {
+    statistics.bytes += messages[idx].len;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+size_t I2cComIF::addTransferMessages(I2cCookie* i2cCookie, I2cInstance& instance) {
+  size_t numberOfMessages = 0;
+  i2c_msg message = {};
+  message.addr = i2cCookie->getAddress();
+  if (instance.writePending) {
+    message.flags = 0;
+    message.len = instance.sendLen;
+    message.buf = instance.sendBuffer.data();
+    batchMessages.push_back(message);
+    numberOfMessages++;
+  }
+  if (instance.requestLen > 0) {
+    message.flags = I2C_M_RD;
+    message.len = instance.requestLen;
+    message.buf = instance.replyBuffer.data();
+    batchMessages.push_back(message);
+    numberOfMessages++;
+  }
+  return numberOfMessages;
+}
+
+void I2cComIF::finishTransfer(I2cInstance& instance, ReturnValue_t result) {
+  if (result == HasReturnvaluesIF::RETURN_OK) {
+    instance.replyLen = instance.requestLen;
+    statistics.transfers++;
+#if FSFW_HAL_I2C_WIRETAPPING == 1
+    sif::info << "I2C read bytes from combined transfer:" << std::endl;
+    arrayprinter::print(instance.replyBuffer.data(), instance.replyLen);
+#endif
+  } else {
+    instance.replyLen = 0;
+  }
+  instance.writePending = false;
+  instance.transferQueued = false;
+}
@@ -3,6 +3,7 @@
 
 #include <fsfw/devicehandlers/DeviceCommunicationIF.h>
 #include <fsfw/objectmanager/SystemObject.h>
+#include <linux/i2c.h>
 
 #include <unordered_map>
 #include <vector>
@@ -13,6 +14,20 @@
  * @brief 	This is the communication interface for I2C devices connected
  * 			to a system running a Linux OS.
  *
+ * @details
+ * Cookies with the combined transfer option (I2cCookie::setCombinedTransfer) perform the write
+ * of sendMessage and the read of requestReceiveMessage as one I2C_RDWR transfer.
+ *
+ * In the optional transfer queue mode, reads are not performed in requestReceiveMessage.
+ * Instead, the transfer is queued until #flushTransferQueue is called or until the reply of a
+ * queued transfer is read. All queued transfers on the same bus, including the pending writes
+ * of combined transfers, are then submitted with a single I2C_RDWR ioctl. If this batch
+ * transfer fails, the driver does not report which message failed, so all transfers of the
+ * batch are repeated one by one and only the failing devices report an error. Transfers which
+ * were already performed before the failure are performed a second time, including the writes
+ * of combined transfers, which is harmless for register addresses. This can be used to read all
+ * devices polled in the same polling sequence slot with one system call.
+ *
  * @note    The Xilinx Linux kernel might not support to read more than 255 bytes at once.
  *
  * @author 	J. Meier
@@ -29,10 +44,48 @@ class I2cComIF : public DeviceCommunicationIF, public SystemObject {
   ReturnValue_t requestReceiveMessage(CookieIF *cookie, size_t requestLen) override;
   ReturnValue_t readReceivedMessage(CookieIF *cookie, uint8_t **buffer, size_t *size) override;
 
+  static constexpr size_t DEFAULT_MAX_QUEUED_TRANSFERS = 16;
+
+  struct TransferStatistics {
+    //! Number of performed device transfers
+    uint32_t transfers = 0;
+    //! Number of driver calls used to perform the transfers
+    uint32_t driverCalls = 0;
+    uint64_t bytes = 0;
+  };
+
+  /**
+   * Enable or disable the transfer queue mode. Pending transfers are flushed when the mode
+   * is disabled.
+   * @param enable
+   * @param maxQueuedTransfers  The queue is flushed automatically once this number of transfers
+   *                            is pending.
+   */
+  void setTransferQueueMode(bool enable,
+                            size_t maxQueuedTransfers = DEFAULT_MAX_QUEUED_TRANSFERS);
+  /**
+   * Perform all queued transfers. This can be called by the user after the last read request
+   * of a polling sequence slot. Otherwise, the queue is flushed when the reply of a queued
+   * transfer is read.
+   * @return First error which occured, or RETURN_OK
+   */
+  ReturnValue_t flushTransferQueue();
+  size_t getQueuedTransfers() const;
+
+  void getTransferStatistics(TransferStatistics &statistics) const;
+  void resetTransferStatistics();
+
  private:
   struct I2cInstance {
     std::vector<uint8_t> replyBuffer;
     size_t replyLen;
+    //! Send data of a combined transfer which was not written yet
+    std::vector<uint8_t> sendBuffer = {};
+    size_t sendLen = 0;
+    bool writePending = false;
+    size_t requestLen = 0;
+    bool transferQueued = false;
+    ReturnValue_t queuedTransferResult = HasReturnvaluesIF::RETURN_OK;
   };
 
   using I2cDeviceMap = std::unordered_map<address_t, I2cInstance>;
@@ -43,6 +96,14 @@ class I2cComIF : public DeviceCommunicationIF, public SystemObject {
   I2cDeviceMap i2cDeviceMap;
   I2cDeviceMapIter i2cDeviceMapIter;
 
+  bool transferQueueEnabled = false;
+  size_t maxQueuedTransfers = DEFAULT_MAX_QUEUED_TRANSFERS;
+  std::vector<I2cCookie *> transferQueue;
+  std::vector<i2c_msg> batchMessages;
+  std::vector<I2cCookie *> batchCookies;
+
+  TransferStatistics statistics;
+
   /**
    * @brief	This function opens an I2C device and binds the opened file
    * 			to a specific I2C address.
@@ -52,6 +113,24 @@ class I2cComIF : public DeviceCommunicationIF, public SystemObject {
    * @return	RETURN_OK if successful, otherwise RETURN_FAILED.
    */
   ReturnValue_t openDevice(std::string deviceFile, address_t i2cAddress, int *fileDescriptor);
+
+  ReturnValue_t queueTransfer(I2cCookie *i2cCookie, I2cInstance &instance);
+  /**
+   * Performs the pending write and the read of a single device with one I2C_RDWR ioctl.
+   */
+  ReturnValue_t performCombinedTransfer(I2cCookie *i2cCookie, I2cInstance &instance);
+  ReturnValue_t flushBusTransfers(size_t firstIdx);
+  ReturnValue_t submitBatch(int fileDescriptor);
+  /**
+   * Performs the messages with one I2C_RDWR ioctl.
+   */
+  ReturnValue_t submitMessages(int fileDescriptor, i2c_msg *messages, size_t numberOfMessages);
+  /**
+   * Appends the messages of a device transfer.
+   * @return Number of appended messages
+   */
+  size_t addTransferMessages(I2cCookie *i2cCookie, I2cInstance &instance);
+  void finishTransfer(I2cInstance &instance, ReturnValue_t result);
 };
 
 #endif /* LINUX_I2C_I2COMIF_H_ */
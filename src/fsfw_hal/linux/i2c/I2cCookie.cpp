@@ -9,4 +9,8 @@ size_t I2cCookie::getMaxReplyLen() const { return maxReplyLen; }
 
 std::string I2cCookie::getDeviceFile() const { return deviceFile; }
 
+void I2cCookie::setCombinedTransfer(bool enable) { combinedTransfer = enable; }
+
+bool I2cCookie::isCombinedTransfer() const { return combinedTransfer; }
+
 I2cCookie::~I2cCookie() {}
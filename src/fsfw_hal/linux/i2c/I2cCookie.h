@@ -27,10 +27,22 @@ class I2cCookie : public CookieIF {
   size_t getMaxReplyLen() const;
   std::string getDeviceFile() const;
 
+  /**
+   * If enabled, the data passed to sendMessage is not written immediately. It is combined with
+   * the following read into a single I2C_RDWR transfer with a repeated start condition instead.
+   * This is what most register based devices expect when a register is read, and it avoids a
+   * separate system call and bus turnaround for the register address.
+   * A write which is not followed by a read is performed with the next requestReceiveMessage
+   * call, even if the requested length is zero.
+   */
+  void setCombinedTransfer(bool enable);
+  bool isCombinedTransfer() const;
+
  private:
   address_t i2cAddress = 0;
   size_t maxReplyLen = 0;
   std::string deviceFile;
+  bool combinedTransfer = false;
 };
 
 #endif /* LINUX_I2C_I2CCOOKIE_H_ */
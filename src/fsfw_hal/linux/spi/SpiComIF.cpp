@@ -3,6 +3,7 @@
 #include <fcntl.h>
 #include <fsfw/globalfunctions/arrayprinter.h>
 #include <fsfw/ipc/MutexFactory.h>
+#include <fsfw/ipc/MutexGuard.h>
 #include <linux/spi/spidev.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
@@ -28,6 +29,8 @@ SpiComIF::SpiComIF(object_id_t objectId, GpioIF* gpioComIF)
   }
 
   spiMutex = MutexFactory::instance()->createMutex();
+  statisticsMutex = MutexFactory::instance()->createMutex();
+  statisticsStart = std::chrono::steady_clock::now();
 }
 
 ReturnValue_t SpiComIF::initializeInterface(CookieIF* cookie) {
@@ -158,7 +161,11 @@ ReturnValue_t SpiComIF::sendMessage(CookieIF* cookie, const uint8_t* sendData, s
   }
 
   if (spiCookie->getComIfMode() == spi::SpiComIfModes::REGULAR) {
-    result = performRegularSendOperation(spiCookie, sendData, sendLen);
+    if (transferQueueEnabled and spiCookie->isFullDuplex()) {
+      result = queueTransfer(spiCookie, sendData, sendLen);
+    } else {
+      result = performRegularSendOperation(spiCookie, sendData, sendLen);
+    }
   } else if (spiCookie->getComIfMode() == spi::SpiComIfModes::CALLBACK) {
     spi::send_callback_function_t sendFunc = nullptr;
     void* funcArgs = nullptr;
@@ -226,7 +233,9 @@ ReturnValue_t SpiComIF::performRegularSendOperation(SpiCookie* spiCookie, const
   /* Execute transfer */
   if (fullDuplex) {
     /* Initiate a full duplex SPI transfer. */
+    auto start = std::chrono::steady_clock::now();
     retval = ioctl(fileDescriptor, SPI_IOC_MESSAGE(1), spiCookie->getTransferStructHandle());
+    addToStatistics(1, sendLen, start);
     if (retval < 0) {
       utility::handleIoctlError("SpiComIF::sendMessage: ioctl error.");
       result = FULL_DUPLEX_TRANSFER_FAILED;
@@ -236,7 +245,10 @@ ReturnValue_t SpiComIF::performRegularSendOperation(SpiCookie* spiCookie, const
 #endif /* FSFW_LINUX_SPI_WIRETAPPING == 1 */
   } else {
     /* We write with a blocking half-duplex transfer here */
-    if (write(fileDescriptor, sendData, sendLen) != static_cast<ssize_t>(sendLen)) {
+    auto start = std::chrono::steady_clock::now();
+    ssize_t writtenBytes = write(fileDescriptor, sendData, sendLen);
+    addToStatistics(1, sendLen, start);
+    if (writtenBytes != static_cast<ssize_t>(sendLen)) {
 #if FSFW_VERBOSE_LEVEL >= 1
 #if FSFW_CPP_OSTREAM_ENABLED == 1
       sif::warning << "SpiComIF::sendMessage: Half-Duplex write operation failed!" << std::endl;
@@ -270,7 +282,7 @@ ReturnValue_t SpiComIF::requestReceiveMessage(CookieIF* cookie, size_t requestLe
   }
 
   if (spiCookie->isFullDuplex()) {
-    return HasReturnvaluesIF::RETURN_OK;
+    return getQueuedTransferResult(spiCookie);
   }
 
   return performHalfDuplexReception(spiCookie);
@@ -304,7 +316,10 @@ ReturnValue_t SpiComIF::performHalfDuplexReception(SpiCookie* spiCookie) {
     gpioComIF->pullLow(gpioId);
   }
 
-  if (read(fileDescriptor, rxBuf, readSize) != static_cast<ssize_t>(readSize)) {
+  auto start = std::chrono::steady_clock::now();
+  ssize_t readBytes = read(fileDescriptor, rxBuf, readSize);
+  addToStatistics(1, readSize, start);
+  if (readBytes != static_cast<ssize_t>(readSize)) {
 #if FSFW_VERBOSE_LEVEL >= 1
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::warning << "SpiComIF::sendMessage: Half-Duplex read operation failed!" << std::endl;
@@ -410,3 +425,316 @@ void SpiComIF::setSpiSpeedAndMode(int spiFd, spi::SpiModes mode, uint32_t speed)
     utility::handleIoctlError("SpiComIF::setSpiSpeedAndMode: Updating SPI default clock failed");
   }
 }
+
+void SpiComIF::setTransferQueueMode(bool enable, size_t maxQueuedTransfers,
+                                    size_t maxBatchBytes) {
+  MutexGuard mg(spiMutex);
+  if (not enable) {
+    flushTransferQueueUnlocked();
+  }
+  if (maxQueuedTransfers == 0) {
+    maxQueuedTransfers = 1;
+  }
+  transferQueueEnabled = enable;
+  this->maxQueuedTransfers = maxQueuedTransfers;
+  this->maxBatchBytes = maxBatchBytes;
+  transferQueue.reserve(maxQueuedTransfers);
+  batchTransfers.reserve(maxQueuedTransfers);
+  batchInstances.reserve(maxQueuedTransfers);
+  batchCookies.reserve(maxQueuedTransfers);
+}
+
+ReturnValue_t SpiComIF::flushTransferQueue() {
+  ReturnValue_t result = lockSpiMutex("SpiComIF::flushTransferQueue");
+  if (result != RETURN_OK) {
+    return result;
+  }
+  ReturnValue_t status = flushTransferQueueUnlocked();
+  result = unlockSpiMutex("SpiComIF::flushTransferQueue");
+  if (result != RETURN_OK) {
+    return result;
+  }
+  return status;
+}
+
+size_t SpiComIF::getQueuedTransfers() const {
+  MutexGuard mg(spiMutex);
+  return transferQueue.size();
+}
+
+void SpiComIF::getTransferStatistics(TransferStatistics& statistics) const {
+  MutexGuard mg(statisticsMutex);
+  statistics = this->statistics;
+}
+
+float SpiComIF::getBusUtilization() const {
+  MutexGuard mg(statisticsMutex);
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - statisticsStart);
+  if (elapsed.count() <= 0) {
+    return 0.0;
+  }
+  return static_cast<float>(statistics.busyTimeUs) / static_cast<float>(elapsed.count());
+}
+
+void SpiComIF::resetTransferStatistics() {
+  MutexGuard mg(statisticsMutex);
+  statistics = TransferStatistics();
+  statisticsStart = std::chrono::steady_clock::now();
+}
+
+ReturnValue_t SpiComIF::lockSpiMutex(const char* context) {
+  ReturnValue_t result = spiMutex->lockMutex(timeoutType, timeoutMs);
+  if (result != RETURN_OK) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << context << ": Failed to lock mutex" << std::endl;
+#else
+    sif::printError("%s: Failed to lock mutex\n", context);
+#endif
+#endif
+  }
+  return result;
+}
+
+ReturnValue_t SpiComIF::unlockSpiMutex(const char* context) {
+  ReturnValue_t result = spiMutex->unlockMutex();
+  if (result != RETURN_OK) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << context << ": Failed to unlock mutex" << std::endl;
+#endif
+  }
+  return result;
+}
+
+ReturnValue_t SpiComIF::flushTransferQueueUnlocked() {
+  ReturnValue_t status = HasReturnvaluesIF::RETURN_OK;
+  for (size_t idx = 0; idx < transferQueue.size(); idx++) {
+    if (transferQueue[idx] == nullptr) {
+      continue;
+    }
+    ReturnValue_t result = flushDeviceTransfers(idx);
+    if (result != HasReturnvaluesIF::RETURN_OK and status == HasReturnvaluesIF::RETURN_OK) {
+      status = result;
+    }
+  }
+  transferQueue.clear();
+  return status;
+}
+
+ReturnValue_t SpiComIF::queueTransfer(SpiCookie* spiCookie, const uint8_t* sendData,
+                                      size_t sendLen) {
+  ReturnValue_t result = lockSpiMutex("SpiComIF::queueTransfer");
+  if (result != RETURN_OK) {
+    return result;
+  }
+  result = queueTransferUnlocked(spiCookie, sendData, sendLen);
+  ReturnValue_t unlockResult = unlockSpiMutex("SpiComIF::queueTransfer");
+  if (result == RETURN_OK) {
+    result = unlockResult;
+  }
+  return result;
+}
+
+ReturnValue_t SpiComIF::queueTransferUnlocked(SpiCookie* spiCookie, const uint8_t* sendData,
+                                              size_t sendLen) {
+  auto iter = spiDeviceMap.find(spiCookie->getSpiAddress());
+  if (iter == spiDeviceMap.end()) {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  SpiInstance& instance = iter->second;
+  if (instance.transferPending or transferQueue.size() >= maxQueuedTransfers) {
+    // The results of the flushed transfers are also reported with requestReceiveMessage.
+    // The new transfer is not queued if the bus failed, so the caller sees the error now.
+    ReturnValue_t result = flushTransferQueueUnlocked();
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+  }
+  if (instance.sendBuffer.size() < spiCookie->getMaxBufferSize()) {
+    instance.sendBuffer.resize(spiCookie->getMaxBufferSize());
+  }
+  if (sendLen > 0) {
+    std::memcpy(instance.sendBuffer.data(), sendData, sendLen);
+  }
+  spiCookie->assignReadBuffer(instance.replyBuffer.data());
+  spiCookie->assignWriteBuffer(instance.sendBuffer.data());
+  spiCookie->setTransferSize(sendLen);
+  instance.transferPending = true;
+  instance.queuedTransferResult = HasReturnvaluesIF::RETURN_OK;
+  transferQueue.push_back(spiCookie);
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t SpiComIF::getQueuedTransferResult(SpiCookie* spiCookie) {
+  auto iter = spiDeviceMap.find(spiCookie->getSpiAddress());
+  if (iter == spiDeviceMap.end()) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  ReturnValue_t result = lockSpiMutex("SpiComIF::requestReceiveMessage");
+  if (result != RETURN_OK) {
+    return result;
+  }
+  if (iter->second.transferPending) {
+    // The result of the own transfer is stored in the instance
+    flushTransferQueueUnlocked();
+  }
+  result = iter->second.queuedTransferResult;
+  iter->second.queuedTransferResult = HasReturnvaluesIF::RETURN_OK;
+  ReturnValue_t unlockResult = unlockSpiMutex("SpiComIF::requestReceiveMessage");
+  if (result == RETURN_OK) {
+    result = unlockResult;
+  }
+  return result;
+}
+
+ReturnValue_t SpiComIF::flushDeviceTransfers(size_t firstIdx) {
+  SpiCookie* firstCookie = transferQueue[firstIdx];
+  std::string device = firstCookie->getSpiDevice();
+  spi::SpiModes spiMode = spi::SpiModes::MODE_0;
+  uint32_t spiSpeed = 0;
+  firstCookie->getSpiParameters(spiMode, spiSpeed, nullptr);
+
+  int fileDescriptor = 0;
+  UnixFileGuard fileHelper(device, &fileDescriptor, O_RDWR, "SpiComIF::flushTransferQueue");
+  ReturnValue_t openResult = HasReturnvaluesIF::RETURN_OK;
+  if (fileHelper.getOpenResult() != HasReturnvaluesIF::RETURN_OK) {
+    openResult = OPENING_FILE_FAILED;
+  } else {
+    // Transfers with different speeds can be combined, the mode applies to the whole message
+    setSpiSpeedAndMode(fileDescriptor, spiMode, spiSpeed);
+  }
+
+  ReturnValue_t status = openResult;
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+  size_t batchBytes = 0;
+  for (size_t idx = firstIdx; idx < transferQueue.size(); idx++) {
+    SpiCookie* spiCookie = transferQueue[idx];
+    if (spiCookie == nullptr) {
+      continue;
+    }
+    spi::SpiModes cookieMode = spi::SpiModes::MODE_0;
+    uint32_t cookieSpeed = 0;
+    spiCookie->getSpiParameters(cookieMode, cookieSpeed, nullptr);
+    if (cookieMode != spiMode or spiCookie->getSpiDevice() != device) {
+      continue;
+    }
+    transferQueue[idx] = nullptr;
+    // The instance was checked when the transfer was queued
+    SpiInstance& instance = spiDeviceMap.find(spiCookie->getSpiAddress())->second;
+    instance.transferPending = false;
+    if (openResult != HasReturnvaluesIF::RETURN_OK) {
+      instance.queuedTransferResult = openResult;
+      continue;
+    }
+
+    if (spiCookie->getChipSelectPin() != gpio::NO_GPIO) {
+      // Submit the transfers before this one first to keep the order on the bus
+      result = submitBatch(fileDescriptor);
+      if (result != HasReturnvaluesIF::RETURN_OK) {
+        status = result;
+      }
+      batchBytes = 0;
+      instance.queuedTransferResult = performGpioCsTransfer(fileDescriptor, spiCookie);
+      if (instance.queuedTransferResult != HasReturnvaluesIF::RETURN_OK) {
+        status = instance.queuedTransferResult;
+      }
+      continue;
+    }
+
+    size_t transferLen = spiCookie->getCurrentTransferSize();
+    if (not batchTransfers.empty() and batchBytes + transferLen > maxBatchBytes) {
+      result = submitBatch(fileDescriptor);
+      if (result != HasReturnvaluesIF::RETURN_OK) {
+        status = result;
+      }
+      batchBytes = 0;
+    }
+    spi_ioc_transfer transfer = *spiCookie->getTransferStructHandle();
+    transfer.speed_hz = cookieSpeed;
+    // Deselect the device between the transfers
+    transfer.cs_change = 1;
+    batchTransfers.push_back(transfer);
+    batchInstances.push_back(&instance);
+    batchCookies.push_back(spiCookie);
+    batchBytes += transferLen;
+  }
+
+  result = submitBatch(fileDescriptor);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    status = result;
+  }
+  return status;
+}
+
+ReturnValue_t SpiComIF::submitBatch(int fileDescriptor) {
+  if (batchTransfers.empty()) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  size_t bytes = 0;
+  for (const auto& transfer : batchTransfers) {
+    bytes += transfer.len;
+  }
+  // cs_change on the last transfer would keep the device selected after the message
+  batchTransfers.back().cs_change = 0;
+
+  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
+  auto start = std::chrono::steady_clock::now();
+  int retval = ioctl(fileDescriptor, SPI_IOC_MESSAGE(batchTransfers.size()), batchTransfers.data());
+  addToStatistics(batchTransfers.size(), bytes, start);
+  if (retval < 0) {
+    utility::handleIoctlError("SpiComIF::flushTransferQueue: ioctl error.");
+    result = FULL_DUPLEX_TRANSFER_FAILED;
+  }
+  for (auto instance : batchInstances) {
+    instance->queuedTransferResult = result;
+  }
+#if FSFW_HAL_SPI_WIRETAPPING == 1
+  for (auto spiCookie : batchCookies) {
+    performSpiWiretapping(spiCookie);
+  }
+#endif /* FSFW_LINUX_SPI_WIRETAPPING == 1 */
+  batchTransfers.clear();
+  batchInstances.clear();
+  batchCookies.clear();
+  return result;
+}
+
+ReturnValue_t SpiComIF::performGpioCsTransfer(int fileDescriptor, SpiCookie* spiCookie) {
+  gpioId_t gpioId = spiCookie->getChipSelectPin();
+  ReturnValue_t result = gpioComIF->pullLow(gpioId);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "SpiComIF::flushTransferQueue: Pulling low CS pin failed" << std::endl;
+#else
+    sif::printWarning("SpiComIF::flushTransferQueue: Pulling low CS pin failed\n");
+#endif
+#endif
+    return result;
+  }
+  auto start = std::chrono::steady_clock::now();
+  int retval = ioctl(fileDescriptor, SPI_IOC_MESSAGE(1), spiCookie->getTransferStructHandle());
+  addToStatistics(1, spiCookie->getCurrentTransferSize(), start);
+  if (retval < 0) {
+    utility::handleIoctlError("SpiComIF::flushTransferQueue: ioctl error.");
+    result = FULL_DUPLEX_TRANSFER_FAILED;
+  }
+#if FSFW_HAL_SPI_WIRETAPPING == 1
+  performSpiWiretapping(spiCookie);
+#endif /* FSFW_LINUX_SPI_WIRETAPPING == 1 */
+  gpioComIF->pullHigh(gpioId);
+  return result;
+}
+
+void SpiComIF::addToStatistics(size_t transfers, size_t bytes,
+                               std::chrono::steady_clock::time_point start) {
+  auto busyTime = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  // Called with and without the bus mutex, so the statistics have their own mutex
+  MutexGuard mg(statisticsMutex);
+  statistics.transfers += transfers;
+  statistics.driverCalls++;
+  statistics.bytes += bytes;
+  statistics.busyTimeUs += busyTime.count();
+}
@@ -1,6 +1,7 @@
 #ifndef LINUX_SPI_SPICOMIF_H_
 #define LINUX_SPI_SPICOMIF_H_
 
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 
@@ -18,6 +19,15 @@ class SpiCookie;
  * @details
  * Right now, only full-duplex SPI is supported. Most device specific transfer properties
  * are contained in the SPI cookie.
+ *
+ * In the optional transfer queue mode, full-duplex transfers of cookies in the regular mode are
+ * not performed immediately. Instead, the send data is copied and the transfer is queued until
+ * #flushTransferQueue is called or until the reply of a queued transfer is requested. All
+ * queued transfers on the same SPI device with the same SPI mode and without a GPIO chip select
+ * are then submitted with a single SPI_IOC_MESSAGE(n) ioctl, using cs_change to deselect the
+ * device between the transfers. Transfers with a GPIO chip select are still performed one by
+ * one, but the bus mutex is only locked once per flush. This reduces the number of system calls
+ * when many devices are polled in the same polling sequence slot.
  * @author  R. Mueller
  */
 class SpiComIF : public DeviceCommunicationIF, public SystemObject {
@@ -32,6 +42,21 @@ class SpiComIF : public DeviceCommunicationIF, public SystemObject {
   static constexpr ReturnValue_t HALF_DUPLEX_TRANSFER_FAILED =
       HasReturnvaluesIF::makeReturnCode(spiRetvalId, 2);
 
+  //! Default limit for the sum of transfer lengths in one ioctl, which is the default buffer size
+  //! of the spidev driver.
+  static constexpr size_t DEFAULT_MAX_BATCH_BYTES = 4096;
+  static constexpr size_t DEFAULT_MAX_QUEUED_TRANSFERS = 16;
+
+  struct TransferStatistics {
+    //! Number of performed device transfers
+    uint32_t transfers = 0;
+    //! Number of driver calls used to perform the transfers
+    uint32_t driverCalls = 0;
+    uint64_t bytes = 0;
+    //! Time spent inside the driver calls in microseconds
+    uint64_t busyTimeUs = 0;
+  };
+
   SpiComIF(object_id_t objectId, GpioIF* gpioComIF);
 
   ReturnValue_t initializeInterface(CookieIF* cookie) override;
@@ -63,15 +88,54 @@ class SpiComIF : public DeviceCommunicationIF, public SystemObject {
 
   ReturnValue_t getReadBuffer(address_t spiAddress, uint8_t** buffer);
 
+  /**
+   * Enable or disable the transfer queue mode. Pending transfers are flushed when the mode
+   * is disabled.
+   * @param enable
+   * @param maxQueuedTransfers  The queue is flushed automatically once this number of transfers
+   *                            is pending.
+   * @param maxBatchBytes       Maximum sum of transfer lengths submitted with one ioctl call.
+   *                            Must not exceed the buffer size of the spidev driver.
+   */
+  void setTransferQueueMode(bool enable, size_t maxQueuedTransfers = DEFAULT_MAX_QUEUED_TRANSFERS,
+                            size_t maxBatchBytes = DEFAULT_MAX_BATCH_BYTES);
+  /**
+   * Perform all queued transfers. This can be called by the user after the last send
+   * operation of a polling sequence slot. Otherwise, the queue is flushed when the reply of
+   * a queued transfer is requested, or when a transfer is queued while the queue is full or
+   * while a transfer of the same device is still pending. If such an automatic flush fails,
+   * the new transfer is not queued and sendMessage returns the error.
+   *
+   * The queue is protected by the bus mutex, so device handlers in different tasks can share
+   * the com interface.
+   * @return First error which occured, or RETURN_OK
+   */
+  ReturnValue_t flushTransferQueue();
+  size_t getQueuedTransfers() const;
+
+  void getTransferStatistics(TransferStatistics& statistics) const;
+  /**
+   * @return Ratio of the time spent in driver calls to the time elapsed since the
+   * statistics were reset.
+   */
+  float getBusUtilization() const;
+  void resetTransferStatistics();
+
  private:
   struct SpiInstance {
     SpiInstance(size_t maxRecvSize) : replyBuffer(std::vector<uint8_t>(maxRecvSize)) {}
     std::vector<uint8_t> replyBuffer;
+    //! Copy of the send data of a queued transfer
+    std::vector<uint8_t> sendBuffer;
+    bool transferPending = false;
+    ReturnValue_t queuedTransferResult = HasReturnvaluesIF::RETURN_OK;
   };
 
   GpioIF* gpioComIF = nullptr;
 
   MutexIF* spiMutex = nullptr;
+  //! Protects the statistics, which are updated with and without the bus mutex
+  MutexIF* statisticsMutex = nullptr;
   MutexIF::TimeoutType timeoutType = MutexIF::TimeoutType::WAITING;
   uint32_t timeoutMs = 20;
   spi_ioc_transfer clockUpdateTransfer = {};
@@ -81,7 +145,31 @@ class SpiComIF : public DeviceCommunicationIF, public SystemObject {
 
   SpiDeviceMap spiDeviceMap;
 
+  bool transferQueueEnabled = false;
+  size_t maxBatchBytes = DEFAULT_MAX_BATCH_BYTES;
+  size_t maxQueuedTransfers = DEFAULT_MAX_QUEUED_TRANSFERS;
+  std::vector<SpiCookie*> transferQueue;
+  std::vector<spi_ioc_transfer> batchTransfers;
+  std::vector<SpiInstance*> batchInstances;
+  std::vector<SpiCookie*> batchCookies;
+
+  TransferStatistics statistics;
+  std::chrono::steady_clock::time_point statisticsStart;
+
   ReturnValue_t performHalfDuplexReception(SpiCookie* spiCookie);
+  ReturnValue_t lockSpiMutex(const char* context);
+  ReturnValue_t unlockSpiMutex(const char* context);
+  ReturnValue_t queueTransfer(SpiCookie* spiCookie, const uint8_t* sendData, size_t sendLen);
+  //! The functions with the Unlocked suffix expect the bus mutex to be locked by the caller
+  ReturnValue_t queueTransferUnlocked(SpiCookie* spiCookie, const uint8_t* sendData,
+                                      size_t sendLen);
+  ReturnValue_t getQueuedTransferResult(SpiCookie* spiCookie);
+  ReturnValue_t flushTransferQueueUnlocked();
+  ReturnValue_t flushDeviceTransfers(size_t firstIdx);
+  ReturnValue_t submitBatch(int fileDescriptor);
+  ReturnValue_t performGpioCsTransfer(int fileDescriptor, SpiCookie* spiCookie);
+  void addToStatistics(size_t transfers, size_t bytes,
+                       std::chrono::steady_clock::time_point start);
 };
 
 #endif /* LINUX_SPI_SPICOMIF_H_ */
@@ -2,18 +2,38 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
 #include <termios.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstring>
 
 #include "fsfw/FSFW.h"
 #include "fsfw/serviceinterface.h"
 #include "fsfw_hal/linux/utility.h"
 
-UartComIF::UartComIF(object_id_t objectId) : SystemObject(objectId) {}
+UartComIF::UartComIF(object_id_t objectId) : SystemObject(objectId) {
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  stopEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (epollFd >= 0 and stopEventFd >= 0) {
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = nullptr;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, stopEventFd, &event);
+  }
+}
 
-UartComIF::~UartComIF() {}
+UartComIF::~UartComIF() {
+  if (epollFd >= 0) {
+    close(epollFd);
+  }
+  if (stopEventFd >= 0) {
+    close(stopEventFd);
+  }
+}
 
 ReturnValue_t UartComIF::initializeInterface(CookieIF* cookie) {
   std::string deviceFile;
@@ -40,8 +60,14 @@ ReturnValue_t UartComIF::initializeInterface(CookieIF* cookie) {
       return RETURN_FAILED;
     }
     size_t maxReplyLen = uartCookie->getMaxReplyLen();
-    UartElements uartElements = {fileDescriptor, std::vector<uint8_t>(maxReplyLen), 0};
-    auto status = uartDeviceMap.emplace(deviceFile, uartElements);
+    UartElements uartElements = {fileDescriptor, {}, 0, nullptr};
+    if (uartCookie->getRingBufferSize() > 0) {
+      uartElements.ringBuffer = std::make_unique<RxRingBuffer>(
+          fileDescriptor, uartCookie->getRingBufferSize(), maxReplyLen);
+    } else {
+      uartElements.replyBuffer.resize(maxReplyLen);
+    }
+    auto status = uartDeviceMap.emplace(deviceFile, std::move(uartElements));
     if (status.second == false) {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
       sif::warning << "UartComIF::initializeInterface: Failed to insert device " << deviceFile
@@ -49,6 +75,9 @@ ReturnValue_t UartComIF::initializeInterface(CookieIF* cookie) {
 #endif
       return RETURN_FAILED;
     }
+    if (status.first->second.ringBuffer != nullptr) {
+      return addToReception(status.first->second);
+    }
   } else {
 #if FSFW_CPP_OSTREAM_ENABLED == 1
     sif::warning << "UartComIF::initializeInterface: UART device " << deviceFile
@@ -400,6 +429,11 @@ ReturnValue_t UartComIF::requestReceiveMessage(CookieIF* cookie, size_t requestL
     return RETURN_FAILED;
   }
 
+  if (uartDeviceMapIter->second.ringBuffer != nullptr) {
+    // Data is read by the reception loop
+    return RETURN_OK;
+  }
+
   if (uartMode == UartModes::CANONICAL) {
     return handleCanonicalRead(*uartCookie, uartDeviceMapIter, requestLen);
   } else if (uartMode == UartModes::NON_CANONICAL) {
@@ -523,6 +557,11 @@ ReturnValue_t UartComIF::readReceivedMessage(CookieIF* cookie, uint8_t** buffer,
     return RETURN_FAILED;
   }
 
+  if (uartDeviceMapIter->second.ringBuffer != nullptr) {
+    readFromRingBuffer(*uartDeviceMapIter->second.ringBuffer, buffer, size);
+    return RETURN_OK;
+  }
+
   *buffer = uartDeviceMapIter->second.replyBuffer.data();
   *size = uartDeviceMapIter->second.replyLen;
 
@@ -547,6 +586,12 @@ ReturnValue_t UartComIF::flushUartRxBuffer(CookieIF* cookie) {
   if (uartDeviceMapIter != uartDeviceMap.end()) {
     int fd = uartDeviceMapIter->second.fileDescriptor;
     tcflush(fd, TCIFLUSH);
+    RxRingBuffer* ringBuffer = uartDeviceMapIter->second.ringBuffer.get();
+    if (ringBuffer != nullptr) {
+      ringBuffer->readCount.store(ringBuffer->writeCount.load(std::memory_order_acquire),
+                                  std::memory_order_release);
+      ringBuffer->viewLen = 0;
+    }
     return RETURN_OK;
   }
   return RETURN_FAILED;
@@ -601,3 +646,132 @@ void UartComIF::setUartMode(struct termios* options, UartCookie& uartCookie) {
     options->c_lflag |= ICANON;
   }
 }
+
+ReturnValue_t UartComIF::performOperation(uint8_t opCode) {
+  struct epoll_event events[MAX_EPOLL_EVENTS];
+  while (not receptionStopped) {
+    int readyFds = epoll_wait(epollFd, events, MAX_EPOLL_EVENTS, -1);
+    if (readyFds < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+      sif::warning << "UartComIF::performOperation: epoll_wait failed with code " << errno << ": "
+                   << strerror(errno) << std::endl;
+#else
+      sif::printWarning("UartComIF::performOperation: epoll_wait failed with code %d: %s\n",
+                        errno, strerror(errno));
+#endif
+#endif
+      return RETURN_FAILED;
+    }
+    for (int idx = 0; idx < readyFds; idx++) {
+      // The stop event file descriptor has no ring buffer assigned
+      if (events[idx].data.ptr != nullptr) {
+        drainIntoRingBuffer(*static_cast<RxRingBuffer*>(events[idx].data.ptr));
+      }
+    }
+  }
+  return RETURN_OK;
+}
+
+void UartComIF::stopReception() {
+  receptionStopped = true;
+  uint64_t wakeUp = 1;
+  if (write(stopEventFd, &wakeUp, sizeof(wakeUp)) != sizeof(wakeUp)) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "UartComIF::stopReception: Waking up reception loop failed" << std::endl;
+#endif
+  }
+}
+
+size_t UartComIF::getDiscardedBytes(CookieIF* cookie) {
+  UartCookie* uartCookie = dynamic_cast<UartCookie*>(cookie);
+  if (uartCookie == nullptr) {
+    return 0;
+  }
+  UartDeviceMapIter uartDeviceMapIter = uartDeviceMap.find(uartCookie->getDeviceFile());
+  if (uartDeviceMapIter == uartDeviceMap.end() or
+      uartDeviceMapIter->second.ringBuffer == nullptr) {
+    return 0;
+  }
+  return uartDeviceMapIter->second.ringBuffer->discardedBytes;
+}
+
+ReturnValue_t UartComIF::addToReception(UartElements& uartElements) {
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.ptr = uartElements.ringBuffer.get();
+  if (epollFd < 0 or epoll_ctl(epollFd, EPOLL_CTL_ADD, uartElements.fileDescriptor, &event) != 0) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "UartComIF::initializeInterface: Adding device to reception failed with "
+                 << "error code " << errno << ": " << strerror(errno) << std::endl;
+#endif
+    return RETURN_FAILED;
+  }
+  return RETURN_OK;
+}
+
+void UartComIF::drainIntoRingBuffer(RxRingBuffer& ringBuffer) {
+  ssize_t bytesRead = 0;
+  size_t requested = 0;
+  do {
+    size_t writeCount = ringBuffer.writeCount.load(std::memory_order_relaxed);
+    size_t freeSpace =
+        ringBuffer.size - (writeCount - ringBuffer.readCount.load(std::memory_order_acquire));
+    if (freeSpace == 0) {
+      // The consumer does not keep up, the oldest data is kept
+      uint8_t discardBuffer[256];
+      requested = sizeof(discardBuffer);
+      bytesRead = read(ringBuffer.fileDescriptor, discardBuffer, requested);
+      if (bytesRead > 0) {
+        ringBuffer.discardedBytes += bytesRead;
+      }
+      continue;
+    }
+    // Fill the free space up to the end of the buffer and from the start in one call
+    size_t writeIdx = writeCount % ringBuffer.size;
+    size_t firstLen = std::min(freeSpace, ringBuffer.size - writeIdx);
+    struct iovec segments[2];
+    segments[0].iov_base = ringBuffer.buffer.data() + writeIdx;
+    segments[0].iov_len = firstLen;
+    segments[1].iov_base = ringBuffer.buffer.data();
+    segments[1].iov_len = freeSpace - firstLen;
+    requested = freeSpace;
+    bytesRead = readv(ringBuffer.fileDescriptor, segments, segments[1].iov_len > 0 ? 2 : 1);
+    if (bytesRead > 0) {
+      ringBuffer.writeCount.store(writeCount + bytesRead, std::memory_order_release);
+    }
+  } while (bytesRead > 0 and static_cast<size_t>(bytesRead) == requested);
+  // EAGAIN only means that no more data is available in canonical mode
+  if (bytesRead < 0 and errno != EAGAIN) {
+#if FSFW_VERBOSE_LEVEL >= 1
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::warning << "UartComIF::drainIntoRingBuffer: read failed with code " << errno << ": "
+                 << strerror(errno) << std::endl;
+#else
+    sif::printWarning("UartComIF::drainIntoRingBuffer: read failed with code %d: %s\n", errno,
+                      strerror(errno));
+#endif
+#endif
+  }
+}
+
+void UartComIF::readFromRingBuffer(RxRingBuffer& ringBuffer, uint8_t** buffer, size_t* size) {
+  // The view returned in the last call is released now
+  size_t readCount = ringBuffer.readCount.load(std::memory_order_relaxed) + ringBuffer.viewLen;
+  ringBuffer.readCount.store(readCount, std::memory_order_release);
+  size_t available = ringBuffer.writeCount.load(std::memory_order_acquire) - readCount;
+  size_t viewLen = std::min(available, ringBuffer.maxViewLen);
+  size_t readIdx = readCount % ringBuffer.size;
+  if (readIdx + viewLen > ringBuffer.size) {
+    // Wrapped data is appended behind the end of the ring buffer. The producer does not write
+    // to the start of the buffer because that data was not read yet.
+    std::memcpy(ringBuffer.buffer.data() + ringBuffer.size, ringBuffer.buffer.data(),
+                readIdx + viewLen - ringBuffer.size);
+  }
+  *buffer = ringBuffer.buffer.data() + readIdx;
+  *size = viewLen;
+  ringBuffer.viewLen = viewLen;
+}
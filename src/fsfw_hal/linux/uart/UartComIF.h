@@ -3,7 +3,10 @@
 
 #include <fsfw/devicehandlers/DeviceCommunicationIF.h>
 #include <fsfw/objectmanager/SystemObject.h>
+#include <fsfw/tasks/ExecutableObjectIF.h>
 
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -16,9 +19,16 @@
  * @details The implementation follows the instructions from https://blog.mbedded.ninja/programming/
  *          operating-systems/linux/linux-serial-ports-using-c-cpp/#disabling-canonical-mode
  *
+ *          Devices can optionally use ring buffer reception, see
+ *          UartCookie::setRingBufferReception. The file descriptors of these devices are
+ *          monitored with epoll in #performOperation, which drains arriving data into a single
+ *          producer, single consumer ring buffer per device. The UartComIF has to be scheduled
+ *          in a dedicated task for this. The device handler then only reads from the ring buffer
+ *          without any copy or system call.
+ *
  * @author 	J. Meier
  */
-class UartComIF : public DeviceCommunicationIF, public SystemObject {
+class UartComIF : public DeviceCommunicationIF, public SystemObject, public ExecutableObjectIF {
  public:
   static constexpr uint8_t uartRetvalId = CLASS_ID::HAL_UART;
 
@@ -29,6 +39,8 @@ class UartComIF : public DeviceCommunicationIF, public SystemObject {
   static constexpr ReturnValue_t UART_RX_BUFFER_TOO_SMALL =
       HasReturnvaluesIF::makeReturnCode(uartRetvalId, 3);
 
+  static constexpr int MAX_EPOLL_EVENTS = 16;
+
   UartComIF(object_id_t objectId);
 
   virtual ~UartComIF();
@@ -54,14 +66,54 @@ class UartComIF : public DeviceCommunicationIF, public SystemObject {
    */
   ReturnValue_t flushUartTxAndRxBuf(CookieIF* cookie);
 
+  /**
+   * @brief   Reception loop for all devices using ring buffer reception. This function blocks
+   *          until #stopReception is called.
+   */
+  ReturnValue_t performOperation(uint8_t opCode) override;
+
+  /**
+   * @brief   Stops the reception loop. The reception can not be restarted afterwards.
+   */
+  void stopReception();
+
+  /**
+   * @return  Number of bytes discarded because the ring buffer of the device was full.
+   */
+  size_t getDiscardedBytes(CookieIF* cookie);
+
  private:
   using UartDeviceFile_t = std::string;
 
+  /**
+   * Single producer, single consumer ring buffer filled by the reception loop. The read and
+   * write counters increase monotonically. The area behind the ring buffer with the size of the
+   * maximum reply length is used to provide contiguous views of wrapped data.
+   */
+  struct RxRingBuffer {
+    RxRingBuffer(int fileDescriptor, size_t size, size_t maxReplyLen)
+        : fileDescriptor(fileDescriptor),
+          size(size),
+          maxViewLen(maxReplyLen),
+          buffer(size + maxReplyLen) {}
+    int fileDescriptor;
+    size_t size;
+    size_t maxViewLen;
+    std::vector<uint8_t> buffer;
+    std::atomic<size_t> writeCount{0};
+    std::atomic<size_t> readCount{0};
+    std::atomic<size_t> discardedBytes{0};
+    /** Length of the view returned by the last readReceivedMessage call */
+    size_t viewLen = 0;
+  };
+
   struct UartElements {
     int fileDescriptor;
     std::vector<uint8_t> replyBuffer;
     /** Number of bytes read will be written to this variable */
     size_t replyLen;
+    /** Only set if ring buffer reception is used */
+    std::unique_ptr<RxRingBuffer> ringBuffer;
   };
 
   using UartDeviceMap = std::unordered_map<UartDeviceFile_t, UartElements>;
@@ -72,6 +124,11 @@ class UartComIF : public DeviceCommunicationIF, public SystemObject {
    */
   UartDeviceMap uartDeviceMap;
 
+  int epollFd = -1;
+  /** Used to wake up the reception loop when it is stopped */
+  int stopEventFd = -1;
+  std::atomic<bool> receptionStopped{false};
+
   /**
    * @brief	This function opens and configures a uart device by using the information stored
    *          in the uart cookie.
@@ -116,6 +173,10 @@ class UartComIF : public DeviceCommunicationIF, public SystemObject {
                                     size_t requestLen);
   ReturnValue_t handleNoncanonicalRead(UartCookie& uartCookie, UartDeviceMapIter& iter,
                                        size_t requestLen);
+
+  ReturnValue_t addToReception(UartElements& uartElements);
+  void drainIntoRingBuffer(RxRingBuffer& ringBuffer);
+  void readFromRingBuffer(RxRingBuffer& ringBuffer, uint8_t** buffer, size_t* size);
 };
 
 #endif /* BSP_Q7S_COMIF_UARTCOMIF_H_ */
@@ -49,3 +49,9 @@ object_id_t UartCookie::getHandlerId() const { return this->handlerId; }
 void UartCookie::setNoFixedSizeReply() { replySizeFixed = false; }
 
 bool UartCookie::isReplySizeFixed() { return replySizeFixed; }
+
+void UartCookie::setRingBufferReception(size_t ringBufferSize) {
+  this->ringBufferSize = ringBufferSize;
+}
+
+size_t UartCookie::getRingBufferSize() const { return ringBufferSize; }
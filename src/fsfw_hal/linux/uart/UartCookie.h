@@ -125,6 +125,20 @@ class UartCookie : public CookieIF {
 
   bool isReplySizeFixed();
 
+  /**
+   * Calling this function enables the ring buffer reception. All data arriving at the UART is
+   * then read by the reception loop of the UartComIF into a ring buffer of the given size, and
+   * requestReceiveMessage does not perform any read calls. readReceivedMessage returns a view of
+   * up to the maximum reply length of the buffered data, which is valid until the next call.
+   * The UartComIF needs to be scheduled as an executable object in this case.
+   * @param ringBufferSize  Size of the ring buffer. Should be larger than the maximum reply length.
+   */
+  void setRingBufferReception(size_t ringBufferSize);
+  /**
+   * @return Size of the reception ring buffer, or 0 if ring buffer reception is disabled.
+   */
+  size_t getRingBufferSize() const;
+
  private:
   const object_id_t handlerId;
   std::string deviceFile;
@@ -137,6 +151,7 @@ class UartCookie : public CookieIF {
   uint8_t readCycles = 1;
   StopBits stopBits = StopBits::ONE_STOP_BIT;
   bool replySizeFixed = true;
+  size_t ringBufferSize = 0;
 };
 
 #endif
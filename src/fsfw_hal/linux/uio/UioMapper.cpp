@@ -1,8 +1,12 @@
 #include "UioMapper.h"
 
+#include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 
+#include <cstring>
+
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -15,22 +19,27 @@ const char UioMapper::SIZE_FILE_PATH[] = "/size";
 
 UioMapper::UioMapper(std::string uioFile, int mapNum) : uioFile(uioFile), mapNum(mapNum) {}
 
-UioMapper::~UioMapper() {}
+UioMapper::~UioMapper() {
+  // Mapped regions stay valid after the device file was closed
+  if (fd >= 0) {
+    close(fd);
+  }
+}
 
-ReturnValue_t UioMapper::getMappedAdress(uint32_t** address, Permissions permissions) {
-  ReturnValue_t result = HasReturnvaluesIF::RETURN_OK;
-  int fd = open(uioFile.c_str(), O_RDWR);
-  if (fd < 1) {
-#if FSFW_CPP_OSTREAM_ENABLED == 1
-    sif::error << "PtmeAxiConfig::initialize: Invalid UIO device file" << std::endl;
-#endif
-    return HasReturnvaluesIF::RETURN_FAILED;
+ReturnValue_t UioMapper::getMappedAdress(uint32_t** address, Permissions permissions,
+                                         size_t* mapSize) {
+  ReturnValue_t result = openDeviceFile();
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
   }
   size_t size = 0;
   result = getMapSize(&size);
   if (result != HasReturnvaluesIF::RETURN_OK) {
     return result;
   }
+  if (mapSize != nullptr) {
+    *mapSize = size;
+  }
   *address = static_cast<uint32_t*>(
       mmap(NULL, size, static_cast<int>(permissions), MAP_SHARED, fd, mapNum * getpagesize()));
 
@@ -44,6 +53,66 @@ ReturnValue_t UioMapper::getMappedAdress(uint32_t** address, Permissions permiss
   return HasReturnvaluesIF::RETURN_OK;
 }
 
+ReturnValue_t UioMapper::enableInterrupt() {
+  ReturnValue_t result = openDeviceFile();
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  uint32_t enable = 1;
+  if (write(fd, &enable, sizeof(enable)) != sizeof(enable)) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "UioMapper::enableInterrupt: Failed to enable interrupt of " << uioFile
+               << " with error code " << errno << ": " << strerror(errno) << std::endl;
+#endif
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t UioMapper::waitForInterrupt(int timeoutMs, uint32_t* interruptCount) {
+  ReturnValue_t result = openDeviceFile();
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  struct pollfd pollFd = {};
+  pollFd.fd = fd;
+  pollFd.events = POLLIN;
+  int ready = 0;
+  do {
+    ready = poll(&pollFd, 1, timeoutMs);
+  } while (ready < 0 and errno == EINTR);
+  if (ready == 0) {
+    return INTERRUPT_TIMEOUT;
+  }
+  // The driver returns the total interrupt count as a 32 bit value
+  uint32_t count = 0;
+  if (ready < 0 or read(fd, &count, sizeof(count)) != sizeof(count)) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "UioMapper::waitForInterrupt: Failed to wait for interrupt of " << uioFile
+               << " with error code " << errno << ": " << strerror(errno) << std::endl;
+#endif
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  if (interruptCount != nullptr) {
+    *interruptCount = count;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t UioMapper::openDeviceFile() {
+  if (fd >= 0) {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  fd = open(uioFile.c_str(), O_RDWR | O_CLOEXEC);
+  if (fd < 0) {
+#if FSFW_CPP_OSTREAM_ENABLED == 1
+    sif::error << "UioMapper::openDeviceFile: Invalid UIO device file " << uioFile << std::endl;
+#endif
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
 ReturnValue_t UioMapper::getMapSize(size_t* size) {
   std::stringstream namestream;
   namestream << UIO_PATH_PREFIX << uioFile.substr(5, std::string::npos) << MAP_SUBSTR << mapNum
@@ -5,16 +5,27 @@
 
 #include <string>
 
+#include "fsfw/returnvalues/FwClassIds.h"
 #include "fsfw/returnvalues/HasReturnvaluesIF.h"
 
 /**
  * @brief   Class to help opening uio device files and mapping the physical addresses into the user
  *          address space.
+ * @details
+ * The device file stays open until the mapper is destroyed, so it can also be used to wait for
+ * the interrupt of the UIO device. Use the UioRegisterMap for typed accesses to the mapped
+ * registers.
  *
  * @author  J. Meier
  */
 class UioMapper {
  public:
+  static constexpr uint8_t uioRetvalId = CLASS_ID::HAL_UIO;
+
+  //! No interrupt occurred within the timeout
+  static constexpr ReturnValue_t INTERRUPT_TIMEOUT =
+      HasReturnvaluesIF::makeReturnCode(uioRetvalId, 1);
+
   enum class Permissions : int {
     READ_ONLY = PROT_READ,
     WRITE_ONLY = PROT_WRITE,
@@ -35,8 +46,25 @@ class UioMapper {
    *
    * @address The mapped user space address
    * @permissions Specifies the read/write permissions of the address region
+   * @mapSize Optional, size of the mapped region in bytes
+   */
+  ReturnValue_t getMappedAdress(uint32_t** address, Permissions permissions,
+                                size_t* mapSize = nullptr);
+
+  /**
+   * @brief   (Re-)enables the interrupt of the UIO device. Most UIO drivers disable the
+   *          interrupt after it occurred, so this has to be called before each wait.
    */
-  ReturnValue_t getMappedAdress(uint32_t** address, Permissions permissions);
+  ReturnValue_t enableInterrupt();
+
+  /**
+   * @brief   Blocks until the interrupt of the UIO device occurred or the timeout expired.
+   *
+   * @param timeoutMs       Timeout in milliseconds, -1 to wait without a timeout
+   * @param interruptCount  Optional, total number of interrupts reported by the driver
+   * @return  INTERRUPT_TIMEOUT if no interrupt occurred within the timeout
+   */
+  ReturnValue_t waitForInterrupt(int timeoutMs, uint32_t* interruptCount = nullptr);
 
  private:
   static const char UIO_PATH_PREFIX[];
@@ -46,6 +74,9 @@ class UioMapper {
 
   std::string uioFile;
   int mapNum = 0;
+  int fd = -1;
+
+  ReturnValue_t openDeviceFile();
 
   /**
    * @brief   Reads the map size from the associated sysfs size file
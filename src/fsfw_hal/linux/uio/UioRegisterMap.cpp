@@ -0,0 +1,52 @@
+#include "UioRegisterMap.h"
+
+UioRegisterMap::UioRegisterMap(volatile void* baseAddress, size_t size)
+    : baseAddress(static_cast<volatile uint8_t*>(baseAddress)), size(size) {}
+
+ReturnValue_t UioRegisterMap::map(UioMapper& mapper, UioMapper::Permissions permissions) {
+  uint32_t* address = nullptr;
+  size_t mapSize = 0;
+  ReturnValue_t result = mapper.getMappedAdress(&address, permissions, &mapSize);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  baseAddress = reinterpret_cast<volatile uint8_t*>(address);
+  size = mapSize;
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t UioRegisterMap::readBlock(size_t offset, uint32_t* buffer, size_t count) const {
+  ReturnValue_t result = checkBlock(offset, count);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  const volatile uint32_t* source =
+      reinterpret_cast<const volatile uint32_t*>(baseAddress + offset);
+  for (size_t idx = 0; idx < count; idx++) {
+    buffer[idx] = source[idx];
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t UioRegisterMap::writeBlock(size_t offset, const uint32_t* data, size_t count) {
+  ReturnValue_t result = checkBlock(offset, count);
+  if (result != HasReturnvaluesIF::RETURN_OK) {
+    return result;
+  }
+  volatile uint32_t* destination = reinterpret_cast<volatile uint32_t*>(baseAddress + offset);
+  for (size_t idx = 0; idx < count; idx++) {
+    destination[idx] = data[idx];
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
+
+ReturnValue_t UioRegisterMap::checkBlock(size_t offset, size_t count) const {
+  if (baseAddress == nullptr) {
+    return NOT_MAPPED;
+  }
+  if (offset % sizeof(uint32_t) != 0 or offset > size or
+      count > (size - offset) / sizeof(uint32_t)) {
+    return OUT_OF_BOUNDS;
+  }
+  return HasReturnvaluesIF::RETURN_OK;
+}
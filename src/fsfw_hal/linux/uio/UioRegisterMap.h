@@ -0,0 +1,180 @@
+#ifndef FSFW_HAL_SRC_FSFW_HAL_LINUX_UIO_UIOREGISTERMAP_H_
+#define FSFW_HAL_SRC_FSFW_HAL_LINUX_UIO_UIOREGISTERMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "UioMapper.h"
+
+namespace uio {
+
+/**
+ * @brief   Compile-time descriptor of a register of a memory-mapped IP core.
+ * @tparam OFFSET   Byte offset of the register relative to the start of the mapped region
+ * @tparam T        Access width of the register
+ */
+template <size_t OFFSET, typename T = uint32_t>
+struct Register {
+  static_assert(std::is_same<T, uint8_t>::value or std::is_same<T, uint16_t>::value or
+                    std::is_same<T, uint32_t>::value,
+                "Registers must be accessed as 8, 16 or 32 bit unsigned integers");
+  static_assert(OFFSET % sizeof(T) == 0, "Register offset must be aligned to the access width");
+
+  using ValueType = T;
+  static constexpr size_t offset = OFFSET;
+};
+
+/**
+ * @brief   Compile-time descriptor of a bit field within a register.
+ * @tparam REGISTER The uio::Register containing the field
+ * @tparam SHIFT    Position of the least significant bit of the field
+ * @tparam WIDTH    Number of bits of the field
+ */
+template <typename REGISTER, unsigned SHIFT, unsigned WIDTH = 1>
+struct Field {
+  using RegisterType = REGISTER;
+  using ValueType = typename REGISTER::ValueType;
+  static_assert(WIDTH > 0 and SHIFT + WIDTH <= sizeof(ValueType) * 8,
+                "Field exceeds the register width");
+
+  static constexpr ValueType mask = static_cast<ValueType>(
+      (WIDTH == 32 ? 0xffffffffULL : ((1ULL << WIDTH) - 1)) << SHIFT);
+
+  static constexpr ValueType extract(ValueType registerValue) {
+    return static_cast<ValueType>((registerValue & mask) >> SHIFT);
+  }
+
+  static constexpr ValueType insert(ValueType registerValue, ValueType fieldValue) {
+    return static_cast<ValueType>((registerValue & ~mask) | ((fieldValue << SHIFT) & mask));
+  }
+};
+
+}  // namespace uio
+
+/**
+ * @brief   Typed access to the registers of a memory-mapped IP core, for example a region
+ *          mapped with the UioMapper.
+ * @details
+ * Registers and fields are described at compile time with uio::Register and uio::Field, so
+ * each access compiles to a single volatile load or store without any system call. This allows
+ * polling FPGA IP cores from a device communication interface with a low latency.
+ * Single register accesses are not bounds checked. Use #getSize to verify that the mapped
+ * region covers the register block of the IP core.
+ *
+ * Example:
+ * @code
+ * using Control = uio::Register<0x00>;
+ * using Enable = uio::Field<Control, 0>;
+ * using Status = uio::Register<0x04>;
+ * using FillLevel = uio::Field<Status, 8, 12>;
+ *
+ * registerMap.writeField<Enable>(1);
+ * uint32_t fillLevel = registerMap.readField<FillLevel>();
+ * @endcode
+ */
+class UioRegisterMap {
+ public:
+  static constexpr uint8_t uioRetvalId = CLASS_ID::HAL_UIO;
+
+  //! The register block exceeds the mapped region
+  static constexpr ReturnValue_t OUT_OF_BOUNDS =
+      HasReturnvaluesIF::makeReturnCode(uioRetvalId, 10);
+  //! The register map was not mapped yet
+  static constexpr ReturnValue_t NOT_MAPPED = HasReturnvaluesIF::makeReturnCode(uioRetvalId, 11);
+
+  UioRegisterMap() = default;
+  /**
+   * @param baseAddress   Start of the already mapped region
+   * @param size          Size of the mapped region in bytes
+   */
+  UioRegisterMap(volatile void* baseAddress, size_t size);
+
+  /**
+   * @brief   Maps the memory region of a UIO device
+   */
+  ReturnValue_t map(UioMapper& mapper, UioMapper::Permissions permissions);
+
+  bool isMapped() const { return baseAddress != nullptr; }
+  size_t getSize() const { return size; }
+
+  template <typename REGISTER>
+  typename REGISTER::ValueType read() const {
+    return *pointer<REGISTER>();
+  }
+
+  template <typename REGISTER>
+  void write(typename REGISTER::ValueType value) {
+    *pointer<REGISTER>() = value;
+  }
+
+  /**
+   * @brief   Read-modify-write access which clears and then sets the given bits
+   */
+  template <typename REGISTER>
+  void modify(typename REGISTER::ValueType clearMask, typename REGISTER::ValueType setMask) {
+    volatile typename REGISTER::ValueType* reg = pointer<REGISTER>();
+    *reg = static_cast<typename REGISTER::ValueType>((*reg & ~clearMask) | setMask);
+  }
+
+  template <typename FIELD>
+  typename FIELD::ValueType readField() const {
+    return FIELD::extract(read<typename FIELD::RegisterType>());
+  }
+
+  /**
+   * @brief   Read-modify-write access to a field. The other bits of the register are kept.
+   */
+  template <typename FIELD>
+  void writeField(typename FIELD::ValueType value) {
+    volatile typename FIELD::ValueType* reg = pointer<typename FIELD::RegisterType>();
+    *reg = FIELD::insert(*reg, value);
+  }
+
+  /**
+   * @brief   Reads a block of consecutive 32 bit registers.
+   * @details
+   * Each register is read with a separate 32 bit access in ascending order, because memcpy
+   * may use wider or unaligned accesses which are not supported by most IP cores.
+   *
+   * @param offset    Byte offset of the first register
+   * @param buffer    Buffer for the register values
+   * @param count     Number of registers to read
+   * @return  OUT_OF_BOUNDS if the block exceeds the mapped region
+   */
+  ReturnValue_t readBlock(size_t offset, uint32_t* buffer, size_t count) const;
+
+  /**
+   * @brief   Writes a block of consecutive 32 bit registers in ascending order.
+   * @return  OUT_OF_BOUNDS if the block exceeds the mapped region
+   */
+  ReturnValue_t writeBlock(size_t offset, const uint32_t* data, size_t count);
+
+  template <typename REGISTER>
+  ReturnValue_t readBlock(uint32_t* buffer, size_t count) const {
+    static_assert(std::is_same<typename REGISTER::ValueType, uint32_t>::value,
+                  "Block accesses require 32 bit registers");
+    return readBlock(REGISTER::offset, buffer, count);
+  }
+
+  template <typename REGISTER>
+  ReturnValue_t writeBlock(const uint32_t* data, size_t count) {
+    static_assert(std::is_same<typename REGISTER::ValueType, uint32_t>::value,
+                  "Block accesses require 32 bit registers");
+    return writeBlock(REGISTER::offset, data, count);
+  }
+
+ private:
+  volatile uint8_t* baseAddress = nullptr;
+  size_t size = 0;
+
+  template <typename REGISTER>
+  volatile typename REGISTER::ValueType* pointer() const {
+    return reinterpret_cast<volatile typename REGISTER::ValueType*>(baseAddress +
+                                                                     REGISTER::offset);
+  }
+
+  ReturnValue_t checkBlock(size_t offset, size_t count) const;
+};
+
+#endif /* FSFW_HAL_SRC_FSFW_HAL_LINUX_UIO_UIOREGISTERMAP_H_ */
@@ -56,8 +56,9 @@ void Factory::produceFrameworkObjects(void* args) {
 }
 
 void Factory::setStaticFrameworkObjectIds() {
-  PusServiceBase::packetSource = objects::NO_OBJECT;
-  PusServiceBase::packetDestination = objects::NO_OBJECT;
+  // The mocks only exist during the PUS service tests
+  PusServiceBase::packetSource = objects::PUS_DISTRIBUTOR_MOCK;
+  PusServiceBase::packetDestination = objects::TM_FUNNEL_MOCK;
 
   CommandingServiceBase::defaultPacketSource = objects::NO_OBJECT;
   CommandingServiceBase::defaultPacketDestination = objects::NO_OBJECT;
@@ -0,0 +1,114 @@
+#include <fsfw/coordinates/Jgm3Model.h>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+constexpr double J2 = 1.0826e-3;
+
+/**
+ * Unnormalized coefficients from pseudo-random normalized coefficients, so the terms of all
+ * degrees and orders have a similar magnitude.
+ */
+template <uint8_t DEGREE, uint8_t ORDER>
+void makeCoefficients(double S[ORDER + 1][DEGREE + 1], double C[ORDER + 1][DEGREE + 1]) {
+  uint32_t state = 12345;
+  auto next = [&state]() {
+    state = state * 1103515245 + 12345;
+    return static_cast<double>((state >> 8) & 0xffff) / 0x8000 - 1;
+  };
+  std::memset(S, 0, sizeof(double) * (ORDER + 1) * (DEGREE + 1));
+  std::memset(C, 0, sizeof(double) * (ORDER + 1) * (DEGREE + 1));
+  for (uint8_t n = 0; n < DEGREE + 1; n++) {
+    for (uint8_t m = 0; m <= n and m < ORDER + 1; m++) {
+      // sqrt((n - m)! / (n + m)!)
+      double normalization = 1;
+      for (uint8_t k = n - m + 1; k <= n + m; k++) {
+        normalization /= std::sqrt(static_cast<double>(k));
+      }
+      C[n][m] = 1e-6 * next() * normalization;
+      if (m > 0) {
+        S[n][m] = 1e-6 * next() * normalization;
+      }
+    }
+  }
+  C[0][0] = 1;
+  C[2][0] = -J2;
+}
+
+//! Positions in a low Earth orbit, in the polar regions and above the equator
+constexpr size_t NUMBER_OF_POSITIONS = 11;
+const double POSITIONS[NUMBER_OF_POSITIONS][3] = {
+    {6878137, 0, 0},
+    {0, 6878137, 0},
+    {0, 0, 6878137},
+    {-4210000, 3950000, 4120000},
+    {1200000, -6700000, 850000},
+    {4863516, 4863516, 0},
+    {-2000000, -2500000, -6100000},
+    {6500000, 1000000, -2000000},
+    {7000, -6900000, 500000},
+    {-6600000, 1500000, 1200000},
+    {3000000, 3000000, 5300000},
+};
+
+template <uint8_t DEGREE, uint8_t ORDER>
+void checkBatchEvaluation() {
+  static double S[ORDER + 1][DEGREE + 1];
+  static double C[ORDER + 1][DEGREE + 1];
+  makeCoefficients<DEGREE, ORDER>(S, C);
+  Jgm3Model<DEGREE, ORDER> model;
+
+  double singleAccels[NUMBER_OF_POSITIONS][3];
+  for (size_t idx = 0; idx < NUMBER_OF_POSITIONS; idx++) {
+    model.accelDegOrd(POSITIONS[idx], S, C, singleAccels[idx]);
+    for (uint8_t axis = 0; axis < 3; axis++) {
+      REQUIRE(std::isfinite(singleAccels[idx][axis]));
+    }
+    // Dominated by the central body
+    double r = VectorOperations<double>::norm<3>(POSITIONS[idx]);
+    double norm = VectorOperations<double>::norm<3>(singleAccels[idx]);
+    CHECK(norm == Catch::Approx(Earth::STANDARD_GRAVITATIONAL_PARAMETER / (r * r)).epsilon(0.01));
+  }
+  // The number of positions is not a multiple of the lanes, so the remainder is evaluated
+  // one by one
+  double batchAccels[NUMBER_OF_POSITIONS][3];
+  model.accelDegOrd(POSITIONS, NUMBER_OF_POSITIONS, S, C, batchAccels);
+  CHECK(std::memcmp(batchAccels, singleAccels, sizeof(batchAccels)) == 0);
+  model.template accelDegOrd<2>(POSITIONS, NUMBER_OF_POSITIONS, S, C, batchAccels);
+  CHECK(std::memcmp(batchAccels, singleAccels, sizeof(batchAccels)) == 0);
+}
+
+}  // namespace
+
+TEST_CASE("JGM3 Model Reference Acceleration", "[Jgm3Model]") {
+  // With only the central body and J2, the acceleration has a closed form
+  double S[9][9] = {};
+  double C[9][9] = {};
+  C[0][0] = 1;
+  C[2][0] = -J2;
+  Jgm3Model<8, 8> model;
+  for (const auto& pos : POSITIONS) {
+    double accel[3];
+    model.accelDegOrd(pos, S, C, accel);
+    double r = VectorOperations<double>::norm<3>(pos);
+    double radiusRatio = Earth::MEAN_RADIUS / r;
+    double zRatio = pos[2] * pos[2] / (r * r);
+    double central = -Earth::STANDARD_GRAVITATIONAL_PARAMETER / (r * r * r);
+    double j2Factor = 1.5 * J2 * radiusRatio * radiusRatio;
+    double expected[3] = {central * pos[0] * (1 + j2Factor * (1 - 5 * zRatio)),
+                          central * pos[1] * (1 + j2Factor * (1 - 5 * zRatio)),
+                          central * pos[2] * (1 + j2Factor * (3 - 5 * zRatio))};
+    for (uint8_t axis = 0; axis < 3; axis++) {
+      CHECK(accel[axis] == Catch::Approx(expected[axis]).epsilon(1e-12).margin(1e-15));
+    }
+  }
+}
+
+TEST_CASE("JGM3 Model Batch Evaluation", "[Jgm3Model]") {
+  SECTION("Degree And Order 8") { checkBatchEvaluation<8, 8>(); }
+  SECTION("Degree And Order 36") { checkBatchEvaluation<36, 36>(); }
+}
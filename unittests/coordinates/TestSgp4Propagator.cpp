@@ -0,0 +1,146 @@
+#include <fsfw/coordinates/Sgp4EphemerisCache.h>
+#include <fsfw/coordinates/Sgp4Propagator.h>
+#include <fsfw/timemanager/Clock.h>
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CatchDefinitions.h"
+
+namespace {
+
+const char TLE_LINE_1[] = "1 25544U 98067A   22001.50000000  .00005764  00000-0  11067-3 0  9990";
+const char TLE_LINE_2[] = "2 25544  51.6442 208.5279 0004654 316.3050 152.1770 15.49890512319553";
+
+//! Epoch of the TLE, 2022-01-01 12:00:00 UTC
+constexpr timeval TLE_EPOCH = {1641038400, 0};
+
+void initializePropagator(Sgp4Propagator& propagator) {
+  // The transformation into the Earth fixed frame needs the leap seconds
+  REQUIRE(Clock::setLeapSeconds(18) == retval::CATCH_OK);
+  REQUIRE(propagator.initialize(reinterpret_cast<const uint8_t*>(TLE_LINE_1),
+                                reinterpret_cast<const uint8_t*>(TLE_LINE_2)) ==
+          retval::CATCH_OK);
+}
+
+double distance(const double* first, const double* second) {
+  double sum = 0;
+  for (uint8_t idx = 0; idx < 3; idx++) {
+    sum += (first[idx] - second[idx]) * (first[idx] - second[idx]);
+  }
+  return std::sqrt(sum);
+}
+
+}  // namespace
+
+TEST_CASE("SGP4 Batch Propagation", "[Sgp4Propagator]") {
+  Sgp4Propagator propagator;
+  initializePropagator(propagator);
+
+  // Enough epochs to split the batch between four threads
+  constexpr size_t COUNT = 4 * Sgp4Propagator::MIN_EPOCHS_PER_THREAD + 17;
+  std::vector<timeval> times(COUNT);
+  for (size_t idx = 0; idx < COUNT; idx++) {
+    times[idx].tv_sec = TLE_EPOCH.tv_sec - 3600 + 37 * idx;
+    times[idx].tv_usec = (idx * 12345) % 1000000;
+  }
+  std::vector<double> singlePositions(3 * COUNT);
+  std::vector<double> singleVelocities(3 * COUNT);
+  for (size_t idx = 0; idx < COUNT; idx++) {
+    REQUIRE(propagator.propagate(&singlePositions[3 * idx], &singleVelocities[3 * idx],
+                                 times[idx], 0) == retval::CATCH_OK);
+  }
+  std::vector<double> positions(3 * COUNT);
+  std::vector<double> velocities(3 * COUNT);
+  auto* positionArray = reinterpret_cast<double(*)[3]>(positions.data());
+  auto* velocityArray = reinterpret_cast<double(*)[3]>(velocities.data());
+
+  for (uint8_t threads : {1, 4}) {
+    propagator.setPropagationThreads(threads);
+    SECTION("Same Results As Single Propagations With " + std::to_string(threads) +
+            " Threads") {
+      size_t propagated = 0;
+      REQUIRE(propagator.propagate(positionArray, velocityArray, times.data(), COUNT, 0,
+                                   &propagated) == retval::CATCH_OK);
+      CHECK(propagated == COUNT);
+      // Bitwise equal, not only within a tolerance
+      CHECK(std::memcmp(positions.data(), singlePositions.data(),
+                        positions.size() * sizeof(double)) == 0);
+      CHECK(std::memcmp(velocities.data(), singleVelocities.data(),
+                        velocities.size() * sizeof(double)) == 0);
+    }
+
+    SECTION("Stops At The First Failing Epoch With " + std::to_string(threads) + " Threads") {
+      constexpr size_t FAILING_EPOCH = 100;
+      times[FAILING_EPOCH].tv_sec = TLE_EPOCH.tv_sec + 2 * 366 * 86400;
+      size_t propagated = 0;
+      CHECK(propagator.propagate(positionArray, velocityArray, times.data(), COUNT, 0,
+                                 &propagated) ==
+            static_cast<ReturnValue_t>(Sgp4Propagator::TLE_TOO_OLD));
+      CHECK(propagated == FAILING_EPOCH);
+      CHECK(std::memcmp(positions.data(), singlePositions.data(),
+                        3 * FAILING_EPOCH * sizeof(double)) == 0);
+    }
+  }
+
+  SECTION("Not Initialized") {
+    Sgp4Propagator uninitialized;
+    size_t propagated = 1;
+    CHECK(uninitialized.propagate(positionArray, velocityArray, times.data(), COUNT, 0,
+                                  &propagated) ==
+            static_cast<ReturnValue_t>(Sgp4Propagator::TLE_NOT_INITIALIZED));
+    CHECK(propagated == 0);
+  }
+}
+
+TEST_CASE("SGP4 Ephemeris Cache", "[Sgp4Propagator]") {
+  Sgp4Propagator propagator;
+  initializePropagator(propagator);
+  Sgp4EphemerisCache cache(propagator, 8, 60000);
+
+  double maxPositionError = 0;
+  double maxVelocityError = 0;
+  auto compare = [&](timeval time) {
+    double expectedPosition[3];
+    double expectedVelocity[3];
+    REQUIRE(propagator.propagate(expectedPosition, expectedVelocity, time, 0) ==
+            retval::CATCH_OK);
+    double position[3];
+    double velocity[3];
+    REQUIRE(cache.getState(position, velocity, time) == retval::CATCH_OK);
+    maxPositionError = std::max(maxPositionError, distance(position, expectedPosition));
+    maxVelocityError = std::max(maxVelocityError, distance(velocity, expectedVelocity));
+    if (time.tv_usec == 0 and time.tv_sec % 60 == 0) {
+      // The nodes are returned without interpolation error
+      CHECK(std::memcmp(position, expectedPosition, sizeof(position)) == 0);
+    }
+  };
+
+  // Forward through several window slides, with steps which do not divide the node step
+  for (int64_t offset = 0; offset < 3600; offset += 7) {
+    // Hits a node every seven minutes
+    suseconds_t usecs = offset % 60 == 0 ? 0 : (offset * 4321) % 1000000;
+    compare({TLE_EPOCH.tv_sec + offset, usecs});
+  }
+  // Small steps back are within the window, large ones refill it
+  for (int64_t offset : {3500, 3480, 3000, 120, -1800, -1790, 5000}) {
+    compare({TLE_EPOCH.tv_sec + offset, 250000});
+  }
+  // About 0.3 m and 3 cm/s with the default node step of 60 seconds
+  CHECK(maxPositionError < 1.0);
+  CHECK(maxVelocityError < 0.1);
+
+  // A failed propagation drops the window
+  double position[3];
+  timeval tooLate = {TLE_EPOCH.tv_sec + 2 * 366 * 86400, 0};
+  CHECK(cache.getState(position, nullptr, tooLate) ==
+        static_cast<ReturnValue_t>(Sgp4Propagator::TLE_TOO_OLD));
+  compare({TLE_EPOCH.tv_sec + 60, 0});
+  cache.invalidate();
+  compare({TLE_EPOCH.tv_sec + 90, 500000});
+  CHECK(maxPositionError < 1.0);
+}
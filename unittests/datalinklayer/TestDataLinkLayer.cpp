@@ -0,0 +1,265 @@
+#include <fsfw/datalinklayer/Clcw.h>
+#include <fsfw/datalinklayer/DataLinkLayer.h>
+#include <fsfw/datalinklayer/MapPacketExtraction.h>
+#include <fsfw/globalfunctions/CRC.h>
+#include <fsfw/ipc/MessageQueueIF.h>
+#include <fsfw/ipc/QueueFactory.h>
+#include <fsfw/objectmanager/ObjectManager.h>
+#include <fsfw/objectmanager/SystemObject.h>
+#include <fsfw/storagemanager/StorageManagerIF.h>
+#include <fsfw/tmtcservices/AcceptsTelecommandsIF.h>
+#include <fsfw/tmtcservices/TmTcMessage.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <vector>
+
+#include "objects/systemObjectList.h"
+
+namespace {
+
+constexpr uint16_t SCID = 0x2A5;
+constexpr uint8_t START_SEQUENCE_LENGTH = 2;
+//! Sequence flags of the segment header
+constexpr uint8_t CONTINUING_PORTION = 0b00;
+constexpr uint8_t FIRST_PORTION = 0b01;
+constexpr uint8_t LAST_PORTION = 0b10;
+
+/**
+ * Builds a TC transfer frame with the bypass flag set and a valid CRC.
+ */
+std::vector<uint8_t> makeFrame(uint8_t vcId, uint8_t sequenceNumber,
+                               const std::vector<uint8_t>& dataField, uint16_t scid = SCID) {
+  std::vector<uint8_t> frame(5 + dataField.size() + 2);
+  const uint16_t frameLength = frame.size() - 1;
+  frame[0] = 0x20 | ((scid >> 8) & 0x03);
+  frame[1] = scid & 0xff;
+  frame[2] = (vcId << 2) | ((frameLength >> 8) & 0x03);
+  frame[3] = frameLength & 0xff;
+  frame[4] = sequenceNumber;
+  std::memcpy(frame.data() + 5, dataField.data(), dataField.size());
+  uint16_t crc = CRC::crc16ccitt(frame.data(), frame.size() - 2);
+  frame[frame.size() - 2] = crc >> 8;
+  frame[frame.size() - 1] = crc & 0xff;
+  return frame;
+}
+
+void appendFrame(std::vector<uint8_t>& buffer, const std::vector<uint8_t>& frame) {
+  buffer.insert(buffer.end(), START_SEQUENCE_LENGTH, 0);
+  buffer.insert(buffer.end(), frame.begin(), frame.end());
+}
+
+class VirtualChannelMock : public VirtualChannelReceptionIF {
+ public:
+  explicit VirtualChannelMock(uint8_t channelId) : channelId(channelId) {}
+
+  std::vector<uint8_t> sequenceNumbers;
+  ReturnValue_t reply = HasReturnvaluesIF::RETURN_OK;
+
+  ReturnValue_t frameAcceptanceAndReportingMechanism(TcTransferFrame* frame,
+                                                     ClcwIF* clcw) override {
+    sequenceNumbers.push_back(frame->getSequenceNumber());
+    return reply;
+  }
+  ReturnValue_t initialize() override { return HasReturnvaluesIF::RETURN_OK; }
+  uint8_t getChannelId() const override { return channelId; }
+
+ private:
+  uint8_t channelId;
+};
+
+class TcDistributorMock : public SystemObject, public AcceptsTelecommandsIF {
+ public:
+  TcDistributorMock() : SystemObject(objects::TC_DISTRIBUTOR_MOCK) {
+    queue = QueueFactory::instance()->createMessageQueue(5);
+  }
+  ~TcDistributorMock() override { QueueFactory::instance()->deleteMessageQueue(queue); }
+
+  uint16_t getIdentifier() override { return 0; }
+  MessageQueueId_t getRequestQueue() override { return queue->getId(); }
+
+  MessageQueueIF* queue;
+};
+
+/**
+ * Segment header and portion of a segmented packet.
+ */
+std::vector<uint8_t> makePortion(uint8_t sequenceFlags, const uint8_t* data, size_t size) {
+  std::vector<uint8_t> dataField(1 + size);
+  dataField[0] = sequenceFlags << 6;
+  std::memcpy(dataField.data() + 1, data, size);
+  return dataField;
+}
+
+}  // namespace
+
+TEST_CASE("Data Link Layer Batch Processing", "[DataLinkLayer]") {
+  Clcw clcw;
+  std::vector<uint8_t> dummy(1);
+  DataLinkLayer dataLinkLayer(dummy.data(), &clcw, START_SEQUENCE_LENGTH, SCID);
+  VirtualChannelMock channel1(1);
+  VirtualChannelMock channel2(2);
+  REQUIRE(dataLinkLayer.addVirtualChannel(1, &channel1) == HasReturnvaluesIF::RETURN_OK);
+  REQUIRE(dataLinkLayer.addVirtualChannel(2, &channel2) == HasReturnvaluesIF::RETURN_OK);
+  const std::vector<uint8_t> payload = {0x00, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<uint8_t> buffer;
+  uint16_t processedFrames = 0xffff;
+
+  SECTION("Several frames") {
+    appendFrame(buffer, makeFrame(1, 10, payload));
+    appendFrame(buffer, makeFrame(2, 20, {0x00, 9}));
+    appendFrame(buffer, makeFrame(1, 11, payload));
+    REQUIRE(dataLinkLayer.processFrames(buffer.data(), buffer.size(), &processedFrames) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(processedFrames == 3);
+    REQUIRE(channel1.sequenceNumbers == std::vector<uint8_t>({10, 11}));
+    REQUIRE(channel2.sequenceNumbers == std::vector<uint8_t>({20}));
+    // The number of processed frames is optional
+    REQUIRE(dataLinkLayer.processFrames(buffer.data(), buffer.size()) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(channel1.sequenceNumbers.size() == 4);
+  }
+
+  SECTION("Truncated last frame") {
+    appendFrame(buffer, makeFrame(1, 10, payload));
+    appendFrame(buffer, makeFrame(1, 11, payload));
+    // Not even a complete header is left
+    buffer.insert(buffer.end(), {0, 0, 0x20, 0x02});
+    REQUIRE(dataLinkLayer.processFrames(buffer.data(), buffer.size(), &processedFrames) ==
+            static_cast<ReturnValue_t>(DataLinkLayer::SHORTER_THAN_HEADER));
+    CHECK(processedFrames == 2);
+    CHECK(channel1.sequenceNumbers.size() == 2);
+
+    // The header announces more data than left in the buffer
+    buffer.clear();
+    appendFrame(buffer, makeFrame(1, 10, payload));
+    auto frame = makeFrame(1, 11, payload);
+    appendFrame(buffer, frame);
+    buffer.resize(buffer.size() - 3);
+    REQUIRE(dataLinkLayer.processFrames(buffer.data(), buffer.size(), &processedFrames) ==
+            static_cast<ReturnValue_t>(DataLinkLayer::TOO_SHORT));
+    CHECK(processedFrames == 1);
+    CHECK(channel1.sequenceNumbers.size() == 3);
+  }
+
+  SECTION("Invalid frames are skipped") {
+    appendFrame(buffer, makeFrame(1, 10, payload));
+    appendFrame(buffer, makeFrame(1, 11, payload, SCID + 1));
+    auto corrupted = makeFrame(2, 20, payload);
+    corrupted[6] ^= 0x10;
+    appendFrame(buffer, corrupted);
+    appendFrame(buffer, makeFrame(2, 21, payload));
+    // Frames for unknown virtual channels are silently dropped
+    appendFrame(buffer, makeFrame(5, 50, payload));
+    REQUIRE(dataLinkLayer.processFrames(buffer.data(), buffer.size(), &processedFrames) ==
+            static_cast<ReturnValue_t>(DataLinkLayer::WRONG_SPACECRAFT_ID));
+    CHECK(processedFrames == 3);
+    REQUIRE(channel1.sequenceNumbers == std::vector<uint8_t>({10}));
+    REQUIRE(channel2.sequenceNumbers == std::vector<uint8_t>({21}));
+  }
+
+  SECTION("Errors of the virtual channel") {
+    channel2.reply = DataLinkLayer::NS_LOCKOUT;
+    appendFrame(buffer, makeFrame(2, 20, payload));
+    auto corrupted = makeFrame(1, 10, payload);
+    corrupted.back() ^= 0x01;
+    appendFrame(buffer, corrupted);
+    appendFrame(buffer, makeFrame(1, 11, payload));
+    REQUIRE(dataLinkLayer.processFrames(buffer.data(), buffer.size(), &processedFrames) ==
+            static_cast<ReturnValue_t>(DataLinkLayer::NS_LOCKOUT));
+    CHECK(processedFrames == 1);
+    CHECK(channel2.sequenceNumbers.size() == 1);
+    REQUIRE(channel1.sequenceNumbers == std::vector<uint8_t>({11}));
+  }
+}
+
+TEST_CASE("MAP Packet Extraction Store Assembly", "[DataLinkLayer]") {
+  TcDistributorMock distributor;
+  MapPacketExtraction extraction(0, objects::TC_DISTRIBUTOR_MOCK);
+  REQUIRE(extraction.initialize() == HasReturnvaluesIF::RETURN_OK);
+  auto* tcStore = ObjectManager::instance()->get<StorageManagerIF>(objects::TC_STORE);
+  REQUIRE(tcStore != nullptr);
+
+  // Space packet with 30 bytes in total
+  uint8_t packet[30];
+  for (uint8_t idx = 0; idx < sizeof(packet); idx++) {
+    packet[idx] = idx * 3;
+  }
+  packet[0] = 0x18;
+  packet[1] = 0x73;
+  packet[2] = 0xc0;
+  packet[3] = 0x01;
+  packet[4] = 0;
+  packet[5] = sizeof(packet) - 7;
+
+  std::vector<uint8_t> frameData;
+  auto extract = [&](uint8_t sequenceFlags, size_t offset, size_t size) {
+    frameData = makeFrame(0, 0, makePortion(sequenceFlags, packet + offset, size));
+    TcTransferFrame frame(frameData.data());
+    return extraction.extractPackets(&frame);
+  };
+  auto requireReceivedPacket = [&]() {
+    TmTcMessage message;
+    REQUIRE(distributor.queue->receiveMessage(&message) == HasReturnvaluesIF::RETURN_OK);
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    REQUIRE(tcStore->getData(message.getStorageId(), &data, &size) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(size == sizeof(packet));
+    CHECK(std::memcmp(data, packet, sizeof(packet)) == 0);
+    tcStore->deleteData(message.getStorageId());
+  };
+  auto requireNoPacket = [&]() {
+    TmTcMessage message;
+    REQUIRE(distributor.queue->receiveMessage(&message) ==
+            static_cast<ReturnValue_t>(MessageQueueIF::EMPTY));
+  };
+
+  SECTION("Packet assembled across frames") {
+    REQUIRE(extract(FIRST_PORTION, 0, 10) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(extract(CONTINUING_PORTION, 10, 12) ==
+            HasReturnvaluesIF::RETURN_OK);
+    requireNoPacket();
+    REQUIRE(extract(LAST_PORTION, 22, 8) == HasReturnvaluesIF::RETURN_OK);
+    requireReceivedPacket();
+  }
+
+  SECTION("First portion shorter than the packet header") {
+    REQUIRE(extract(FIRST_PORTION, 0, 4) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(extract(CONTINUING_PORTION, 4, 16) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(extract(LAST_PORTION, 20, 10) == HasReturnvaluesIF::RETURN_OK);
+    requireReceivedPacket();
+  }
+
+  SECTION("A new first portion drops the incomplete packet") {
+    REQUIRE(extract(FIRST_PORTION, 0, 10) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(extract(FIRST_PORTION, 0, 15) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(extract(LAST_PORTION, 15, 15) == HasReturnvaluesIF::RETURN_OK);
+    requireReceivedPacket();
+    requireNoPacket();
+  }
+
+  SECTION("Portions which do not add up are rejected") {
+    // Failed assemblies must release their store element, otherwise the store runs full
+    for (uint8_t attempt = 0; attempt < 80; attempt++) {
+      REQUIRE(extract(FIRST_PORTION, 0, 10) ==
+              HasReturnvaluesIF::RETURN_OK);
+      if (attempt % 2 == 0) {
+        REQUIRE(extract(LAST_PORTION, 10, 12) ==
+                static_cast<ReturnValue_t>(MapPacketExtractionIF::DATA_CORRUPTED));
+      } else {
+        REQUIRE(extract(CONTINUING_PORTION, 10, 25) ==
+                static_cast<ReturnValue_t>(MapPacketExtractionIF::CONTENT_TOO_LARGE));
+      }
+    }
+    requireNoPacket();
+    // A continuing portion without a first portion is illegal
+    REQUIRE(extract(CONTINUING_PORTION, 10, 12) ==
+            static_cast<ReturnValue_t>(MapPacketExtractionIF::ILLEGAL_SEGMENTATION_FLAG));
+
+    REQUIRE(extract(FIRST_PORTION, 0, 10) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(extract(LAST_PORTION, 10, 20) == HasReturnvaluesIF::RETURN_OK);
+    requireReceivedPacket();
+  }
+}
@@ -0,0 +1,314 @@
+#include <fsfw/datalinklayer/Clcw.h>
+#include <fsfw/datalinklayer/TmTransferFrame.h>
+#include <fsfw/datalinklayer/TmVirtualChannelMultiplexer.h>
+#include <fsfw/datalinklayer/VirtualChannelTransmission.h>
+#include <fsfw/globalfunctions/CRC.h>
+#include <fsfw/objectmanager/ObjectManager.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <vector>
+
+#include "objects/systemObjectList.h"
+
+namespace {
+
+std::vector<uint8_t> makePacket(size_t size, uint8_t seed) {
+  std::vector<uint8_t> packet(size);
+  for (size_t idx = 0; idx < size; idx++) {
+    packet[idx] = seed + idx;
+  }
+  return packet;
+}
+
+}  // namespace
+
+TEST_CASE("TM Transfer Frame Layout", "[TmTransferFrame]") {
+  TmFrameConfig config;
+  config.spacecraftId = 0x2AB;
+  config.frameLength = 64;
+  std::array<uint8_t, 64> buffer = {};
+  TmTransferFrame frame(buffer.data(), config);
+
+  SECTION("Primary header") {
+    REQUIRE(config.getDataFieldLength() == 64 - 6 - 4 - 2);
+    frame.setPrimaryHeader(5, 0xA5, 0x3C, 0x123);
+    // Version 00, SCID 10 bits, VCID 3 bits, OCF flag
+    CHECK(buffer[0] == 0b00101010);
+    CHECK(buffer[1] == 0b10111011);
+    CHECK(buffer[2] == 0xA5);
+    CHECK(buffer[3] == 0x3C);
+    // No secondary header, sync flag and packet order zero, segment length ID 0b11, FHP 11 bits
+    CHECK(buffer[4] == 0b00011001);
+    CHECK(buffer[5] == 0x23);
+
+    CHECK(frame.getVersionNumber() == 0);
+    CHECK(frame.getSpacecraftId() == 0x2AB);
+    CHECK(frame.getVirtualChannelId() == 5);
+    CHECK(frame.ocfFlagSet());
+    CHECK(frame.getMasterChannelFrameCount() == 0xA5);
+    CHECK(frame.getVirtualChannelFrameCount() == 0x3C);
+    CHECK(frame.getFirstHeaderPointer() == 0x123);
+    CHECK(frame.getDataField() == buffer.data() + 6);
+    CHECK(frame.getFullSize() == 64);
+
+    frame.setMasterChannelFrameCount(0x11);
+    CHECK(buffer[2] == 0x11);
+
+    // Special first header pointer values
+    frame.setPrimaryHeader(7, 0, 0, TmTransferFrame::FHP_IDLE_DATA_ONLY);
+    CHECK(buffer[4] == 0b00011111);
+    CHECK(buffer[5] == 0xFE);
+    frame.setPrimaryHeader(7, 0, 0, TmTransferFrame::FHP_NO_PACKET_START);
+    CHECK(buffer[4] == 0b00011111);
+    CHECK(buffer[5] == 0xFF);
+    CHECK(frame.getFirstHeaderPointer() == 0x7FF);
+  }
+
+  SECTION("Trailer") {
+    frame.setPrimaryHeader(1, 2, 3, 0);
+    std::memset(frame.getDataField(), 0xAA, config.getDataFieldLength());
+    frame.setOcf(0x01020304);
+    CHECK(buffer[58] == 0x01);
+    CHECK(buffer[59] == 0x02);
+    CHECK(buffer[60] == 0x03);
+    CHECK(buffer[61] == 0x04);
+    CHECK(frame.getOcf() == 0x01020304);
+    CHECK(buffer[57] == 0xAA);
+    frame.setFecf();
+    CHECK(CRC::crc16ccitt(buffer.data(), 62) == ((buffer[62] << 8) | buffer[63]));
+    // A correct FECF leads to a remainder of zero
+    CHECK(CRC::crc16ccitt(buffer.data(), 64) == 0);
+  }
+
+  SECTION("Frame without OCF and FECF") {
+    config.ocfPresent = false;
+    config.fecfPresent = false;
+    REQUIRE(config.getDataFieldLength() == 64 - 6);
+    frame.setPrimaryHeader(5, 0, 0, 0);
+    CHECK(buffer[1] == 0b10111010);
+    CHECK(not frame.ocfFlagSet());
+    buffer.fill(0xAA);
+    frame.setOcf(0x01020304);
+    frame.setFecf();
+    for (size_t idx = 6; idx < buffer.size(); idx++) {
+      CHECK(buffer[idx] == 0xAA);
+    }
+    CHECK(frame.getOcf() == 0);
+  }
+}
+
+TEST_CASE("TM Virtual Channel Transmission", "[TmTransferFrame]") {
+  TmFrameConfig config;
+  config.spacecraftId = 0x2AB;
+  // Data field of 20 bytes
+  config.frameLength = 32;
+  VirtualChannelTransmission channel(3, config, 4);
+  std::array<uint8_t, 32> frameBuffer = {};
+  TmTransferFrame frame(frameBuffer.data(), config);
+  const uint8_t* dataField = frameBuffer.data() + TmTransferFrame::PRIMARY_HEADER_SIZE;
+
+  SECTION("Packets spanning frames") {
+    auto packetA = makePacket(12, 0x10);
+    auto packetB = makePacket(30, 0x40);
+    auto packetC = makePacket(10, 0x80);
+    REQUIRE(channel.addPacket(packetA.data(), packetA.size()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(not channel.hasCompletedFrame());
+    REQUIRE(channel.addPacket(packetB.data(), packetB.size()) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(channel.addPacket(packetC.data(), packetC.size()) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(channel.getCompletedFrameCount() == 2);
+    REQUIRE(channel.flush() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(channel.getCompletedFrameCount() == 3);
+
+    std::vector<uint8_t> stream;
+    std::vector<uint8_t> expected;
+    expected.insert(expected.end(), packetA.begin(), packetA.end());
+    expected.insert(expected.end(), packetB.begin(), packetB.end());
+    expected.insert(expected.end(), packetC.begin(), packetC.end());
+
+    // Packet A starts at the beginning of the first frame
+    REQUIRE(channel.popFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getVirtualChannelId() == 3);
+    CHECK(frame.getSpacecraftId() == 0x2AB);
+    CHECK(frame.getVirtualChannelFrameCount() == 0);
+    CHECK(frame.getFirstHeaderPointer() == 0);
+    stream.insert(stream.end(), dataField, dataField + 20);
+    // The second frame only contains a part of packet B
+    REQUIRE(channel.popFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getVirtualChannelFrameCount() == 1);
+    CHECK(frame.getFirstHeaderPointer() == TmTransferFrame::FHP_NO_PACKET_START);
+    stream.insert(stream.end(), dataField, dataField + 20);
+    // Packet C starts after the last two bytes of packet B
+    REQUIRE(channel.popFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getVirtualChannelFrameCount() == 2);
+    CHECK(frame.getFirstHeaderPointer() == 2);
+    stream.insert(stream.end(), dataField, dataField + 12);
+    CHECK(stream == expected);
+
+    // Idle packet with APID 0x7FF fills the remaining eight bytes
+    CHECK(dataField[12] == 0x07);
+    CHECK(dataField[13] == 0xFF);
+    CHECK(dataField[16] == 0x00);
+    CHECK(dataField[17] == 8 - 7);
+    CHECK(dataField[18] == VirtualChannelTransmission::IDLE_PATTERN);
+    CHECK(dataField[19] == VirtualChannelTransmission::IDLE_PATTERN);
+
+    CHECK(channel.popFrame(frameBuffer.data()) ==
+          static_cast<ReturnValue_t>(CCSDSReturnValuesIF::NO_FRAME_AVAILABLE));
+    CHECK(channel.getPackingEfficiency() == (52.0f / 60.0f));
+  }
+
+  SECTION("Idle packet continues in the next frame") {
+    auto packet = makePacket(16, 0);
+    REQUIRE(channel.addPacket(packet.data(), packet.size()) == HasReturnvaluesIF::RETURN_OK);
+    // Four bytes are too small for an idle packet
+    REQUIRE(channel.flush() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(channel.getCompletedFrameCount() == 2);
+    REQUIRE(channel.popFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getFirstHeaderPointer() == 0);
+    CHECK(dataField[16] == 0x07);
+    CHECK(dataField[17] == 0xFF);
+    REQUIRE(channel.popFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getFirstHeaderPointer() == TmTransferFrame::FHP_NO_PACKET_START);
+    // The idle packet header ends with the data length 24 - 6 - 1
+    CHECK(dataField[0] == 0);
+    CHECK(dataField[1] == 17);
+    CHECK(dataField[2] == VirtualChannelTransmission::IDLE_PATTERN);
+    // Nothing to flush
+    REQUIRE(channel.flush() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(not channel.hasCompletedFrame());
+  }
+
+  SECTION("Frame buffer full") {
+    REQUIRE(channel.getFreeSpace() == 80);
+    auto packet = makePacket(81, 0);
+    CHECK(channel.addPacket(packet.data(), packet.size()) ==
+          static_cast<ReturnValue_t>(CCSDSReturnValuesIF::FRAME_BUFFER_FULL));
+    CHECK(channel.getFreeSpace() == 80);
+    CHECK(not channel.hasCompletedFrame());
+
+    REQUIRE(channel.addPacket(packet.data(), 75) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(channel.getFreeSpace() == 5);
+    // The idle packet does not fit anymore
+    CHECK(channel.flush() == static_cast<ReturnValue_t>(CCSDSReturnValuesIF::FRAME_BUFFER_FULL));
+    REQUIRE(channel.addPacket(packet.data(), 5) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(channel.getFreeSpace() == 0);
+    CHECK(channel.addPacket(packet.data(), 1) ==
+          static_cast<ReturnValue_t>(CCSDSReturnValuesIF::FRAME_BUFFER_FULL));
+
+    // Popping a frame frees space
+    REQUIRE(channel.popFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(channel.getFreeSpace() == 20);
+    channel.clear();
+    CHECK(channel.getFreeSpace() == 80);
+    CHECK(channel.popFrame(frameBuffer.data()) ==
+          static_cast<ReturnValue_t>(CCSDSReturnValuesIF::NO_FRAME_AVAILABLE));
+  }
+}
+
+TEST_CASE("TM Virtual Channel Multiplexer", "[TmTransferFrame]") {
+  TmFrameConfig config;
+  config.spacecraftId = 0x2AB;
+  config.frameLength = 32;
+  Clcw clcw;
+  clcw.setVirtualChannel(2);
+  clcw.setReceiverFrameSequenceNumber(0x5A);
+  TmVirtualChannelMultiplexer multiplexer(config, &clcw);
+  VirtualChannelTransmission channel1(1, config, 8);
+  VirtualChannelTransmission channel2(2, config, 8);
+  REQUIRE(multiplexer.addVirtualChannel(&channel1, 3) == HasReturnvaluesIF::RETURN_OK);
+  REQUIRE(multiplexer.addVirtualChannel(&channel2, 1) == HasReturnvaluesIF::RETURN_OK);
+  VirtualChannelTransmission duplicate(2, config, 1);
+  CHECK(multiplexer.addVirtualChannel(&duplicate, 1) == HasReturnvaluesIF::RETURN_FAILED);
+  CHECK(multiplexer.addVirtualChannel(&duplicate, 0) == HasReturnvaluesIF::RETURN_FAILED);
+  // VC 7 is used for the idle frames and higher VCIDs do not fit into the header
+  VirtualChannelTransmission idleChannel(7, config, 1);
+  CHECK(multiplexer.addVirtualChannel(&idleChannel, 1) == HasReturnvaluesIF::RETURN_FAILED);
+  VirtualChannelTransmission invalidChannel(9, config, 1);
+  CHECK(multiplexer.addVirtualChannel(&invalidChannel, 1) == HasReturnvaluesIF::RETURN_FAILED);
+  TmFrameConfig longerConfig = config;
+  longerConfig.frameLength = 64;
+  VirtualChannelTransmission longerChannel(3, longerConfig, 1);
+  CHECK(multiplexer.addVirtualChannel(&longerChannel, 1) == HasReturnvaluesIF::RETURN_FAILED);
+  TmFrameConfig noOcfConfig = config;
+  noOcfConfig.ocfPresent = false;
+  VirtualChannelTransmission noOcfChannel(3, noOcfConfig, 1);
+  CHECK(multiplexer.addVirtualChannel(&noOcfChannel, 1) == HasReturnvaluesIF::RETURN_FAILED);
+
+  std::array<uint8_t, 32> frameBuffer = {};
+  TmTransferFrame frame(frameBuffer.data(), config);
+  auto packet = makePacket(20, 0);
+
+  SECTION("Weighted round robin") {
+    for (uint8_t idx = 0; idx < 8; idx++) {
+      REQUIRE(channel1.addPacket(packet.data(), packet.size()) == HasReturnvaluesIF::RETURN_OK);
+    }
+    for (uint8_t idx = 0; idx < 3; idx++) {
+      REQUIRE(channel2.addPacket(packet.data(), packet.size()) == HasReturnvaluesIF::RETURN_OK);
+    }
+    // Smooth weighted round robin for the weights 3 and 1, the remaining frames of VC 1 follow
+    // once VC 2 has no frames anymore
+    const std::vector<uint8_t> expectedOrder = {1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 2};
+    std::vector<uint8_t> order;
+    for (uint8_t idx = 0; idx < 11; idx++) {
+      REQUIRE(multiplexer.getNextFrame(frameBuffer.data(), false) ==
+              HasReturnvaluesIF::RETURN_OK);
+      order.push_back(frame.getVirtualChannelId());
+      CHECK(frame.getMasterChannelFrameCount() == idx);
+      CHECK(frame.getOcf() == clcw.getAsWhole());
+      CHECK(CRC::crc16ccitt(frameBuffer.data(), frameBuffer.size()) == 0);
+    }
+    CHECK(order == expectedOrder);
+    CHECK(multiplexer.getNextFrame(frameBuffer.data(), false) ==
+          static_cast<ReturnValue_t>(CCSDSReturnValuesIF::NO_FRAME_AVAILABLE));
+    CHECK(multiplexer.getSentFrameCount() == 11);
+    CHECK(multiplexer.getIdleFrameCount() == 0);
+  }
+
+  SECTION("Idle frames") {
+    REQUIRE(multiplexer.getNextFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getVirtualChannelId() == TmVirtualChannelMultiplexer::IDLE_VIRTUAL_CHANNEL);
+    CHECK(frame.getFirstHeaderPointer() == TmTransferFrame::FHP_IDLE_DATA_ONLY);
+    CHECK(frame.getVirtualChannelFrameCount() == 0);
+    for (uint8_t idx = 0; idx < config.getDataFieldLength(); idx++) {
+      CHECK(frame.getDataField()[idx] == VirtualChannelTransmission::IDLE_PATTERN);
+    }
+    CHECK(frame.getOcf() == clcw.getAsWhole());
+    CHECK(CRC::crc16ccitt(frameBuffer.data(), frameBuffer.size()) == 0);
+
+    // A partially filled frame is only sent after flushing
+    REQUIRE(channel2.addPacket(packet.data(), 10) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(multiplexer.getNextFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getVirtualChannelId() == 7);
+    CHECK(frame.getVirtualChannelFrameCount() == 1);
+    REQUIRE(multiplexer.flushAll() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(multiplexer.getNextFrame(frameBuffer.data()) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(frame.getVirtualChannelId() == 2);
+    CHECK(frame.getMasterChannelFrameCount() == 2);
+    CHECK(multiplexer.getIdleFrameCount() == 2);
+    CHECK(multiplexer.getSentFrameCount() == 3);
+  }
+
+  SECTION("Packets from the store") {
+    auto* tmStore = ObjectManager::instance()->get<StorageManagerIF>(objects::TM_STORE);
+    REQUIRE(tmStore != nullptr);
+    TmVirtualChannelMultiplexer storeMultiplexer(config, nullptr, tmStore);
+    REQUIRE(storeMultiplexer.addVirtualChannel(&channel1) == HasReturnvaluesIF::RETURN_OK);
+    store_address_t storeId;
+    REQUIRE(tmStore->addData(&storeId, packet.data(), packet.size()) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(storeMultiplexer.addStoredPacket(4, storeId) ==
+          static_cast<ReturnValue_t>(CCSDSReturnValuesIF::VC_NOT_FOUND));
+    REQUIRE(storeMultiplexer.addStoredPacket(1, storeId) == HasReturnvaluesIF::RETURN_OK);
+    // The store entry was deleted
+    const uint8_t* storedPacket = nullptr;
+    size_t storedSize = 0;
+    CHECK(tmStore->getData(storeId, &storedPacket, &storedSize) != HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(storeMultiplexer.getNextFrame(frameBuffer.data(), false) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(std::memcmp(frame.getDataField(), packet.data(), packet.size()) == 0);
+    // Without a CLCW, the OCF is zero
+    CHECK(frame.getOcf() == 0);
+  }
+}
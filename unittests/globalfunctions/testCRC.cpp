@@ -11,4 +11,34 @@ TEST_CASE("CRC", "[CRC]") {
   for (uint8_t index = 0; index < testData.size(); index++) {
     REQUIRE(testData[index] == index);
   }
-}
\ No newline at end of file
+}
+TEST_CASE("CRC Block Processing", "[CRC]") {
+  // Bitwise reference implementation of the CRC16-CCITT
+  auto referenceCrc = [](const uint8_t* data, uint32_t length, uint16_t crc) {
+    for (uint32_t idx = 0; idx < length; idx++) {
+      crc ^= data[idx] << 8;
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                             : static_cast<uint16_t>(crc << 1);
+      }
+    }
+    return crc;
+  };
+  std::array<uint8_t, 1031> testData{};
+  for (size_t index = 0; index < testData.size(); index++) {
+    testData[index] = (index * 37 + 11) & 0xff;
+  }
+  for (uint32_t length = 0; length < 20; length++) {
+    REQUIRE(CRC::crc16ccitt(testData.data(), length) ==
+            referenceCrc(testData.data(), length, 0xffff));
+  }
+  REQUIRE(CRC::crc16ccitt(testData.data(), testData.size()) ==
+          referenceCrc(testData.data(), testData.size(), 0xffff));
+  REQUIRE(CRC::crc16ccitt(testData.data() + 3, 517, 0x1234) ==
+          referenceCrc(testData.data() + 3, 517, 0x1234));
+  // A frame with the CRC appended yields zero
+  uint16_t crc = CRC::crc16ccitt(testData.data(), 1029);
+  testData[1029] = crc >> 8;
+  testData[1030] = crc & 0xff;
+  REQUIRE(CRC::crc16ccitt(testData.data(), testData.size()) == 0);
+}
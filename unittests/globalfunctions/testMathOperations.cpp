@@ -0,0 +1,172 @@
+#include <fsfw/globalfunctions/math/MatrixOperations.h>
+#include <fsfw/globalfunctions/math/QuaternionOperations.h>
+#include <fsfw/globalfunctions/math/VectorOperations.h>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+template <typename T>
+void fill(T* values, size_t size, double offset) {
+  for (size_t idx = 0; idx < size; idx++) {
+    values[idx] = static_cast<T>(offset + 0.37 * idx - 0.013 * idx * idx);
+  }
+}
+
+template <typename T>
+void requireEqual(const T* expected, const T* actual, size_t size) {
+  for (size_t idx = 0; idx < size; idx++) {
+    REQUIRE(actual[idx] == Catch::Approx(expected[idx]).epsilon(1e-15).margin(1e-15));
+  }
+}
+
+template <uint8_t ROWS1, uint8_t COLUMNS1, uint8_t COLUMNS2>
+void checkMultiply() {
+  double matrix1[ROWS1 * COLUMNS1];
+  double matrix2[COLUMNS1 * COLUMNS2];
+  double expected[ROWS1 * COLUMNS2];
+  double result[ROWS1 * COLUMNS2];
+  fill(matrix1, ROWS1 * COLUMNS1, -1.5);
+  fill(matrix2, COLUMNS1 * COLUMNS2, 0.25);
+  MatrixOperations<double>::multiply(matrix1, matrix2, expected, ROWS1, COLUMNS1, COLUMNS2);
+  MatrixOperations<double>::multiply<ROWS1, COLUMNS1, COLUMNS2>(matrix1, matrix2, result);
+  requireEqual(expected, result, ROWS1 * COLUMNS2);
+}
+
+template <uint8_t ROWS, uint8_t COLUMNS>
+void checkElementWise() {
+  constexpr size_t SIZE = ROWS * COLUMNS;
+  double matrix1[SIZE];
+  double matrix2[SIZE];
+  double expected[SIZE];
+  double result[SIZE];
+  fill(matrix1, SIZE, -2.0);
+  fill(matrix2, SIZE, 3.0);
+
+  MatrixOperations<double>::add(matrix1, matrix2, expected, ROWS, COLUMNS);
+  MatrixOperations<double>::add<ROWS, COLUMNS>(matrix1, matrix2, result);
+  requireEqual(expected, result, SIZE);
+
+  MatrixOperations<double>::subtract(matrix1, matrix2, expected, ROWS, COLUMNS);
+  MatrixOperations<double>::subtract<ROWS, COLUMNS>(matrix1, matrix2, result);
+  requireEqual(expected, result, SIZE);
+
+  MatrixOperations<double>::multiplyScalar(matrix1, 0.7, expected, ROWS, COLUMNS);
+  MatrixOperations<double>::multiplyScalar<ROWS, COLUMNS>(matrix1, 0.7, result);
+  requireEqual(expected, result, SIZE);
+}
+
+template <uint8_t SIZE>
+void checkVector() {
+  double vector1[SIZE];
+  double vector2[SIZE];
+  double expected[SIZE];
+  double result[SIZE];
+  fill(vector1, SIZE, 1.0);
+  fill(vector2, SIZE, -4.0);
+
+  VectorOperations<double>::add(vector1, vector2, expected, SIZE);
+  VectorOperations<double>::add<SIZE>(vector1, vector2, result);
+  requireEqual(expected, result, SIZE);
+
+  VectorOperations<double>::subtract(vector1, vector2, expected, SIZE);
+  VectorOperations<double>::subtract<SIZE>(vector1, vector2, result);
+  requireEqual(expected, result, SIZE);
+
+  VectorOperations<double>::mulScalar(vector1, -3.5, expected, SIZE);
+  VectorOperations<double>::mulScalar<SIZE>(vector1, -3.5, result);
+  requireEqual(expected, result, SIZE);
+
+  REQUIRE(VectorOperations<double>::norm<SIZE>(vector2) ==
+          Catch::Approx(VectorOperations<double>::norm(vector2, SIZE)).epsilon(1e-15));
+  VectorOperations<double>::normalize(vector2, expected, SIZE);
+  VectorOperations<double>::normalize<SIZE>(vector2, result);
+  requireEqual(expected, result, SIZE);
+
+  // In-place operation as used by the propagators
+  VectorOperations<double>::add(vector1, vector2, expected, SIZE);
+  VectorOperations<double>::add<SIZE>(vector1, vector2, vector1);
+  requireEqual(expected, vector1, SIZE);
+}
+
+}  // namespace
+
+TEST_CASE("Fixed-size math operations", "[MathOperations]") {
+  SECTION("Matrix multiplication") {
+    checkMultiply<3, 3, 3>();
+    checkMultiply<3, 3, 1>();
+    checkMultiply<4, 4, 4>();
+    checkMultiply<4, 4, 1>();
+    checkMultiply<6, 6, 6>();
+    checkMultiply<6, 6, 1>();
+    checkMultiply<2, 5, 3>();
+  }
+
+  SECTION("Multiplication with the result aliasing an input is skipped") {
+    double matrix[9];
+    double vector[3] = {1, 2, 3};
+    fill(matrix, 9, 1.0);
+    MatrixOperations<double>::multiply<3, 3, 1>(matrix, vector, vector);
+    REQUIRE(vector[0] == 1);
+    REQUIRE(vector[1] == 2);
+    REQUIRE(vector[2] == 3);
+  }
+
+  SECTION("Element-wise matrix operations") {
+    checkElementWise<3, 3>();
+    checkElementWise<4, 4>();
+    checkElementWise<6, 6>();
+    checkElementWise<3, 1>();
+  }
+
+  SECTION("Transpose") {
+    double matrix[16];
+    double expected[16];
+    double result[16];
+    fill(matrix, 16, 0.5);
+    MatrixOperations<double>::transpose(matrix, expected, 4);
+    MatrixOperations<double>::transpose<4>(matrix, result);
+    requireEqual(expected, result, 16);
+    // In place
+    MatrixOperations<double>::transpose<4>(matrix, matrix);
+    requireEqual(expected, matrix, 16);
+  }
+
+  SECTION("Non-double types use the generic loops") {
+    float matrix1[9];
+    float matrix2[9];
+    float expected[9];
+    float result[9];
+    fill(matrix1, 9, -1.0);
+    fill(matrix2, 9, 2.0);
+    MatrixOperations<float>::multiply(matrix1, matrix2, expected, 3, 3, 3);
+    MatrixOperations<float>::multiply<3, 3, 3>(matrix1, matrix2, result);
+    requireEqual(expected, result, 9);
+    VectorOperations<float>::add(matrix1, matrix2, expected, 9);
+    VectorOperations<float>::add<9>(matrix1, matrix2, result);
+    requireEqual(expected, result, 9);
+  }
+
+  SECTION("Vector operations") {
+    checkVector<3>();
+    checkVector<4>();
+    checkVector<6>();
+  }
+
+  SECTION("Quaternion multiplication") {
+    double q1[4] = {0.1, -0.7, 0.3, 0.64};
+    double q2[4] = {-0.5, 0.2, 0.8, -0.26};
+    double expected[4];
+    expected[0] = q1[3] * q2[0] + q1[2] * q2[1] - q1[1] * q2[2] + q1[0] * q2[3];
+    expected[1] = -q1[2] * q2[0] + q1[3] * q2[1] + q1[0] * q2[2] + q1[1] * q2[3];
+    expected[2] = q1[1] * q2[0] - q1[0] * q2[1] + q1[3] * q2[2] + q1[2] * q2[3];
+    expected[3] = -q1[0] * q2[0] - q1[1] * q2[1] - q1[2] * q2[2] + q1[3] * q2[3];
+    double result[4];
+    QuaternionOperations::multiply(q1, q2, result);
+    requireEqual(expected, result, 4);
+    // The result may alias an input
+    QuaternionOperations::multiply(q1, q2, q1);
+    requireEqual(expected, q1, 4);
+  }
+}
@@ -0,0 +1,150 @@
+#include "DeviceFileMock.h"
+
+#include <fcntl.h>
+
+#include <cerrno>
+#include <cstdarg>
+#include <map>
+#include <mutex>
+
+extern "C" {
+int __real_open(const char* path, int flags, ...);
+int __real_close(int fd);
+int __real_ioctl(int fd, unsigned long request, ...);
+ssize_t __real_read(int fd, void* buf, size_t count);
+ssize_t __real_write(int fd, const void* buf, size_t count);
+}
+
+namespace {
+
+std::mutex registryMutex;
+std::map<std::string, DeviceFileMock*> mocksByPath;
+std::map<int, DeviceFileMock*> mocksByFd;
+
+DeviceFileMock* findMock(int fd) {
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto iter = mocksByFd.find(fd);
+  if (iter == mocksByFd.end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+
+}  // namespace
+
+DeviceFileMock::DeviceFileMock(std::string path) : path(std::move(path)) {
+  std::lock_guard<std::mutex> lock(registryMutex);
+  mocksByPath[this->path] = this;
+}
+
+DeviceFileMock::~DeviceFileMock() {
+  std::lock_guard<std::mutex> lock(registryMutex);
+  mocksByPath.erase(path);
+  for (auto iter = mocksByFd.begin(); iter != mocksByFd.end();) {
+    if (iter->second == this) {
+      iter = mocksByFd.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+int DeviceFileMock::ioctl(unsigned long request, void* arg) {
+  errno = ENOTTY;
+  return -1;
+}
+
+ssize_t DeviceFileMock::read(void* buf, size_t count) {
+  errno = EIO;
+  return -1;
+}
+
+ssize_t DeviceFileMock::write(const void* buf, size_t count) {
+  errno = EIO;
+  return -1;
+}
+
+const std::string& DeviceFileMock::getPath() const { return path; }
+
+void DeviceFileMock::resetCounts() {
+  counts.open = 0;
+  counts.close = 0;
+  counts.ioctl = 0;
+  counts.read = 0;
+  counts.write = 0;
+}
+
+extern "C" {
+
+int __wrap_open(const char* path, int flags, ...) {
+  mode_t mode = 0;
+  if ((flags & O_CREAT) != 0 or (flags & O_TMPFILE) == O_TMPFILE) {
+    va_list args;
+    va_start(args, flags);
+    mode = va_arg(args, mode_t);
+    va_end(args);
+  }
+  DeviceFileMock* mock = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto iter = mocksByPath.find(path);
+    if (iter != mocksByPath.end()) {
+      mock = iter->second;
+    }
+  }
+  if (mock == nullptr) {
+    return __real_open(path, flags, mode);
+  }
+  mock->counts.open++;
+  // The descriptor of /dev/null can not collide with a descriptor opened by someone else
+  int fd = __real_open("/dev/null", O_RDWR);
+  if (fd >= 0) {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    mocksByFd[fd] = mock;
+  }
+  return fd;
+}
+
+int __wrap_close(int fd) {
+  {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto iter = mocksByFd.find(fd);
+    if (iter != mocksByFd.end()) {
+      iter->second->counts.close++;
+      mocksByFd.erase(iter);
+    }
+  }
+  return __real_close(fd);
+}
+
+int __wrap_ioctl(int fd, unsigned long request, ...) {
+  va_list args;
+  va_start(args, request);
+  void* arg = va_arg(args, void*);
+  va_end(args);
+  DeviceFileMock* mock = findMock(fd);
+  if (mock == nullptr) {
+    return __real_ioctl(fd, request, arg);
+  }
+  mock->counts.ioctl++;
+  return mock->ioctl(request, arg);
+}
+
+ssize_t __wrap_read(int fd, void* buf, size_t count) {
+  DeviceFileMock* mock = findMock(fd);
+  if (mock == nullptr) {
+    return __real_read(fd, buf, count);
+  }
+  mock->counts.read++;
+  return mock->read(buf, count);
+}
+
+ssize_t __wrap_write(int fd, const void* buf, size_t count) {
+  DeviceFileMock* mock = findMock(fd);
+  if (mock == nullptr) {
+    return __real_write(fd, buf, count);
+  }
+  mock->counts.write++;
+  return mock->write(buf, count);
+}
+}
@@ -0,0 +1,48 @@
+#ifndef UNITTEST_HAL_DEVICEFILEMOCK_H_
+#define UNITTEST_HAL_DEVICEFILEMOCK_H_
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief   Stand-in for a Linux device file like /dev/spidev0.0 or /dev/i2c-1.
+ * @details
+ * The test executable is linked with --wrap for open, close, ioctl, read and write. Opening the
+ * path of a constructed mock returns a descriptor of /dev/null, and the calls on this descriptor
+ * are forwarded to the virtual functions of the mock. All other calls go to the C library.
+ * The calls on the mock are counted, so tests can check the number of system calls.
+ */
+class DeviceFileMock {
+ public:
+  struct SyscallCounts {
+    std::atomic<uint32_t> open{0};
+    std::atomic<uint32_t> close{0};
+    std::atomic<uint32_t> ioctl{0};
+    std::atomic<uint32_t> read{0};
+    std::atomic<uint32_t> write{0};
+  };
+
+  explicit DeviceFileMock(std::string path);
+  virtual ~DeviceFileMock();
+
+  DeviceFileMock(const DeviceFileMock&) = delete;
+  DeviceFileMock& operator=(const DeviceFileMock&) = delete;
+
+  //! Set errno and return -1 to simulate a failure
+  virtual int ioctl(unsigned long request, void* arg);
+  virtual ssize_t read(void* buf, size_t count);
+  virtual ssize_t write(const void* buf, size_t count);
+
+  const std::string& getPath() const;
+  void resetCounts();
+
+  SyscallCounts counts;
+
+ private:
+  std::string path;
+};
+
+#endif /* UNITTEST_HAL_DEVICEFILEMOCK_H_ */
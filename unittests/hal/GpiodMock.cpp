@@ -0,0 +1,138 @@
+#include "GpiodMock.h"
+
+#include <gpiod.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+GpiodMock* activeMock = nullptr;
+
+GpiodMock::Line* toLine(gpiod_line* line) { return reinterpret_cast<GpiodMock::Line*>(line); }
+
+int requestLine(gpiod_line* line, GpiodMock::Request request) {
+  if (line == nullptr) {
+    return -1;
+  }
+  toLine(line)->request = request;
+  return 0;
+}
+
+}  // namespace
+
+GpiodMock::GpiodMock() {
+  for (auto& line : lines) {
+    if (pipe(line.eventFds) != 0) {
+      line.eventFds[0] = -1;
+      line.eventFds[1] = -1;
+    }
+  }
+  activeMock = this;
+}
+
+GpiodMock::~GpiodMock() {
+  activeMock = nullptr;
+  for (auto& line : lines) {
+    for (int fd : line.eventFds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  }
+}
+
+bool GpiodMock::injectEdgeEvent(unsigned int lineNum, bool risingEdge, timespec timestamp) {
+  if (lineNum >= NUMBER_OF_LINES) {
+    return false;
+  }
+  gpiod_line_event event;
+  std::memset(&event, 0, sizeof(event));
+  event.ts = timestamp;
+  event.event_type = risingEdge ? GPIOD_LINE_EVENT_RISING_EDGE : GPIOD_LINE_EVENT_FALLING_EDGE;
+  return write(lines[lineNum].eventFds[1], &event, sizeof(event)) ==
+         static_cast<ssize_t>(sizeof(event));
+}
+
+extern "C" {
+
+gpiod_chip* gpiod_chip_open_by_label(const char* label) {
+  return reinterpret_cast<gpiod_chip*>(activeMock);
+}
+
+gpiod_chip* gpiod_chip_open_by_name(const char* name) {
+  return reinterpret_cast<gpiod_chip*>(activeMock);
+}
+
+void gpiod_chip_close(gpiod_chip* chip) {}
+
+int gpiod_ctxless_find_line(const char* name, char* chipname, size_t chipname_size,
+                            unsigned int* offset) {
+  if (std::strncmp(name, "line", 4) != 0 or chipname_size == 0) {
+    return 0;
+  }
+  *offset = std::strtoul(name + 4, nullptr, 10);
+  std::strncpy(chipname, "gpiochip0", chipname_size - 1);
+  chipname[chipname_size - 1] = '\0';
+  return 1;
+}
+
+gpiod_line* gpiod_chip_get_line(gpiod_chip* chip, unsigned int offset) {
+  auto* mock = reinterpret_cast<GpiodMock*>(chip);
+  if (mock == nullptr or offset >= GpiodMock::NUMBER_OF_LINES) {
+    return nullptr;
+  }
+  return reinterpret_cast<gpiod_line*>(&mock->lines[offset]);
+}
+
+int gpiod_line_request_output(gpiod_line* line, const char* consumer, int default_val) {
+  if (requestLine(line, GpiodMock::Request::OUTPUT) != 0) {
+    return -1;
+  }
+  toLine(line)->value = default_val;
+  return 0;
+}
+
+int gpiod_line_request_input(gpiod_line* line, const char* consumer) {
+  return requestLine(line, GpiodMock::Request::INPUT);
+}
+
+int gpiod_line_request_rising_edge_events(gpiod_line* line, const char* consumer) {
+  return requestLine(line, GpiodMock::Request::RISING_EDGE);
+}
+
+int gpiod_line_request_falling_edge_events(gpiod_line* line, const char* consumer) {
+  return requestLine(line, GpiodMock::Request::FALLING_EDGE);
+}
+
+int gpiod_line_request_both_edges_events(gpiod_line* line, const char* consumer) {
+  return requestLine(line, GpiodMock::Request::BOTH_EDGES);
+}
+
+int gpiod_line_event_get_fd(gpiod_line* line) { return toLine(line)->eventFds[0]; }
+
+int gpiod_line_event_read_fd(int fd, gpiod_line_event* event) {
+  if (read(fd, event, sizeof(*event)) != static_cast<ssize_t>(sizeof(*event))) {
+    return -1;
+  }
+  return 0;
+}
+
+void gpiod_line_release(gpiod_line* line) { requestLine(line, GpiodMock::Request::NONE); }
+
+int gpiod_line_set_value(gpiod_line* line, int value) {
+  if (line == nullptr or toLine(line)->request != GpiodMock::Request::OUTPUT) {
+    return -1;
+  }
+  toLine(line)->value = value;
+  return 0;
+}
+
+int gpiod_line_get_value(gpiod_line* line) {
+  if (line == nullptr) {
+    return -1;
+  }
+  return toLine(line)->value;
+}
+}
@@ -0,0 +1,43 @@
+#ifndef UNITTEST_HAL_GPIODMOCK_H_
+#define UNITTEST_HAL_GPIODMOCK_H_
+
+#include <ctime>
+
+/**
+ * @brief   Stand-in for a GPIO chip accessed with libgpiod.
+ * @details
+ * The test executable defines the libgpiod functions used by the LinuxLibgpioIF, so they take
+ * precedence over the ones of the library. They operate on the lines of the constructed mock.
+ * Each line has a pipe whose read end is the event file descriptor of the line. Edge events are
+ * written into the pipe with #injectEdgeEvent, so the event loop of the LinuxLibgpioIF can
+ * monitor the line with epoll like a real line.
+ * Only one instance may exist at a time.
+ */
+class GpiodMock {
+ public:
+  static constexpr unsigned int NUMBER_OF_LINES = 8;
+
+  enum class Request { NONE, INPUT, OUTPUT, RISING_EDGE, FALLING_EDGE, BOTH_EDGES };
+
+  struct Line {
+    Request request = Request::NONE;
+    int value = 0;
+    //! Read and write end of the event pipe
+    int eventFds[2] = {-1, -1};
+  };
+
+  GpiodMock();
+  ~GpiodMock();
+
+  GpiodMock(const GpiodMock&) = delete;
+  GpiodMock& operator=(const GpiodMock&) = delete;
+
+  /**
+   * @return false if the event could not be written into the pipe of the line
+   */
+  bool injectEdgeEvent(unsigned int lineNum, bool risingEdge, timespec timestamp);
+
+  Line lines[NUMBER_OF_LINES];
+};
+
+#endif /* UNITTEST_HAL_GPIODMOCK_H_ */
@@ -0,0 +1,205 @@
+#include <linux/i2c-dev.h>
+#include <linux/i2c.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "DeviceFileMock.h"
+#include "fsfw_hal/linux/i2c/I2cComIF.h"
+#include "fsfw_hal/linux/i2c/I2cCookie.h"
+#include "objects/systemObjectList.h"
+
+namespace {
+
+const char I2C_DEV[] = "/dev/i2c-mock";
+
+/**
+ * Register based devices. A write sets the register address of the device, a read returns the
+ * sum of the device address, the register address and the byte index.
+ */
+class I2cDevMock : public DeviceFileMock {
+ public:
+  I2cDevMock() : DeviceFileMock(I2C_DEV) {}
+
+  int ioctl(unsigned long request, void* arg) override {
+    if (request == I2C_SLAVE) {
+      slaveAddress = reinterpret_cast<uintptr_t>(arg);
+      return 0;
+    }
+    if (request != I2C_RDWR) {
+      errno = ENOTTY;
+      return -1;
+    }
+    auto* transfer = static_cast<i2c_rdwr_ioctl_data*>(arg);
+    messageSizes.push_back(transfer->nmsgs);
+    for (size_t idx = 0; idx < transfer->nmsgs; idx++) {
+      i2c_msg& message = transfer->msgs[idx];
+      if (nackAddresses.count(message.addr) != 0) {
+        // Like the Linux driver, no partial result is reported
+        errno = ENXIO;
+        return -1;
+      }
+      perform(message.addr, message.buf, message.len, message.flags & I2C_M_RD);
+    }
+    return transfer->nmsgs;
+  }
+
+  ssize_t read(void* buf, size_t count) override {
+    perform(slaveAddress, static_cast<uint8_t*>(buf), count, true);
+    return count;
+  }
+
+  ssize_t write(const void* buf, size_t count) override {
+    perform(slaveAddress, static_cast<uint8_t*>(const_cast<void*>(buf)), count, false);
+    return count;
+  }
+
+  void perform(uint16_t address, uint8_t* buf, size_t len, bool read) {
+    if (read) {
+      for (size_t idx = 0; idx < len; idx++) {
+        buf[idx] = address + registers[address] + idx;
+      }
+    } else {
+      registers[address] = buf[0];
+      writes[address]++;
+    }
+  }
+
+  uint16_t slaveAddress = 0;
+  std::map<uint16_t, uint8_t> registers;
+  //! Number of writes performed on each device
+  std::map<uint16_t, size_t> writes;
+  std::vector<size_t> messageSizes;
+  std::set<uint16_t> nackAddresses;
+};
+
+}  // namespace
+
+TEST_CASE("I2C Transfer Queue", "[I2cComIF]") {
+  I2cDevMock i2cDev;
+  I2cComIF comIF(objects::I2C_COM_IF);
+
+  constexpr size_t NUM_DEVICES = 4;
+  constexpr size_t LEN = 4;
+  std::vector<I2cCookie*> cookies;
+  for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+    cookies.push_back(new I2cCookie(0x10 + idx, 16, I2C_DEV));
+    REQUIRE(comIF.initializeInterface(cookies.back()) == HasReturnvaluesIF::RETURN_OK);
+  }
+  // Reads register 2 * idx of device idx
+  auto request = [&](size_t idx) {
+    uint8_t reg = 2 * idx;
+    ReturnValue_t result = comIF.sendMessage(cookies[idx], &reg, 1);
+    if (result != HasReturnvaluesIF::RETURN_OK) {
+      return result;
+    }
+    return comIF.requestReceiveMessage(cookies[idx], LEN);
+  };
+  auto checkReply = [&](size_t idx) {
+    uint8_t* buffer = nullptr;
+    size_t size = 0;
+    if (comIF.readReceivedMessage(cookies[idx], &buffer, &size) != HasReturnvaluesIF::RETURN_OK or
+        size != LEN) {
+      return false;
+    }
+    for (size_t byte = 0; byte < LEN; byte++) {
+      if (buffer[byte] != 0x10 + 3 * idx + byte) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  SECTION("Regular Transfers") {
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      REQUIRE(request(idx) == HasReturnvaluesIF::RETURN_OK);
+      CHECK(checkReply(idx));
+    }
+    CHECK(i2cDev.messageSizes.empty());
+    CHECK(i2cDev.counts.open == 2 * NUM_DEVICES);
+    CHECK(i2cDev.counts.close == 2 * NUM_DEVICES);
+    CHECK(i2cDev.counts.ioctl == 2 * NUM_DEVICES);
+    CHECK(i2cDev.counts.write == NUM_DEVICES);
+    CHECK(i2cDev.counts.read == NUM_DEVICES);
+  }
+
+  SECTION("Combined Transfers") {
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      cookies[idx]->setCombinedTransfer(true);
+      REQUIRE(request(idx) == HasReturnvaluesIF::RETURN_OK);
+      CHECK(checkReply(idx));
+    }
+    CHECK(i2cDev.messageSizes == std::vector<size_t>(NUM_DEVICES, 2));
+    CHECK(i2cDev.counts.open == NUM_DEVICES);
+    CHECK(i2cDev.counts.ioctl == NUM_DEVICES);
+    CHECK(i2cDev.counts.write == 0);
+    CHECK(i2cDev.counts.read == 0);
+  }
+
+  comIF.setTransferQueueMode(true);
+  for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+    cookies[idx]->setCombinedTransfer(true);
+  }
+
+  SECTION("Queued Transfers Are Batched") {
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      REQUIRE(request(idx) == HasReturnvaluesIF::RETURN_OK);
+    }
+    CHECK(comIF.getQueuedTransfers() == NUM_DEVICES);
+    CHECK(i2cDev.counts.ioctl == 0);
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      CHECK(checkReply(idx));
+    }
+    CHECK(i2cDev.messageSizes == std::vector<size_t>{2 * NUM_DEVICES});
+    CHECK(i2cDev.counts.open == 1);
+    CHECK(i2cDev.counts.close == 1);
+    CHECK(i2cDev.counts.ioctl == 1);
+    I2cComIF::TransferStatistics statistics;
+    comIF.getTransferStatistics(statistics);
+    CHECK(statistics.transfers == NUM_DEVICES);
+    CHECK(statistics.driverCalls == 1);
+    CHECK(statistics.bytes == NUM_DEVICES * (LEN + 1));
+  }
+
+  SECTION("All Transfers Are Repeated One By One After A Failed Batch") {
+    i2cDev.nackAddresses.insert(0x12);
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      REQUIRE(request(idx) == HasReturnvaluesIF::RETURN_OK);
+    }
+    CHECK(comIF.flushTransferQueue() == HasReturnvaluesIF::RETURN_FAILED);
+    CHECK(i2cDev.messageSizes == std::vector<size_t>{2 * NUM_DEVICES, 2, 2, 2, 2});
+    CHECK(i2cDev.counts.ioctl == 1 + NUM_DEVICES);
+    // The transfers before the failing one were performed in the batch and are repeated
+    CHECK(i2cDev.writes[0x10] == 2);
+    CHECK(i2cDev.writes[0x11] == 2);
+    CHECK(i2cDev.writes[0x13] == 1);
+    CHECK(checkReply(0));
+    CHECK(checkReply(1));
+    CHECK(not checkReply(2));
+    CHECK(checkReply(3));
+    I2cComIF::TransferStatistics statistics;
+    comIF.getTransferStatistics(statistics);
+    CHECK(statistics.transfers == NUM_DEVICES - 1);
+    CHECK(statistics.driverCalls == 1 + NUM_DEVICES);
+    CHECK(statistics.bytes == (NUM_DEVICES - 1) * (LEN + 1));
+  }
+
+  SECTION("Automatic Flush") {
+    comIF.setTransferQueueMode(true, 2);
+    REQUIRE(request(0) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(i2cDev.counts.ioctl == 0);
+    REQUIRE(request(1) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(i2cDev.messageSizes == std::vector<size_t>{4});
+    CHECK(comIF.getQueuedTransfers() == 0);
+    CHECK(checkReply(0));
+    CHECK(checkReply(1));
+  }
+
+  comIF.setTransferQueueMode(false);
+  for (auto* cookie : cookies) {
+    delete cookie;
+  }
+}
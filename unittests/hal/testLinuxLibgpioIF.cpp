@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include <ctime>
+#include <thread>
+
+#include "GpiodMock.h"
+#include "fsfw/ipc/CommandMessage.h"
+#include "fsfw/ipc/QueueFactory.h"
+#include "fsfw/tasks/SemaphoreFactory.h"
+#include "fsfw_hal/common/gpio/GpioCookie.h"
+#include "fsfw_hal/common/gpio/GpioMessage.h"
+#include "fsfw_hal/linux/gpio/LinuxLibgpioIF.h"
+#include "objects/systemObjectList.h"
+
+namespace {
+
+constexpr gpioId_t OUTPUT_GPIO = 1;
+constexpr gpioId_t EDGE_GPIO = 2;
+constexpr gpioId_t INPUT_GPIO = 3;
+constexpr unsigned int OUTPUT_LINE = 0;
+constexpr unsigned int EDGE_LINE = 4;
+constexpr unsigned int INPUT_LINE = 5;
+
+}  // namespace
+
+TEST_CASE("Linux libgpiod GPIO Interface", "[LinuxLibgpioIF]") {
+  GpiodMock gpiod;
+  LinuxLibgpioIF gpioIF(objects::GPIO_IF);
+
+  // The GPIO configurations are deleted by the GPIO interface
+  auto* cookie = new GpioCookie();
+  cookie->addGpio(OUTPUT_GPIO, new GpiodRegularByChip("gpiochip0", OUTPUT_LINE, "test",
+                                                      gpio::Direction::OUT, gpio::Levels::HIGH));
+  auto* edgeGpio = new GpiodRegularByChip("gpiochip0", EDGE_LINE, "test");
+  edgeGpio->edgeDetection = gpio::EdgeDetection::BOTH;
+  cookie->addGpio(EDGE_GPIO, edgeGpio);
+  cookie->addGpio(INPUT_GPIO, new GpiodRegularByLineName("line5", "test"));
+  REQUIRE(gpioIF.addGpios(cookie) == HasReturnvaluesIF::RETURN_OK);
+
+  SECTION("Regular GPIOs") {
+    CHECK(gpiod.lines[OUTPUT_LINE].request == GpiodMock::Request::OUTPUT);
+    CHECK(gpiod.lines[OUTPUT_LINE].value == 1);
+    CHECK(gpiod.lines[EDGE_LINE].request == GpiodMock::Request::BOTH_EDGES);
+    CHECK(gpiod.lines[INPUT_LINE].request == GpiodMock::Request::INPUT);
+    CHECK(gpioIF.pullLow(OUTPUT_GPIO) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(gpiod.lines[OUTPUT_LINE].value == 0);
+    gpiod.lines[INPUT_LINE].value = 1;
+    int state = 0;
+    CHECK(gpioIF.readGpio(INPUT_GPIO, &state) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(state == 1);
+    CHECK(gpioIF.pullHigh(4) == LinuxLibgpioIF::UNKNOWN_GPIO_ID);
+  }
+
+  SECTION("Edge Events") {
+    MessageQueueIF* queue = QueueFactory::instance()->createMessageQueue(5);
+    SemaphoreIF* semaphore = SemaphoreFactory::instance()->createCountingSemaphore(5, 0);
+    CHECK(gpioIF.registerEdgeEventListener(INPUT_GPIO, queue->getId()) ==
+          LinuxLibgpioIF::NO_EDGE_DETECTION);
+    CHECK(gpioIF.registerEdgeEventListener(INPUT_GPIO, semaphore) ==
+          LinuxLibgpioIF::NO_EDGE_DETECTION);
+    REQUIRE(gpioIF.registerEdgeEventListener(EDGE_GPIO, queue->getId()) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(gpioIF.registerEdgeEventListener(EDGE_GPIO, semaphore) ==
+            HasReturnvaluesIF::RETURN_OK);
+
+    ReturnValue_t loopResult = HasReturnvaluesIF::RETURN_FAILED;
+    std::thread eventLoop([&]() { loopResult = gpioIF.performOperation(0); });
+
+    timespec timestamp = {100, 200};
+    for (unsigned int idx = 0; idx < 3; idx++) {
+      bool risingEdge = idx % 2 == 0;
+      timestamp.tv_nsec = idx;
+      REQUIRE(gpiod.injectEdgeEvent(EDGE_LINE, risingEdge, timestamp));
+      // The semaphore is released after the message was sent
+      REQUIRE(semaphore->acquire(SemaphoreIF::TimeoutType::WAITING, 1000) ==
+              HasReturnvaluesIF::RETURN_OK);
+      CommandMessage message;
+      REQUIRE(queue->receiveMessage(&message) == HasReturnvaluesIF::RETURN_OK);
+      CHECK(message.getCommand() == static_cast<Command_t>(GpioMessage::EDGE_EVENT));
+      gpio::EdgeEvent event;
+      GpioMessage::getEdgeEvent(&message, &event);
+      CHECK(event.gpioId == EDGE_GPIO);
+      CHECK(event.level == (risingEdge ? gpio::Levels::HIGH : gpio::Levels::LOW));
+      CHECK(event.timestamp.tv_sec == 100);
+      CHECK(event.timestamp.tv_nsec == idx);
+    }
+    gpio::EdgeEvent lastEvent;
+    uint32_t eventCount = 0;
+    CHECK(gpioIF.getLastEdgeEvent(EDGE_GPIO, &lastEvent, &eventCount) ==
+          HasReturnvaluesIF::RETURN_OK);
+    CHECK(eventCount == 3);
+    CHECK(lastEvent.level == gpio::Levels::HIGH);
+
+    // Only the semaphore is released once the queue listener was removed
+    REQUIRE(gpioIF.registerEdgeEventListener(EDGE_GPIO, MessageQueueIF::NO_QUEUE) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(gpiod.injectEdgeEvent(EDGE_LINE, false, timestamp));
+    REQUIRE(semaphore->acquire(SemaphoreIF::TimeoutType::WAITING, 1000) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CommandMessage message;
+    CHECK(queue->receiveMessage(&message) == static_cast<ReturnValue_t>(MessageQueueIF::EMPTY));
+
+    gpioIF.stopEventLoop();
+    eventLoop.join();
+    CHECK(loopResult == HasReturnvaluesIF::RETURN_OK);
+    CHECK(gpioIF.getLastEdgeEvent(EDGE_GPIO, &lastEvent, &eventCount) ==
+          HasReturnvaluesIF::RETURN_OK);
+    CHECK(eventCount == 4);
+
+    QueueFactory::instance()->deleteMessageQueue(queue);
+    SemaphoreFactory::instance()->deleteSemaphore(semaphore);
+  }
+}
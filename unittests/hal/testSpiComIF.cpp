@@ -0,0 +1,266 @@
+#include <linux/spi/spidev.h>
+#include <sys/ioctl.h>
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DeviceFileMock.h"
+#include "fsfw_hal/common/gpio/GpioIF.h"
+#include "fsfw_hal/linux/spi/SpiComIF.h"
+#include "fsfw_hal/linux/spi/SpiCookie.h"
+#include "objects/systemObjectList.h"
+
+namespace {
+
+const char SPI_DEV[] = "/dev/spidev-mock";
+
+/**
+ * Answers each full-duplex transfer with the inverted send data and logs the bus activity.
+ */
+class SpiDevMock : public DeviceFileMock {
+ public:
+  SpiDevMock(std::vector<std::string>& log) : DeviceFileMock(SPI_DEV), log(log) {}
+
+  int ioctl(unsigned long request, void* arg) override {
+    if (request == SPI_IOC_WR_MODE or request == SPI_IOC_WR_MAX_SPEED_HZ) {
+      return 0;
+    }
+    if (_IOC_TYPE(request) != SPI_IOC_MAGIC or _IOC_NR(request) != 0) {
+      errno = ENOTTY;
+      return -1;
+    }
+    size_t numTransfers = _IOC_SIZE(request) / sizeof(spi_ioc_transfer);
+    auto* transfers = static_cast<spi_ioc_transfer*>(arg);
+    if (numTransfers == 1 and transfers[0].len == 0) {
+      // Clock polarity update
+      return 0;
+    }
+    std::lock_guard<std::mutex> lock(logMutex);
+    if (failTransfers) {
+      errno = EIO;
+      return -1;
+    }
+    messageSizes.push_back(numTransfers);
+    for (size_t idx = 0; idx < numTransfers; idx++) {
+      auto* tx = reinterpret_cast<const uint8_t*>(transfers[idx].tx_buf);
+      auto* rx = reinterpret_cast<uint8_t*>(transfers[idx].rx_buf);
+      for (size_t byte = 0; byte < transfers[idx].len; byte++) {
+        rx[byte] = ~tx[byte];
+      }
+      log.push_back("transfer " + std::to_string(tx[0]));
+    }
+    return static_cast<int>(numTransfers);
+  }
+
+  std::mutex logMutex;
+  std::vector<std::string>& log;
+  std::vector<size_t> messageSizes;
+  bool failTransfers = false;
+};
+
+class GpioMock : public GpioIF {
+ public:
+  GpioMock(std::vector<std::string>& log) : log(log) {}
+
+  ReturnValue_t addGpios(GpioCookie* cookie) override { return RETURN_OK; }
+  ReturnValue_t pullHigh(gpioId_t gpioId) override {
+    log.push_back("high " + std::to_string(gpioId));
+    return RETURN_OK;
+  }
+  ReturnValue_t pullLow(gpioId_t gpioId) override {
+    log.push_back("low " + std::to_string(gpioId));
+    return RETURN_OK;
+  }
+  ReturnValue_t readGpio(gpioId_t gpioId, int* gpioState) override { return RETURN_OK; }
+
+  std::vector<std::string>& log;
+};
+
+bool checkReply(SpiComIF& comIF, SpiCookie& cookie, uint8_t firstByte, size_t len) {
+  if (comIF.requestReceiveMessage(&cookie, len) != HasReturnvaluesIF::RETURN_OK) {
+    return false;
+  }
+  uint8_t* buffer = nullptr;
+  size_t size = 0;
+  if (comIF.readReceivedMessage(&cookie, &buffer, &size) != HasReturnvaluesIF::RETURN_OK or
+      size != len) {
+    return false;
+  }
+  for (size_t idx = 0; idx < len; idx++) {
+    if (buffer[idx] != static_cast<uint8_t>(~(firstByte + idx))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST_CASE("SPI Transfer Queue", "[SpiComIF]") {
+  std::vector<std::string> log;
+  SpiDevMock spiDev(log);
+  GpioMock gpio(log);
+  SpiComIF comIF(objects::SPI_COM_IF, &gpio);
+
+  constexpr size_t NUM_DEVICES = 4;
+  constexpr size_t LEN = 4;
+  std::vector<SpiCookie*> cookies;
+  for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+    cookies.push_back(new SpiCookie(idx, SPI_DEV, 16, spi::SpiModes::MODE_0, 1000000));
+    REQUIRE(comIF.initializeInterface(cookies.back()) == HasReturnvaluesIF::RETURN_OK);
+  }
+  // Send data of device idx starts with 16 * idx
+  auto send = [&](size_t idx) {
+    uint8_t data[LEN];
+    for (size_t byte = 0; byte < LEN; byte++) {
+      data[byte] = 16 * idx + byte;
+    }
+    return comIF.sendMessage(cookies[idx], data, LEN);
+  };
+  spiDev.resetCounts();
+  comIF.resetTransferStatistics();
+
+  SECTION("Regular Transfers") {
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      REQUIRE(send(idx) == HasReturnvaluesIF::RETURN_OK);
+      CHECK(checkReply(comIF, *cookies[idx], 16 * idx, LEN));
+    }
+    CHECK(spiDev.messageSizes == std::vector<size_t>(NUM_DEVICES, 1));
+    CHECK(spiDev.counts.open == NUM_DEVICES);
+    CHECK(spiDev.counts.close == NUM_DEVICES);
+    SpiComIF::TransferStatistics statistics;
+    comIF.getTransferStatistics(statistics);
+    CHECK(statistics.transfers == NUM_DEVICES);
+    CHECK(statistics.driverCalls == NUM_DEVICES);
+    CHECK(statistics.bytes == NUM_DEVICES * LEN);
+  }
+
+  SECTION("Queued Transfers Are Batched") {
+    comIF.setTransferQueueMode(true);
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      REQUIRE(send(idx) == HasReturnvaluesIF::RETURN_OK);
+    }
+    CHECK(comIF.getQueuedTransfers() == NUM_DEVICES);
+    CHECK(spiDev.counts.open == 0);
+    CHECK(spiDev.messageSizes.empty());
+    // The first reply request flushes the whole queue with one message
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      CHECK(checkReply(comIF, *cookies[idx], 16 * idx, LEN));
+    }
+    CHECK(spiDev.messageSizes == std::vector<size_t>{NUM_DEVICES});
+    CHECK(comIF.getQueuedTransfers() == 0);
+    // Mode, speed, clock update and the message itself
+    CHECK(spiDev.counts.open == 1);
+    CHECK(spiDev.counts.ioctl == 4);
+    SpiComIF::TransferStatistics statistics;
+    comIF.getTransferStatistics(statistics);
+    CHECK(statistics.transfers == NUM_DEVICES);
+    CHECK(statistics.driverCalls == 1);
+    CHECK(statistics.bytes == NUM_DEVICES * LEN);
+  }
+
+  SECTION("Batch Size Limit") {
+    comIF.setTransferQueueMode(true, SpiComIF::DEFAULT_MAX_QUEUED_TRANSFERS, 2 * LEN);
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      REQUIRE(send(idx) == HasReturnvaluesIF::RETURN_OK);
+    }
+    REQUIRE(comIF.flushTransferQueue() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(spiDev.messageSizes == std::vector<size_t>{2, 2});
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      CHECK(checkReply(comIF, *cookies[idx], 16 * idx, LEN));
+    }
+  }
+
+  SECTION("Automatic Flush") {
+    comIF.setTransferQueueMode(true, 2);
+    REQUIRE(send(0) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(send(1) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(spiDev.messageSizes.empty());
+    // The queue is full
+    REQUIRE(send(2) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(spiDev.messageSizes == std::vector<size_t>{2});
+    CHECK(comIF.getQueuedTransfers() == 1);
+    // A pending transfer of the same device
+    REQUIRE(send(2) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(spiDev.messageSizes == std::vector<size_t>{2, 1});
+    CHECK(comIF.getQueuedTransfers() == 1);
+    for (size_t idx = 0; idx < 3; idx++) {
+      CHECK(checkReply(comIF, *cookies[idx], 16 * idx, LEN));
+    }
+    // Disabling the queue mode flushes the queue as well
+    REQUIRE(send(3) == HasReturnvaluesIF::RETURN_OK);
+    comIF.setTransferQueueMode(false);
+    CHECK(spiDev.messageSizes == std::vector<size_t>{2, 1, 1, 1});
+    CHECK(checkReply(comIF, *cookies[3], 48, LEN));
+  }
+
+  SECTION("Failed Automatic Flush Is Propagated") {
+    comIF.setTransferQueueMode(true, 2);
+    REQUIRE(send(0) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(send(1) == HasReturnvaluesIF::RETURN_OK);
+    spiDev.failTransfers = true;
+    CHECK(send(2) == SpiComIF::FULL_DUPLEX_TRANSFER_FAILED);
+    // The new transfer is not queued
+    CHECK(comIF.getQueuedTransfers() == 0);
+    CHECK(comIF.requestReceiveMessage(cookies[0], LEN) == SpiComIF::FULL_DUPLEX_TRANSFER_FAILED);
+    CHECK(comIF.requestReceiveMessage(cookies[1], LEN) == SpiComIF::FULL_DUPLEX_TRANSFER_FAILED);
+    CHECK(comIF.requestReceiveMessage(cookies[2], LEN) == HasReturnvaluesIF::RETURN_OK);
+
+    spiDev.failTransfers = false;
+    REQUIRE(send(2) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(checkReply(comIF, *cookies[2], 32, LEN));
+  }
+
+  SECTION("GPIO Chip Select Keeps The Bus Order") {
+    auto* gpioCookie = new SpiCookie(NUM_DEVICES, 7, SPI_DEV, 16, spi::SpiModes::MODE_0, 1000000);
+    REQUIRE(comIF.initializeInterface(gpioCookie) == HasReturnvaluesIF::RETURN_OK);
+    cookies.push_back(gpioCookie);
+    comIF.setTransferQueueMode(true);
+    log.clear();
+    REQUIRE(send(0) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(send(1) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(send(NUM_DEVICES) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(send(2) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(comIF.flushTransferQueue() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(log == std::vector<std::string>{"transfer 0", "transfer 16", "low 7", "transfer 64",
+                                          "high 7", "transfer 32"});
+    CHECK(spiDev.messageSizes == std::vector<size_t>{2, 1, 1});
+    CHECK(checkReply(comIF, *gpioCookie, 64, LEN));
+  }
+
+  SECTION("Queue Shared By Several Tasks") {
+    comIF.setTransferQueueMode(true, 3);
+    constexpr size_t CYCLES = 200;
+    std::atomic<uint32_t> failures{0};
+    std::vector<std::thread> threads;
+    for (size_t idx = 0; idx < NUM_DEVICES; idx++) {
+      threads.emplace_back([&, idx]() {
+        for (size_t cycle = 0; cycle < CYCLES; cycle++) {
+          if (send(idx) != HasReturnvaluesIF::RETURN_OK or
+              not checkReply(comIF, *cookies[idx], 16 * idx, LEN)) {
+            failures++;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    CHECK(failures == 0);
+    CHECK(comIF.getQueuedTransfers() == 0);
+    SpiComIF::TransferStatistics statistics;
+    comIF.getTransferStatistics(statistics);
+    CHECK(statistics.transfers == NUM_DEVICES * CYCLES);
+    CHECK(statistics.bytes == NUM_DEVICES * CYCLES * LEN);
+    CHECK(statistics.driverCalls == spiDev.messageSizes.size());
+  }
+
+  for (auto cookie : cookies) {
+    delete cookie;
+  }
+}
@@ -0,0 +1,72 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "fsfw/platform.h"
+#include "fsfw/tasks/TaskFactory.h"
+#include "fsfw_hal/linux/uart/UartComIF.h"
+#include "fsfw_hal/linux/uart/UartCookie.h"
+#include "tests/TestsConfig.h"
+
+#ifdef PLATFORM_UNIX
+
+TEST_CASE("UART Ring Buffer Reception", "[uart-ring-buffer]") {
+  // A pseudo terminal is used as a stand-in for the UART
+  int ptyMaster = posix_openpt(O_RDWR | O_NOCTTY);
+  REQUIRE(ptyMaster >= 0);
+  REQUIRE(grantpt(ptyMaster) == 0);
+  REQUIRE(unlockpt(ptyMaster) == 0);
+  std::string ptySlave = ptsname(ptyMaster);
+
+  UartComIF uartComIF(objects::UART_COM_IF);
+  UartCookie cookie(objects::NO_OBJECT, ptySlave, UartModes::NON_CANONICAL,
+                    UartBaudRate::RATE_921600, 32);
+  cookie.setRingBufferReception(64);
+  REQUIRE(uartComIF.initializeInterface(&cookie) == HasReturnvaluesIF::RETURN_OK);
+  std::thread receptionThread([&]() { uartComIF.performOperation(0); });
+
+  auto receive = [&](uint8_t** buffer, size_t* size) {
+    // Give the reception thread time to read the data
+    TaskFactory::delayTask(20);
+    REQUIRE(uartComIF.requestReceiveMessage(&cookie, 0) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(uartComIF.readReceivedMessage(&cookie, buffer, size) == HasReturnvaluesIF::RETURN_OK);
+  };
+
+  uint8_t* buffer = nullptr;
+  size_t size = 0;
+  SECTION("Simple Reception") {
+    const uint8_t data[] = {1, 2, 3, 4, 5};
+    REQUIRE(write(ptyMaster, data, sizeof(data)) == sizeof(data));
+    receive(&buffer, &size);
+    REQUIRE(size == sizeof(data));
+    CHECK(std::memcmp(buffer, data, sizeof(data)) == 0);
+    // Data is released with the next read
+    REQUIRE(uartComIF.readReceivedMessage(&cookie, &buffer, &size) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(size == 0);
+  }
+
+  SECTION("Wrapped Reception") {
+    uint8_t data[24];
+    for (uint8_t cycle = 0; cycle < 5; cycle++) {
+      for (uint8_t idx = 0; idx < sizeof(data); idx++) {
+        data[idx] = cycle * sizeof(data) + idx;
+      }
+      REQUIRE(write(ptyMaster, data, sizeof(data)) == sizeof(data));
+      receive(&buffer, &size);
+      REQUIRE(size == sizeof(data));
+      CHECK(std::memcmp(buffer, data, sizeof(data)) == 0);
+    }
+    CHECK(uartComIF.getDiscardedBytes(&cookie) == 0);
+  }
+
+  uartComIF.stopReception();
+  receptionThread.join();
+  close(ptyMaster);
+}
+
+#endif
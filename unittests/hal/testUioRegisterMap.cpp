@@ -0,0 +1,105 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+
+#include "fsfw/platform.h"
+#include "fsfw_hal/linux/uio/UioRegisterMap.h"
+#include "tests/TestsConfig.h"
+
+#ifdef PLATFORM_UNIX
+
+namespace {
+using Control = uio::Register<0x00>;
+using Enable = uio::Field<Control, 0>;
+using Mode = uio::Field<Control, 4, 3>;
+using Status = uio::Register<0x04>;
+using FillLevel = uio::Field<Status, 8, 12>;
+using Id = uio::Register<0x0a, uint16_t>;
+using Data = uio::Register<0x10>;
+}  // namespace
+
+static const char REGISTER_FILE_NAME[] = "/tmp/fsfw-unittest-uio-registers.bin";
+static const char INTERRUPT_FIFO_NAME[] = "/tmp/fsfw-unittest-uio-interrupt";
+
+TEST_CASE("UIO Register Map", "[uio]") {
+  // A file-backed mapping is used as a stand-in for the memory of the IP core
+  constexpr size_t MAP_SIZE = 64;
+  int fd = open(REGISTER_FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  REQUIRE(fd >= 0);
+  REQUIRE(ftruncate(fd, MAP_SIZE) == 0);
+  void* mapping = mmap(nullptr, MAP_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  REQUIRE(mapping != MAP_FAILED);
+  auto* words = static_cast<uint32_t*>(mapping);
+  UioRegisterMap registerMap(mapping, MAP_SIZE);
+  REQUIRE(registerMap.isMapped());
+  REQUIRE(registerMap.getSize() == MAP_SIZE);
+
+  SECTION("Registers And Fields") {
+    registerMap.write<Control>(0xf0f0f0f0);
+    CHECK(words[0] == 0xf0f0f0f0);
+    registerMap.writeField<Enable>(1);
+    registerMap.writeField<Mode>(0b101);
+    CHECK(words[0] == 0xf0f0f0d1);
+    CHECK(registerMap.readField<Mode>() == 0b101);
+    registerMap.modify<Control>(0xff000000, 0x00000100);
+    CHECK(registerMap.read<Control>() == 0x00f0f1d1);
+
+    words[1] = 0x00abcdef;
+    CHECK(registerMap.readField<FillLevel>() == 0xbcd);
+    // Field values are truncated to the field width
+    registerMap.writeField<FillLevel>(0x1234);
+    CHECK(words[1] == 0x00a234ef);
+
+    registerMap.write<Id>(0xbeef);
+    CHECK(registerMap.read<Id>() == 0xbeef);
+    CHECK(words[2] == 0xbeef0000);
+  }
+
+  SECTION("Block Accesses") {
+    const uint32_t data[4] = {1, 2, 3, 0xffffffff};
+    REQUIRE(registerMap.writeBlock<Data>(data, 4) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(words[4] == 1);
+    CHECK(words[7] == 0xffffffff);
+    uint32_t readBack[4] = {};
+    REQUIRE(registerMap.readBlock(0x10, readBack, 4) == HasReturnvaluesIF::RETURN_OK);
+    for (size_t idx = 0; idx < 4; idx++) {
+      CHECK(readBack[idx] == data[idx]);
+    }
+    // The last register of the map can be accessed, the one after it not
+    REQUIRE(registerMap.readBlock(MAP_SIZE - 4, readBack, 1) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(registerMap.readBlock(MAP_SIZE - 4, readBack, 2) == UioRegisterMap::OUT_OF_BOUNDS);
+    CHECK(registerMap.writeBlock(MAP_SIZE, data, 1) == UioRegisterMap::OUT_OF_BOUNDS);
+    CHECK(registerMap.writeBlock(0x02, data, 1) == UioRegisterMap::OUT_OF_BOUNDS);
+    UioRegisterMap unmapped;
+    CHECK(unmapped.readBlock(0, readBack, 1) == UioRegisterMap::NOT_MAPPED);
+  }
+
+  munmap(mapping, MAP_SIZE);
+  std::remove(REGISTER_FILE_NAME);
+}
+
+TEST_CASE("UIO Interrupt Wait", "[uio]") {
+  // A FIFO is used as a stand-in for the UIO device file which returns the interrupt count
+  std::remove(INTERRUPT_FIFO_NAME);
+  REQUIRE(mkfifo(INTERRUPT_FIFO_NAME, 0644) == 0);
+  UioMapper mapper(INTERRUPT_FIFO_NAME);
+  uint32_t interruptCount = 0;
+  CHECK(mapper.waitForInterrupt(10, &interruptCount) == UioMapper::INTERRUPT_TIMEOUT);
+
+  int fd = open(INTERRUPT_FIFO_NAME, O_WRONLY | O_NONBLOCK);
+  REQUIRE(fd >= 0);
+  uint32_t count = 7;
+  REQUIRE(write(fd, &count, sizeof(count)) == sizeof(count));
+  REQUIRE(mapper.waitForInterrupt(100, &interruptCount) == HasReturnvaluesIF::RETURN_OK);
+  CHECK(interruptCount == 7);
+  CHECK(mapper.waitForInterrupt(0) == UioMapper::INTERRUPT_TIMEOUT);
+  close(fd);
+  std::remove(INTERRUPT_FIFO_NAME);
+}
+
+#endif
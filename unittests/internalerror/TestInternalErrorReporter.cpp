@@ -7,6 +7,8 @@
 
 #include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
 
 #include "CatchDefinitions.h"
 #include "fsfw/action/ActionMessage.h"
@@ -115,6 +117,71 @@ TEST_CASE("Internal Error Reporter", "[TestInternalError]") {
       internalErrorReporter->performOperation(0);
     }
   }
+  SECTION("Breakdown") {
+    const MessageQueueId_t destination = testQueue->getId();
+    const object_id_t storeId = 0x12345678;
+    const object_id_t highStoreId = 0xFFFFFFFE;
+    constexpr size_t NUM_THREADS = 4;
+    constexpr uint32_t HITS_PER_THREAD = 2500;
+    // Flush errors of previous tests, then report the errors concurrently
+    internalErrorReporter->performOperation(0);
+    CommandMessage hkMessage;
+    store_address_t storeAddress;
+    while (hkQueue->receiveMessage(&hkMessage) == HasReturnvaluesIF::RETURN_OK) {
+      HousekeepingMessage::getUpdateSnapshotSetCommand(&hkMessage, &storeAddress);
+      ipcStore->deleteData(storeAddress);
+    }
+    // Errors without a valid source are only counted in the totals
+    internalErrorReporter->storeFullWithId(objects::NO_OBJECT);
+    internalErrorReporter->queueMessageNotSentTo(MessageQueueIF::NO_QUEUE);
+    internalErrorReporter->storeFullWithId(highStoreId);
+    std::vector<std::thread> threads;
+    for (size_t idx = 0; idx < NUM_THREADS; idx++) {
+      threads.emplace_back([&]() {
+        for (uint32_t hit = 0; hit < HITS_PER_THREAD; hit++) {
+          internalErrorReporter->queueMessageNotSentTo(destination);
+          internalErrorReporter->storeFullWithId(storeId);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    internalErrorReporter->performOperation(0);
+    REQUIRE(hkQueue->receiveMessage(&hkMessage) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(hkMessage.getCommand() == HousekeepingMessage::UPDATE_SNAPSHOT_SET);
+    HousekeepingMessage::getUpdateSnapshotSetCommand(&hkMessage, &storeAddress);
+    ConstAccessorPair data = ipcStore->getData(storeAddress);
+    REQUIRE(data.first == HasReturnvaluesIF::RETURN_OK);
+    CCSDSTime::CDS_short time;
+    InternalErrorDataset dataset(objects::INTERNAL_ERROR_REPORTER);
+    HousekeepingSnapshot hkSnapshot(&time, &dataset);
+    const uint8_t* buffer = data.second.data();
+    size_t size = data.second.size();
+    auto result = hkSnapshot.deSerialize(&buffer, &size, SerializeIF::Endianness::MACHINE);
+    REQUIRE(result == HasReturnvaluesIF::RETURN_OK);
+    bool queueFound = false;
+    bool storeFound = false;
+    bool highStoreFound = false;
+    for (size_t idx = 0; idx < InternalErrorDataset::BREAKDOWN_ENTRIES; idx++) {
+      CHECK(dataset.storeHitIds.value[idx] != objects::NO_OBJECT);
+      if (dataset.storeHitIds.value[idx] == highStoreId) {
+        highStoreFound = true;
+        CHECK(dataset.storeHitCounts.value[idx] == 1);
+      }
+      if (dataset.queueHitIds.value[idx] == destination) {
+        queueFound = true;
+        CHECK(dataset.queueHitCounts.value[idx] >= NUM_THREADS * HITS_PER_THREAD);
+      }
+      if (dataset.storeHitIds.value[idx] == storeId) {
+        storeFound = true;
+        CHECK(dataset.storeHitCounts.value[idx] == NUM_THREADS * HITS_PER_THREAD);
+      }
+    }
+    CHECK(queueFound);
+    CHECK(storeFound);
+    CHECK(highStoreFound);
+  }
   QueueFactory::instance()->deleteMessageQueue(testQueue);
   QueueFactory::instance()->deleteMessageQueue(hkQueue);
 }
@@ -0,0 +1,246 @@
+#include <fsfw/objectmanager/ObjectManager.h>
+#include <fsfw/objectmanager/SystemObject.h>
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CatchDefinitions.h"
+
+namespace {
+
+class FirstTestIF {
+ public:
+  virtual ~FirstTestIF() = default;
+  virtual int first() = 0;
+};
+
+class SecondTestIF {
+ public:
+  virtual ~SecondTestIF() = default;
+  virtual int second() = 0;
+};
+
+class FirstTestObject : public SystemObject, public FirstTestIF {
+ public:
+  FirstTestObject(object_id_t objectId) : SystemObject(objectId) {}
+  int first() override { return 1; }
+};
+
+class BothTestObject : public SystemObject, public FirstTestIF, public SecondTestIF {
+ public:
+  BothTestObject(object_id_t objectId) : SystemObject(objectId) {}
+  int first() override { return 3; }
+  int second() override { return 4; }
+};
+
+constexpr object_id_t FIRST_OBJECT_ID = 0x7e000001;
+constexpr object_id_t BOTH_OBJECT_ID = 0x7e000002;
+constexpr object_id_t MISSING_OBJECT_ID = 0x7e000003;
+
+//! Object manager which is independent of the global one
+class SchedulerTestManager : public ObjectManager {
+ public:
+  SchedulerTestManager() { setObjectFactoryFunction([](void* args) {}, nullptr); }
+};
+
+//! Records the order in which the objects finished their initialization
+class InitLog {
+ public:
+  void record(object_id_t objectId) {
+    std::lock_guard<std::mutex> guard(lock);
+    order.push_back(objectId);
+  }
+  std::vector<object_id_t> getOrder() {
+    std::lock_guard<std::mutex> guard(lock);
+    return order;
+  }
+
+ private:
+  std::mutex lock;
+  std::vector<object_id_t> order;
+};
+
+/**
+ * Optionally sleeps and looks up another object during its initialization. The object is not
+ * registered in the global object manager and is deleted by the manager it is inserted into.
+ */
+class InitTestObject : public SystemObject {
+ public:
+  InitTestObject(ObjectManager& manager, InitLog& log, object_id_t objectId,
+                 object_id_t lookupId = objects::NO_OBJECT, uint32_t delayMs = 0)
+      : SystemObject(objectId, false),
+        manager(manager),
+        log(log),
+        lookupId(lookupId),
+        delayMs(delayMs) {
+    manager.insert(objectId, this);
+  }
+
+  ReturnValue_t initialize() override {
+    initializeCalls++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+    if (lookupId != objects::NO_OBJECT) {
+      auto* other = manager.get<InitTestObject>(lookupId);
+      lookupSawInitialized = other != nullptr and other->initialized;
+    }
+    initialized = true;
+    log.record(getObjectId());
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+
+  std::atomic<bool> initialized{false};
+  std::atomic<uint32_t> initializeCalls{0};
+  //! Whether the looked up object was initialized when the lookup returned
+  std::atomic<bool> lookupSawInitialized{false};
+
+ private:
+  ObjectManager& manager;
+  InitLog& log;
+  object_id_t lookupId;
+  uint32_t delayMs;
+};
+
+constexpr object_id_t INIT_OBJECT_1 = 0x7e000011;
+constexpr object_id_t INIT_OBJECT_2 = 0x7e000012;
+constexpr object_id_t INIT_OBJECT_3 = 0x7e000013;
+constexpr object_id_t INIT_OBJECT_4 = 0x7e000014;
+
+}  // namespace
+
+TEST_CASE("Object Manager Lookup", "[ObjectManager]") {
+  ObjectManager* objectManager = ObjectManager::instance();
+  // The object manager was already initialized by the test setup, so these objects are
+  // inserted into the frozen object list
+  FirstTestObject firstObject(FIRST_OBJECT_ID);
+  {
+    BothTestObject bothObject(BOTH_OBJECT_ID);
+
+    // The second lookup returns the cached casts
+    for (uint8_t lookup = 0; lookup < 2; lookup++) {
+      FirstTestIF* first = objectManager->get<FirstTestIF>(FIRST_OBJECT_ID);
+      REQUIRE(first == &firstObject);
+      CHECK(first->first() == 1);
+      CHECK(objectManager->get<SecondTestIF>(FIRST_OBJECT_ID) == nullptr);
+      SecondTestIF* second = objectManager->get<SecondTestIF>(BOTH_OBJECT_ID);
+      REQUIRE(second == &bothObject);
+      CHECK(second->second() == 4);
+      CHECK(objectManager->get<FirstTestIF>(BOTH_OBJECT_ID) == &bothObject);
+      CHECK(objectManager->get<SystemObjectIF>(BOTH_OBJECT_ID) == &bothObject);
+      CHECK(objectManager->get<FirstTestIF>(MISSING_OBJECT_ID) == nullptr);
+    }
+  }
+  // Removing an object invalidates the cached casts
+  CHECK(objectManager->get<FirstTestIF>(BOTH_OBJECT_ID) == nullptr);
+  CHECK(objectManager->get<SecondTestIF>(BOTH_OBJECT_ID) == nullptr);
+  CHECK(objectManager->get<FirstTestIF>(FIRST_OBJECT_ID) == &firstObject);
+  CHECK(objectManager->remove(MISSING_OBJECT_ID) ==
+        static_cast<ReturnValue_t>(ObjectManagerIF::NOT_FOUND));
+
+  // Other objects of the framework are still found
+  CHECK(objectManager->get<SystemObjectIF>(objects::INTERNAL_ERROR_REPORTER) != nullptr);
+}
+
+TEST_CASE("Object Manager Initialization Order", "[ObjectManager]") {
+  SchedulerTestManager manager;
+  InitLog log;
+  new InitTestObject(manager, log, INIT_OBJECT_1);
+  new InitTestObject(manager, log, INIT_OBJECT_2);
+  new InitTestObject(manager, log, INIT_OBJECT_3);
+
+  SECTION("Declared Dependencies Are Initialized First") {
+    new InitTestObject(manager, log, INIT_OBJECT_4);
+    manager.addInitDependency(INIT_OBJECT_1, INIT_OBJECT_3);
+    // Dependencies on unknown objects are ignored
+    manager.addInitDependency(INIT_OBJECT_2, MISSING_OBJECT_ID);
+    manager.initialize();
+    CHECK(log.getOrder() ==
+          std::vector<object_id_t>{INIT_OBJECT_2, INIT_OBJECT_3, INIT_OBJECT_1, INIT_OBJECT_4});
+  }
+
+  SECTION("Cyclic Dependencies Are Broken In The Order Of The Object IDs") {
+    manager.addInitDependency(INIT_OBJECT_1, INIT_OBJECT_2);
+    manager.addInitDependency(INIT_OBJECT_2, INIT_OBJECT_1);
+    manager.initialize();
+    CHECK(log.getOrder() == std::vector<object_id_t>{INIT_OBJECT_3, INIT_OBJECT_1, INIT_OBJECT_2});
+    for (object_id_t objectId : {INIT_OBJECT_1, INIT_OBJECT_2, INIT_OBJECT_3}) {
+      CHECK(manager.get<InitTestObject>(objectId)->initializeCalls == 1);
+    }
+  }
+
+  SECTION("Initialization Durations") {
+    new InitTestObject(manager, log, INIT_OBJECT_4, objects::NO_OBJECT, 20);
+    manager.initialize();
+    const auto& durations = manager.getInitDurations();
+    REQUIRE(durations.size() == 4);
+    CHECK(std::is_sorted(durations.begin(), durations.end(),
+                         [](const ObjectManager::InitDuration& first,
+                            const ObjectManager::InitDuration& second) {
+                           return first.objectId < second.objectId;
+                         }));
+    CHECK(durations[0].objectId == INIT_OBJECT_1);
+    CHECK(durations[3].objectId == INIT_OBJECT_4);
+    CHECK(durations[3].initializeUs >= 15000);
+  }
+}
+
+#if defined(FSFW_OSAL_HOST) || defined(FSFW_OSAL_LINUX)
+TEST_CASE("Object Manager Parallel Initialization", "[ObjectManager]") {
+  SchedulerTestManager manager;
+  InitLog log;
+
+  SECTION("Lookups Wait For The Initialization") {
+    manager.setInitializationThreads(4);
+    auto* first = new InitTestObject(manager, log, INIT_OBJECT_1, INIT_OBJECT_2);
+    auto* second = new InitTestObject(manager, log, INIT_OBJECT_2, objects::NO_OBJECT, 30);
+    auto* third = new InitTestObject(manager, log, INIT_OBJECT_3, INIT_OBJECT_2);
+    manager.initialize();
+    CHECK(first->lookupSawInitialized);
+    CHECK(third->lookupSawInitialized);
+    CHECK(second->initializeCalls == 1);
+    std::vector<object_id_t> order = log.getOrder();
+    REQUIRE(order.size() == 3);
+    CHECK(order[0] == INIT_OBJECT_2);
+  }
+
+  SECTION("Declared Dependencies Are Kept") {
+    manager.setInitializationThreads(4);
+    new InitTestObject(manager, log, INIT_OBJECT_1);
+    new InitTestObject(manager, log, INIT_OBJECT_2, objects::NO_OBJECT, 20);
+    manager.addInitDependency(INIT_OBJECT_1, INIT_OBJECT_2);
+    manager.initialize();
+    CHECK(log.getOrder() == std::vector<object_id_t>{INIT_OBJECT_2, INIT_OBJECT_1});
+  }
+
+  SECTION("Cyclic Lookups Do Not Deadlock") {
+    manager.setInitializationThreads(2);
+    // Both objects are initialized at the same time. The first lookup waits, the second one
+    // would wait for the waiting thread and returns immediately.
+    auto* first = new InitTestObject(manager, log, INIT_OBJECT_1, INIT_OBJECT_2, 20);
+    auto* second = new InitTestObject(manager, log, INIT_OBJECT_2, INIT_OBJECT_1, 60);
+    manager.initialize();
+    CHECK(first->lookupSawInitialized);
+    CHECK(not second->lookupSawInitialized);
+    CHECK(first->initializeCalls == 1);
+    CHECK(second->initializeCalls == 1);
+    CHECK(log.getOrder() == std::vector<object_id_t>{INIT_OBJECT_2, INIT_OBJECT_1});
+  }
+
+  SECTION("Lookups Of Pending Objects Run Their Initialization") {
+    // The second thread is busy with the slow object, so the looked up object is initialized
+    // by the thread which looks it up
+    manager.setInitializationThreads(2);
+    auto* first = new InitTestObject(manager, log, INIT_OBJECT_1, INIT_OBJECT_3);
+    new InitTestObject(manager, log, INIT_OBJECT_2, objects::NO_OBJECT, 50);
+    auto* third = new InitTestObject(manager, log, INIT_OBJECT_3);
+    manager.initialize();
+    CHECK(first->lookupSawInitialized);
+    CHECK(third->initializeCalls == 1);
+    CHECK(log.getOrder() == std::vector<object_id_t>{INIT_OBJECT_3, INIT_OBJECT_1, INIT_OBJECT_2});
+  }
+}
+#endif
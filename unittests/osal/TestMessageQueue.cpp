@@ -53,6 +53,37 @@ TEST_CASE("MessageQueue Basic Test", "[TestMq]") {
     REQUIRE(result == retval::CATCH_OK);
     CHECK(recvMessage.getData()[0] == 42);
   }
+  SECTION("Batch Tests") {
+    MessageQueueIF* batchReceiverMq = QueueFactory::instance()->createMessageQueue(4);
+    std::array<MessageQueueMessage, 5> messages;
+    std::array<MessageQueueMessage, 5> recvMessages;
+    std::array<MessageQueueMessageIF*, 5> messagePointers;
+    std::array<MessageQueueMessageIF*, 5> recvPointers;
+    for (size_t idx = 0; idx < messages.size(); idx++) {
+      testData[0] = idx;
+      messages[idx] = MessageQueueMessage(testData.data(), 1);
+      messagePointers[idx] = &messages[idx];
+      recvPointers[idx] = &recvMessages[idx];
+    }
+    size_t sent = 0;
+    auto result = testSenderMq->sendMessages(batchReceiverMq->getId(), messagePointers.data(), 5,
+                                             &sent, true);
+    REQUIRE(result == MessageQueueIF::FULL);
+    CHECK(sent == 4);
+    size_t received = 0;
+    result = batchReceiverMq->receiveMessages(recvPointers.data(), 5, &received);
+    REQUIRE(result == retval::CATCH_OK);
+    REQUIRE(received == 4);
+    for (size_t idx = 0; idx < received; idx++) {
+      CHECK(recvMessages[idx].getData()[0] == idx);
+      CHECK(recvMessages[idx].getSender() == testSenderMqId);
+    }
+    CHECK(batchReceiverMq->getLastPartner() == testSenderMqId);
+    result = batchReceiverMq->receiveMessages(recvPointers.data(), 5, &received);
+    REQUIRE(result == static_cast<ReturnValue_t>(MessageQueueIF::EMPTY));
+    CHECK(received == 0);
+    QueueFactory::instance()->deleteMessageQueue(batchReceiverMq);
+  }
   // We have to clear MQs ourself ATM
   QueueFactory::instance()->deleteMessageQueue(testSenderMq);
   QueueFactory::instance()->deleteMessageQueue(testReceiverMq);
@@ -0,0 +1,107 @@
+#include <fsfw/ipc/MessageQueueIF.h>
+#include <fsfw/ipc/QueueFactory.h>
+#include <fsfw/osal/linux/MessageQueueWaitSet.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+
+#include "CatchDefinitions.h"
+
+TEST_CASE("MessageQueue Wait Set", "[TestMq]") {
+  MessageQueueIF* senderMq = QueueFactory::instance()->createMessageQueue(3);
+  MessageQueueIF* firstMq = QueueFactory::instance()->createMessageQueue(3);
+  MessageQueueIF* secondMq = QueueFactory::instance()->createMessageQueue(3);
+  MessageQueueWaitSet waitSet;
+  REQUIRE(waitSet.addQueue(firstMq->getId(), 1) == retval::CATCH_OK);
+  REQUIRE(waitSet.addQueue(secondMq->getId(), 2) == retval::CATCH_OK);
+  CHECK(waitSet.addQueue(secondMq->getId(), 1) == MessageQueueWaitSet::INVALID_SOURCE_ID);
+  CHECK(waitSet.addQueue(secondMq->getId(), MessageQueueWaitSet::WAKE_UP) ==
+        MessageQueueWaitSet::INVALID_SOURCE_ID);
+
+  std::array<uint32_t, 4> ready{};
+  size_t readyCount = 0;
+  std::array<uint8_t, 4> testData{42};
+  MessageQueueMessage testMessage(testData.data(), testData.size());
+  MessageQueueMessage recvMessage;
+
+  SECTION("Queues") {
+    CHECK(waitSet.wait(0, ready.data(), ready.size(), &readyCount) ==
+          MessageQueueWaitSet::WAIT_TIMEOUT);
+    CHECK(readyCount == 0);
+    REQUIRE(senderMq->sendMessage(secondMq->getId(), &testMessage) == retval::CATCH_OK);
+    REQUIRE(waitSet.wait(0, ready.data(), ready.size(), &readyCount) == retval::CATCH_OK);
+    REQUIRE(readyCount == 1);
+    CHECK(ready[0] == 2);
+    // The queue stays ready until the message was received
+    REQUIRE(waitSet.wait(0, ready.data(), ready.size(), &readyCount) == retval::CATCH_OK);
+    CHECK(readyCount == 1);
+    REQUIRE(secondMq->receiveMessage(&recvMessage) == retval::CATCH_OK);
+    CHECK(recvMessage.getData()[0] == 42);
+    CHECK(waitSet.wait(0, ready.data(), ready.size(), &readyCount) ==
+          MessageQueueWaitSet::WAIT_TIMEOUT);
+
+    // A message sent by another thread wakes up the blocking wait
+    std::thread sender([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      senderMq->sendMessage(firstMq->getId(), &testMessage);
+    });
+    REQUIRE(waitSet.wait(-1, ready.data(), ready.size(), &readyCount) == retval::CATCH_OK);
+    sender.join();
+    REQUIRE(readyCount == 1);
+    CHECK(ready[0] == 1);
+    REQUIRE(firstMq->receiveMessage(&recvMessage) == retval::CATCH_OK);
+
+    REQUIRE(waitSet.removeSource(1) == retval::CATCH_OK);
+    CHECK(waitSet.removeSource(1) == MessageQueueWaitSet::INVALID_SOURCE_ID);
+    REQUIRE(senderMq->sendMessage(firstMq->getId(), &testMessage) == retval::CATCH_OK);
+    CHECK(waitSet.wait(0, ready.data(), ready.size(), &readyCount) ==
+          MessageQueueWaitSet::WAIT_TIMEOUT);
+    REQUIRE(firstMq->receiveMessage(&recvMessage) == retval::CATCH_OK);
+  }
+
+  SECTION("Wake Up And File Descriptors") {
+    waitSet.wakeUp();
+    waitSet.wakeUp();
+    REQUIRE(waitSet.wait(-1, ready.data(), ready.size(), &readyCount) == retval::CATCH_OK);
+    REQUIRE(readyCount == 1);
+    CHECK(ready[0] == MessageQueueWaitSet::WAKE_UP);
+    CHECK(waitSet.wait(0, ready.data(), ready.size(), &readyCount) ==
+          MessageQueueWaitSet::WAIT_TIMEOUT);
+
+    int eventFd = eventfd(0, EFD_NONBLOCK);
+    REQUIRE(eventFd >= 0);
+    REQUIRE(waitSet.addFileDescriptor(eventFd, 3) == retval::CATCH_OK);
+    uint64_t value = 1;
+    REQUIRE(write(eventFd, &value, sizeof(value)) == sizeof(value));
+    REQUIRE(senderMq->sendMessage(firstMq->getId(), &testMessage) == retval::CATCH_OK);
+    REQUIRE(waitSet.wait(0, ready.data(), ready.size(), &readyCount) == retval::CATCH_OK);
+    CHECK(readyCount == 2);
+    // Only one source is reported if the array is too small, the other one is reported next
+    REQUIRE(waitSet.wait(0, ready.data(), 1, &readyCount) == retval::CATCH_OK);
+    CHECK(readyCount == 1);
+    REQUIRE(firstMq->receiveMessage(&recvMessage) == retval::CATCH_OK);
+    REQUIRE(read(eventFd, &value, sizeof(value)) == sizeof(value));
+    CHECK(waitSet.wait(0, ready.data(), ready.size(), &readyCount) ==
+          MessageQueueWaitSet::WAIT_TIMEOUT);
+    REQUIRE(waitSet.removeSource(3) == retval::CATCH_OK);
+    close(eventFd);
+  }
+
+  SECTION("Periodic Timer") {
+    REQUIRE(waitSet.addPeriodicTimer(20, 4) == retval::CATCH_OK);
+    REQUIRE(waitSet.wait(1000, ready.data(), ready.size(), &readyCount) == retval::CATCH_OK);
+    REQUIRE(readyCount == 1);
+    CHECK(ready[0] == 4);
+    CHECK(waitSet.getTimerExpirations(4) >= 1);
+    // The expiration was consumed by the wait set
+    CHECK(waitSet.wait(0, ready.data(), ready.size(), &readyCount) ==
+          MessageQueueWaitSet::WAIT_TIMEOUT);
+  }
+
+  QueueFactory::instance()->deleteMessageQueue(senderMq);
+  QueueFactory::instance()->deleteMessageQueue(firstMq);
+  QueueFactory::instance()->deleteMessageQueue(secondMq);
+}
@@ -0,0 +1,186 @@
+#include <fsfw/ipc/CommandMessage.h>
+#include <fsfw/osal/linux/SharedMemoryPool.h>
+#include <fsfw/osal/linux/SharedMessageQueue.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+#include "CatchDefinitions.h"
+
+static const char POOL_NAME[] = "/fsfw-unittest-pool";
+static const char DOMAIN_NAME[] = "/fsfw-unittest-queues";
+static const Command_t TEST_COMMAND = 0x1005;
+static const Command_t OTHER_COMMAND = 0x1006;
+// Local copies, because Catch2 binds the static const members to references
+static const ReturnValue_t DATA_DOES_NOT_EXIST = StorageManagerIF::DATA_DOES_NOT_EXIST;
+static const ReturnValue_t DATA_STORAGE_FULL = StorageManagerIF::DATA_STORAGE_FULL;
+static const ReturnValue_t DATA_TOO_LARGE = StorageManagerIF::DATA_TOO_LARGE;
+static const ReturnValue_t ILLEGAL_STORAGE_ID = StorageManagerIF::ILLEGAL_STORAGE_ID;
+static const ReturnValue_t EMPTY = MessageQueueIF::EMPTY;
+static const ReturnValue_t FULL = MessageQueueIF::FULL;
+static const ReturnValue_t DESTINATION_INVALID = MessageQueueIF::DESTINATION_INVALID;
+
+TEST_CASE("Shared Memory Pool", "[SharedMemory]") {
+  LocalPool::LocalPoolConfig config = {{2, 8}, {4, 64}};
+  SharedMemoryPool owner(objects::NO_OBJECT, POOL_NAME, config,
+                         SharedMemoryPool::Mode::CREATE);
+  REQUIRE(owner.isMapped());
+  // A second mapping in the same process stands in for another process
+  SharedMemoryPool user(objects::NO_OBJECT, POOL_NAME, config, SharedMemoryPool::Mode::ATTACH);
+  REQUIRE(user.isMapped());
+  CHECK(owner.getNumberOfSubPools() == 2);
+
+  std::array<uint8_t, 40> data{};
+  for (size_t idx = 0; idx < data.size(); idx++) {
+    data[idx] = idx;
+  }
+  store_address_t storeId;
+  REQUIRE(owner.addData(&storeId, data.data(), data.size()) == retval::CATCH_OK);
+  CHECK(storeId.poolIndex == 1);
+  {
+    ConstAccessorPair accessor = user.getData(storeId);
+    REQUIRE(accessor.first == retval::CATCH_OK);
+    REQUIRE(accessor.second.size() == data.size());
+    CHECK(std::memcmp(accessor.second.data(), data.data(), data.size()) == 0);
+    // The accessor deletes the element on destruction
+  }
+  const uint8_t* readPtr = nullptr;
+  size_t size = 0;
+  CHECK(owner.getData(storeId, &readPtr, &size) == DATA_DOES_NOT_EXIST);
+
+  uint8_t* writePtr = nullptr;
+  REQUIRE(user.getFreeElement(&storeId, 4, &writePtr) == retval::CATCH_OK);
+  CHECK(storeId.poolIndex == 0);
+  std::memcpy(writePtr, data.data(), 4);
+  REQUIRE(owner.getData(storeId, &readPtr, &size) == retval::CATCH_OK);
+  CHECK(size == 4);
+  CHECK(readPtr[3] == 3);
+  REQUIRE(user.deleteData(writePtr, 4) == retval::CATCH_OK);
+
+  SECTION("Full And Invalid") {
+    for (size_t idx = 0; idx < 2; idx++) {
+      REQUIRE(owner.addData(&storeId, data.data(), 8) == retval::CATCH_OK);
+    }
+    CHECK(user.addData(&storeId, data.data(), 8) == DATA_STORAGE_FULL);
+    CHECK(user.addData(&storeId, data.data(), 65) == DATA_TOO_LARGE);
+    CHECK(user.getData(store_address_t(2, 0), &readPtr, &size) ==
+          ILLEGAL_STORAGE_ID);
+    uint8_t fillCount[3] = {};
+    uint8_t written = 0;
+    owner.getFillCount(fillCount, &written);
+    CHECK(written == 3);
+    CHECK(fillCount[0] == 100);
+    user.clearStore();
+    REQUIRE(owner.addData(&storeId, data.data(), 8) == retval::CATCH_OK);
+  }
+
+  SECTION("Layout Mismatch") {
+    LocalPool::LocalPoolConfig otherConfig = {{2, 8}, {5, 64}};
+    SharedMemoryPool other(objects::NO_OBJECT, POOL_NAME, otherConfig,
+                           SharedMemoryPool::Mode::ATTACH);
+    CHECK(not other.isMapped());
+  }
+}
+
+TEST_CASE("Shared Message Queue", "[SharedMemory]") {
+  SharedMessageQueueDomain owner(DOMAIN_NAME, 2, 3, SharedMessageQueueDomain::Mode::CREATE);
+  REQUIRE(owner.isMapped());
+  SharedMessageQueueDomain user(DOMAIN_NAME, 2, 3, SharedMessageQueueDomain::Mode::ATTACH);
+  REQUIRE(user.isMapped());
+  SharedMessageQueue receiverQueue(owner, 0);
+  SharedMessageQueue senderQueue(user, 1);
+  MessageQueueIF& receiver = receiverQueue;
+  MessageQueueIF& sender = senderQueue;
+  CHECK(receiver.getId() == SharedMessageQueue::getQueueId(0));
+
+  CommandMessage command(TEST_COMMAND, 0x1234, 0x5678);
+  CommandMessage received;
+  CHECK(receiver.receiveMessage(&received) == EMPTY);
+  REQUIRE(sender.sendMessage(receiver.getId(), &command) == retval::CATCH_OK);
+  MessageQueueId_t senderId = MessageQueueIF::NO_QUEUE;
+  REQUIRE(receiver.receiveMessage(&received, &senderId) == retval::CATCH_OK);
+  CHECK(senderId == sender.getId());
+  CHECK(received.getCommand() == TEST_COMMAND);
+  CHECK(received.getParameter() == 0x1234);
+  CHECK(received.getParameter2() == 0x5678);
+
+  // The replies go to the queue of the sender in the other mapping
+  REQUIRE(receiver.reply(&command) == retval::CATCH_OK);
+  REQUIRE(sender.receiveMessage(&received) == retval::CATCH_OK);
+  CHECK(sender.getLastPartner() == receiver.getId());
+
+  SECTION("Full And Invalid") {
+    // The depth is rounded up to four
+    for (size_t idx = 0; idx < 4; idx++) {
+      REQUIRE(sender.sendMessage(receiver.getId(), &command, true) == retval::CATCH_OK);
+    }
+    CHECK(sender.sendMessage(receiver.getId(), &command, true) == FULL);
+    uint32_t count = 0;
+    REQUIRE(receiver.flush(&count) == retval::CATCH_OK);
+    CHECK(count == 4);
+    CHECK(sender.sendMessage(SharedMessageQueue::getQueueId(2), &command) ==
+          DESTINATION_INVALID);
+    CHECK(sender.sendMessage(5, &command) == DESTINATION_INVALID);
+  }
+
+  SECTION("Batches") {
+    std::array<CommandMessage, 6> commands;
+    std::array<CommandMessage, 6> receivedCommands;
+    std::array<MessageQueueMessageIF*, 6> commandPointers;
+    std::array<MessageQueueMessageIF*, 6> receivedPointers;
+    for (size_t idx = 0; idx < commands.size(); idx++) {
+      commands[idx].setCommand(TEST_COMMAND);
+      commands[idx].setParameter(idx);
+      commandPointers[idx] = &commands[idx];
+      receivedPointers[idx] = &receivedCommands[idx];
+    }
+    // Only four of the six messages fit into the queue
+    size_t sent = 0;
+    CHECK(sender.sendMessages(receiver.getId(), commandPointers.data(), 6, &sent, true) == FULL);
+    CHECK(sent == 4);
+    size_t receivedCount = 0;
+    REQUIRE(receiver.receiveMessages(receivedPointers.data(), 3, &receivedCount) ==
+            retval::CATCH_OK);
+    CHECK(receivedCount == 3);
+    REQUIRE(sender.sendMessages(receiver.getId(), commandPointers.data() + 4, 2, &sent) ==
+            retval::CATCH_OK);
+    CHECK(sent == 2);
+    REQUIRE(receiver.receiveMessages(receivedPointers.data() + 3, 6, &receivedCount) ==
+            retval::CATCH_OK);
+    CHECK(receivedCount == 3);
+    for (size_t idx = 0; idx < receivedCommands.size(); idx++) {
+      CHECK(receivedCommands[idx].getParameter() == idx);
+      CHECK(receivedCommands[idx].getSender() == sender.getId());
+    }
+    CHECK(receiver.getLastPartner() == sender.getId());
+    CHECK(receiver.receiveMessages(receivedPointers.data(), 6, &receivedCount) == EMPTY);
+    CHECK(receivedCount == 0);
+  }
+
+  SECTION("Other Process") {
+    CHECK(receiverQueue.waitForMessage(5) == EMPTY);
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+      SharedMessageQueueDomain childDomain(DOMAIN_NAME, 2, 3,
+                                           SharedMessageQueueDomain::Mode::ATTACH);
+      SharedMessageQueue childQueue(childDomain, 1);
+      usleep(10000);
+      CommandMessage childCommand(OTHER_COMMAND, 42, 0);
+      ReturnValue_t result =
+          childQueue.sendMessageFrom(SharedMessageQueue::getQueueId(0), &childCommand,
+                                     childQueue.getId());
+      _exit(result == HasReturnvaluesIF::RETURN_OK ? 0 : 1);
+    }
+    REQUIRE(receiverQueue.waitForMessage(2000) == retval::CATCH_OK);
+    REQUIRE(receiver.receiveMessage(&received) == retval::CATCH_OK);
+    CHECK(received.getCommand() == OTHER_COMMAND);
+    CHECK(received.getParameter() == 42);
+    int status = 0;
+    waitpid(child, &status, 0);
+    CHECK(WEXITSTATUS(status) == 0);
+  }
+}
@@ -0,0 +1,177 @@
+#include <fsfw/osal/common/TraceRingFile.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CatchDefinitions.h"
+
+namespace {
+
+constexpr size_t CAPACITY = 8;
+constexpr uint32_t OBJECT_ID = 0x12345678;
+constexpr size_t HEADER_SIZE = 64;
+constexpr size_t RECORD_SIZE = 32;
+
+/**
+ * Raw file content, read like the decoder does instead of through the structures of the
+ * TraceRingFile.
+ */
+class TraceFileContent {
+ public:
+  explicit TraceFileContent(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    REQUIRE(file != nullptr);
+    uint8_t buffer[256];
+    size_t read = 0;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+      raw.insert(raw.end(), buffer, buffer + read);
+    }
+    std::fclose(file);
+  }
+
+  template <typename T>
+  T get(size_t offset) const {
+    T value;
+    std::memcpy(&value, raw.data() + offset, sizeof(value));
+    return value;
+  }
+  uint64_t getWriteIndex() const { return get<uint64_t>(24); }
+  uint32_t getSequence(size_t slot) const { return get<uint32_t>(recordOffset(slot)); }
+  uint32_t getId(size_t slot) const { return get<uint32_t>(recordOffset(slot) + 8); }
+  uint64_t getTimestamp(size_t slot) const { return get<uint64_t>(recordOffset(slot) + 16); }
+
+  static size_t recordOffset(size_t slot) { return HEADER_SIZE + slot * RECORD_SIZE; }
+
+  std::vector<uint8_t> raw;
+};
+
+void writeRecords(TraceRingFile& ring, uint32_t firstId, uint32_t count) {
+  for (uint32_t id = firstId; id < firstId + count; id++) {
+    ring.write(trace::RecordTypes::USER, id, OBJECT_ID, id * 10, ~id);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("Trace Ring File", "[TraceRingFile]") {
+  char pathTemplate[] = "/tmp/fsfw-unittest-trace-XXXXXX";
+  int fd = mkstemp(pathTemplate);
+  REQUIRE(fd >= 0);
+  close(fd);
+  const std::string path = pathTemplate;
+
+  TraceRingFile ring(path, CAPACITY);
+  REQUIRE(ring.open(false) == retval::CATCH_OK);
+  writeRecords(ring, 0, 5);
+  CHECK(ring.getRecordCount() == 5);
+  REQUIRE(ring.sync(true) == retval::CATCH_OK);
+  ring.close();
+
+  {
+    TraceFileContent content(path);
+    REQUIRE(content.raw.size() == HEADER_SIZE + CAPACITY * RECORD_SIZE);
+    CHECK(std::memcmp(content.raw.data(), "FSFWTRC1", 8) == 0);
+    CHECK(content.get<uint32_t>(8) == TraceRingFile::FILE_VERSION);
+    CHECK(content.get<uint32_t>(12) == RECORD_SIZE);
+    CHECK(content.get<uint64_t>(16) == CAPACITY);
+    CHECK(content.getWriteIndex() == 5);
+    for (size_t slot = 0; slot < 5; slot++) {
+      size_t offset = TraceFileContent::recordOffset(slot);
+      CHECK(content.getSequence(slot) == slot + 1);
+      CHECK(content.get<uint8_t>(offset + 4) == static_cast<uint8_t>(trace::RecordTypes::USER));
+      CHECK(content.getId(slot) == slot);
+      CHECK(content.get<uint32_t>(offset + 12) == OBJECT_ID);
+      CHECK(content.getTimestamp(slot) != 0);
+      CHECK(content.get<uint32_t>(offset + 24) == slot * 10);
+      CHECK(content.get<uint32_t>(offset + 28) == ~static_cast<uint32_t>(slot));
+    }
+    CHECK(content.getTimestamp(4) >= content.getTimestamp(0));
+    for (size_t slot = 5; slot < CAPACITY; slot++) {
+      CHECK(content.getSequence(slot) == 0);
+    }
+  }
+
+  SECTION("Preserved Records Wrap Around") {
+    REQUIRE(ring.open(true) == retval::CATCH_OK);
+    CHECK(ring.getRecordCount() == 5);
+    // Records written through the trace channel end up in the ring as well
+    trace::setSink(&ring);
+    trace::record(trace::RecordTypes::USER, 5, OBJECT_ID, 50, ~5u);
+    trace::setSink(nullptr);
+    writeRecords(ring, 6, 6);
+    CHECK(ring.getRecordCount() == 12);
+    ring.close();
+
+    TraceFileContent content(path);
+    CHECK(content.getWriteIndex() == 12);
+    // The first four slots were overwritten by the records 8 to 11
+    for (size_t slot = 0; slot < CAPACITY; slot++) {
+      uint32_t index = slot < 4 ? slot + CAPACITY : slot;
+      CHECK(content.getSequence(slot) == index + 1);
+      CHECK(content.getId(slot) == index);
+    }
+
+    std::string decoder = FSFW_TRACE_DECODER_SCRIPT;
+    if (std::system("python3 --version > /dev/null 2>&1") != 0) {
+      WARN("python3 is not available, the trace decoder is not checked");
+    } else {
+      std::string command = "python3 " + decoder + " --csv " + path;
+      FILE* output = popen(command.c_str(), "r");
+      REQUIRE(output != nullptr);
+      std::vector<std::string> lines;
+      char line[256];
+      while (std::fgets(line, sizeof(line), output) != nullptr) {
+        lines.emplace_back(line);
+      }
+      CHECK(pclose(output) == 0);
+      // Header line and the records 4 to 11 in the order they were written
+      REQUIRE(lines.size() == 1 + CAPACITY);
+      CHECK(lines[0] == "index,time,type,id,object,parameter1,parameter2\n");
+      for (uint32_t index = 4; index < 12; index++) {
+        char idField[16];
+        std::snprintf(idField, sizeof(idField), "%#010x", index);
+        std::string expectedStart = std::to_string(index) + ",";
+        std::string expectedFields = ",USER_0x80," + std::string(idField) + ",0x12345678," +
+                                     std::to_string(index * 10) + "," +
+                                     std::to_string(~index) + "\n";
+        const std::string& record = lines[index - 3];
+        CHECK(record.compare(0, expectedStart.size(), expectedStart) == 0);
+        REQUIRE(record.size() > expectedFields.size());
+        CHECK(record.compare(record.size() - expectedFields.size(), expectedFields.size(),
+                             expectedFields) == 0);
+      }
+    }
+  }
+
+  SECTION("Layout Changes Reset The File") {
+    TraceRingFile largerRing(path, 2 * CAPACITY);
+    REQUIRE(largerRing.open(true) == retval::CATCH_OK);
+    CHECK(largerRing.getRecordCount() == 0);
+    largerRing.close();
+    CHECK(TraceFileContent(path).getSequence(0) == 0);
+  }
+
+  SECTION("Records Are Dropped Without Preserve") {
+    REQUIRE(ring.open(false) == retval::CATCH_OK);
+    CHECK(ring.getRecordCount() == 0);
+    writeRecords(ring, 0, 1);
+    ring.close();
+    TraceFileContent content(path);
+    CHECK(content.getWriteIndex() == 1);
+    CHECK(content.getSequence(1) == 0);
+  }
+
+  SECTION("Closed Ring") {
+    // Records are ignored while the file is not open
+    writeRecords(ring, 0, 1);
+    CHECK(ring.getRecordCount() == 0);
+    CHECK(ring.sync() == retval::CATCH_FAILED);
+  }
+
+  std::remove(path.c_str());
+}
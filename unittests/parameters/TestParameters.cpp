@@ -0,0 +1,201 @@
+#include <fsfw/ipc/CommandMessage.h>
+#include <fsfw/ipc/QueueFactory.h>
+#include <fsfw/parameters/ParameterHelper.h>
+#include <fsfw/parameters/ParameterMessage.h>
+#include <fsfw/parameters/ParameterWrapper.h>
+#include <fsfw/parameters/ReceivesParameterMessagesIF.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include "CatchDefinitions.h"
+
+class ParameterOwnerMock : public ReceivesParameterMessagesIF {
+ public:
+  explicit ParameterOwnerMock(MessageQueueId_t queueId) : queueId(queueId) {}
+
+  MessageQueueId_t getCommandQueue() const override { return queueId; }
+
+  ReturnValue_t getParameter(uint8_t domainId, uint8_t uniqueIdentifier,
+                             ParameterWrapper* parameterWrapper,
+                             const ParameterWrapper* newValues, uint16_t startAtIndex) override {
+    if (domainId != 0) {
+      return INVALID_DOMAIN_ID;
+    }
+    switch (uniqueIdentifier) {
+      case 0:
+        parameterWrapper->set(scalar);
+        break;
+      case 1:
+        parameterWrapper->setMatrix(matrix);
+        break;
+      default:
+        return INVALID_IDENTIFIER_ID;
+    }
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+
+  MessageQueueId_t queueId;
+  uint16_t scalar = 0;
+  float matrix[3][4] = {};
+};
+
+TEST_CASE("Parameter Wrapper", "[ParameterWrapper]") {
+  float matrix[3][4] = {};
+  ParameterWrapper target;
+  target.setMatrix(matrix);
+
+  SECTION("Copy from local data") {
+    const float source[2][2] = {{1.0, 2.0}, {3.0, 4.0}};
+    ParameterWrapper sourceWrapper;
+    sourceWrapper.setMatrix(source);
+    // Start at row 1, column 1
+    REQUIRE(target.copyFrom(&sourceWrapper, 5) == retval::CATCH_OK);
+    CHECK(matrix[1][1] == 1.0);
+    CHECK(matrix[1][2] == 2.0);
+    CHECK(matrix[2][1] == 3.0);
+    CHECK(matrix[2][2] == 4.0);
+    CHECK(matrix[0][0] == 0.0);
+    CHECK(target.copyFrom(&sourceWrapper, 7) == static_cast<int>(ParameterWrapper::TOO_BIG));
+  }
+
+  SECTION("Serialization round trip") {
+    for (uint8_t row = 0; row < 3; row++) {
+      for (uint8_t column = 0; column < 4; column++) {
+        matrix[row][column] = row * 4 + column + 0.5;
+      }
+    }
+    std::array<uint8_t, 64> buffer = {};
+    uint8_t* serPtr = buffer.data();
+    size_t serSize = 0;
+    REQUIRE(target.serialize(&serPtr, &serSize, buffer.size(), SerializeIF::Endianness::BIG) ==
+            retval::CATCH_OK);
+    REQUIRE(serSize == target.getSerializedSize());
+    // The type information is followed by the columns and the rows
+    CHECK(buffer[2] == 4);
+    CHECK(buffer[3] == 3);
+    // 0.5 as big endian IEEE 754 single precision value
+    CHECK(buffer[4] == 0x3f);
+    CHECK(buffer[5] == 0x00);
+
+    float copy[3][4] = {};
+    ParameterWrapper copyWrapper;
+    copyWrapper.setMatrix(copy);
+    const uint8_t* deserPtr = buffer.data();
+    REQUIRE(copyWrapper.deSerialize(&deserPtr, &serSize, SerializeIF::Endianness::BIG, 0) ==
+            retval::CATCH_OK);
+    CHECK(serSize == 0);
+    for (uint8_t row = 0; row < 3; row++) {
+      for (uint8_t column = 0; column < 4; column++) {
+        CHECK(copy[row][column] == matrix[row][column]);
+      }
+    }
+
+    serPtr = buffer.data();
+    serSize = 0;
+    CHECK(target.serialize(&serPtr, &serSize, 20, SerializeIF::Endianness::BIG) ==
+          static_cast<int>(SerializeIF::BUFFER_TOO_SHORT));
+  }
+
+  SECTION("Partial stream") {
+    // One row of big endian data written into the last row
+    const std::array<uint8_t, 8> stream = {0x3f, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00};
+    ParameterWrapper streamWrapper;
+    REQUIRE(streamWrapper.set(Type::FLOAT, 1, 2, stream.data(), stream.size()) ==
+            retval::CATCH_OK);
+    REQUIRE(target.copyFrom(&streamWrapper, 10) == retval::CATCH_OK);
+    CHECK(matrix[2][2] == 1.0);
+    CHECK(matrix[2][3] == 2.0);
+    CHECK(streamWrapper.set(Type::FLOAT, 2, 2, stream.data(), stream.size()) ==
+          static_cast<int>(SerializeIF::STREAM_TOO_SHORT));
+  }
+}
+
+TEST_CASE("Parameter Helper Bulk Commands", "[ParameterHelper]") {
+  MessageQueueIF* queue = QueueFactory::instance()->createMessageQueue(3);
+  ParameterOwnerMock owner(queue->getId());
+  ParameterHelper helper(&owner);
+  REQUIRE(helper.initialize() == retval::CATCH_OK);
+  StorageManagerIF* ipcStore = tglob::getIpcStoreHandle();
+  REQUIRE(ipcStore != nullptr);
+  CommandMessage command;
+  command.setSender(queue->getId());
+  CommandMessage reply;
+
+  SECTION("Bulk load") {
+    // Scalar uint16_t: PTC 3, PFC 12
+    std::vector<uint8_t> load = {0, 0, 0, 0, 3, 12, 1, 1, 0x12, 0x34};
+    // Second row of the matrix, float: PTC 5, PFC 1
+    const std::vector<uint8_t> row = {0, 1, 0, 4,    5,    1,    1,    4,    0x3f, 0x80, 0, 0,
+                                      0x40, 0, 0, 0, 0x40, 0x40, 0, 0, 0x40, 0x80, 0, 0};
+    load.insert(load.end(), row.begin(), row.end());
+    store_address_t storeId;
+    REQUIRE(ipcStore->addData(&storeId, load.data(), load.size()) == retval::CATCH_OK);
+    ParameterMessage::setParameterBulkLoadCommand(&command, storeId);
+    REQUIRE(helper.handleParameterMessage(&command) == retval::CATCH_OK);
+    REQUIRE(queue->receiveMessage(&reply) == retval::CATCH_OK);
+    REQUIRE(reply.getCommand() ==
+            static_cast<uint32_t>(ParameterMessage::REPLY_PARAMETER_BULK_LOAD));
+    uint32_t numberOfParameters = 0;
+    ReturnValue_t result = HasReturnvaluesIF::RETURN_FAILED;
+    uint32_t durationUs = 0;
+    ParameterMessage::getParameterBulkLoadReply(&reply, &numberOfParameters, &result,
+                                                &durationUs);
+    CHECK(numberOfParameters == 2);
+    CHECK(result == retval::CATCH_OK);
+    CHECK(owner.scalar == 0x1234);
+    CHECK(owner.matrix[1][0] == 1.0);
+    CHECK(owner.matrix[1][3] == 4.0);
+    CHECK(owner.matrix[0][0] == 0.0);
+    // The command data was consumed
+    const uint8_t* storeData = nullptr;
+    size_t storeDataSize = 0;
+    CHECK(ipcStore->getData(storeId, &storeData, &storeDataSize) ==
+          static_cast<int>(StorageManagerIF::DATA_DOES_NOT_EXIST));
+
+    // The second entry has an invalid identifier, the first one stays loaded
+    load = {0, 0, 0, 0, 3, 12, 1, 1, 0x56, 0x78, 0, 5, 0, 0, 3, 12, 1, 1, 0, 0};
+    REQUIRE(ipcStore->addData(&storeId, load.data(), load.size()) == retval::CATCH_OK);
+    ParameterMessage::setParameterBulkLoadCommand(&command, storeId);
+    REQUIRE(helper.handleParameterMessage(&command) == retval::CATCH_OK);
+    REQUIRE(queue->receiveMessage(&reply) == retval::CATCH_OK);
+    ParameterMessage::getParameterBulkLoadReply(&reply, &numberOfParameters, &result,
+                                                &durationUs);
+    CHECK(numberOfParameters == 1);
+    CHECK(result == static_cast<int>(HasParametersIF::INVALID_IDENTIFIER_ID));
+    CHECK(owner.scalar == 0x5678);
+  }
+
+  SECTION("Bulk dump") {
+    owner.scalar = 0xabcd;
+    owner.matrix[2][3] = 1.0;
+    const std::array<uint8_t, 8> ids = {0, 0, 0, 0, 0, 1, 0, 0};
+    store_address_t storeId;
+    REQUIRE(ipcStore->addData(&storeId, ids.data(), ids.size()) == retval::CATCH_OK);
+    ParameterMessage::setParameterBulkDumpCommand(&command, storeId);
+    REQUIRE(helper.handleParameterMessage(&command) == retval::CATCH_OK);
+    REQUIRE(queue->receiveMessage(&reply) == retval::CATCH_OK);
+    REQUIRE(reply.getCommand() ==
+            static_cast<uint32_t>(ParameterMessage::REPLY_PARAMETER_BULK_DUMP));
+    uint32_t numberOfParameters = 0;
+    uint32_t durationUs = 0;
+    store_address_t replyId =
+        ParameterMessage::getParameterBulkDumpReply(&reply, &numberOfParameters, &durationUs);
+    CHECK(numberOfParameters == 2);
+    ConstAccessorPair accessor = ipcStore->getData(replyId);
+    REQUIRE(accessor.first == retval::CATCH_OK);
+    // ID, type, columns, rows and data for both parameters
+    REQUIRE(accessor.second.size() == (4 + 4 + 2) + (4 + 4 + 12 * 4));
+    const uint8_t* data = accessor.second.data();
+    CHECK(data[8] == 0xab);
+    CHECK(data[9] == 0xcd);
+    CHECK(data[16] == 4);
+    CHECK(data[17] == 3);
+    // Last element of the matrix
+    CHECK(data[accessor.second.size() - 4] == 0x3f);
+    CHECK(data[accessor.second.size() - 3] == 0x80);
+  }
+
+  QueueFactory::instance()->deleteMessageQueue(queue);
+}
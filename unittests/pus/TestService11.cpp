@@ -0,0 +1,347 @@
+#include <fsfw/ipc/QueueFactory.h>
+#include <fsfw/objectmanager/ObjectManager.h>
+#include <fsfw/pus/Service11TelecommandScheduling.h>
+#include <fsfw/tcdistribution/PUSDistributorIF.h>
+#include <fsfw/timemanager/Clock.h>
+#include <fsfw/tmtcpacket/pus/tc/TcPacketPus.h>
+#include <fsfw/tmtcpacket/pus/tc/TcPacketStoredPus.h>
+#include <fsfw/tmtcservices/AcceptsTelemetryIF.h>
+#include <fsfw/tmtcservices/AcceptsVerifyMessageIF.h>
+#include <fsfw/tmtcservices/PusVerificationReport.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "objects/systemObjectList.h"
+
+namespace {
+
+constexpr uint16_t APID = 0x42;
+constexpr uint16_t TARGET_APID = 0x24;
+constexpr size_t MAX_TCS = 4;
+using Service11 = Service11TelecommandScheduling<MAX_TCS>;
+
+class PusDistributorMock : public SystemObject, public PUSDistributorIF {
+ public:
+  PusDistributorMock() : SystemObject(objects::PUS_DISTRIBUTOR_MOCK) {}
+  ReturnValue_t registerService(AcceptsTelecommandsIF* service) override {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+};
+
+class TmFunnelMock : public SystemObject, public AcceptsTelemetryIF {
+ public:
+  TmFunnelMock() : SystemObject(objects::TM_FUNNEL_MOCK) {
+    queue = QueueFactory::instance()->createMessageQueue(10);
+  }
+  ~TmFunnelMock() override { QueueFactory::instance()->deleteMessageQueue(queue); }
+  MessageQueueId_t getReportReceptionQueue(uint8_t virtualChannel) override {
+    return queue->getId();
+  }
+  MessageQueueIF* queue;
+};
+
+//! Receives the verification reports of the service
+class VerificationMock : public SystemObject, public AcceptsVerifyMessageIF {
+ public:
+  VerificationMock() : SystemObject(objects::PUS_SERVICE_1_VERIFICATION) {
+    queue = QueueFactory::instance()->createMessageQueue(10);
+  }
+  ~VerificationMock() override { QueueFactory::instance()->deleteMessageQueue(queue); }
+  MessageQueueId_t getVerificationQueue() override { return queue->getId(); }
+
+  //! @return Error code of the completion report of the last TC
+  ReturnValue_t getCompletionResult() {
+    PusVerificationMessage message;
+    ReturnValue_t result = HasReturnvaluesIF::RETURN_FAILED;
+    while (queue->receiveMessage(&message) == HasReturnvaluesIF::RETURN_OK) {
+      if (message.getReportId() == tc_verification::COMPLETION_SUCCESS) {
+        result = HasReturnvaluesIF::RETURN_OK;
+      } else if (message.getReportId() == tc_verification::COMPLETION_FAILURE) {
+        result = message.getErrorCode();
+      }
+    }
+    return result;
+  }
+  MessageQueueIF* queue;
+};
+
+class TcRecipientMock : public AcceptsTelecommandsIF {
+ public:
+  TcRecipientMock() { queue = QueueFactory::instance()->createMessageQueue(10); }
+  ~TcRecipientMock() override { QueueFactory::instance()->deleteMessageQueue(queue); }
+  uint16_t getIdentifier() override { return 0; }
+  MessageQueueId_t getRequestQueue() override { return queue->getId(); }
+  MessageQueueIF* queue;
+};
+
+void append(std::vector<uint8_t>& data, uint32_t value, size_t size) {
+  for (size_t idx = 0; idx < size; idx++) {
+    data.push_back(value >> (8 * (size - 1 - idx)));
+  }
+}
+
+//! TC which is scheduled, the sequence count makes the request ID unique
+std::vector<uint8_t> makeScheduledTc(uint8_t sequenceCount) {
+  const uint8_t payload[] = {sequenceCount, 0xAA, 0xBB};
+  TcPacketStoredPus packet(TARGET_APID, 17, 1, sequenceCount, payload, sizeof(payload));
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  REQUIRE(packet.getData(&data, &size) == HasReturnvaluesIF::RETURN_OK);
+  std::vector<uint8_t> tc(data, data + size);
+  packet.deletePacket();
+  return tc;
+}
+
+std::vector<uint8_t> makeInsertData(uint32_t releaseTime, uint8_t sequenceCount) {
+  std::vector<uint8_t> data;
+  append(data, releaseTime, 4);
+  std::vector<uint8_t> tc = makeScheduledTc(sequenceCount);
+  data.insert(data.end(), tc.begin(), tc.end());
+  return data;
+}
+
+//! Request ID of the scheduled TC with the sequence count as used by TC[11,5] and TC[11,7]
+std::vector<uint8_t> makeRequestIdData(uint8_t sequenceCount) {
+  std::vector<uint8_t> tc = makeScheduledTc(sequenceCount);
+  TcPacketPus packet(tc.data());
+  std::vector<uint8_t> data;
+  append(data, packet.getSourceId(), 4);
+  append(data, TARGET_APID, 2);
+  append(data, sequenceCount, 2);
+  return data;
+}
+
+uint32_t now() {
+  timeval time;
+  Clock::getClock_timeval(&time);
+  return time.tv_sec;
+}
+
+}  // namespace
+
+TEST_CASE("Service 11 Telecommand Scheduling", "[Service11]") {
+  PusDistributorMock distributor;
+  TmFunnelMock funnel;
+  VerificationMock verification;
+  TcRecipientMock recipient;
+  auto* tcStore = ObjectManager::instance()->get<StorageManagerIF>(objects::TC_STORE);
+  REQUIRE(tcStore != nullptr);
+
+  char pathTemplate[] = "/tmp/fsfw-pus11-XXXXXX";
+  REQUIRE(mkdtemp(pathTemplate) != nullptr);
+  std::string directory = pathTemplate;
+  std::string path = directory + "/schedule.bin";
+
+  auto* service = new Service11(objects::PUS_SERVICE_11_TC_SCHEDULING, APID, 11, &recipient, 1);
+  service->setPersistenceFile(path);
+  REQUIRE(service->initialize() == HasReturnvaluesIF::RETURN_OK);
+
+  uint8_t sequenceCount = 0;
+  auto command = [&](uint8_t subservice, const std::vector<uint8_t>& data) {
+    TcPacketStoredPus packet(APID, 11, subservice, sequenceCount++, data.data(), data.size());
+    TmTcMessage message(packet.getStoreAddress());
+    REQUIRE(MessageQueueSenderIF::sendMessage(service->getRequestQueue(), &message) ==
+            HasReturnvaluesIF::RETURN_OK);
+    service->performOperation(0);
+    return verification.getCompletionResult();
+  };
+  const uint32_t releaseTime = now() + 100;
+
+  SECTION("Insert, Delete And Timeshift") {
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, 1)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime + 10, 2)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 2);
+
+    // Release time within the margin
+    CHECK(command(Service11::INSERT_ACTIVITY, makeInsertData(now(), 3)) ==
+          HasReturnvaluesIF::RETURN_FAILED);
+
+    std::vector<uint8_t> timeshift;
+    append(timeshift, 50, 4);
+    std::vector<uint8_t> requestId = makeRequestIdData(1);
+    timeshift.insert(timeshift.end(), requestId.begin(), requestId.end());
+    CHECK(command(Service11::TIMESHIFT_ACTIVITY, timeshift) == HasReturnvaluesIF::RETURN_OK);
+    // TC 1 is now scheduled after TC 2, so only TC 2 is in this window
+    std::vector<uint8_t> window;
+    append(window, Service11::TO_TIMETAG, 4);
+    append(window, releaseTime + 20, 4);
+    CHECK(command(Service11::FILTER_DELETE_ACTIVITY, window) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 1);
+
+    CHECK(command(Service11::DELETE_ACTIVITY, makeRequestIdData(1)) ==
+          HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 0);
+    CHECK(command(Service11::DELETE_ACTIVITY, makeRequestIdData(1)) ==
+          HasReturnvaluesIF::RETURN_FAILED);
+    CHECK(command(Service11::TIMESHIFT_ACTIVITY, timeshift) ==
+          Service11::TIMESHIFTING_NOT_POSSIBLE);
+  }
+
+  SECTION("Duplicate Request IDs Are Rejected") {
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, 1)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime + 5, 1)) ==
+          Service11::REQUEST_ID_ALREADY_SCHEDULED);
+    CHECK(service->getNumberOfScheduledTcs() == 1);
+  }
+
+  SECTION("Full Schedule") {
+    for (uint8_t idx = 0; idx < MAX_TCS; idx++) {
+      REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, idx + 1)) ==
+              HasReturnvaluesIF::RETURN_OK);
+    }
+    CHECK(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, MAX_TCS + 1)) ==
+          Service11::SCHEDULE_FULL);
+  }
+
+  SECTION("Bulk Insertion Is Rolled Back") {
+    service->enableBulkInsertion();
+    auto bulk = [](std::vector<uint8_t> activities, uint32_t number) {
+      std::vector<uint8_t> data;
+      append(data, number, 4);
+      data.insert(data.end(), activities.begin(), activities.end());
+      return data;
+    };
+    std::vector<uint8_t> activities = makeInsertData(releaseTime, 1);
+    std::vector<uint8_t> second = makeInsertData(releaseTime + 1, 2);
+    activities.insert(activities.end(), second.begin(), second.end());
+    // The third activity repeats the first one
+    std::vector<uint8_t> invalid = activities;
+    std::vector<uint8_t> third = makeInsertData(releaseTime + 2, 1);
+    invalid.insert(invalid.end(), third.begin(), third.end());
+
+    CHECK(command(Service11::INSERT_ACTIVITY, bulk(invalid, 3)) ==
+          Service11::REQUEST_ID_ALREADY_SCHEDULED);
+    CHECK(service->getNumberOfScheduledTcs() == 0);
+    CHECK(command(Service11::INSERT_ACTIVITY, bulk(activities, 2)) ==
+          HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 2);
+  }
+
+  SECTION("Release") {
+    REQUIRE(command(Service11::ENABLE_SCHEDULING, {}) == HasReturnvaluesIF::RETURN_OK);
+    uint32_t soon = now() + 2;
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(soon, 1)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, 2)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    TmTcMessage message;
+    CHECK(recipient.queue->receiveMessage(&message) ==
+          static_cast<ReturnValue_t>(MessageQueueIF::EMPTY));
+    while (now() < soon) {
+      usleep(50000);
+    }
+    service->performOperation(0);
+    REQUIRE(recipient.queue->receiveMessage(&message) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 1);
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    REQUIRE(tcStore->getData(message.getStorageId(), &data, &size) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(std::vector<uint8_t>(data, data + size) == makeScheduledTc(1));
+    tcStore->deleteData(message.getStorageId());
+  }
+
+  SECTION("Schedule Is Restored From The Persistence File") {
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, 1)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime + 10, 2)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime + 20, 3)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::DELETE_ACTIVITY, makeRequestIdData(2)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    std::vector<uint8_t> timeshift;
+    append(timeshift, 1000, 4);
+    std::vector<uint8_t> requestId = makeRequestIdData(3);
+    timeshift.insert(timeshift.end(), requestId.begin(), requestId.end());
+    REQUIRE(command(Service11::TIMESHIFT_ACTIVITY, timeshift) == HasReturnvaluesIF::RETURN_OK);
+
+    // Simulate a reset while a record was written
+    delete service;
+    tcStore->clearStore();
+    std::FILE* file = std::fopen(path.c_str(), "ab");
+    REQUIRE(file != nullptr);
+    const uint8_t torn[] = {1, 0, 0, 0, 0x12, 0x34};
+    std::fwrite(torn, 1, sizeof(torn), file);
+    std::fclose(file);
+
+    service = new Service11(objects::PUS_SERVICE_11_TC_SCHEDULING, APID, 11, &recipient, 1);
+    service->setPersistenceFile(path);
+    REQUIRE(service->initialize() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 2);
+    CHECK(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, 1)) ==
+          Service11::REQUEST_ID_ALREADY_SCHEDULED);
+    // TC 3 was shifted out of this window
+    std::vector<uint8_t> window;
+    append(window, Service11::FROM_TIMETAG_TO_TIMETAG, 4);
+    append(window, releaseTime + 500, 4);
+    append(window, releaseTime + 1500, 4);
+    CHECK(command(Service11::FILTER_DELETE_ACTIVITY, window) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 1);
+
+    // The compacted file is restored as well
+    delete service;
+    tcStore->clearStore();
+    service = new Service11(objects::PUS_SERVICE_11_TC_SCHEDULING, APID, 11, &recipient, 1);
+    service->setPersistenceFile(path);
+    REQUIRE(service->initialize() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(service->getNumberOfScheduledTcs() == 1);
+    CHECK(command(Service11::DELETE_ACTIVITY, makeRequestIdData(1)) ==
+          HasReturnvaluesIF::RETURN_OK);
+  }
+
+  SECTION("Oversized TCs In The Persistence File Are Skipped") {
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime, 1)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::INSERT_ACTIVITY, makeInsertData(releaseTime + 10, 2)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(command(Service11::DELETE_ACTIVITY, makeRequestIdData(2)) ==
+            HasReturnvaluesIF::RETURN_OK);
+    delete service;
+    tcStore->clearStore();
+
+    // Insertion record of a TC which is too large to be restored, in host byte order, followed
+    // by the records written by the service
+    std::vector<uint8_t> content(24, 0);
+    content[0] = 1;
+    uint32_t oversizedLength = Service11::MAX_PERSISTED_TC_SIZE + 100;
+    std::memcpy(&content[4], &releaseTime, sizeof(releaseTime));
+    std::memcpy(&content[16], &oversizedLength, sizeof(oversizedLength));
+    content.resize(content.size() + oversizedLength, 0x5A);
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    REQUIRE(file != nullptr);
+    int byte = 0;
+    while ((byte = std::fgetc(file)) != EOF) {
+      content.push_back(byte);
+    }
+    std::fclose(file);
+    file = std::fopen(path.c_str(), "wb");
+    REQUIRE(file != nullptr);
+    REQUIRE(std::fwrite(content.data(), 1, content.size(), file) == content.size());
+    std::fclose(file);
+
+    service = new Service11(objects::PUS_SERVICE_11_TC_SCHEDULING, APID, 11, &recipient, 1);
+    service->setPersistenceFile(path);
+    REQUIRE(service->initialize() == HasReturnvaluesIF::RETURN_OK);
+    // The deletion after the oversized TC was replayed as well
+    CHECK(service->getNumberOfScheduledTcs() == 1);
+    CHECK(command(Service11::DELETE_ACTIVITY, makeRequestIdData(2)) !=
+          HasReturnvaluesIF::RETURN_OK);
+    CHECK(command(Service11::DELETE_ACTIVITY, makeRequestIdData(1)) ==
+          HasReturnvaluesIF::RETURN_OK);
+  }
+
+  REQUIRE(command(Service11::RESET_SCHEDULING, {}) == HasReturnvaluesIF::RETURN_OK);
+  delete service;
+  std::remove(path.c_str());
+  rmdir(directory.c_str());
+}
@@ -0,0 +1,130 @@
+#include <fsfw/events/Event.h>
+#include <fsfw/objectmanager/SystemObjectIF.h>
+#include <fsfw/pus/servicepackets/Service1Packets.h>
+#include <fsfw/pus/servicepackets/Service5Packets.h>
+#include <fsfw/pus/servicepackets/Service8Packets.h>
+#include <fsfw/serialize/SerialStruct.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+
+#include "CatchDefinitions.h"
+#include "TestSerialLinkedPacket.h"
+
+namespace {
+class TestStruct : public SerialStruct<uint32_t, int16_t, uint8_t, double> {
+ public:
+  enum Fields { HEADER, VALUE, FLAGS, MEASUREMENT };
+  TestStruct() = default;
+  TestStruct(uint32_t header, int16_t value, uint8_t flags, double measurement)
+      : SerialStruct(header, value, flags, measurement) {}
+};
+}  // namespace
+
+TEST_CASE("Serial Struct", "[SerialStruct]") {
+  std::array<uint8_t, 32> buffer = {};
+  uint8_t* bufPtr = buffer.data();
+  size_t serializedSize = 0;
+
+  SECTION("Plain Fields") {
+    static_assert(serial::fixedSize<uint32_t, int16_t, uint8_t, double>() == 15);
+    TestStruct testStruct(0x01020304, -2, 0xab, 1.5);
+    REQUIRE(testStruct.getSerializedSize() == 15);
+    REQUIRE(testStruct.serialize(&bufPtr, &serializedSize, buffer.size(),
+                                 SerializeIF::Endianness::BIG) == retval::CATCH_OK);
+    CHECK(serializedSize == 15);
+    CHECK(bufPtr == buffer.data() + 15);
+    CHECK(buffer[0] == 0x01);
+    CHECK(buffer[3] == 0x04);
+    CHECK(buffer[4] == 0xff);
+    CHECK(buffer[5] == 0xfe);
+    CHECK(buffer[6] == 0xab);
+    // 1.5 as IEEE 754 double
+    CHECK(buffer[7] == 0x3f);
+    CHECK(buffer[8] == 0xf8);
+
+    TestStruct readBack;
+    const uint8_t* readPtr = buffer.data();
+    size_t remaining = serializedSize;
+    REQUIRE(readBack.deSerialize(&readPtr, &remaining, SerializeIF::Endianness::BIG) ==
+            retval::CATCH_OK);
+    CHECK(remaining == 0);
+    CHECK(readBack.get<TestStruct::HEADER>() == 0x01020304);
+    CHECK(readBack.get<TestStruct::VALUE>() == -2);
+    CHECK(readBack.get<TestStruct::FLAGS>() == 0xab);
+    CHECK(readBack.get<TestStruct::MEASUREMENT>() == 1.5);
+
+    readPtr = buffer.data();
+    remaining = 14;
+    CHECK(readBack.deSerialize(&readPtr, &remaining, SerializeIF::Endianness::BIG) ==
+          SerializeIF::STREAM_TOO_SHORT);
+  }
+
+  SECTION("Buffer Too Short") {
+    TestStruct testStruct(1, 2, 3, 4.0);
+    serializedSize = 20;
+    CHECK(testStruct.serialize(&bufPtr, &serializedSize, 34, SerializeIF::Endianness::BIG) ==
+          SerializeIF::BUFFER_TOO_SHORT);
+    // Nothing was written
+    CHECK(serializedSize == 20);
+    CHECK(bufPtr == buffer.data());
+  }
+
+  SECTION("Wire Compatibility With Linked List Adapter") {
+    const std::array<uint8_t, 3> data = {1, 2, 3};
+    TestPacket linkedPacket(42, 96, data.data(), data.size());
+    std::array<uint8_t, 32> linkedBuffer = {};
+    uint8_t* linkedPtr = linkedBuffer.data();
+    size_t linkedSize = 0;
+    REQUIRE(linkedPacket.serialize(&linkedPtr, &linkedSize, linkedBuffer.size(),
+                                   SerializeIF::Endianness::BIG) == retval::CATCH_OK);
+
+    SerialStruct<uint32_t, SerialBufferAdapter<uint8_t>, uint32_t> serialStruct(
+        42, SerialBufferAdapter<uint8_t>(data.data(), data.size()), 96);
+    REQUIRE(serialStruct.getSerializedSize() == linkedPacket.getSerializedSize());
+    REQUIRE(serialStruct.serialize(&bufPtr, &serializedSize, buffer.size(),
+                                   SerializeIF::Endianness::BIG) == retval::CATCH_OK);
+    REQUIRE(serializedSize == linkedSize);
+    CHECK(buffer == linkedBuffer);
+
+    // Mixed fields check the size of each plain field
+    size_t partialSize = 0;
+    bufPtr = buffer.data();
+    CHECK(serialStruct.serialize(&bufPtr, &partialSize, linkedSize - 1,
+                                 SerializeIF::Endianness::BIG) == SerializeIF::BUFFER_TOO_SHORT);
+  }
+
+  SECTION("Service Packets") {
+    EventReport eventReport(0x0203, 0x44556677, 8, 9);
+    REQUIRE(eventReport.getSerializedSize() == 14);
+    REQUIRE(eventReport.serialize(&bufPtr, &serializedSize, buffer.size(),
+                                  SerializeIF::Endianness::BIG) == retval::CATCH_OK);
+    CHECK(buffer[1] == 0x03);
+    CHECK(buffer[2] == 0x44);
+    CHECK(buffer[9] == 8);
+    CHECK(buffer[13] == 9);
+
+    FailureReport failureReport(tc_verification::PROGRESS_FAILURE, 0x1801, 0xc003, 5, 0x1234, 1,
+                                2);
+    CHECK(failureReport.getSerializedSize() == 15);
+    SuccessReport successReport(tc_verification::ACCEPTANCE_SUCCESS, 0x1801, 0xc003, 5);
+    CHECK(successReport.getSerializedSize() == 4);
+
+    const std::array<uint8_t, 2> replyData = {0xaa, 0xbb};
+    DataReply dataReply(0x01020304, 0x05060708, replyData.data(), replyData.size());
+    REQUIRE(dataReply.getSerializedSize() == 10);
+    bufPtr = buffer.data();
+    serializedSize = 0;
+    REQUIRE(dataReply.serialize(&bufPtr, &serializedSize, buffer.size(),
+                                SerializeIF::Endianness::BIG) == retval::CATCH_OK);
+    CHECK(serializedSize == 10);
+    CHECK(buffer[4] == 0x05);
+    CHECK(buffer[8] == 0xaa);
+    CHECK(buffer[9] == 0xbb);
+
+    DirectReply stepReply(1, 2, 3, true, 4);
+    CHECK(stepReply.getSerializedSize() == 11);
+    DirectReply completionReply(1, 2, 3);
+    CHECK(completionReply.getSerializedSize() == 10);
+  }
+}
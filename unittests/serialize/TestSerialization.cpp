@@ -1,6 +1,7 @@
 #include <fsfw/serialize/SerialBufferAdapter.h>
 #include <fsfw/serialize/SerializeAdapter.h>
 
+#include <algorithm>
 #include <array>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -200,3 +201,116 @@ TEST_CASE("Auto Serialize Adapter", "[SerAdapter]") {
     REQUIRE(tvSdouble == Catch::Approx(-2.2421e19));
   }
 }
+
+TEST_CASE("Array Serialize Adapter", "[SerAdapter]") {
+  // Odd element counts make sure the remainder after the vectorized blocks is handled
+  std::array<uint16_t, 19> u16{};
+  std::array<uint32_t, 11> u32{};
+  std::array<double, 5> f64{};
+  for (size_t idx = 0; idx < u16.size(); idx++) {
+    u16[idx] = static_cast<uint16_t>(0x0102 + idx * 0x0202);
+  }
+  for (size_t idx = 0; idx < u32.size(); idx++) {
+    u32[idx] = static_cast<uint32_t>(0x01020304 + idx);
+  }
+  for (size_t idx = 0; idx < f64.size(); idx++) {
+    f64[idx] = -1.5 * idx;
+  }
+  uint8_t* buffer = TEST_ARRAY.data();
+  size_t size = 0;
+
+  SECTION("Matches Single Elements") {
+    std::array<uint8_t, 512> reference{};
+    uint8_t* referencePtr = reference.data();
+    size_t referenceSize = 0;
+    for (auto endianness : {SerializeIF::Endianness::BIG, SerializeIF::Endianness::LITTLE,
+                            SerializeIF::Endianness::MACHINE}) {
+      buffer = TEST_ARRAY.data();
+      size = 0;
+      referencePtr = reference.data();
+      referenceSize = 0;
+      REQUIRE(SerializeAdapter::serializeArray(u16.data(), u16.size(), &buffer, &size,
+                                               TEST_ARRAY.size(),
+                                               endianness) == HasReturnvaluesIF::RETURN_OK);
+      REQUIRE(SerializeAdapter::serializeArray(u32.data(), u32.size(), &buffer, &size,
+                                               TEST_ARRAY.size(),
+                                               endianness) == HasReturnvaluesIF::RETURN_OK);
+      REQUIRE(SerializeAdapter::serializeArray(f64.data(), f64.size(), &buffer, &size,
+                                               TEST_ARRAY.size(),
+                                               endianness) == HasReturnvaluesIF::RETURN_OK);
+      for (auto& value : u16) {
+        SerializeAdapter::serialize(&value, &referencePtr, &referenceSize, reference.size(),
+                                    endianness);
+      }
+      for (auto& value : u32) {
+        SerializeAdapter::serialize(&value, &referencePtr, &referenceSize, reference.size(),
+                                    endianness);
+      }
+      for (auto& value : f64) {
+        SerializeAdapter::serialize(&value, &referencePtr, &referenceSize, reference.size(),
+                                    endianness);
+      }
+      REQUIRE(size == referenceSize);
+      REQUIRE(size == SerializeAdapter::getSerializedArraySize(u16.data(), u16.size()) +
+                          SerializeAdapter::getSerializedArraySize(u32.data(), u32.size()) +
+                          SerializeAdapter::getSerializedArraySize(f64.data(), f64.size()));
+      CHECK(std::equal(reference.begin(), reference.begin() + size, TEST_ARRAY.begin()));
+    }
+    CHECK(TEST_ARRAY[0] == 0x02);
+    CHECK(TEST_ARRAY[1] == 0x01);
+  }
+
+  SECTION("Round Trip") {
+    REQUIRE(SerializeAdapter::serializeArray(u32.data(), u32.size(), &buffer, &size,
+                                             TEST_ARRAY.size(), SerializeIF::Endianness::BIG) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(TEST_ARRAY[0] == 0x01);
+    CHECK(TEST_ARRAY[3] == 0x04);
+    CHECK(TEST_ARRAY[43] == 0x0e);
+    std::array<uint32_t, 11> readBack{};
+    const uint8_t* readPtr = TEST_ARRAY.data();
+    REQUIRE(SerializeAdapter::deSerializeArray(readBack.data(), readBack.size(), &readPtr, &size,
+                                               SerializeIF::Endianness::BIG) ==
+            HasReturnvaluesIF::RETURN_OK);
+    CHECK(size == 0);
+    CHECK(readBack == u32);
+  }
+
+  SECTION("Size Checks") {
+    REQUIRE(SerializeAdapter::serializeArray(u32.data(), u32.size(), &buffer, &size, 43,
+                                             SerializeIF::Endianness::BIG) ==
+            SerializeIF::BUFFER_TOO_SHORT);
+    CHECK(size == 0);
+    CHECK(buffer == TEST_ARRAY.data());
+    size = 10;
+    const uint8_t* readPtr = TEST_ARRAY.data();
+    REQUIRE(SerializeAdapter::deSerializeArray(u32.data(), 3, &readPtr, &size,
+                                               SerializeIF::Endianness::BIG) ==
+            SerializeIF::STREAM_TOO_SHORT);
+    CHECK(size == 10);
+    CHECK(readPtr == TEST_ARRAY.data());
+  }
+}
+
+TEST_CASE("Endian Converter Arrays", "[SerAdapter]") {
+  // Element sizes without a vectorized implementation are reversed generically, also in place
+  uint8_t data[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EndianConverter::swapArray(data, data, 3, 3);
+  const uint8_t expected[9] = {3, 2, 1, 6, 5, 4, 9, 8, 7};
+  CHECK(std::equal(std::begin(data), std::end(data), std::begin(expected)));
+
+  std::array<uint64_t, 9> values{};
+  for (size_t idx = 0; idx < values.size(); idx++) {
+    values[idx] = 0x0102030405060708ULL * (idx + 1);
+  }
+  std::array<uint64_t, 9> swapped = values;
+  EndianConverter::swapArray(reinterpret_cast<uint8_t*>(swapped.data()),
+                             reinterpret_cast<const uint8_t*>(swapped.data()), 8, swapped.size());
+  for (size_t idx = 0; idx < values.size(); idx++) {
+    uint64_t reversed = 0;
+    for (size_t byte = 0; byte < sizeof(uint64_t); byte++) {
+      reversed = (reversed << 8) | ((values[idx] >> (byte * 8)) & 0xff);
+    }
+    CHECK(swapped[idx] == reversed);
+  }
+}
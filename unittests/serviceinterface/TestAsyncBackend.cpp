@@ -0,0 +1,175 @@
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fsfw/serviceinterface/ServiceInterfaceAsyncBackend.h"
+
+namespace {
+
+struct Formatted {
+  bool captured = false;
+  std::string deferred;
+  std::string direct;
+};
+
+// Same buffer size as the print buffer, minus a typical preamble
+constexpr size_t OUT_SIZE = 100;
+
+Formatted format(const char* fmt, ...) {
+  Formatted result;
+  char out[OUT_SIZE];
+  va_list args;
+  va_start(args, fmt);
+  result.captured = ServiceInterfaceAsyncBackend::formatDeferred(out, sizeof(out), fmt, args);
+  va_end(args);
+  if (result.captured) {
+    result.deferred = out;
+  }
+  va_start(args, fmt);
+  vsnprintf(out, sizeof(out), fmt, args);
+  va_end(args);
+  result.direct = out;
+  return result;
+}
+
+bool log(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  bool stored = ServiceInterfaceAsyncBackend::logFormatted(sif::PrintLevel::INFO_LEVEL, fmt, args);
+  va_end(args);
+  return stored;
+}
+
+}  // namespace
+
+#define CHECK_SAME_OUTPUT(...)                     \
+  do {                                             \
+    Formatted formatted = format(__VA_ARGS__);     \
+    CHECK(formatted.captured);                     \
+    CHECK(formatted.deferred == formatted.direct); \
+  } while (false)
+
+TEST_CASE("Async Backend Formatting", "[AsyncBackend]") {
+  SECTION("Integer Conversions") {
+    CHECK_SAME_OUTPUT("%d %i %u %o %x %X", -42, 17, 4000000000U, 8U, 0xbeefU, 0xcafeU);
+    CHECK_SAME_OUTPUT("%hhd %hhu %hd %hu", -3, 250, -30000, 60000);
+    CHECK_SAME_OUTPUT("%ld %lu %lx", -1234567890L, 4000000000UL, 0xdeadbeefUL);
+    CHECK_SAME_OUTPUT("%lld %llu %llX", -1234567890123LL, 18446744073709551615ULL,
+                      0x1234567890ABULL);
+    CHECK_SAME_OUTPUT("%jd %ju", static_cast<intmax_t>(-7), static_cast<uintmax_t>(7));
+    CHECK_SAME_OUTPUT("%zu %zx %td", static_cast<size_t>(123456), static_cast<size_t>(0xff),
+                      static_cast<ptrdiff_t>(-99));
+  }
+
+  SECTION("Flags, Width And Precision") {
+    CHECK_SAME_OUTPUT("[%-8d] [%+d] [% d] [%08d] [%#x] [%#o]", 5, 5, 5, -5, 255U, 8U);
+    CHECK_SAME_OUTPUT("[%10.4d] [%-10.3u] [%.0d]", 42, 7U, 0);
+    CHECK_SAME_OUTPUT("[%*d] [%-*d] [%.*d] [%*.*d]", 6, 1, 6, 2, 4, 3, 8, 5, 4);
+    CHECK_SAME_OUTPUT("[%*s] [%.*s]", 10, "right", 3, "truncated");
+    CHECK_SAME_OUTPUT("100%% done, %d%%", 99);
+  }
+
+  SECTION("Floating Point Conversions") {
+    CHECK_SAME_OUTPUT("%f %F %e %E %g %G", 3.14159, -2.5, 12345.678, 0.000123, 1e-10, 1e20);
+    CHECK_SAME_OUTPUT("%a %A %.3f %+010.2f %#g", 1.0, -0.5, 2.0 / 3.0, -3.14159, 1.0);
+    CHECK_SAME_OUTPUT("%Lf %.2Le", 1.25L, -1e100L);
+    CHECK_SAME_OUTPUT("%*.*f", 12, 5, 2.718281828);
+  }
+
+  SECTION("Characters, Strings And Pointers") {
+    int value = 0;
+    CHECK_SAME_OUTPUT("%c%c%c %5c", 'a', 'b', 'c', 'd');
+    CHECK_SAME_OUTPUT("%s: %-12s|%12s|", "name", "left", "right");
+    CHECK_SAME_OUTPUT("%p", static_cast<void*>(&value));
+    const char* nullString = nullptr;
+    Formatted formatted = format("%s", nullString);
+    CHECK(formatted.captured);
+    CHECK(formatted.deferred == "(null)");
+  }
+
+  SECTION("Long Strings Are Not Truncated") {
+    // Longer than the previous limit for string arguments
+    std::string longString(98, 'x');
+    longString.back() = 'y';
+    CHECK_SAME_OUTPUT("%s", longString.c_str());
+    CHECK_SAME_OUTPUT("%.97s|", longString.c_str());
+    // Exceeds the output buffer, both outputs are truncated the same way
+    CHECK_SAME_OUTPUT("%s %s", longString.c_str(), longString.c_str());
+    // Arguments which do not fit are formatted by the caller
+    std::string tooLong(ServiceInterfaceAsyncBackend::MAX_ARGS_SIZE, 'z');
+    CHECK(not format("%s", tooLong.c_str()).captured);
+  }
+
+  SECTION("Output Truncation") {
+    std::string literal(OUT_SIZE - 5, '-');
+    literal += "%d%s";
+    CHECK_SAME_OUTPUT(literal.c_str(), 123456, "tail");
+  }
+
+  SECTION("Unsupported Conversions") {
+    int count = 0;
+    CHECK(not format("%d%n", 1, &count).captured);
+    CHECK(not format("%ls", L"wide").captured);
+    CHECK(not format("%lc", L'w').captured);
+    CHECK(not format("%Ld", 1).captured);
+    // Specification longer than the internal buffer
+    CHECK(not format("%000000000000000000000000001d", 1).captured);
+  }
+}
+
+TEST_CASE("Async Backend Records", "[AsyncBackend]") {
+  SECTION("Records Are Stored Only With An Active Back-End") {
+    CHECK(ServiceInterfaceAsyncBackend::instance() == nullptr);
+    CHECK(not log("no back-end %d", 1));
+    {
+      ServiceInterfaceAsyncBackend backend(512, 2);
+      CHECK(ServiceInterfaceAsyncBackend::instance() == &backend);
+      CHECK(log("record %d %s", 1, "one"));
+      CHECK(log("record %f", 2.0));
+      CHECK(backend.drain() == 2);
+      CHECK(backend.drain() == 0);
+      // Formatted by the caller
+      CHECK(not log("%n", nullptr));
+      // The ring buffer is full
+      size_t stored = 0;
+      while (backend.getDroppedRecords() == 0 and stored < 100) {
+        log("filling %d", 3);
+        stored++;
+      }
+      CHECK(backend.getDroppedRecords() == 1);
+      CHECK(backend.drain() == stored - 1);
+    }
+    CHECK(ServiceInterfaceAsyncBackend::instance() == nullptr);
+  }
+
+  SECTION("Destruction While Other Threads Log") {
+    for (uint8_t cycle = 0; cycle < 10; cycle++) {
+      auto* backend = new ServiceInterfaceAsyncBackend(1024, 8);
+      std::atomic<bool> stop{false};
+      std::atomic<uint32_t> stored{0};
+      std::vector<std::thread> threads;
+      for (uint8_t idx = 0; idx < 4; idx++) {
+        threads.emplace_back([&]() {
+          while (not stop) {
+            if (log("thread record %d %s", 5, "text")) {
+              stored++;
+            }
+          }
+        });
+      }
+      while (stored < 100) {
+        backend->drain();
+      }
+      delete backend;
+      CHECK(ServiceInterfaceAsyncBackend::instance() == nullptr);
+      stop = true;
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+  }
+}
@@ -27,7 +27,17 @@ enum sourceObjects : uint32_t {
 
   DEVICE_HANDLER_MOCK = 29,
   COM_IF_MOCK = 30,
+  UART_COM_IF = 31,
+  SPI_COM_IF = 32,
+  I2C_COM_IF = 33,
+  GPIO_IF = 34,
   DEVICE_HANDLER_COMMANDER = 40,
+  TM_STORE_FRONTEND_MOCK = 41,
+  TM_STORE_FILE_BACKEND = 42,
+  TC_DISTRIBUTOR_MOCK = 43,
+  PUS_DISTRIBUTOR_MOCK = 44,
+  TM_FUNNEL_MOCK = 45,
+  PUS_SERVICE_11_TC_SCHEDULING = 46,
 };
 }
 
@@ -4,9 +4,66 @@
 #include <array>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include "CatchDefinitions.h"
 
+namespace {
+
+bool convertDaysOfYear(uint16_t dayOfYear, uint16_t year, uint8_t* month, uint8_t* day) {
+  bool leapYear = (year % 4 == 0 and year % 100 != 0) or year % 400 == 0;
+  const uint16_t february = leapYear ? 29 : 28;
+  const uint16_t daysOfMonth[] = {31, february, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (dayOfYear > (leapYear ? 366 : 365)) {
+    return false;
+  }
+  *month = 1;
+  while (*month < 12 and dayOfYear > daysOfMonth[*month - 1]) {
+    dayOfYear -= daysOfMonth[*month - 1];
+    (*month)++;
+  }
+  *day = dayOfYear;
+  return true;
+}
+
+/**
+ * Reference for the ASCII parser, the same sscanf calls which were used before
+ */
+bool scanAsciiReference(Clock::TimeOfDay_t* to, const char* from) {
+  uint16_t year;
+  uint8_t month;
+  uint16_t day;
+  uint8_t hour;
+  uint8_t minute;
+  float second;
+  int count = sscanf(from, "%4" SCNu16 "-%2" SCNu8 "-%2" SCNu16 "T%2" SCNu8 ":%2" SCNu8 ":%fZ",
+                     &year, &month, &day, &hour, &minute, &second);
+  if (count != 6) {
+    count = sscanf(from, "%4" SCNu16 "-%3" SCNu16 "T%2" SCNu8 ":%2" SCNu8 ":%fZ", &year, &day,
+                   &hour, &minute, &second);
+    uint8_t dayOfMonth = 0;
+    if (count != 5 or not convertDaysOfYear(day, year, &month, &dayOfMonth)) {
+      return false;
+    }
+    day = dayOfMonth;
+  }
+  to->year = year;
+  to->month = month;
+  to->day = day;
+  to->hour = hour;
+  to->minute = minute;
+  to->second = second;
+  to->usecond = (second - floor(second)) * 1000000;
+  return true;
+}
+
+}  // namespace
+
 TEST_CASE("CCSDSTime Tests", "[TestCCSDSTime]") {
   INFO("CCSDSTime Tests");
   CCSDSTime::Ccs_mseconds cssMilliSecconds{};
@@ -216,4 +273,122 @@ TEST_CASE("CCSDSTime Tests", "[TestCCSDSTime]") {
     result = CCSDSTime::convertToCcsds(&to2, &time);
     REQUIRE(result == CCSDSTime::INVALID_TIME_FORMAT);
   }
-}
\ No newline at end of file
+
+  SECTION("ASCII parser matches sscanf") {
+    std::vector<std::string> times = {
+        "2022-12-31T23:59:59.123Z", "2022-365T23:59:59.123Z", "2020-02-29T13:24:45.123456Z",
+        "2020-060T13:24:45.123456Z", "1999-01-01T00:00:00Z", "2000-366T12:00:00.5Z",
+        "2021-366T12:00:00.5Z", "2022-06-15T08:30:07.999999999Z", "2022-06-15T08:30:07.Z",
+        "2022-06-15T08:30:07.0000001Z", "2022-06-15T08:30:07.12345678901234567Z",
+        " 2022-06-15T08:30:07.25Z", "2022-6-15T08:30:07.25Z", "2022-06-15T08:30:7.25Z",
+        "2022-06-15T08:30:07.25e1Z", "2022-06-15T08:30:07.25", "+2022-06-15T08:30:07.25Z",
+        "2022-06-15 08:30:07.25Z", "2022-13-45T99:99:99.25Z"};
+    // Seconds with all numbers of fraction digits, including values which are close to the
+    // middle between two floats
+    for (int digits = 1; digits <= 9; digits++) {
+      for (uint32_t fraction : {1u, 5u, 12345u, 99999u, 123456789u, 999999999u}) {
+        char buf[40];
+        snprintf(buf, sizeof(buf), "2022-06-15T08:30:%02u.%0*u", fraction % 60, digits,
+                 fraction % static_cast<uint32_t>(std::pow(10, digits)));
+        times.emplace_back(buf);
+      }
+    }
+    for (const auto& timeAscii : times) {
+      INFO(timeAscii);
+      Clock::TimeOfDay_t expected{};
+      bool expectedOk = scanAsciiReference(&expected, timeAscii.c_str());
+      Clock::TimeOfDay_t timeTo{};
+      auto result = CCSDSTime::convertFromASCII(
+          &timeTo, reinterpret_cast<const uint8_t*>(timeAscii.c_str()), timeAscii.length());
+      REQUIRE((result == HasReturnvaluesIF::RETURN_OK) == expectedOk);
+      if (expectedOk) {
+        CHECK(timeTo.year == expected.year);
+        CHECK(timeTo.month == expected.month);
+        CHECK(timeTo.day == expected.day);
+        CHECK(timeTo.hour == expected.hour);
+        CHECK(timeTo.minute == expected.minute);
+        CHECK(timeTo.second == expected.second);
+        CHECK(timeTo.usecond == expected.usecond);
+      }
+    }
+    // Binary time codes are rejected before scanning them
+    std::array<uint8_t, 20> binary = {CCSDSTime::P_FIELD_CDS_SHORT, 0x5A, 0x3C};
+    Clock::TimeOfDay_t timeTo{};
+    auto result = CCSDSTime::convertFromASCII(&timeTo, binary.data(), binary.size());
+    CHECK(result == static_cast<ReturnValue_t>(CCSDSTime::UNSUPPORTED_TIME_FORMAT));
+  }
+
+  SECTION("CDS submilliseconds") {
+    // 2022-01-01T00:00:00.001 + 777 us, 16 bit submillisecond field
+    std::array<uint8_t, 9> cdsUs = {CCSDSTime::P_FIELD_CDS_SHORT | 0b01, 0x5B, 0x50, 0, 0, 0, 1,
+                                    0x03, 0x09};
+    timeval to;
+    size_t foundLength = 0;
+    auto result = CCSDSTime::convertFromCDS(&to, cdsUs.data(), &foundLength, cdsUs.size());
+    REQUIRE(result == HasReturnvaluesIF::RETURN_OK);
+    CHECK(foundLength == 9);
+    CHECK(to.tv_sec == 1640995200);
+    CHECK(to.tv_usec == 1777);
+    cdsUs[7] = 0x04;
+    result = CCSDSTime::convertFromCDS(&to, cdsUs.data(), &foundLength, cdsUs.size());
+    CHECK(result == static_cast<ReturnValue_t>(CCSDSTime::INVALID_TIME_FORMAT));
+    result = CCSDSTime::convertFromCDS(&to, cdsUs.data(), &foundLength, cdsUs.size() - 1);
+    CHECK(result == static_cast<ReturnValue_t>(CCSDSTime::LENGTH_MISMATCH));
+
+    // 24 bit day field and 32 bit picoseconds
+    std::array<uint8_t, 12> cdsExtended = {
+        CCSDSTime::P_FIELD_CDS_SHORT | 0b110, 0, 0x5B, 0x50, 0, 0, 0x03, 0xE8, 0, 0x0F, 0x42, 0x3F};
+    result =
+        CCSDSTime::convertFromCDS(&to, cdsExtended.data(), &foundLength, cdsExtended.size());
+    REQUIRE(result == HasReturnvaluesIF::RETURN_OK);
+    CHECK(foundLength == 12);
+    CHECK(to.tv_sec == 1640995201);
+    CHECK(to.tv_usec == 999);
+  }
+
+  SECTION("Batch conversion") {
+    CCSDSTime::CDS_short cds{};
+    timeval cdsTime = {1640995200, 250000};
+    REQUIRE(CCSDSTime::convertToCcsds(&cds, &cdsTime) == HasReturnvaluesIF::RETURN_OK);
+    std::string ascii = "2022-01-01T00:00:01.500Z";
+    CCSDSTime::Ccs_mseconds ccs{};
+    Clock::TimeOfDay_t tod = {2022, 1, 1, 0, 0, 2, 750000};
+    REQUIRE(CCSDSTime::convertToCcsds(&ccs, &tod) == HasReturnvaluesIF::RETURN_OK);
+    std::array<uint8_t, 32> cdsBuffer{};
+    std::memcpy(cdsBuffer.data(), &cds, sizeof(cds));
+    std::array<uint8_t, 32> asciiBuffer{};
+    std::memcpy(asciiBuffer.data(), ascii.data(), ascii.size());
+    std::array<uint8_t, 32> ccsBuffer{};
+    std::memcpy(ccsBuffer.data(), &ccs, sizeof(ccs));
+    std::array<uint8_t, 32> invalidBuffer{};
+    std::array<const uint8_t*, 4> codes = {cdsBuffer.data(), asciiBuffer.data(), ccsBuffer.data(),
+                                           invalidBuffer.data()};
+
+    std::array<timeval, 4> times{};
+    size_t converted = 0;
+    auto result = CCSDSTime::convertFromCcsds(times.data(), codes.data(), 3, 32, &converted);
+    REQUIRE(result == HasReturnvaluesIF::RETURN_OK);
+    CHECK(converted == 3);
+    CHECK(times[0].tv_sec == 1640995200);
+    CHECK(times[0].tv_usec == 250000);
+    CHECK(times[1].tv_sec == 1640995201);
+    CHECK(times[1].tv_usec == 500000);
+    CHECK(times[2].tv_sec == 1640995202);
+    CHECK(times[2].tv_usec == 750000);
+
+    std::array<uint64_t, 4> usecs{};
+    result = CCSDSTime::convertFromCcsds(usecs.data(), codes.data(), codes.size(), 32, &converted);
+    CHECK(result == static_cast<ReturnValue_t>(CCSDSTime::UNSUPPORTED_TIME_FORMAT));
+    CHECK(converted == 3);
+    CHECK(usecs[0] == 1640995200250000);
+    CHECK(usecs[1] == 1640995201500000);
+    CHECK(usecs[2] == 1640995202750000);
+
+    std::string beforeEpoch = "1969-12-31T23:59:59Z";
+    const uint8_t* beforeEpochCode = reinterpret_cast<const uint8_t*>(beforeEpoch.c_str());
+    result = CCSDSTime::convertFromCcsds(usecs.data(), &beforeEpochCode, 1, beforeEpoch.size(),
+                                         &converted);
+    CHECK(result == static_cast<ReturnValue_t>(CCSDSTime::TIME_DOES_NOT_FIT_FORMAT));
+    CHECK(converted == 0);
+  }
+}
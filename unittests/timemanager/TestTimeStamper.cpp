@@ -0,0 +1,130 @@
+#include <fsfw/timemanager/CCSDSTime.h>
+#include <fsfw/timemanager/TimeStamper.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+#include "CatchDefinitions.h"
+
+namespace {
+
+constexpr object_id_t TIME_STAMPER_ID = 0x7e000010;
+
+class FixedTimeStamper : public TimeStamper {
+ public:
+  FixedTimeStamper() : TimeStamper(TIME_STAMPER_ID) {}
+  timeval now = {0, 0};
+  size_t clockReads = 0;
+
+ protected:
+  ReturnValue_t readClock(timeval* time) override {
+    clockReads++;
+    *time = now;
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+};
+
+/**
+ * Compares the stamp with the one of the generic CCSDSTime conversion
+ */
+void checkStamp(const uint8_t* stamp, const timeval& time) {
+  CCSDSTime::CDS_short expected{};
+  REQUIRE(CCSDSTime::convertToCcsds(&expected, &time) == retval::CATCH_OK);
+  CHECK(std::memcmp(stamp, &expected, sizeof(expected)) == 0);
+}
+
+}  // namespace
+
+TEST_CASE("Time Stamper", "[TimeStamper]") {
+  FixedTimeStamper stamper;
+  std::array<uint8_t, TimeStamperIF::MISSION_TIMESTAMP_SIZE> stamp{};
+
+  SECTION("Matches CCSDSTime") {
+    // 2020-02-29 13:24:45.123456
+    stamper.now = {1582982685, 123456};
+    REQUIRE(stamper.addTimeStamp(stamp.data(), stamp.size()) == retval::CATCH_OK);
+    checkStamp(stamp.data(), stamper.now);
+    timeval decoded;
+    auto cds = reinterpret_cast<CCSDSTime::CDS_short*>(stamp.data());
+    REQUIRE(CCSDSTime::convertFromCDS(&decoded, cds) == retval::CATCH_OK);
+    CHECK(decoded.tv_sec == 1582982685);
+    CHECK(decoded.tv_usec == 123000);
+
+    stamper.now = {0, 999};
+    REQUIRE(stamper.addTimeStamp(stamp.data(), stamp.size()) == retval::CATCH_OK);
+    checkStamp(stamp.data(), stamper.now);
+  }
+
+  SECTION("Cached day changes") {
+    // Last millisecond of a day, first millisecond of the next day and back in time
+    const timeval times[] = {{1582934399, 999999}, {1582934400, 0},      {1582934400, 1000},
+                             {1583020799, 999000}, {1583020800, 500},    {1582934399, 0},
+                             {1582848000, 0},      {4102444800, 123456}, {1582934400, 42}};
+    for (const auto& time : times) {
+      stamper.now = time;
+      REQUIRE(stamper.addTimeStamp(stamp.data(), stamp.size()) == retval::CATCH_OK);
+      checkStamp(stamp.data(), time);
+    }
+  }
+
+  SECTION("Invalid") {
+    stamper.now = {1582982685, 0};
+    CHECK(stamper.addTimeStamp(stamp.data(), stamp.size() - 1) == retval::CATCH_FAILED);
+    // Day 65536 after the CCSDS epoch
+    stamper.now = {static_cast<time_t>(65536 - CCSDSTime::DAYS_CCSDS_TO_UNIX_EPOCH) *
+                       CCSDSTime::SECONDS_PER_DAY,
+                   0};
+    CHECK(stamper.addTimeStamp(stamp.data(), stamp.size()) ==
+          static_cast<ReturnValue_t>(CCSDSTime::TIME_DOES_NOT_FIT_FORMAT));
+  }
+
+  SECTION("Batch") {
+    std::array<std::array<uint8_t, TimeStamperIF::MISSION_TIMESTAMP_SIZE>, 5> stamps{};
+    std::array<uint8_t*, 5> buffers{};
+    for (size_t idx = 0; idx < stamps.size(); idx++) {
+      buffers[idx] = stamps[idx].data();
+    }
+    stamper.now = {1582982685, 123456};
+    auto result = stamper.addTimeStamps(buffers.data(), buffers.size(), stamp.size());
+    REQUIRE(result == retval::CATCH_OK);
+    CHECK(stamper.clockReads == 1);
+    for (const auto& batchStamp : stamps) {
+      checkStamp(batchStamp.data(), stamper.now);
+    }
+    CHECK(stamper.addTimeStamps(buffers.data(), 0, stamp.size()) == retval::CATCH_OK);
+    CHECK(stamper.addTimeStamps(buffers.data(), buffers.size(), 2) == retval::CATCH_FAILED);
+    CHECK(stamper.clockReads == 1);
+  }
+
+  SECTION("System clock") {
+    TimeStamper coarseStamper(TIME_STAMPER_ID + 1, TimeStamper::ClockSource::COARSE);
+    TimeStamper preciseStamper(TIME_STAMPER_ID + 2);
+    std::array<uint8_t, TimeStamperIF::MISSION_TIMESTAMP_SIZE> coarseStamp{};
+    timeval before;
+    Clock::getClock_timeval(&before);
+    REQUIRE(preciseStamper.addTimeStamp(stamp.data(), stamp.size()) == retval::CATCH_OK);
+    auto result = coarseStamper.addTimeStamp(coarseStamp.data(), coarseStamp.size());
+    REQUIRE(result == retval::CATCH_OK);
+    timeval precise;
+    timeval coarse;
+    auto preciseCds = reinterpret_cast<CCSDSTime::CDS_short*>(stamp.data());
+    auto coarseCds = reinterpret_cast<CCSDSTime::CDS_short*>(coarseStamp.data());
+    REQUIRE(CCSDSTime::convertFromCDS(&precise, preciseCds) == retval::CATCH_OK);
+    REQUIRE(CCSDSTime::convertFromCDS(&coarse, coarseCds) == retval::CATCH_OK);
+    // The coarse clock lags by up to one scheduler tick
+    CHECK(precise.tv_sec - before.tv_sec <= 1);
+    CHECK(before.tv_sec - coarse.tv_sec <= 1);
+  }
+}
+
+TEST_CASE("Leap seconds", "[TimeStamper]") {
+  REQUIRE(Clock::setLeapSeconds(27) == retval::CATCH_OK);
+  uint16_t leapSeconds = 0;
+  REQUIRE(Clock::getLeapSeconds(&leapSeconds) == retval::CATCH_OK);
+  CHECK(leapSeconds == 27);
+  timeval tt;
+  REQUIRE(Clock::convertUTCToTT({100, 0}, &tt) == retval::CATCH_OK);
+  CHECK(tt.tv_sec == 169);
+  CHECK(tt.tv_usec == 184000);
+}
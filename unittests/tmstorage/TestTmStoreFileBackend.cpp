@@ -0,0 +1,373 @@
+#include <fsfw/ipc/MessageQueueIF.h>
+#include <fsfw/objectmanager/SystemObject.h>
+#include <fsfw/tmstorage/TmStoreFileBackend.h>
+#include <fsfw/tmtcpacket/pus/PacketTimestampInterpreterIF.h>
+#include <fsfw/tmtcpacket/pus/tm/TmPacketMinimal.h>
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fsfw/platform.h"
+#include "objects/systemObjectList.h"
+
+#ifdef PLATFORM_UNIX
+
+#include <unistd.h>
+
+namespace {
+
+constexpr uint16_t APID = 0x42;
+//! Primary header, minimal data field header, 4 byte time, 4 byte payload and CRC
+constexpr size_t PACKET_SIZE = 6 + 4 + 4 + 4 + 2;
+constexpr size_t TIME_OFFSET = 10;
+constexpr size_t PAYLOAD_OFFSET = 14;
+
+/**
+ * The time of the test packets is a big endian seconds field after the minimal data field header.
+ */
+class SecondsInterpreter : public PacketTimestampInterpreterIF {
+ public:
+  ReturnValue_t getPacketTime(TmPacketMinimal* packet, timeval* timestamp) const override {
+    const uint8_t* time = packet->getWholeData() + TIME_OFFSET;
+    timestamp->tv_sec = (time[0] << 24) | (time[1] << 16) | (time[2] << 8) | time[3];
+    timestamp->tv_usec = 0;
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  ReturnValue_t getPacketTimeRaw(TmPacketMinimal* packet, const uint8_t** timePtr,
+                                 uint32_t* size) const override {
+    return HasReturnvaluesIF::RETURN_FAILED;
+  }
+};
+
+class TmStoreFrontendMock : public SystemObject, public TmStoreFrontendIF {
+ public:
+  TmStoreFrontendMock() : SystemObject(objects::TM_STORE_FRONTEND_MOCK) {}
+
+  struct Retrieved {
+    uint32_t address;
+    uint32_t seconds;
+    uint32_t payload;
+  };
+  std::vector<Retrieved> retrieved;
+  uint32_t noMorePacketsCalls = 0;
+  //! Fetch is stopped after this number of packets
+  size_t stopAfter = 0;
+
+  TmStoreBackendIF* getBackend() const override { return nullptr; }
+  ReturnValue_t performOperation(uint8_t opCode) override { return HasReturnvaluesIF::RETURN_OK; }
+  ReturnValue_t packetRetrieved(TmPacketMinimal* packet, uint32_t address) override {
+    const uint8_t* data = packet->getWholeData();
+    retrieved.push_back({address, readField(data + TIME_OFFSET), readField(data + PAYLOAD_OFFSET)});
+    if (stopAfter != 0 and retrieved.size() >= stopAfter) {
+      return STOP_FETCH;
+    }
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  void noMorePacketsInStore() override { noMorePacketsCalls++; }
+  void handleRetrievalFailed(ReturnValue_t errorCode, uint32_t parameter1,
+                             uint32_t parameter2) override {}
+  MessageQueueId_t getCommandQueue() const override { return MessageQueueIF::NO_QUEUE; }
+  ReturnValue_t fetchPackets(ApidSsc start, ApidSsc end) override {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  ReturnValue_t deletePackets(ApidSsc upTo) override { return HasReturnvaluesIF::RETURN_OK; }
+  ReturnValue_t checkPacket(SpacePacketBase* tmPacket) override {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+  bool isEnabled() const override { return true; }
+  void setEnabled(bool enabled) override {}
+  void resetDownlinkedPacketCount() override {}
+  ReturnValue_t setDumpTarget(object_id_t dumpTarget) override {
+    return HasReturnvaluesIF::RETURN_OK;
+  }
+
+  static uint32_t readField(const uint8_t* field) {
+    return (field[0] << 24) | (field[1] << 16) | (field[2] << 8) | field[3];
+  }
+};
+
+void writeField(uint8_t* field, uint32_t value) {
+  field[0] = value >> 24;
+  field[1] = value >> 16;
+  field[2] = value >> 8;
+  field[3] = value;
+}
+
+ReturnValue_t storePacket(TmStoreFileBackend& backend, uint16_t sequenceCount, uint32_t seconds) {
+  std::array<uint8_t, PACKET_SIZE> data = {};
+  data[0] = 0x08 | (APID >> 8);
+  data[1] = APID & 0xff;
+  data[2] = 0xc0 | ((sequenceCount >> 8) & 0x3f);
+  data[3] = sequenceCount & 0xff;
+  data[4] = (PACKET_SIZE - 7) >> 8;
+  data[5] = (PACKET_SIZE - 7) & 0xff;
+  data[6] = 0x10;
+  data[7] = 3;
+  data[8] = 25;
+  writeField(data.data() + TIME_OFFSET, seconds);
+  writeField(data.data() + PAYLOAD_OFFSET, sequenceCount);
+  TmPacketMinimal packet(data.data());
+  return backend.storePacket(&packet);
+}
+
+long fileSize(const std::string& path) {
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return -1;
+  }
+  std::fseek(file, 0, SEEK_END);
+  long size = std::ftell(file);
+  std::fclose(file);
+  return size;
+}
+
+}  // namespace
+
+TEST_CASE("TM Store File Backend", "[TmStoreFileBackend]") {
+  static SecondsInterpreter interpreter;
+  TmPacketMinimal::setInterpretTimestampObject(&interpreter);
+
+  char directoryTemplate[] = "/tmp/fsfw-unittest-tmstore-XXXXXX";
+  REQUIRE(mkdtemp(directoryTemplate) != nullptr);
+  const std::string directory = directoryTemplate;
+  auto path = [&](uint32_t segment, const char* suffix) {
+    return directory + "/test_" + std::to_string(segment) + suffix;
+  };
+
+  TmStoreFrontendMock frontend;
+  // Five packets per segment, at most three segments
+  auto backend = std::make_unique<TmStoreFileBackend>(
+      objects::TM_STORE_FILE_BACKEND, objects::TM_STORE_FRONTEND_MOCK, directory, "test",
+      5 * PACKET_SIZE, 3);
+  REQUIRE(backend->initialize() == HasReturnvaluesIF::RETURN_OK);
+  REQUIRE(backend->isReady());
+  REQUIRE(backend->getStoredPacketsCount() == 0);
+
+  SECTION("Append and fetch") {
+    backend->setGroupCommitPackets(4);
+    for (uint16_t count = 0; count < 4; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    // The group commit flushed the packets
+    CHECK(fileSize(path(0, ".tm")) == 4 * PACKET_SIZE);
+    CHECK(fileSize(path(0, ".idx")) == 4 * sizeof(TmStoreFileBackend::IndexEntry));
+    REQUIRE(backend->getStoredPacketsCount() == 4);
+    CHECK(backend->getOldestPacket()->isValid());
+
+    REQUIRE(backend->setFetchLimitBlocks(1, 100) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(backend->availableData() == 3);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 3);
+    for (uint32_t idx = 0; idx < 3; idx++) {
+      CHECK(frontend.retrieved[idx].address == idx + 1);
+      CHECK(frontend.retrieved[idx].payload == idx + 1);
+      CHECK(frontend.retrieved[idx].seconds == 101 + idx);
+    }
+    CHECK(frontend.noMorePacketsCalls == 1);
+    CHECK(backend->fetchPackets() == static_cast<ReturnValue_t>(TmStoreBackendIF::EMPTY));
+
+    // The front-end stops the fetch, the next call continues after the last packet
+    frontend.retrieved.clear();
+    frontend.stopAfter = 2;
+    REQUIRE(backend->fetchPackets(true) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 2);
+    frontend.stopAfter = 0;
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 3);
+    CHECK(frontend.retrieved[2].address == 3);
+
+    // Uncommitted packets can be fetched as well
+    REQUIRE(storePacket(*backend, 4, 104) == HasReturnvaluesIF::RETURN_OK);
+    frontend.retrieved.clear();
+    REQUIRE(backend->setFetchLimitBlocks(4, 4) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 1);
+    CHECK(frontend.retrieved[0].payload == 4);
+    CHECK(backend->setFetchLimitBlocks(5, 10) ==
+          static_cast<ReturnValue_t>(TmStoreBackendIF::BLOCK_NOT_FOUND));
+  }
+
+  SECTION("Segment rollover") {
+    for (uint16_t count = 0; count < 12; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    REQUIRE(backend->getStoredPacketsCount() == 12);
+    REQUIRE(backend->commit() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(fileSize(path(0, ".tm")) == 5 * PACKET_SIZE);
+    CHECK(fileSize(path(2, ".tm")) == 2 * PACKET_SIZE);
+
+    // The fourth segment replaces the oldest one
+    for (uint16_t count = 12; count < 16; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    CHECK(fileSize(path(0, ".tm")) == -1);
+    CHECK(fileSize(path(0, ".idx")) == -1);
+    REQUIRE(backend->getStoredPacketsCount() == 11);
+    // Addresses stay valid after the deletion
+    REQUIRE(backend->setFetchLimitBlocks(0, 100) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 11);
+    for (uint32_t idx = 0; idx < 11; idx++) {
+      CHECK(frontend.retrieved[idx].address == idx + 5);
+      CHECK(frontend.retrieved[idx].payload == idx + 5);
+    }
+  }
+
+  SECTION("Fetch by time") {
+    for (uint16_t count = 0; count < 12; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + 10 * count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    timeval lower = {125, 0};
+    timeval upper = {160, 0};
+    REQUIRE(backend->setFetchLimitTime(&lower, &upper) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 4);
+    CHECK(frontend.retrieved.front().seconds == 130);
+    CHECK(frontend.retrieved.front().address == 3);
+    // The upper limit is inclusive
+    CHECK(frontend.retrieved.back().seconds == 160);
+
+    // Limits across a segment boundary and at the ends of the store
+    frontend.retrieved.clear();
+    lower = {0, 0};
+    upper = {155, 0};
+    REQUIRE(backend->setFetchLimitTime(&lower, &upper) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(backend->availableData() == 6);
+    lower = {140, 0};
+    upper = {1000, 0};
+    REQUIRE(backend->setFetchLimitTime(&lower, &upper) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(backend->availableData() == 8);
+
+    lower = {131, 0};
+    upper = {139, 0};
+    CHECK(backend->setFetchLimitTime(&lower, &upper) ==
+          static_cast<ReturnValue_t>(TmStoreBackendIF::EMPTY));
+    CHECK(backend->setFetchLimitTime(&upper, &lower) ==
+          static_cast<ReturnValue_t>(TmStoreBackendIF::INVALID_REQUEST));
+  }
+
+  SECTION("Delete up to") {
+    for (uint16_t count = 0; count < 12; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    // Only complete segments are deleted
+    REQUIRE(backend->deleteBlocks(0, 7) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(backend->getStoredPacketsCount() == 7);
+    CHECK(fileSize(path(0, ".tm")) == -1);
+    CHECK(backend->deleteBlocks(6, 20) ==
+          static_cast<ReturnValue_t>(TmStoreBackendIF::INVALID_REQUEST));
+
+    uint32_t deleted = 0;
+    timeval until = {109, 0};
+    REQUIRE(backend->deleteTime(&until, &deleted) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(deleted == 5);
+    REQUIRE(backend->getStoredPacketsCount() == 2);
+
+    REQUIRE(backend->setFetchLimitBlocks(0, 100) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 2);
+    CHECK(frontend.retrieved[0].address == 10);
+
+    // Deleting everything keeps the store usable
+    until = {1000, 0};
+    REQUIRE(backend->deleteTime(&until, &deleted) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(deleted == 2);
+    CHECK(backend->getStoredPacketsCount() == 0);
+    REQUIRE(storePacket(*backend, 12, 112) == HasReturnvaluesIF::RETURN_OK);
+    CHECK(backend->getStoredPacketsCount() == 1);
+  }
+
+  SECTION("Recovery after a restart") {
+    for (uint16_t count = 0; count < 8; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    backend.reset();
+    // Simulate a torn write: the last index record of the active segment is incomplete and the
+    // data file contains a packet without index record.
+    const long indexSize = fileSize(path(1, ".idx"));
+    REQUIRE(indexSize == 3 * sizeof(TmStoreFileBackend::IndexEntry));
+    REQUIRE(truncate(path(1, ".idx").c_str(), indexSize - 5) == 0);
+    std::FILE* data = std::fopen(path(1, ".tm").c_str(), "ab");
+    REQUIRE(data != nullptr);
+    const uint8_t garbage[7] = {};
+    std::fwrite(garbage, 1, sizeof(garbage), data);
+    std::fclose(data);
+
+    backend = std::make_unique<TmStoreFileBackend>(
+        objects::TM_STORE_FILE_BACKEND, objects::TM_STORE_FRONTEND_MOCK, directory, "test",
+        5 * PACKET_SIZE, 3);
+    REQUIRE(backend->initialize() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->getStoredPacketsCount() == 7);
+    CHECK(fileSize(path(1, ".tm")) == 2 * PACKET_SIZE);
+    CHECK(fileSize(path(1, ".idx")) == 2 * sizeof(TmStoreFileBackend::IndexEntry));
+
+    // New packets line up with the index again
+    REQUIRE(storePacket(*backend, 100, 200) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->setFetchLimitBlocks(0, 100) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 8);
+    for (uint32_t idx = 0; idx < 7; idx++) {
+      CHECK(frontend.retrieved[idx].address == idx);
+      CHECK(frontend.retrieved[idx].payload == idx);
+    }
+    CHECK(frontend.retrieved[7].address == 7);
+    CHECK(frontend.retrieved[7].payload == 100);
+    CHECK(frontend.retrieved[7].seconds == 200);
+  }
+
+  SECTION("Torn meta file") {
+    for (uint16_t count = 0; count < 3; count++) {
+      REQUIRE(storePacket(*backend, count, 100 + count) == HasReturnvaluesIF::RETURN_OK);
+    }
+    backend.reset();
+    const std::string metaPath = directory + "/test.meta";
+    REQUIRE(fileSize(metaPath) == 3 * sizeof(uint32_t));
+    CHECK(fileSize(metaPath + ".tmp") == -1);
+    REQUIRE(truncate(metaPath.c_str(), 5) == 0);
+    // A segment which is not known to any meta file and a file of another store
+    std::FILE* stray = std::fopen(path(7, ".tm").c_str(), "wb");
+    REQUIRE(stray != nullptr);
+    std::fclose(stray);
+    const std::string otherPath = directory + "/test_other.tm";
+    std::FILE* other = std::fopen(otherPath.c_str(), "wb");
+    REQUIRE(other != nullptr);
+    std::fclose(other);
+
+    backend = std::make_unique<TmStoreFileBackend>(
+        objects::TM_STORE_FILE_BACKEND, objects::TM_STORE_FRONTEND_MOCK, directory, "test",
+        5 * PACKET_SIZE, 3);
+    REQUIRE(backend->initialize() == HasReturnvaluesIF::RETURN_OK);
+    CHECK(backend->getStoredPacketsCount() == 0);
+    // The store starts over in empty files
+    CHECK(fileSize(path(0, ".tm")) == 0);
+    CHECK(fileSize(path(0, ".idx")) == 0);
+    CHECK(fileSize(path(7, ".tm")) == -1);
+    CHECK(fileSize(otherPath) == 0);
+    CHECK(fileSize(metaPath) == 3 * sizeof(uint32_t));
+    std::remove(otherPath.c_str());
+
+    REQUIRE(storePacket(*backend, 50, 150) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->setFetchLimitBlocks(0, 100) == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(backend->fetchPackets() == HasReturnvaluesIF::RETURN_OK);
+    REQUIRE(frontend.retrieved.size() == 1);
+    CHECK(frontend.retrieved[0].address == 0);
+    CHECK(frontend.retrieved[0].payload == 50);
+    CHECK(frontend.retrieved[0].seconds == 150);
+  }
+
+  backend->resetStore(true, true, true);
+  backend.reset();
+  std::remove((directory + "/test.meta").c_str());
+  for (uint32_t segment = 0; segment < 8; segment++) {
+    std::remove(path(segment, ".tm").c_str());
+    std::remove(path(segment, ".idx").c_str());
+  }
+  rmdir(directory.c_str());
+}
+
+#endif